@@ -22,6 +22,7 @@
 
 import urllib.request
 import re
+import sys
 from bs4 import BeautifulSoup
 
 header_license = """\
@@ -59,6 +60,12 @@ header_start_h = """\
 #include <vector>
 #include <unordered_map>
 #include <cassert>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <algorithm>
 
 namespace vgs
 {
@@ -77,6 +84,12 @@ header_start_hpp = """\
 #include <vector>
 #include <unordered_map>
 #include <cassert>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <algorithm>
 
 namespace vgs
 {
@@ -100,6 +113,243 @@ inline void InitSType(void* ptr, ptrdiff_t offset, VulkanStructureType value)
 }
 """
 
+header_member_range = """\
+
+//Byte range of a single structure member
+struct StructureMemberRange
+{
+	uint32_t Offset;
+	uint32_t Size;
+};
+"""
+
+header_pointer_layout = """\
+
+//How to deep-copy the data a pointer member points to
+enum class PointerMemberKind: uint32_t
+{
+	Array,		//(Count + CountAdd) / CountDivisor elements of ElementSize bytes, or a single element if CountSize is 0
+	String,		//Null-terminated string
+	StringArray //Count null-terminated strings
+};
+
+struct StructurePointerLayout;
+
+//Pointer member of a structure, along with the member that holds the number of elements
+struct PointerMemberLayout
+{
+	uint32_t					  Offset;
+	uint32_t					  ElementSize;
+	uint32_t					  CountOffset;
+	uint32_t					  CountSize;
+	uint32_t					  CountAdd;
+	uint32_t					  CountDivisor;
+	PointerMemberKind			  Kind;
+	const StructurePointerLayout* ElementLayout;		  //Null if the elements contain no pointers to follow
+	const StructureMemberRange*	  ElementMemberRanges;	  //Members of the elements without sType, null if the elements are not structures or have sType
+	uint32_t					  ElementMemberRangeCount;
+};
+
+//All pointer members of a structure except pNext: the ones that can be deep-copied and the opaque ones (e.g. pUserData or function pointers)
+struct StructurePointerLayout
+{
+	const PointerMemberLayout* Members;
+	uint32_t				   MemberCount;
+	const uint32_t*			   OpaquePointerOffsets; //Not followed, copied as is. Zeroed when loading serialized data
+	uint32_t				   OpaquePointerCount;
+	bool					   HasPNext;
+};
+"""
+
+header_feature_structures = """\
+
+constexpr uint32_t FeatureStructureMaxExtensions = 4;
+
+//Structure that extends VkPhysicalDeviceFeatures2, along with what provides it
+struct FeatureStructureInfo
+{
+	VulkanStructureType SType;
+	uint32_t			Size;
+	uint32_t			CoreVersion;									//0 if the structure is not a part of any core version
+	const char*			ExtensionNames[FeatureStructureMaxExtensions];	//Extensions that provide the structure, the unused ones are null
+	const uint32_t*		FeatureMemberOffsets;							//Offsets of the VkBool32 members, including the ones of the nested structures
+	uint32_t			FeatureMemberCount;
+	VulkanStructureType CoreFeaturesSType;								//VkPhysicalDeviceVulkanNNFeatures of the version the structure is promoted to if it has all of its features, SType otherwise
+	const uint32_t*		CoreFeatureMemberIndices;						//Index of each feature member in FeatureMemberOffsets of CoreFeaturesSType, null if there's no such structure
+};
+"""
+
+header_feature_member_names = """\
+
+//Feature member of the structure from FeatureStructureInfos, by its name in a profile, e.g. "VkPhysicalDeviceFeatures.geometryShader"
+struct FeatureMemberNameEntry
+{
+	const char*			Name;		 //Null for an empty slot
+	VulkanStructureType SType;
+	uint32_t			MemberIndex; //Index in FeatureMemberOffsets of the structure
+};
+"""
+
+header_reflection_start_h = """\
+#ifndef VULKAN_GENERIC_STRUCTURES_REFLECTION_H
+#define VULKAN_GENERIC_STRUCTURES_REFLECTION_H
+
+//Member tables of all structures from vk.xml. Opt-in, since they are much larger than the rest of the library
+#include "VulkanGenericStructures.h"
+
+namespace vgs
+{
+"""
+
+header_reflection_start_hpp = """\
+#ifndef VULKAN_GENERIC_STRUCTURES_REFLECTION_HPP
+#define VULKAN_GENERIC_STRUCTURES_REFLECTION_HPP
+
+//Member tables of all structures from vk.xml. Opt-in, since they are much larger than the rest of the library
+#include "VulkanGenericStructures.hpp"
+
+namespace vgs
+{
+"""
+
+header_reflection_types = """\
+
+//What a member holds, for array and pointer members what each element holds
+enum class MemberScalarKind: uint32_t
+{
+	Void,
+	Bool32,
+	Char,
+	Int8,
+	Uint8,
+	Int16,
+	Uint16,
+	Int32,
+	Uint32,
+	Int64,
+	Uint64,
+	Size,
+	Float,
+	Double,
+	Enum,
+	Flags,
+	Flags64,
+	Handle,
+	FunctionPointer,
+	Struct,			//See ElementReflection
+	Union,
+	Other			//Platform types, e.g. HWND or ANativeWindow
+};
+
+constexpr uint32_t NoMemberIndex = 0xffffffff;
+
+struct StructureReflection;
+
+struct StructureMemberInfo
+{
+	const char*				   Name;
+	uint32_t				   Offset;
+	uint32_t				   Size;
+	MemberScalarKind		   ScalarKind;
+	uint32_t				   PointerDepth;
+	uint32_t				   ArrayLength;		  //Number of elements of a fixed-size array member, 0 for the other members
+	const char*				   Len;				  //len (or altlen) attribute of vk.xml, e.g. "enabledExtensionCount,null-terminated", null if none
+	uint32_t				   LenMemberIndex;	  //Index of the member that holds the number of elements, NoMemberIndex if none
+	const StructureReflection* ElementReflection; //Members of the structure the member holds or points to, null if none or unknown
+};
+
+struct StructureReflection
+{
+	const char*				   Name;			  //Null for the structures with unknown layout
+	VulkanStructureType		   SType;
+	uint32_t				   Size;
+	const StructureMemberInfo* Members;
+	uint32_t				   MemberCount;
+};
+"""
+
+header_reflection_end = """\
+
+//Index of the member with the given name, or NoMemberIndex. Can be used in constant expressions
+constexpr uint32_t FindStructureMemberIndex(const StructureReflection& reflection, const char* memberName)
+{
+	for(uint32_t memberIndex = 0; memberIndex < reflection.MemberCount; memberIndex++)
+	{
+		const char* reflectedName = reflection.Members[memberIndex].Name;
+
+		uint32_t charIndex = 0;
+		while(reflectedName[charIndex] != '\\0' && reflectedName[charIndex] == memberName[charIndex])
+		{
+			charIndex++;
+		}
+
+		if(reflectedName[charIndex] == memberName[charIndex])
+		{
+			return memberIndex;
+		}
+	}
+
+	return NoMemberIndex;
+}
+
+//Member with the given name, or nullptr
+inline const StructureMemberInfo* FindStructureMember(const StructureReflection& reflection, const char* memberName)
+{
+	uint32_t memberIndex = FindStructureMemberIndex(reflection, memberName);
+	if(memberIndex == NoMemberIndex)
+	{
+		return nullptr;
+	}
+
+	return &reflection.Members[memberIndex];
+}
+}
+
+#endif
+"""
+
+header_structure_visit = """\
+
+constexpr uint32_t StructureOrdinalCount = (uint32_t)StructureOrdinal::Count;
+constexpr uint32_t NoStructureOrdinal	= 0xffffffff;
+
+//Open addressing table from sType to StructureOrdinal, with at least twice as many slots as there are structures
+constexpr uint32_t GetSTypeOrdinalSlotBits()
+{
+	uint32_t slotBits = 1;
+	while((1u << slotBits) < 2 * StructureOrdinalCount)
+	{
+		slotBits++;
+	}
+
+	return slotBits;
+}
+
+constexpr uint32_t STypeOrdinalSlotBits  = GetSTypeOrdinalSlotBits();
+constexpr uint32_t STypeOrdinalSlotCount = 1u << STypeOrdinalSlotBits;
+
+struct STypeOrdinalHashTable
+{
+	uint32_t SlotSTypes[STypeOrdinalSlotCount];
+	uint32_t SlotOrdinals[STypeOrdinalSlotCount]; //NoStructureOrdinal for an empty slot
+};
+
+//Fibonacci hashing, sType values are either small or 1000000000 + 1000 * extension number + offset
+constexpr uint32_t GetSTypeOrdinalSlot(uint32_t sTypeValue)
+{
+	return (uint32_t)(((uint64_t)sTypeValue * 0x9e3779b97f4a7c15ull) >> (64 - STypeOrdinalSlotBits));
+}
+
+template<typename VkStruct, typename Visitor>
+inline void VisitStructureAs(void* structure, Visitor& visitor)
+{
+	visitor(*reinterpret_cast<VkStruct*>(structure));
+}
+
+template<typename Visitor>
+using StructureVisitFunction = void(*)(void*, Visitor&);
+"""
+
 header_end = """\
 
 //==========================================================================================================================
@@ -125,6 +375,11 @@ public:
 	ptrdiff_t		   GetSTypeOffset() const;
 	VulkanStructureType GetSType()	   const;
 
+	//Both ignore the value of pNext and the padding
+	uint64_t Hash() const;
+	bool	 operator==(const GenericStructBase& rhs) const;
+	bool	 operator!=(const GenericStructBase& rhs) const;
+
 protected:
 	std::byte* StructureData;
 	size_t	 StructureSize;
@@ -199,6 +454,47 @@ inline VulkanStructureType GenericStructBase::GetSType() const
 
 //==========================================================================================================================
 
+//Calls visitor(typedStructure) with the structure cast to the type its sType tells, e.g. Visit(pNextLink, [](auto& typedLink){...})
+//The dispatch is a lookup of the dense structure ordinal and a single indirect call through StructureVisitFunctions
+//Return false if the sType is unknown or the structure is not available in this configuration
+template<typename Visitor>
+bool Visit(void* structure, Visitor&& visitor);
+
+template<typename Visitor>
+bool Visit(const GenericStructBase& structure, Visitor&& visitor);
+
+template<typename Visitor>
+inline bool VisitWithSType(VulkanStructureType sType, void* structure, Visitor& visitor)
+{
+	uint32_t ordinal = GetStructureOrdinal(sType);
+	if(ordinal == NoStructureOrdinal)
+	{
+		return false;
+	}
+
+	StructureVisitFunctions<Visitor>[ordinal](structure, visitor);
+	return true;
+}
+
+template<typename Visitor>
+inline bool Visit(void* structure, Visitor&& visitor)
+{
+	assert(structure != nullptr);
+
+	VulkanStructureType sType;
+	memcpy(&sType, structure, sizeof(VulkanStructureType));
+
+	return VisitWithSType<std::remove_reference_t<Visitor>>(sType, structure, visitor);
+}
+
+template<typename Visitor>
+inline bool Visit(const GenericStructBase& structure, Visitor&& visitor)
+{
+	return VisitWithSType<std::remove_reference_t<Visitor>>(structure.GetSType(), structure.GetStructureData(), visitor);
+}
+
+//==========================================================================================================================
+
 //Non-owning version of a generic structure
 class GenericStruct: public GenericStructBase
 {
@@ -254,6 +550,12 @@ public:
 	template<typename Struct>
 	StructureBlob(const Struct& structure);
 
+	//Serializes the structure alone, see SerializeStructures()
+	std::vector<std::byte> Serialize() const;
+
+	//Loads the head structure serialized with SerializeStructures(). Returns false if the data is not valid or is a deep serialization
+	static bool Deserialize(const void* serializedData, size_t serializedSize, StructureBlob& outBlob);
+
 private:
 	std::vector<std::byte> StructureBlobData;
 };
@@ -304,6 +606,12 @@ inline StructureBlob& StructureBlob::operator=(const StructureBlob& right)
 	STypeOffset		= right.STypeOffset;
 	PNextPointerOffset = right.PNextPointerOffset;
 
+	//Default-constructed blob has no pNext to zero out
+	if(StructureBlobData.empty())
+	{
+		return *this;
+	}
+
 	assert(PNextPointerOffset + sizeof(void*) <= StructureBlobData.size());
 
 	//Zero out PNext
@@ -314,461 +622,7130 @@ inline StructureBlob& StructureBlob::operator=(const StructureBlob& right)
 
 //==========================================================================================================================
 
-//Base class for a generic structure chain, hiding chain link type info
-template<typename HeadType>
-class GenericStructureChainBase
+inline uint32_t FindLowestSetBit(uint64_t value)
 {
-protected:
-	GenericStructureChainBase();
-	~GenericStructureChainBase();
-
-public:
-	HeadType& GetChainHead();
-
-	template<typename Struct>
-	Struct& GetChainLinkDataAs();
-
-public:
-	GenericStructureChainBase(const GenericStructureChainBase& rhs) = delete;
-	GenericStructureChainBase& operator=(const GenericStructureChainBase& rhs) = delete;
+	assert(value != 0);
 
-protected:
-	std::vector<std::byte*> StructureDataPointers;
-	std::vector<ptrdiff_t>  PNextPointerOffsets;
-	std::vector<ptrdiff_t>  STypeOffsets;
-
-	std::unordered_map<VulkanStructureType, size_t> StructureDataIndices;
-};
-
-template<typename HeadType>
-inline GenericStructureChainBase<HeadType>::GenericStructureChainBase()
-{
-}
+	uint32_t index = 0;
+	if((value & 0x00000000FFFFFFFFull) == 0) { value >>= 32; index += 32; }
+	if((value & 0x000000000000FFFFull) == 0) { value >>= 16; index += 16; }
+	if((value & 0x00000000000000FFull) == 0) { value >>= 8;  index += 8;  }
+	if((value & 0x000000000000000Full) == 0) { value >>= 4;  index += 4;  }
+	if((value & 0x0000000000000003ull) == 0) { value >>= 2;  index += 2;  }
+	if((value & 0x0000000000000001ull) == 0) { index += 1; }
 
-template<typename HeadType>
-inline GenericStructureChainBase<HeadType>::~GenericStructureChainBase()
-{
+	return index;
 }
 
-template<typename HeadType>
-inline HeadType& GenericStructureChainBase<HeadType>::GetChainHead()
+inline uint32_t FindHighestSetBit(uint64_t value)
 {
-	assert(StructureDataPointers.size() > 0);
-	assert(StructureDataPointers[0] != nullptr);
+	assert(value != 0);
 
-	HeadType* head = reinterpret_cast<HeadType*>(StructureDataPointers[0]);
-	return *head;
-}
+	uint32_t index = 0;
+	if(value & 0xFFFFFFFF00000000ull) { value >>= 32; index += 32; }
+	if(value & 0x00000000FFFF0000ull) { value >>= 16; index += 16; }
+	if(value & 0x000000000000FF00ull) { value >>= 8;  index += 8;  }
+	if(value & 0x00000000000000F0ull) { value >>= 4;  index += 4;  }
+	if(value & 0x000000000000000Cull) { value >>= 2;  index += 2;  }
+	if(value & 0x0000000000000002ull) { index += 1; }
 
-template<typename HeadType>
-template<typename Struct>
-inline Struct& GenericStructureChainBase<HeadType>::GetChainLinkDataAs()
-{
-	Struct* structPtr = reinterpret_cast<Struct*>(StructureDataPointers[StructureDataIndices.at(ValidStructureType<Struct>)]);
-	return *structPtr;
+	return index;
 }
 
 //==========================================================================================================================
 
-//Generic structure chain, non-owning version
-template<typename HeadType>
-class GenericStructureChain: public GenericStructureChainBase<HeadType>
+//Flat sType -> link indices map. Keeps every occurrence of every structure type, so the chains can hold duplicate structures.
+//The map itself is an open-addressing table, and all indices live in a single shared pool where each sType owns a contiguous run.
+//A run that outgrows its capacity is moved to a free run of twice the capacity, so lookups of any occurrence are O(1).
+//Capacities are powers of two, the runs left behind are kept in a free list per capacity and reused, so the pool doesn't grow in edit loops
+class StructureTypeIndexMap
 {
-	using GenericStructureChainBase<HeadType>::StructureDataPointers;
-	using GenericStructureChainBase<HeadType>::STypeOffsets;
-	using GenericStructureChainBase<HeadType>::PNextPointerOffsets;
-	using GenericStructureChainBase<HeadType>::StructureDataIndices;
-
 public:
-	GenericStructureChain();
-	GenericStructureChain(HeadType& head);
-	~GenericStructureChain();
-	
-	//Clears everything EXCEPT head
+	StructureTypeIndexMap();
+	~StructureTypeIndexMap();
+
+	StructureTypeIndexMap(const StructureTypeIndexMap& rhs)			   = default;
+	StructureTypeIndexMap& operator=(const StructureTypeIndexMap& rhs) = default;
+
+	StructureTypeIndexMap(StructureTypeIndexMap&& rhs)			  = default;
+	StructureTypeIndexMap& operator=(StructureTypeIndexMap&& rhs) = default;
+
 	void Clear();
 
-	template<typename Struct>
-	void AppendToChain(Struct& next);
+	void AddIndex(VulkanStructureType sType, size_t index);
+	void RemoveIndex(VulkanStructureType sType, size_t index);
 
-	void AppendToChainGeneric(GenericStructBase& nextBlobData);
+	size_t GetIndex(VulkanStructureType sType, size_t occurrence) const;
+	size_t GetCount(VulkanStructureType sType)                    const;
 
-public:
-	GenericStructureChain(const GenericStructureChain& rhs) = delete;
-	GenericStructureChain& operator=(const GenericStructureChain& rhs) = delete;
+private:
+	struct TypeEntry
+	{
+		VulkanStructureType SType;
+		uint32_t			RunStart;
+		uint32_t			RunCount;
+		uint32_t			RunCapacity;
+	};
+
+	static constexpr VulkanStructureType EmptySType = static_cast<VulkanStructureType>(0x7FFFFFFF);
+	static constexpr size_t				 NoEntry	= (size_t)(-1);
+
+	size_t HashSType(VulkanStructureType sType) const;
+
+	size_t	   FindEntry(VulkanStructureType sType) const;
+	TypeEntry& FindOrAddEntry(VulkanStructureType sType);
+
+	void Rehash(size_t newTableSize);
+
+	uint32_t AllocateRun(uint32_t runCapacity);
+	void	 FreeRun(uint32_t runStart, uint32_t runCapacity);
 
 private:
-	void AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType);
+	static constexpr uint32_t RunCapacityClassCount = 32;
 
-protected:
-	HeadType HeadData;
+	std::vector<TypeEntry> TypeEntries;
+	std::vector<uint32_t>  IndexPool;
+	std::vector<uint32_t>  FreeRunStarts[RunCapacityClassCount]; //Indexed by log2 of the run capacity
+
+	size_t UsedEntryCount;
 };
 
-template<typename HeadType>
-inline GenericStructureChain<HeadType>::GenericStructureChain()
+inline StructureTypeIndexMap::StructureTypeIndexMap(): UsedEntryCount(0)
+{
+}
+
+inline StructureTypeIndexMap::~StructureTypeIndexMap()
+{
+}
+
+inline void StructureTypeIndexMap::Clear()
 {
-	//Init HeadData's sType and pNext
-	InitSType(&HeadData, offsetof(HeadData, sType), ValidStructureType<HeadType>);
-	HeadData.pNext = nullptr;
+	//Keep the allocated memory, it's going to be reused for the same chain anyway
+	for(TypeEntry& entry: TypeEntries)
+	{
+		entry.SType = EmptySType;
+	}
 
-	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(&HeadData));
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	IndexPool.clear();
+	for(std::vector<uint32_t>& freeRunStarts: FreeRunStarts)
+	{
+		freeRunStarts.clear();
+	}
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+	UsedEntryCount = 0;
 }
 
-template<typename HeadType>
-inline GenericStructureChain<HeadType>::GenericStructureChain(HeadType& head)
+inline void StructureTypeIndexMap::AddIndex(VulkanStructureType sType, size_t index)
 {
-	HeadData = head;
+	TypeEntry& entry = FindOrAddEntry(sType);
+	if(entry.RunCount == entry.RunCapacity)
+	{
+		//Relocate the run to a bigger one, the old run goes to the free list
+		uint32_t newRunCapacity = entry.RunCapacity * 2;
+		uint32_t newRunStart    = AllocateRun(newRunCapacity);
 
-	InitSType(&HeadData, offsetof(HeadData, sType), ValidStructureType<HeadType>);
-	HeadData.pNext = nullptr;
+		memcpy(IndexPool.data() + newRunStart, IndexPool.data() + entry.RunStart, entry.RunCount * sizeof(uint32_t));
+		FreeRun(entry.RunStart, entry.RunCapacity);
 
-	//Head is always the first pointer
-	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(&HeadData));
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+		entry.RunStart    = newRunStart;
+		entry.RunCapacity = newRunCapacity;
+	}
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+	IndexPool[entry.RunStart + entry.RunCount] = (uint32_t)index;
+	entry.RunCount++;
 }
 
-template<typename HeadType>
-inline GenericStructureChain<HeadType>::~GenericStructureChain()
+inline void StructureTypeIndexMap::RemoveIndex(VulkanStructureType sType, size_t index)
 {
+	size_t entrySlot = FindEntry(sType);
+	assert(entrySlot != NoEntry);
+
+	//Keep the order of the remaining occurrences, so it's O(occurrences of the sType), which is 1 for almost every chain
+	//The entry itself and its run stay in the table even if the run becomes empty, the same sType is likely to be added again
+	TypeEntry& entry = TypeEntries[entrySlot];
+	for(uint32_t i = 0; i < entry.RunCount; i++)
+	{
+		if(IndexPool[entry.RunStart + i] == (uint32_t)index)
+		{
+			memmove(IndexPool.data() + entry.RunStart + i, IndexPool.data() + entry.RunStart + i + 1, (entry.RunCount - i - 1) * sizeof(uint32_t));
+			entry.RunCount--;
+			return;
+		}
+	}
+
+	assert(false); //The index was never added
 }
 
-template<typename HeadType>
-inline void GenericStructureChain<HeadType>::Clear()
+inline size_t StructureTypeIndexMap::GetIndex(VulkanStructureType sType, size_t occurrence) const
 {
-	//Just reset the pointers
-	StructureDataPointers.clear();
-	PNextPointerOffsets.clear();
+	size_t entrySlot = FindEntry(sType);
+	assert(entrySlot != NoEntry);
 
-	StructureDataIndices.clear();
+	const TypeEntry& entry = TypeEntries[entrySlot];
+	assert(occurrence < entry.RunCount);
 
-	HeadData.pNext = nullptr;
+	return IndexPool[entry.RunStart + occurrence];
+}
 
-	StructureDataPointers.push_back(&HeadData);
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+inline size_t StructureTypeIndexMap::GetCount(VulkanStructureType sType) const
+{
+	size_t entrySlot = FindEntry(sType);
+	if(entrySlot == NoEntry)
+	{
+		return 0;
+	}
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+	return TypeEntries[entrySlot].RunCount;
 }
 
-template<typename HeadType>
-template<typename Struct>
-inline void GenericStructureChain<HeadType>::AppendToChain(Struct& next)
+inline size_t StructureTypeIndexMap::HashSType(VulkanStructureType sType) const
 {
-	AppendDataToChain(&next, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	//Extension sTypes differ mostly in the middle digits, Fibonacci hashing spreads them well enough
+	uint64_t hash = (uint64_t)(uint32_t)sType * 0x9E3779B97F4A7C15ull;
+	return (size_t)(hash >> 32) & (TypeEntries.size() - 1);
 }
 
-template<typename HeadType>
-inline void GenericStructureChain<HeadType>::AppendToChainGeneric(GenericStructBase& nextBlobData)
+inline size_t StructureTypeIndexMap::FindEntry(VulkanStructureType sType) const
 {
-	AppendDataToChain(nextBlobData.GetStructureData(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+	if(TypeEntries.size() == 0)
+	{
+		return NoEntry;
+	}
+
+	size_t tableMask = TypeEntries.size() - 1;
+	for(size_t slot = HashSType(sType); ; slot = (slot + 1) & tableMask)
+	{
+		const TypeEntry& entry = TypeEntries[slot];
+		if(entry.SType == sType)
+		{
+			return slot;
+		}
+		else if(entry.SType == EmptySType)
+		{
+			return NoEntry;
+		}
+	}
 }
 
-template<typename HeadType>
-inline void GenericStructureChain<HeadType>::AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType)
+inline StructureTypeIndexMap::TypeEntry& StructureTypeIndexMap::FindOrAddEntry(VulkanStructureType sType)
 {
-	std::byte* prevLastStruct  = StructureDataPointers.back();
-	ptrdiff_t  prevPNextOffset = PNextPointerOffsets.back();
+	assert(sType != EmptySType);
 
-	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(dataPtr));
-	STypeOffsets.push_back(sTypeOffset);
-	PNextPointerOffsets.push_back(pNextOffset);
-
-	std::byte* currLastStructPtr = StructureDataPointers.back();
-	InitSType(dataPtr, sTypeOffset, sType);										   //Set sType of the current struct
-	memcpy(prevLastStruct + prevPNextOffset, &currLastStructPtr, sizeof(std::byte*)); //Set pNext pointer of the previous struct
+	//Keep the load factor at most 1/2
+	if((UsedEntryCount + 1) * 2 > TypeEntries.size())
+	{
+		Rehash(TypeEntries.size() == 0 ? 16 : TypeEntries.size() * 2);
+	}
 
-	StructureDataIndices[sType] = StructureDataPointers.size() - 1;
+	size_t tableMask = TypeEntries.size() - 1;
+	for(size_t slot = HashSType(sType); ; slot = (slot + 1) & tableMask)
+	{
+		TypeEntry& entry = TypeEntries[slot];
+		if(entry.SType == sType)
+		{
+			return entry;
+		}
+		else if(entry.SType == EmptySType)
+		{
+			entry.SType       = sType;
+			entry.RunStart    = AllocateRun(1);
+			entry.RunCount    = 0;
+			entry.RunCapacity = 1;
+
+			UsedEntryCount++;
+
+			return entry;
+		}
+	}
 }
 
-//==========================================================================================================================
-
-//Generic structure chain, owning version
-template<typename HeadType> 
-class StructureChainBlob: public GenericStructureChainBase<HeadType>
+inline void StructureTypeIndexMap::Rehash(size_t newTableSize)
 {
-	using GenericStructureChainBase<HeadType>::StructureDataPointers;
-	using GenericStructureChainBase<HeadType>::STypeOffsets;
-	using GenericStructureChainBase<HeadType>::PNextPointerOffsets;
-	using GenericStructureChainBase<HeadType>::StructureDataIndices;
-
-public:
-	StructureChainBlob();
-	StructureChainBlob(const HeadType& head);
-	~StructureChainBlob();
-	   
-	//Clears everything EXCEPT head
-	void Clear();
-
-	template<typename Struct>
-	void AppendToChain(const Struct& next);
+	std::vector<TypeEntry> oldEntries = std::move(TypeEntries);
 
-	void AppendToChainGeneric(const GenericStructBase& nextBlobData);
+	TypeEntries.assign(newTableSize, TypeEntry{EmptySType, 0, 0, 0});
 
-public:
-	StructureChainBlob(const StructureChainBlob& rhs)			= delete;
-	StructureChainBlob& operator=(const StructureChainBlob& rhs) = delete;
+	size_t tableMask = TypeEntries.size() - 1;
+	for(const TypeEntry& oldEntry: oldEntries)
+	{
+		if(oldEntry.SType == EmptySType)
+		{
+			continue;
+		}
+
+		size_t slot = HashSType(oldEntry.SType);
+		while(TypeEntries[slot].SType != EmptySType)
+		{
+			slot = (slot + 1) & tableMask;
+		}
+
+		TypeEntries[slot] = oldEntry;
+	}
+}
 
-private:
-	void AppendDataToBlob(const std::byte* data, size_t dataSize, const void* dataPNext, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+inline uint32_t StructureTypeIndexMap::AllocateRun(uint32_t runCapacity)
+{
+	std::vector<uint32_t>& freeRunStarts = FreeRunStarts[FindLowestSetBit(runCapacity)];
+	if(!freeRunStarts.empty())
+	{
+		uint32_t runStart = freeRunStarts.back();
+		freeRunStarts.pop_back();
+		return runStart;
+	}
 
-private:
-	std::vector<std::byte> StructureChainBlobData;
-};
+	uint32_t runStart = (uint32_t)IndexPool.size();
+	IndexPool.resize(IndexPool.size() + runCapacity);
+	return runStart;
+}
 
-template<typename HeadType>
-inline StructureChainBlob<HeadType>::StructureChainBlob()
+inline void StructureTypeIndexMap::FreeRun(uint32_t runStart, uint32_t runCapacity)
 {
-	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
-
-	//Store head in the blob
-	StructureChainBlobData.resize(sizeof(HeadType));
+	FreeRunStarts[FindLowestSetBit(runCapacity)].push_back(runStart);
+}
 
-	HeadType head;
-	InitSType(&head, offsetof(HeadType, sType), ValidStructureType<HeadType>);
-	head.pNext = nullptr;
+//==========================================================================================================================
 
-	memcpy(StructureChainBlobData.data(), &head, sizeof(HeadType));
+//Alignment of every structure stored in owning chains, enough for any Vulkan structure
+constexpr size_t ChainLinkDataAlignment = alignof(uint64_t) > alignof(void*) ? alignof(uint64_t) : alignof(void*);
 
-	StructureDataPointers.push_back(StructureChainBlobData.data());
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+//Raw access to sType and pNext of any Vulkan structure, for walking the chains of unknown structures
+inline VulkanStructureType GetChainLinkSType(const void* structure)
+{
+	VulkanStructureType sType;
+	memcpy(&sType, (const std::byte*)structure + offsetof(VkBaseInStructure, sType), sizeof(VulkanStructureType));
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+	return sType;
+}
+
+inline const void* GetChainLinkPNext(const void* structure)
+{
+	const void* pNext = nullptr;
+	memcpy(&pNext, (const std::byte*)structure + offsetof(VkBaseInStructure, pNext), sizeof(void*));
+
+	return pNext;
+}
+
+inline void SetChainLinkPNext(void* structure, const void* pNext)
+{
+	memcpy((std::byte*)structure + offsetof(VkBaseOutStructure, pNext), &pNext, sizeof(void*));
+}
+
+//==========================================================================================================================
+
+//Final mixing step of the hash, so every input bit affects every output bit
+constexpr uint64_t MixHash(uint64_t hash)
+{
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDull;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ull;
+	hash ^= hash >> 33;
+
+	return hash;
+}
+
+constexpr uint64_t NameHashBasis = 0xCBF29CE484222325ull;
+constexpr uint64_t NameHashPrime = 0x100000001B3ull;
+
+//FNV-1a, same as the generator uses for the perfect hash tables of names. Can be continued, e.g. with the structure name hashed once for all its members
+constexpr uint64_t HashName(uint64_t nameHash, const char* name, size_t nameLength)
+{
+	for(size_t i = 0; i < nameLength; i++)
+	{
+		nameHash = (nameHash ^ (uint8_t)name[i]) * NameHashPrime;
+	}
+
+	return nameHash;
+}
+
+//Hashes 32 bytes per iteration in 4 independent lanes, so the main loop can be vectorized
+//Returns the number of bytes hashed, the rest is the tail shorter than an iteration
+inline size_t HashBytesLanes(const std::byte* data, size_t dataSize, uint64_t* lanes)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	size_t offset = 0;
+	for(; offset + 4 * sizeof(uint64_t) <= dataSize; offset += 4 * sizeof(uint64_t))
+	{
+		for(size_t i = 0; i < 4; i++)
+		{
+			uint64_t word;
+			memcpy(&word, data + offset + i * sizeof(uint64_t), sizeof(uint64_t));
+
+			lanes[i] = (lanes[i] ^ word) * multiplier;
+			lanes[i] = lanes[i] ^ (lanes[i] >> 29);
+		}
+	}
+
+	return offset;
+}
+
+//Folds the lanes and the tail into the final hash. The tail is zero-padded to the whole word
+inline uint64_t HashBytesFold(const uint64_t* lanes, const std::byte* tailData, size_t tailSize, uint64_t hash)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	for(size_t i = 0; i < 4; i++)
+	{
+		hash = (hash ^ MixHash(lanes[i])) * multiplier;
+	}
+
+	for(size_t offset = 0; offset < tailSize; offset += sizeof(uint64_t))
+	{
+		uint64_t word = 0;
+		memcpy(&word, tailData + offset, tailSize - offset < sizeof(uint64_t) ? tailSize - offset : sizeof(uint64_t));
+
+		hash = (hash ^ word) * multiplier;
+		hash = hash ^ (hash >> 29);
+	}
+
+	return MixHash(hash);
+}
+
+inline uint64_t HashBytes(const std::byte* data, size_t dataSize, uint64_t seed = 0)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	uint64_t lanes[4] = {seed, seed + multiplier, seed ^ multiplier, seed - multiplier};
+	size_t	 laneDataSize = HashBytesLanes(data, dataSize, lanes);
+
+	return HashBytesFold(lanes, data + laneDataSize, dataSize - laneDataSize, dataSize);
+}
+
+//128-bit hash, for the keys that are compared by the hash alone. Both halves are folded from the same lanes in different order
+inline void HashBytes128(const std::byte* data, size_t dataSize, uint64_t* outHash)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	uint64_t lanes[4] = {0, multiplier, multiplier, 0 - multiplier};
+	size_t	 laneDataSize = HashBytesLanes(data, dataSize, lanes);
+
+	uint64_t reversedLanes[4] = {lanes[3], lanes[2], lanes[1], lanes[0]};
+
+	outHash[0] = HashBytesFold(lanes,		  data + laneDataSize, dataSize - laneDataSize, dataSize);
+	outHash[1] = HashBytesFold(reversedLanes, data + laneDataSize, dataSize - laneDataSize, ~(uint64_t)dataSize);
+}
+
+//Copies only the given members of the structure, everything between them is zeroed out
+inline void CopyStructureMemberRanges(std::byte* maskedData, const std::byte* structureData, size_t structureSize, const StructureMemberRange* memberRanges, size_t rangeCount)
+{
+	memset(maskedData, 0, structureSize);
+	for(size_t i = 0; i < rangeCount; i++)
+	{
+		memcpy(maskedData + memberRanges[i].Offset, structureData + memberRanges[i].Offset, memberRanges[i].Size);
+	}
+}
+
+//Copies the structure with pNext and padding zeroed out. Padding is known from the generated member ranges
+//For the structures with unknown layout only pNext is zeroed out
+inline void CopyMaskedStructure(std::byte* maskedData, const std::byte* structureData, size_t structureSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset)
+{
+	VulkanStructureType sType;
+	memcpy(&sType, structureData + sTypeOffset, sizeof(VulkanStructureType));
+
+	size_t						rangeCount   = 0;
+	const StructureMemberRange* memberRanges = GetSTypeMemberRanges(sType, &rangeCount);
+	if(memberRanges != nullptr && GetSTypeStructureSize(sType) == structureSize)
+	{
+		CopyStructureMemberRanges(maskedData, structureData, structureSize, memberRanges, rangeCount);
+	}
+	else
+	{
+		memcpy(maskedData, structureData, structureSize);
+		memset(maskedData + pNextOffset, 0, sizeof(void*));
+	}
+}
+
+//Copy of the structure with pNext and padding zeroed out, for hashing and comparison
+class MaskedStructure
+{
+public:
+	MaskedStructure(const std::byte* structureData, size_t structureSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset);
+	~MaskedStructure();
+
+	const std::byte* GetData() const;
+	size_t			 GetSize() const;
+
+public:
+	MaskedStructure(const MaskedStructure& rhs)			   = delete;
+	MaskedStructure& operator=(const MaskedStructure& rhs) = delete;
+
+private:
+	//Most structures fit into the stack buffer
+	std::byte			   StackData[1024];
+	std::vector<std::byte> HeapData;
+
+	std::byte* Data;
+	size_t	   Size;
+};
+
+inline MaskedStructure::MaskedStructure(const std::byte* structureData, size_t structureSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset): Data(StackData), Size(structureSize)
+{
+	if(Size == 0)
+	{
+		return;
+	}
+
+	if(Size > sizeof(StackData))
+	{
+		HeapData.resize(Size);
+		Data = HeapData.data();
+	}
+
+	CopyMaskedStructure(Data, structureData, Size, sTypeOffset, pNextOffset);
+}
+
+inline MaskedStructure::~MaskedStructure()
+{
+}
+
+inline const std::byte* MaskedStructure::GetData() const
+{
+	return Data;
+}
+
+inline size_t MaskedStructure::GetSize() const
+{
+	return Size;
+}
+
+inline uint64_t GenericStructBase::Hash() const
+{
+	MaskedStructure maskedStructure(StructureData, StructureSize, STypeOffset, PNextPointerOffset);
+	return HashBytes(maskedStructure.GetData(), maskedStructure.GetSize());
+}
+
+inline bool GenericStructBase::operator==(const GenericStructBase& rhs) const
+{
+	if(StructureSize != rhs.StructureSize)
+	{
+		return false;
+	}
+
+	if(StructureSize == 0)
+	{
+		return true;
+	}
+
+	if(GetSType() != rhs.GetSType())
+	{
+		return false;
+	}
+
+	MaskedStructure lhsMaskedStructure(StructureData,	  StructureSize,	 STypeOffset,	  PNextPointerOffset);
+	MaskedStructure rhsMaskedStructure(rhs.StructureData, rhs.StructureSize, rhs.STypeOffset, rhs.PNextPointerOffset);
+
+	return memcmp(lhsMaskedStructure.GetData(), rhsMaskedStructure.GetData(), StructureSize) == 0;
+}
+
+inline bool GenericStructBase::operator!=(const GenericStructBase& rhs) const
+{
+	return !(*this == rhs);
+}
+
+//The contents of the links with unknown sType can't be read, such links are only equal to themselves
+inline uint64_t HashChainLink(const void* link)
+{
+	VulkanStructureType sType	= GetChainLinkSType(link);
+	size_t				linkSize = GetSTypeStructureSize(sType);
+	if(linkSize == 0)
+	{
+		return MixHash((uint64_t)sType);
+	}
+
+	MaskedStructure maskedLink((const std::byte*)link, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+	return HashBytes(maskedLink.GetData(), maskedLink.GetSize());
+}
+
+inline bool CompareChainLinks(const void* lhsLink, const void* rhsLink)
+{
+	VulkanStructureType sType = GetChainLinkSType(lhsLink);
+	if(sType != GetChainLinkSType(rhsLink))
+	{
+		return false;
+	}
+
+	size_t linkSize = GetSTypeStructureSize(sType);
+	if(linkSize == 0)
+	{
+		return lhsLink == rhsLink;
+	}
+
+	MaskedStructure lhsMaskedLink((const std::byte*)lhsLink, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+	MaskedStructure rhsMaskedLink((const std::byte*)rhsLink, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+
+	return memcmp(lhsMaskedLink.GetData(), rhsMaskedLink.GetData(), linkSize) == 0;
+}
+
+//Both go through the whole pNext chain. The order of the links after the head doesn't matter
+//With skipUnknownLinks the links with unknown sType are left out, so a chain compares equal to its linearized copy
+inline uint64_t HashChain(const void* head, bool skipUnknownLinks = false)
+{
+	//The sum doesn't depend on the link order
+	uint64_t linksHash = 0;
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(skipUnknownLinks && GetSTypeStructureSize(GetChainLinkSType(link)) == 0)
+		{
+			continue;
+		}
+
+		linksHash += HashChainLink(link);
+	}
+
+	return MixHash(HashChainLink(head) ^ MixHash(linksHash));
+}
+
+inline bool CompareChains(const void* lhsHead, const void* rhsHead, bool skipUnknownLinks = false)
+{
+	if(!CompareChainLinks(lhsHead, rhsHead))
+	{
+		return false;
+	}
+
+	std::vector<const void*> unmatchedRhsLinks;
+	for(const void* link = GetChainLinkPNext(rhsHead); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(!skipUnknownLinks || GetSTypeStructureSize(GetChainLinkSType(link)) != 0)
+		{
+			unmatchedRhsLinks.push_back(link);
+		}
+	}
+
+	//Every link has to match a different link of rhs, in any order
+	for(const void* link = GetChainLinkPNext(lhsHead); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(skipUnknownLinks && GetSTypeStructureSize(GetChainLinkSType(link)) == 0)
+		{
+			continue;
+		}
+
+		size_t matchIndex = 0;
+		while(matchIndex < unmatchedRhsLinks.size() && !CompareChainLinks(link, unmatchedRhsLinks[matchIndex]))
+		{
+			matchIndex++;
+		}
+
+		if(matchIndex == unmatchedRhsLinks.size())
+		{
+			return false;
+		}
+
+		unmatchedRhsLinks[matchIndex] = unmatchedRhsLinks.back();
+		unmatchedRhsLinks.pop_back();
+	}
+
+	return unmatchedRhsLinks.empty();
+}
+
+//==========================================================================================================================
+
+//Pointers to the structures of a chain, in a separate allocation that moves together with the chain
+//LinkHandles point to the allocation, so they survive both the growth of the chain storage and moving the chain. A moved-from table is empty
+class LinkDataPointerTable
+{
+public:
+	LinkDataPointerTable();
+	~LinkDataPointerTable();
+
+	//A copy gets its own allocation, the handles keep pointing to the original chain
+	LinkDataPointerTable(const LinkDataPointerTable& rhs);
+	LinkDataPointerTable& operator=(const LinkDataPointerTable& rhs);
+
+	//Has to be noexcept, otherwise std::vector copies the chains when it grows instead of moving them
+	LinkDataPointerTable(LinkDataPointerTable&& rhs) noexcept;
+	LinkDataPointerTable& operator=(LinkDataPointerTable&& rhs) noexcept;
+
+	std::byte*&		  operator[](size_t index);
+	std::byte* const& operator[](size_t index) const;
+
+	std::byte* back() const;
+	size_t	   size() const;
+
+	void push_back(std::byte* linkData);
+	void resize(size_t linkCount);
+	void reserve(size_t linkCount);
+
+	const std::vector<std::byte*>* GetPointers() const;
+
+private:
+	std::vector<std::byte*>& GetOrAllocatePointers();
+
+private:
+	std::unique_ptr<std::vector<std::byte*>> Pointers; //Allocated on the first use
+};
+
+inline LinkDataPointerTable::LinkDataPointerTable()
+{
+}
+
+inline LinkDataPointerTable::~LinkDataPointerTable()
+{
+}
+
+inline LinkDataPointerTable::LinkDataPointerTable(const LinkDataPointerTable& rhs)
+{
+	*this = rhs;
+}
+
+inline LinkDataPointerTable& LinkDataPointerTable::operator=(const LinkDataPointerTable& rhs)
+{
+	if(this == &rhs)
+	{
+		return *this;
+	}
+
+	if(rhs.Pointers == nullptr)
+	{
+		Pointers.reset();
+	}
+	else
+	{
+		GetOrAllocatePointers() = *rhs.Pointers;
+	}
+
+	return *this;
+}
+
+inline LinkDataPointerTable::LinkDataPointerTable(LinkDataPointerTable&& rhs) noexcept: Pointers(std::move(rhs.Pointers))
+{
+}
+
+inline LinkDataPointerTable& LinkDataPointerTable::operator=(LinkDataPointerTable&& rhs) noexcept
+{
+	Pointers = std::move(rhs.Pointers);
+	return *this;
+}
+
+inline std::byte*& LinkDataPointerTable::operator[](size_t index)
+{
+	assert(index < size());
+
+	return (*Pointers)[index];
+}
+
+inline std::byte* const& LinkDataPointerTable::operator[](size_t index) const
+{
+	assert(index < size());
+
+	return (*Pointers)[index];
+}
+
+inline std::byte* LinkDataPointerTable::back() const
+{
+	assert(size() > 0);
+
+	return Pointers->back();
+}
+
+inline size_t LinkDataPointerTable::size() const
+{
+	return (Pointers == nullptr) ? 0 : Pointers->size();
+}
+
+inline void LinkDataPointerTable::push_back(std::byte* linkData)
+{
+	GetOrAllocatePointers().push_back(linkData);
+}
+
+inline void LinkDataPointerTable::resize(size_t linkCount)
+{
+	GetOrAllocatePointers().resize(linkCount);
+}
+
+inline void LinkDataPointerTable::reserve(size_t linkCount)
+{
+	GetOrAllocatePointers().reserve(linkCount);
+}
+
+inline const std::vector<std::byte*>* LinkDataPointerTable::GetPointers() const
+{
+	assert(Pointers != nullptr);
+
+	return Pointers.get();
+}
+
+inline std::vector<std::byte*>& LinkDataPointerTable::GetOrAllocatePointers()
+{
+	if(Pointers == nullptr)
+	{
+		Pointers = std::make_unique<std::vector<std::byte*>>();
+	}
+
+	return *Pointers;
+}
+
+//Stable reference to a chain link. Stays valid when the chain storage grows and when the chain is moved, until the link is removed or the chain is cleared or destroyed
+template<typename Struct>
+class LinkHandle
+{
+public:
+	LinkHandle();
+	LinkHandle(const std::vector<std::byte*>* linkDataPointers, size_t linkIndex);
+
+	Struct& operator*()  const;
+	Struct* operator->() const;
+	Struct* Get()		 const;
+
+	size_t GetLinkIndex() const;
+
+private:
+	const std::vector<std::byte*>* LinkDataPointers;
+	size_t						   LinkIndex;
+};
+
+template<typename Struct>
+inline LinkHandle<Struct>::LinkHandle(): LinkDataPointers(nullptr), LinkIndex(0)
+{
+}
+
+template<typename Struct>
+inline LinkHandle<Struct>::LinkHandle(const std::vector<std::byte*>* linkDataPointers, size_t linkIndex): LinkDataPointers(linkDataPointers), LinkIndex(linkIndex)
+{
+}
+
+template<typename Struct>
+inline Struct& LinkHandle<Struct>::operator*() const
+{
+	return *Get();
+}
+
+template<typename Struct>
+inline Struct* LinkHandle<Struct>::operator->() const
+{
+	return Get();
+}
+
+template<typename Struct>
+inline Struct* LinkHandle<Struct>::Get() const
+{
+	assert(LinkDataPointers != nullptr);
+	assert(LinkIndex < LinkDataPointers->size());
+
+	return reinterpret_cast<Struct*>((*LinkDataPointers)[LinkIndex]);
+}
+
+template<typename Struct>
+inline size_t LinkHandle<Struct>::GetLinkIndex() const
+{
+	return LinkIndex;
+}
+
+//==========================================================================================================================
+
+//Base class for a generic structure chain, hiding chain link type info and the head type
+class GenericStructureChainBase
+{
+protected:
+	GenericStructureChainBase();
+	~GenericStructureChainBase();
+
+	GenericStructureChainBase(GenericStructureChainBase&& rhs)			  = default;
+	GenericStructureChainBase& operator=(GenericStructureChainBase&& rhs) = default;
+
+	//Only the owning chains can be copied, they relocate the pointers themselves
+	GenericStructureChainBase(const GenericStructureChainBase& rhs)			   = default;
+	GenericStructureChainBase& operator=(const GenericStructureChainBase& rhs) = default;
+
+public:
+	std::byte*			GetChainHeadData()  const;
+	VulkanStructureType GetChainHeadSType() const;
+
+	template<typename HeadType>
+	HeadType& GetChainHeadAs();
+
+	//Returns the occurrence-th structure of the type Struct in the chain, in order of adding
+	template<typename Struct>
+	Struct& GetChainLinkDataAs(size_t occurrence = 0);
+
+	template<typename Struct>
+	size_t CountOf() const;
+
+	//Same as GetChainLinkDataAs, but the result stays valid after adding more structures to the chain
+	template<typename Struct>
+	LinkHandle<Struct> GetChainLinkHandle(size_t occurrence = 0) const;
+
+	//Both go through the whole pNext chain. The order of the links after the head doesn't matter, the values of pNext and the padding are ignored
+	uint64_t Hash() const;
+	bool	 operator==(const GenericStructureChainBase& rhs) const;
+	bool	 operator!=(const GenericStructureChainBase& rhs) const;
+
+	//Serializes the whole pNext chain, see SerializeStructures()
+	std::vector<std::byte> Serialize(bool deep = false) const;
+
+protected:
+	VulkanStructureType GetLinkSType(size_t linkIndex) const;
+
+	void* GetLinkPNext(size_t linkIndex) const;
+	void  SetLinkPNext(size_t linkIndex, const void* pNext);
+
+protected:
+	LinkDataPointerTable   StructureDataPointers;
+	std::vector<ptrdiff_t> PNextPointerOffsets;
+	std::vector<ptrdiff_t> STypeOffsets;
+
+	StructureTypeIndexMap StructureDataIndices;
+};
+
+inline GenericStructureChainBase::GenericStructureChainBase()
+{
+}
+
+inline GenericStructureChainBase::~GenericStructureChainBase()
+{
+}
+
+inline std::byte* GenericStructureChainBase::GetChainHeadData() const
+{
+	assert(StructureDataPointers.size() > 0);
+	assert(StructureDataPointers[0] != nullptr);
+
+	return StructureDataPointers[0];
+}
+
+inline VulkanStructureType GenericStructureChainBase::GetChainHeadSType() const
+{
+	assert(StructureDataPointers.size() > 0);
+
+	return GetLinkSType(0);
+}
+
+template<typename HeadType>
+inline HeadType& GenericStructureChainBase::GetChainHeadAs()
+{
+	assert(GetChainHeadSType() == ValidStructureType<HeadType>);
+
+	HeadType* head = reinterpret_cast<HeadType*>(GetChainHeadData());
+	return *head;
+}
+
+template<typename Struct>
+inline Struct& GenericStructureChainBase::GetChainLinkDataAs(size_t occurrence)
+{
+	Struct* structPtr = reinterpret_cast<Struct*>(StructureDataPointers[StructureDataIndices.GetIndex(ValidStructureType<Struct>, occurrence)]);
+	return *structPtr;
+}
+
+template<typename Struct>
+inline size_t GenericStructureChainBase::CountOf() const
+{
+	return StructureDataIndices.GetCount(ValidStructureType<Struct>);
+}
+
+template<typename Struct>
+inline LinkHandle<Struct> GenericStructureChainBase::GetChainLinkHandle(size_t occurrence) const
+{
+	return LinkHandle<Struct>(StructureDataPointers.GetPointers(), StructureDataIndices.GetIndex(ValidStructureType<Struct>, occurrence));
+}
+
+inline uint64_t GenericStructureChainBase::Hash() const
+{
+	return HashChain(GetChainHeadData());
+}
+
+inline bool GenericStructureChainBase::operator==(const GenericStructureChainBase& rhs) const
+{
+	return CompareChains(GetChainHeadData(), rhs.GetChainHeadData());
+}
+
+inline bool GenericStructureChainBase::operator!=(const GenericStructureChainBase& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline VulkanStructureType GenericStructureChainBase::GetLinkSType(size_t linkIndex) const
+{
+	VulkanStructureType sType;
+	memcpy(&sType, StructureDataPointers[linkIndex] + STypeOffsets[linkIndex], sizeof(VulkanStructureType));
+
+	return sType;
+}
+
+inline void* GenericStructureChainBase::GetLinkPNext(size_t linkIndex) const
+{
+	void* pNext = nullptr;
+	memcpy(&pNext, StructureDataPointers[linkIndex] + PNextPointerOffsets[linkIndex], sizeof(void*));
+
+	return pNext;
+}
+
+inline void GenericStructureChainBase::SetLinkPNext(size_t linkIndex, const void* pNext)
+{
+	memcpy(StructureDataPointers[linkIndex] + PNextPointerOffsets[linkIndex], &pNext, sizeof(void*));
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, non-owning version with the head type erased. The head is referenced, not copied
+//Every appended link keeps its slot until Clear(). Links can be disabled and re-enabled through a bitmask, which only relinks the neighbours
+class AnyGenericStructureChain: public GenericStructureChainBase
+{
+public:
+	AnyGenericStructureChain(GenericStructBase& head);
+	~AnyGenericStructureChain();
+	
+	//Clears everything EXCEPT head
+	void Clear();
+
+	//Both return the index of the appended link. The link is enabled after appending
+	template<typename Struct>
+	size_t AppendToChain(Struct& next);
+
+	size_t AppendToChainGeneric(GenericStructBase& nextBlobData);
+
+	//Disabled links are skipped by the pNext pointers, but still can be accessed with GetChainLinkDataAs. Head is always enabled
+	void SetLinkEnabled(size_t linkIndex, bool enabled);
+	bool IsLinkEnabled(size_t linkIndex) const;
+
+	template<typename Struct>
+	void SetStructureEnabled(bool enabled, size_t occurrence = 0);
+
+	//Enable mask for links [64 * wordIndex, 64 * wordIndex + 63]. Only the links with the changed bits get relinked
+	void	 SetLinkEnableMask(uint64_t enableMask, size_t wordIndex = 0);
+	uint64_t GetLinkEnableMask(size_t wordIndex = 0) const;
+
+public:
+	AnyGenericStructureChain(const AnyGenericStructureChain& rhs) = delete;
+	AnyGenericStructureChain& operator=(const AnyGenericStructureChain& rhs) = delete;
+
+protected:
+	AnyGenericStructureChain();
+
+	void InitChainHead(std::byte* headData, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType);
+
+private:
+	size_t AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType);
+
+	void EnableLink(size_t linkIndex);
+	void DisableLink(size_t linkIndex);
+
+	size_t FindPrevEnabledLink(size_t linkIndex) const;
+
+private:
+	std::vector<uint64_t> LinkEnableMask;
+};
+
+inline AnyGenericStructureChain::AnyGenericStructureChain()
+{
+}
+
+inline AnyGenericStructureChain::AnyGenericStructureChain(GenericStructBase& head)
+{
+	InitChainHead(head.GetStructureData(), head.GetSTypeOffset(), head.GetPNextOffset(), head.GetSType());
+}
+
+inline AnyGenericStructureChain::~AnyGenericStructureChain()
+{
+}
+
+inline void AnyGenericStructureChain::Clear()
+{
+	//Just reset the pointers, head is always the first one
+	StructureDataPointers.resize(1);
+	STypeOffsets.resize(1);
+	PNextPointerOffsets.resize(1);
+
+	SetLinkPNext(0, nullptr);
+
+	LinkEnableMask.assign(1, 1);
+
+	StructureDataIndices.Clear();
+	StructureDataIndices.AddIndex(GetLinkSType(0), 0);
+}
+
+template<typename Struct>
+inline size_t AnyGenericStructureChain::AppendToChain(Struct& next)
+{
+	return AppendDataToChain(&next, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+}
+
+inline size_t AnyGenericStructureChain::AppendToChainGeneric(GenericStructBase& nextBlobData)
+{
+	return AppendDataToChain(nextBlobData.GetStructureData(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+}
+
+inline void AnyGenericStructureChain::SetLinkEnabled(size_t linkIndex, bool enabled)
+{
+	assert(linkIndex < StructureDataPointers.size());
+
+	if(IsLinkEnabled(linkIndex) == enabled)
+	{
+		return;
+	}
+
+	if(enabled)
+	{
+		EnableLink(linkIndex);
+	}
+	else
+	{
+		DisableLink(linkIndex);
+	}
+}
+
+inline bool AnyGenericStructureChain::IsLinkEnabled(size_t linkIndex) const
+{
+	return (LinkEnableMask[linkIndex / 64] >> (linkIndex % 64)) & 1;
+}
+
+template<typename Struct>
+inline void AnyGenericStructureChain::SetStructureEnabled(bool enabled, size_t occurrence)
+{
+	SetLinkEnabled(StructureDataIndices.GetIndex(ValidStructureType<Struct>, occurrence), enabled);
+}
+
+inline void AnyGenericStructureChain::SetLinkEnableMask(uint64_t enableMask, size_t wordIndex)
+{
+	assert(wordIndex < LinkEnableMask.size());
+
+	//Bits for the links that don't exist yet are ignored
+	size_t linkCountInWord = StructureDataPointers.size() - wordIndex * 64;
+	if(linkCountInWord < 64)
+	{
+		enableMask &= (1ull << linkCountInWord) - 1;
+	}
+
+	//Head is always enabled
+	if(wordIndex == 0)
+	{
+		enableMask |= 1;
+	}
+
+	uint64_t changedMask = LinkEnableMask[wordIndex] ^ enableMask;
+	while(changedMask != 0)
+	{
+		size_t bitIndex  = FindLowestSetBit(changedMask);
+		size_t linkIndex = wordIndex * 64 + bitIndex;
+
+		if((enableMask >> bitIndex) & 1)
+		{
+			EnableLink(linkIndex);
+		}
+		else
+		{
+			DisableLink(linkIndex);
+		}
+
+		changedMask &= changedMask - 1;
+	}
+}
+
+inline uint64_t AnyGenericStructureChain::GetLinkEnableMask(size_t wordIndex) const
+{
+	assert(wordIndex < LinkEnableMask.size());
+
+	return LinkEnableMask[wordIndex];
+}
+
+inline void AnyGenericStructureChain::InitChainHead(std::byte* headData, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType)
+{
+	//Head is always the first pointer
+	StructureDataPointers.push_back(headData);
+	STypeOffsets.push_back(sTypeOffset);
+	PNextPointerOffsets.push_back(pNextOffset);
+
+	SetLinkPNext(0, nullptr);
+
+	LinkEnableMask.push_back(1);
+
+	StructureDataIndices.AddIndex(sType, 0);
+}
+
+inline size_t AnyGenericStructureChain::AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType)
+{
+	size_t linkIndex = StructureDataPointers.size();
+
+	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(dataPtr));
+	STypeOffsets.push_back(sTypeOffset);
+	PNextPointerOffsets.push_back(pNextOffset);
+
+	if(linkIndex % 64 == 0)
+	{
+		LinkEnableMask.push_back(0);
+	}
+
+	LinkEnableMask[linkIndex / 64] |= (1ull << (linkIndex % 64));
+
+	std::byte* currLastStructPtr = StructureDataPointers.back();
+	InitSType(dataPtr, sTypeOffset, sType);						  //Set sType of the current struct
+	SetLinkPNext(FindPrevEnabledLink(linkIndex), currLastStructPtr); //Set pNext pointer of the previous enabled struct
+
+	StructureDataIndices.AddIndex(sType, linkIndex);
+	return linkIndex;
+}
+
+inline void AnyGenericStructureChain::EnableLink(size_t linkIndex)
+{
+	size_t prevLinkIndex = FindPrevEnabledLink(linkIndex);
+
+	//The previous enabled link points either to the next enabled link or to the end of the chain
+	SetLinkPNext(linkIndex, GetLinkPNext(prevLinkIndex));
+	SetLinkPNext(prevLinkIndex, StructureDataPointers[linkIndex]);
+
+	LinkEnableMask[linkIndex / 64] |= (1ull << (linkIndex % 64));
+}
+
+inline void AnyGenericStructureChain::DisableLink(size_t linkIndex)
+{
+	assert(linkIndex != 0); //Head cannot be disabled
+
+	size_t prevLinkIndex = FindPrevEnabledLink(linkIndex);
+	SetLinkPNext(prevLinkIndex, GetLinkPNext(linkIndex));
+
+	LinkEnableMask[linkIndex / 64] &= ~(1ull << (linkIndex % 64));
+}
+
+inline size_t AnyGenericStructureChain::FindPrevEnabledLink(size_t linkIndex) const
+{
+	//Head is always enabled, so the loop always ends
+	size_t   wordIndex = linkIndex / 64;
+	uint64_t wordMask  = LinkEnableMask[wordIndex] & ((1ull << (linkIndex % 64)) - 1);
+	while(wordMask == 0)
+	{
+		wordIndex--;
+		wordMask = LinkEnableMask[wordIndex];
+	}
+
+	return wordIndex * 64 + FindHighestSetBit(wordMask);
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, non-owning version. Stores a copy of the head
+template<typename HeadType>
+class GenericStructureChain: public AnyGenericStructureChain
+{
+public:
+	GenericStructureChain();
+	GenericStructureChain(HeadType& head);
+	~GenericStructureChain();
+
+	HeadType& GetChainHead();
+
+public:
+	GenericStructureChain(const GenericStructureChain& rhs) = delete;
+	GenericStructureChain& operator=(const GenericStructureChain& rhs) = delete;
+
+protected:
+	HeadType HeadData;
+};
+
+template<typename HeadType>
+inline GenericStructureChain<HeadType>::GenericStructureChain()
+{
+	//Init HeadData's sType, pNext is initialized in InitChainHead()
+	InitSType(&HeadData, offsetof(HeadType, sType), ValidStructureType<HeadType>);
+	InitChainHead(reinterpret_cast<std::byte*>(&HeadData), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline GenericStructureChain<HeadType>::GenericStructureChain(HeadType& head)
+{
+	HeadData = head;
+
+	InitSType(&HeadData, offsetof(HeadType, sType), ValidStructureType<HeadType>);
+	InitChainHead(reinterpret_cast<std::byte*>(&HeadData), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline GenericStructureChain<HeadType>::~GenericStructureChain()
+{
+}
+
+template<typename HeadType>
+inline HeadType& GenericStructureChain<HeadType>::GetChainHead()
+{
+	return HeadData;
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, owning version with the head type erased. Can be copied and moved, so chains with different heads can be stored together
+//All links live in a single blob that grows geometrically. The chain order is tracked apart from the storage order,
+//so links can be inserted and removed by patching only the neighbouring pNext pointers. Storage of removed links gets reused
+class ExtensionBitset;
+
+class AnyStructureChainBlob: public GenericStructureChainBase
+{
+public:
+	//Creates an empty chain without a head. Only useful as a placeholder to move another chain into
+	AnyStructureChainBlob();
+	explicit AnyStructureChainBlob(const GenericStructBase& head);
+	~AnyStructureChainBlob();
+
+	//Copying is a single blob copy plus relocation of the link pointers
+	AnyStructureChainBlob(const AnyStructureChainBlob& rhs);
+	AnyStructureChainBlob& operator=(const AnyStructureChainBlob& rhs);
+
+	//Moving keeps all structure pointers and LinkHandles valid, since the blob memory and the link table stay the same
+	AnyStructureChainBlob(AnyStructureChainBlob&& rhs)			  = default;
+	AnyStructureChainBlob& operator=(AnyStructureChainBlob&& rhs) = default;
+	   
+	//Clears everything EXCEPT head
+	void Clear();
+
+	template<typename Struct>
+	void AppendToChain(const Struct& next);
+
+	void AppendToChainGeneric(const GenericStructBase& nextBlobData);
+
+	//Inserts the structure right after the anchorOccurrence-th structure of the type AnchorStruct
+	template<typename AnchorStruct, typename Struct>
+	void InsertAfter(const Struct& next, size_t anchorOccurrence = 0);
+
+	template<typename AnchorStruct>
+	void InsertAfterGeneric(const GenericStructBase& nextBlobData, size_t anchorOccurrence = 0);
+
+	//Unlinks the occurrence-th structure of the type Struct. Its storage is reused by the next added structure that fits
+	template<typename Struct>
+	void Remove(size_t occurrence = 0);
+
+	//Overwrites the first structure of the type Struct in place, keeping its position in the chain. Appends the structure if there's none
+	template<typename Struct>
+	void Upsert(const Struct& value);
+
+	//Constructs the structure directly in the blob with Struct{args...} and appends it to the chain
+	template<typename Struct, typename... Args>
+	LinkHandle<Struct> Emplace(Args&&... args);
+
+	//Copies the whole chain into a single exact-size blob, in the pNext order. Links with unknown sType are skipped, the head has to be known
+	static AnyStructureChainBlob Linearize(const void* head);
+	static AnyStructureChainBlob Linearize(const GenericStructureChainBase& chain);
+
+	//Loads the chain serialized with SerializeStructures(), straight from the serialized records in a single exact-size blob
+	//Returns false if the data is not valid or is a deep serialization, since a chain can't own the data its pointer members point to
+	static bool Deserialize(const void* serializedData, size_t serializedSize, AnyStructureChainBlob& outChain);
+
+protected:
+	friend size_t FilterByEnabled(AnyStructureChainBlob& chain, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+
+	void LinearizeChain(const void* head);
+
+	void InitChainHead(const std::byte* headData, size_t headSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType);
+
+	size_t AllocateLink(size_t dataSize);
+	size_t AddLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+	void   InitEmplacedLink(size_t linkIndex, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+	void   RemoveLink(VulkanStructureType sType, size_t occurrence);
+	void   RemoveLinkAt(size_t linkIndex);
+	void   UpsertLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+
+	void LinkAfter(size_t prevLinkIndex, size_t linkIndex, const void* linkPNext);
+	void GrowBlob(size_t requiredSize);
+	void RelocateLinks(const std::byte* oldBlobData);
+
+protected:
+	static constexpr size_t NoLink = (size_t)(-1);
+
+	std::vector<std::byte> StructureChainBlobData;
+
+	std::vector<size_t> LinkDataCapacities;
+	std::vector<size_t> PrevLinkIndices;
+	std::vector<size_t> NextLinkIndices;
+	std::vector<size_t> FreeLinkIndices;
+
+	size_t LastLinkIndex;
+};
+
+inline AnyStructureChainBlob::AnyStructureChainBlob(): LastLinkIndex(NoLink)
+{
+}
+
+inline AnyStructureChainBlob::AnyStructureChainBlob(const GenericStructBase& head): LastLinkIndex(NoLink)
+{
+	InitChainHead(head.GetStructureData(), head.GetStructureSize(), head.GetSTypeOffset(), head.GetPNextOffset(), head.GetSType());
+}
+
+inline AnyStructureChainBlob::AnyStructureChainBlob(const AnyStructureChainBlob& rhs): GenericStructureChainBase(rhs), StructureChainBlobData(rhs.StructureChainBlobData), LinkDataCapacities(rhs.LinkDataCapacities), PrevLinkIndices(rhs.PrevLinkIndices), NextLinkIndices(rhs.NextLinkIndices), FreeLinkIndices(rhs.FreeLinkIndices), LastLinkIndex(rhs.LastLinkIndex)
+{
+	RelocateLinks(rhs.StructureChainBlobData.data());
+}
+
+inline AnyStructureChainBlob::~AnyStructureChainBlob()
+{
+}
+
+inline AnyStructureChainBlob& AnyStructureChainBlob::operator=(const AnyStructureChainBlob& rhs)
+{
+	if(this == &rhs)
+	{
+		return *this;
+	}
+
+	GenericStructureChainBase::operator=(rhs);
+
+	StructureChainBlobData = rhs.StructureChainBlobData;
+
+	LinkDataCapacities = rhs.LinkDataCapacities;
+	PrevLinkIndices	   = rhs.PrevLinkIndices;
+	NextLinkIndices	   = rhs.NextLinkIndices;
+	FreeLinkIndices	   = rhs.FreeLinkIndices;
+
+	LastLinkIndex = rhs.LastLinkIndex;
+
+	RelocateLinks(rhs.StructureChainBlobData.data());
+	return *this;
+}
+
+inline void AnyStructureChainBlob::Clear()
+{
+	assert(StructureDataPointers.size() > 0);
+
+	//The head is always the first in the blob, so it's enough to just drop everything after it
+	StructureChainBlobData.resize(LinkDataCapacities[0]);
+
+	StructureDataPointers.resize(1);
+	STypeOffsets.resize(1);
+	PNextPointerOffsets.resize(1);
+
+	LinkDataCapacities.resize(1);
+	PrevLinkIndices.resize(1);
+	NextLinkIndices.resize(1);
+	FreeLinkIndices.clear();
+
+	NextLinkIndices[0] = NoLink;
+	LastLinkIndex	   = 0;
+
+	SetLinkPNext(0, nullptr);
+
+	StructureDataIndices.Clear();
+	StructureDataIndices.AddIndex(GetLinkSType(0), 0);
+}
+
+template<typename Struct>
+inline void AnyStructureChainBlob::AppendToChain(const Struct& next)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	size_t linkIndex = AddLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	LinkAfter(LastLinkIndex, linkIndex, next.pNext);
+}
+
+inline void AnyStructureChainBlob::AppendToChainGeneric(const GenericStructBase& nextBlobData)
+{
+	const void* nextPNext = nextBlobData.GetPNext();
+
+	size_t linkIndex = AddLinkData(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+	LinkAfter(LastLinkIndex, linkIndex, nextPNext);
+}
+
+template<typename AnchorStruct, typename Struct>
+inline void AnyStructureChainBlob::InsertAfter(const Struct& next, size_t anchorOccurrence)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	size_t anchorLinkIndex = StructureDataIndices.GetIndex(ValidStructureType<AnchorStruct>, anchorOccurrence);
+
+	size_t linkIndex = AddLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	LinkAfter(anchorLinkIndex, linkIndex, next.pNext);
+}
+
+template<typename AnchorStruct>
+inline void AnyStructureChainBlob::InsertAfterGeneric(const GenericStructBase& nextBlobData, size_t anchorOccurrence)
+{
+	size_t anchorLinkIndex = StructureDataIndices.GetIndex(ValidStructureType<AnchorStruct>, anchorOccurrence);
+
+	const void* nextPNext = nextBlobData.GetPNext();
+
+	size_t linkIndex = AddLinkData(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+	LinkAfter(anchorLinkIndex, linkIndex, nextPNext);
+}
+
+template<typename Struct>
+inline void AnyStructureChainBlob::Remove(size_t occurrence)
+{
+	RemoveLink(ValidStructureType<Struct>, occurrence);
+}
+
+template<typename Struct>
+inline void AnyStructureChainBlob::Upsert(const Struct& value)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	UpsertLinkData((const std::byte*)(&value), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+}
+
+template<typename Struct, typename... Args>
+inline LinkHandle<Struct> AnyStructureChainBlob::Emplace(Args&&... args)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	size_t linkIndex = AllocateLink(sizeof(Struct));
+	new(StructureDataPointers[linkIndex]) Struct{std::forward<Args>(args)...};
+
+	InitEmplacedLink(linkIndex, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	return LinkHandle<Struct>(StructureDataPointers.GetPointers(), linkIndex);
+}
+
+inline AnyStructureChainBlob AnyStructureChainBlob::Linearize(const void* head)
+{
+	AnyStructureChainBlob linearizedChain;
+	linearizedChain.LinearizeChain(head);
+
+	return linearizedChain;
+}
+
+inline AnyStructureChainBlob AnyStructureChainBlob::Linearize(const GenericStructureChainBase& chain)
+{
+	return Linearize(chain.GetChainHeadData());
+}
+
+inline void AnyStructureChainBlob::LinearizeChain(const void* head)
+{
+	assert(head != nullptr);
+	assert(StructureDataPointers.size() == 0);
+
+	VulkanStructureType headSType = GetChainLinkSType(head);
+	size_t				headSize  = GetSTypeStructureSize(headSType);
+	assert(headSize != 0);
+
+	//Measure the chain first, so everything is allocated only once
+	size_t blobSize  = headSize;
+	size_t linkCount = 1;
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize != 0)
+		{
+			blobSize = ((blobSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1)) + linkSize;
+			linkCount++;
+		}
+	}
+
+	StructureChainBlobData.reserve(blobSize);
+
+	StructureDataPointers.reserve(linkCount);
+	STypeOffsets.reserve(linkCount);
+	PNextPointerOffsets.reserve(linkCount);
+	LinkDataCapacities.reserve(linkCount);
+	PrevLinkIndices.reserve(linkCount);
+	NextLinkIndices.reserve(linkCount);
+
+	InitChainHead((const std::byte*)head, headSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), headSType);
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		VulkanStructureType linkSType = GetChainLinkSType(link);
+		size_t				linkSize  = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		size_t linkIndex = AddLinkData((const std::byte*)link, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), linkSType);
+		LinkAfter(LastLinkIndex, linkIndex, nullptr);
+	}
+}
+
+inline void AnyStructureChainBlob::InitChainHead(const std::byte* headData, size_t headSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType)
+{
+	//Store head in the blob
+	StructureChainBlobData.resize(headSize);
+	memcpy(StructureChainBlobData.data(), headData, headSize);
+
+	StructureDataPointers.push_back(StructureChainBlobData.data());
+	STypeOffsets.push_back(sTypeOffset);
+	PNextPointerOffsets.push_back(pNextOffset);
+
+	LinkDataCapacities.push_back(headSize);
+	PrevLinkIndices.push_back(NoLink);
+	NextLinkIndices.push_back(NoLink);
+
+	LastLinkIndex = 0;
+
+	InitSType(StructureDataPointers.back(), sTypeOffset, sType);
+	SetLinkPNext(0, nullptr);
+
+	StructureDataIndices.AddIndex(sType, 0);
+}
+
+inline size_t AnyStructureChainBlob::AllocateLink(size_t dataSize)
+{
+	//Most recently removed links are the most likely to be re-added, so in an edit loop the first one checked fits
+	for(size_t i = FreeLinkIndices.size(); i > 0; i--)
+	{
+		size_t freeLinkIndex = FreeLinkIndices[i - 1];
+		if(LinkDataCapacities[freeLinkIndex] >= dataSize)
+		{
+			//The order of the free links doesn't matter, swap-and-pop
+			FreeLinkIndices[i - 1] = FreeLinkIndices.back();
+			FreeLinkIndices.pop_back();
+			return freeLinkIndex;
+		}
+	}
+
+	size_t linkDataOffset = (StructureChainBlobData.size() + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+	GrowBlob(linkDataOffset + dataSize);
+
+	StructureDataPointers.push_back(StructureChainBlobData.data() + linkDataOffset);
+	STypeOffsets.push_back(0);
+	PNextPointerOffsets.push_back(0);
+
+	LinkDataCapacities.push_back(dataSize);
+	PrevLinkIndices.push_back(NoLink);
+	NextLinkIndices.push_back(NoLink);
+
+	return StructureDataPointers.size() - 1;
+}
+
+inline size_t AnyStructureChainBlob::AddLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	//The data can be a part of this very blob, which can get reallocated
+	const std::byte* blobBegin = StructureChainBlobData.data();
+	const std::byte* blobEnd   = StructureChainBlobData.data() + StructureChainBlobData.size();
+
+	ptrdiff_t dataOffsetInBlob = -1;
+	if(data >= blobBegin && data < blobEnd)
+	{
+		dataOffsetInBlob = data - blobBegin;
+	}
+
+	size_t linkIndex = AllocateLink(dataSize);
+	if(dataOffsetInBlob >= 0)
+	{
+		data = StructureChainBlobData.data() + dataOffsetInBlob;
+	}
+
+	memmove(StructureDataPointers[linkIndex], data, dataSize);
+
+	STypeOffsets[linkIndex]		   = dataSTypeOffset;
+	PNextPointerOffsets[linkIndex] = dataPNextOffset;
+
+	InitSType(StructureDataPointers[linkIndex], dataSTypeOffset, sType);
+
+	StructureDataIndices.AddIndex(sType, linkIndex);
+	return linkIndex;
+}
+
+inline void AnyStructureChainBlob::InitEmplacedLink(size_t linkIndex, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	STypeOffsets[linkIndex]		   = dataSTypeOffset;
+	PNextPointerOffsets[linkIndex] = dataPNextOffset;
+
+	InitSType(StructureDataPointers[linkIndex], dataSTypeOffset, sType);
+
+	StructureDataIndices.AddIndex(sType, linkIndex);
+	LinkAfter(LastLinkIndex, linkIndex, GetLinkPNext(linkIndex));
+}
+
+inline void AnyStructureChainBlob::RemoveLink(VulkanStructureType sType, size_t occurrence)
+{
+	RemoveLinkAt(StructureDataIndices.GetIndex(sType, occurrence));
+}
+
+inline void AnyStructureChainBlob::RemoveLinkAt(size_t linkIndex)
+{
+	assert(linkIndex != 0); //Head cannot be removed
+
+	VulkanStructureType sType = GetLinkSType(linkIndex);
+
+	size_t prevLinkIndex = PrevLinkIndices[linkIndex];
+	size_t nextLinkIndex = NextLinkIndices[linkIndex];
+
+	//The removed structure's pNext is either the next link or whatever the user specified for the last structure
+	SetLinkPNext(prevLinkIndex, GetLinkPNext(linkIndex));
+
+	NextLinkIndices[prevLinkIndex] = nextLinkIndex;
+	if(nextLinkIndex != NoLink)
+	{
+		PrevLinkIndices[nextLinkIndex] = prevLinkIndex;
+	}
+	else
+	{
+		LastLinkIndex = prevLinkIndex;
+	}
+
+	PrevLinkIndices[linkIndex] = NoLink;
+	NextLinkIndices[linkIndex] = NoLink;
+
+	StructureDataIndices.RemoveIndex(sType, linkIndex);
+	FreeLinkIndices.push_back(linkIndex);
+}
+
+inline void AnyStructureChainBlob::UpsertLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	if(StructureDataIndices.GetCount(sType) == 0)
+	{
+		const void* dataPNext = nullptr;
+		memcpy(&dataPNext, data + dataPNextOffset, sizeof(void*));
+
+		size_t linkIndex = AddLinkData(data, dataSize, dataSTypeOffset, dataPNextOffset, sType);
+		LinkAfter(LastLinkIndex, linkIndex, dataPNext);
+		return;
+	}
+
+	size_t linkIndex = StructureDataIndices.GetIndex(sType, 0);
+	assert(LinkDataCapacities[linkIndex] >= dataSize);
+
+	void* linkPNext = GetLinkPNext(linkIndex);
+	memmove(StructureDataPointers[linkIndex], data, dataSize);
+
+	InitSType(StructureDataPointers[linkIndex], dataSTypeOffset, sType);
+	SetLinkPNext(linkIndex, linkPNext);
+}
+
+inline void AnyStructureChainBlob::LinkAfter(size_t prevLinkIndex, size_t linkIndex, const void* linkPNext)
+{
+	size_t nextLinkIndex = NextLinkIndices[prevLinkIndex];
+
+	PrevLinkIndices[linkIndex]	   = prevLinkIndex;
+	NextLinkIndices[linkIndex]	   = nextLinkIndex;
+	NextLinkIndices[prevLinkIndex] = linkIndex;
+
+	if(nextLinkIndex != NoLink)
+	{
+		PrevLinkIndices[nextLinkIndex] = linkIndex;
+		SetLinkPNext(linkIndex, StructureDataPointers[nextLinkIndex]);
+	}
+	else
+	{
+		//The last pNext can point to whatever the user specified
+		SetLinkPNext(linkIndex, linkPNext);
+		LastLinkIndex = linkIndex;
+	}
+
+	SetLinkPNext(prevLinkIndex, StructureDataPointers[linkIndex]);
+}
+
+inline void AnyStructureChainBlob::GrowBlob(size_t requiredSize)
+{
+	if(requiredSize > StructureChainBlobData.capacity())
+	{
+		size_t doubledCapacity = StructureChainBlobData.capacity() * 2;
+
+		//Moved-from vector is guaranteed to be empty
+		std::vector<std::byte> oldStructureChainData = std::move(StructureChainBlobData);
+
+		StructureChainBlobData.reserve(requiredSize > doubledCapacity ? requiredSize : doubledCapacity);
+		StructureChainBlobData.resize(oldStructureChainData.size());
+
+		memcpy(StructureChainBlobData.data(), oldStructureChainData.data(), oldStructureChainData.size());
+		RelocateLinks(oldStructureChainData.data());
+	}
+
+	//Never reallocates after the check above
+	StructureChainBlobData.resize(requiredSize);
+}
+
+inline void AnyStructureChainBlob::RelocateLinks(const std::byte* oldBlobData)
+{
+	//Link pointers serve as the relocation table: each one is an offset from the blob start. Rebase all of them, including the free ones
+	std::byte* newBlobData = StructureChainBlobData.data();
+	for(size_t i = 0; i < StructureDataPointers.size(); i++)
+	{
+		StructureDataPointers[i] = newBlobData + (StructureDataPointers[i] - oldBlobData);
+	}
+
+	//Point pNext of every linked structure to the relocated next one. pNext of the last structure is left as is, it can point to whatever the user specified
+	for(size_t linkIndex = 0; linkIndex < NextLinkIndices.size(); linkIndex++)
+	{
+		if(NextLinkIndices[linkIndex] != NoLink)
+		{
+			SetLinkPNext(linkIndex, StructureDataPointers[NextLinkIndices[linkIndex]]);
+		}
+	}
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, owning version
+template<typename HeadType> 
+class StructureChainBlob: public AnyStructureChainBlob
+{
+public:
+	StructureChainBlob();
+	StructureChainBlob(const HeadType& head);
+	~StructureChainBlob();
+
+	StructureChainBlob(const StructureChainBlob& rhs)			 = default;
+	StructureChainBlob& operator=(const StructureChainBlob& rhs) = default;
+
+	StructureChainBlob(StructureChainBlob&& rhs)			= default;
+	StructureChainBlob& operator=(StructureChainBlob&& rhs) = default;
+
+	HeadType& GetChainHead();
+
+	//Same as AnyStructureChainBlob::Linearize, the head has to be of the type HeadType
+	static StructureChainBlob Linearize(const void* head);
+	static StructureChainBlob Linearize(const GenericStructureChainBase& chain);
+
+	//Same as AnyStructureChainBlob::Deserialize, also returns false if the head is not of the type HeadType
+	static bool Deserialize(const void* serializedData, size_t serializedSize, StructureChainBlob& outChain);
+
+private:
+	explicit StructureChainBlob(AnyStructureChainBlob&& linearizedChain);
+};
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::StructureChainBlob()
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+
+	HeadType head = HeadType();
+	InitChainHead((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::StructureChainBlob(const HeadType& head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+
+	InitChainHead((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::StructureChainBlob(AnyStructureChainBlob&& linearizedChain): AnyStructureChainBlob(std::move(linearizedChain))
+{
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::~StructureChainBlob()
+{
+}
+
+template<typename HeadType>
+inline HeadType& StructureChainBlob<HeadType>::GetChainHead()
+{
+	return GetChainHeadAs<HeadType>();
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType> StructureChainBlob<HeadType>::Linearize(const void* head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+	assert(GetChainLinkSType(head) == ValidStructureType<HeadType>);
+
+	return StructureChainBlob(AnyStructureChainBlob::Linearize(head));
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType> StructureChainBlob<HeadType>::Linearize(const GenericStructureChainBase& chain)
+{
+	return Linearize(chain.GetChainHeadData());
+}
+
+//==========================================================================================================================
+
+//Thread-safe table of unique chains. Equal chains (see CompareChains) are stored only once, as shared immutable blobs
+//The table is split into shards with separate reader-writer locks, so the threads rarely wait for each other
+class ChainInternTable
+{
+public:
+	ChainInternTable();
+	~ChainInternTable();
+
+	//Returns the shared copy of the chain. Equal chains always give the same pointer, which can serve as the identity of the chain contents
+	//The links with unknown sType are not copied, so they are ignored when looking for an equal chain too
+	std::shared_ptr<const AnyStructureChainBlob> Intern(const void* head);
+	std::shared_ptr<const AnyStructureChainBlob> Intern(const GenericStructureChainBase& chain);
+
+	//Removes the chains that are not referenced outside the table. Returns the number of the removed chains
+	size_t Purge();
+
+	size_t GetChainCount() const;
+
+public:
+	ChainInternTable(const ChainInternTable& rhs)			 = delete;
+	ChainInternTable& operator=(const ChainInternTable& rhs) = delete;
+
+private:
+	using ChainMap = std::unordered_multimap<uint64_t, std::shared_ptr<const AnyStructureChainBlob>>;
+
+	struct Shard
+	{
+		mutable std::shared_mutex Mutex;
+
+		ChainMap Chains;
+	};
+
+	std::shared_ptr<const AnyStructureChainBlob> FindChain(const Shard& shard, const void* head, uint64_t chainHash) const;
+
+private:
+	static constexpr size_t ShardCount = 16;
+
+	Shard Shards[ShardCount];
+};
+
+inline ChainInternTable::ChainInternTable()
+{
+}
+
+inline ChainInternTable::~ChainInternTable()
+{
+}
+
+inline std::shared_ptr<const AnyStructureChainBlob> ChainInternTable::Intern(const void* head)
+{
+	uint64_t chainHash = HashChain(head, true);
+
+	//The lower bits are used by the shard hash map
+	Shard& shard = Shards[(chainHash >> 32) % ShardCount];
+
+	{
+		std::shared_lock<std::shared_mutex> readLock(shard.Mutex);
+
+		std::shared_ptr<const AnyStructureChainBlob> existingChain = FindChain(shard, head, chainHash);
+		if(existingChain != nullptr)
+		{
+			return existingChain;
+		}
+	}
+
+	//Copy the chain outside of the lock
+	std::shared_ptr<const AnyStructureChainBlob> newChain = std::make_shared<const AnyStructureChainBlob>(AnyStructureChainBlob::Linearize(head));
+
+	std::unique_lock<std::shared_mutex> writeLock(shard.Mutex);
+
+	//Another thread could have added the same chain in the meantime
+	std::shared_ptr<const AnyStructureChainBlob> existingChain = FindChain(shard, head, chainHash);
+	if(existingChain != nullptr)
+	{
+		return existingChain;
+	}
+
+	shard.Chains.emplace(chainHash, newChain);
+	return newChain;
+}
+
+inline std::shared_ptr<const AnyStructureChainBlob> ChainInternTable::Intern(const GenericStructureChainBase& chain)
+{
+	return Intern(chain.GetChainHeadData());
+}
+
+inline size_t ChainInternTable::Purge()
+{
+	size_t removedCount = 0;
+	for(size_t i = 0; i < ShardCount; i++)
+	{
+		std::unique_lock<std::shared_mutex> writeLock(Shards[i].Mutex);
+
+		//The references can only be added under the lock, so use_count() can be trusted here
+		ChainMap::iterator chainIt = Shards[i].Chains.begin();
+		while(chainIt != Shards[i].Chains.end())
+		{
+			if(chainIt->second.use_count() == 1)
+			{
+				chainIt = Shards[i].Chains.erase(chainIt);
+				removedCount++;
+			}
+			else
+			{
+				++chainIt;
+			}
+		}
+	}
+
+	return removedCount;
+}
+
+inline size_t ChainInternTable::GetChainCount() const
+{
+	size_t chainCount = 0;
+	for(size_t i = 0; i < ShardCount; i++)
+	{
+		std::shared_lock<std::shared_mutex> readLock(Shards[i].Mutex);
+		chainCount += Shards[i].Chains.size();
+	}
+
+	return chainCount;
+}
+
+inline std::shared_ptr<const AnyStructureChainBlob> ChainInternTable::FindChain(const Shard& shard, const void* head, uint64_t chainHash) const
+{
+	std::pair<ChainMap::const_iterator, ChainMap::const_iterator> chainRange = shard.Chains.equal_range(chainHash);
+	for(ChainMap::const_iterator chainIt = chainRange.first; chainIt != chainRange.second; ++chainIt)
+	{
+		if(CompareChains(chainIt->second->GetChainHeadData(), head, true))
+		{
+			return chainIt->second;
+		}
+	}
+
+	return nullptr;
+}
+
+//==========================================================================================================================
+
+//Immutable structure chain, tightly packed into a single exact-size blob. Made by StructureChainBuilder::Bake()
+//Has no mutable state at all, so it can be shared across threads without locks. The last pNext is always null
+class BakedStructureChain
+{
+public:
+	//Creates an empty chain without a head. Only useful as a placeholder to move another chain into
+	BakedStructureChain();
+	~BakedStructureChain();
+
+	BakedStructureChain(BakedStructureChain&& rhs)			  = default;
+	BakedStructureChain& operator=(BakedStructureChain&& rhs) = default;
+
+	const void*			GetChainHeadData()  const;
+	VulkanStructureType GetChainHeadSType() const;
+	size_t				GetChainDataSize()  const;
+
+	template<typename HeadType>
+	const HeadType& GetChainHeadAs() const;
+
+	//Both walk the chain, since the baked chain has no index map
+	template<typename Struct>
+	const Struct& GetChainLinkDataAs(size_t occurrence = 0) const;
+
+	template<typename Struct>
+	size_t CountOf() const;
+
+public:
+	BakedStructureChain(const BakedStructureChain& rhs)			   = delete;
+	BakedStructureChain& operator=(const BakedStructureChain& rhs) = delete;
+
+private:
+	template<typename HeadType>
+	friend class StructureChainBuilder;
+
+	BakedStructureChain(std::vector<std::byte>&& chainData);
+
+private:
+	std::vector<std::byte> ChainData;
+};
+
+//Append-only structure chain builder. Appending only copies the structure, all pNext pointers are set at once in Bake()
+template<typename HeadType>
+class StructureChainBuilder
+{
+public:
+	StructureChainBuilder();
+	StructureChainBuilder(const HeadType& head);
+	~StructureChainBuilder();
+
+	//The reference is invalidated by appending
+	HeadType& GetChainHead();
+
+	//Clears everything EXCEPT head
+	void Clear();
+
+	template<typename Struct>
+	void AppendToChain(const Struct& next);
+
+	void AppendToChainGeneric(const GenericStructBase& nextBlobData);
+
+	BakedStructureChain Bake() const;
+
+private:
+	void AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+
+private:
+	std::vector<std::byte> ChainData;
+	std::vector<size_t>	   LinkOffsets;
+	std::vector<ptrdiff_t> PNextPointerOffsets;
+};
+
+inline BakedStructureChain::BakedStructureChain()
+{
+}
+
+inline BakedStructureChain::BakedStructureChain(std::vector<std::byte>&& chainData): ChainData(std::move(chainData))
+{
+}
+
+inline BakedStructureChain::~BakedStructureChain()
+{
+}
+
+inline const void* BakedStructureChain::GetChainHeadData() const
+{
+	assert(ChainData.size() > 0);
+
+	return ChainData.data();
+}
+
+inline VulkanStructureType BakedStructureChain::GetChainHeadSType() const
+{
+	return GetChainLinkSType(GetChainHeadData());
+}
+
+inline size_t BakedStructureChain::GetChainDataSize() const
+{
+	return ChainData.size();
+}
+
+template<typename HeadType>
+inline const HeadType& BakedStructureChain::GetChainHeadAs() const
+{
+	assert(GetChainHeadSType() == ValidStructureType<HeadType>);
+
+	const HeadType* head = reinterpret_cast<const HeadType*>(GetChainHeadData());
+	return *head;
+}
+
+template<typename Struct>
+inline const Struct& BakedStructureChain::GetChainLinkDataAs(size_t occurrence) const
+{
+	const void* link = GetChainHeadData();
+	while(link != nullptr)
+	{
+		if(GetChainLinkSType(link) == ValidStructureType<Struct> && occurrence-- == 0)
+		{
+			break;
+		}
+
+		link = GetChainLinkPNext(link);
+	}
+
+	assert(link != nullptr);
+
+	const Struct* structPtr = reinterpret_cast<const Struct*>(link);
+	return *structPtr;
+}
+
+template<typename Struct>
+inline size_t BakedStructureChain::CountOf() const
+{
+	size_t count = 0;
+	for(const void* link = GetChainHeadData(); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(GetChainLinkSType(link) == ValidStructureType<Struct>)
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
+
+template<typename HeadType>
+inline StructureChainBuilder<HeadType>::StructureChainBuilder()
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain builder must be trivially destructible");
+
+	HeadType head = HeadType();
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBuilder<HeadType>::StructureChainBuilder(const HeadType& head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain builder must be trivially destructible");
+
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBuilder<HeadType>::~StructureChainBuilder()
+{
+}
+
+template<typename HeadType>
+inline HeadType& StructureChainBuilder<HeadType>::GetChainHead()
+{
+	HeadType* head = reinterpret_cast<HeadType*>(ChainData.data());
+	return *head;
+}
+
+template<typename HeadType>
+inline void StructureChainBuilder<HeadType>::Clear()
+{
+	//Head is always the first one
+	ChainData.resize(sizeof(HeadType));
+	LinkOffsets.resize(1);
+	PNextPointerOffsets.resize(1);
+}
+
+template<typename HeadType>
+template<typename Struct>
+inline void StructureChainBuilder<HeadType>::AppendToChain(const Struct& next)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain builder must be trivially destructible");
+
+	AppendLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+}
+
+template<typename HeadType>
+inline void StructureChainBuilder<HeadType>::AppendToChainGeneric(const GenericStructBase& nextBlobData)
+{
+	AppendLinkData(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+}
+
+template<typename HeadType>
+inline BakedStructureChain StructureChainBuilder<HeadType>::Bake() const
+{
+	//The builder data is already packed, only the pNext pointers are missing
+	std::vector<std::byte> bakedData(ChainData.begin(), ChainData.end());
+	for(size_t i = 0; i < LinkOffsets.size(); i++)
+	{
+		const void* pNext = nullptr;
+		if(i + 1 < LinkOffsets.size())
+		{
+			pNext = bakedData.data() + LinkOffsets[i + 1];
+		}
+
+		memcpy(bakedData.data() + LinkOffsets[i] + PNextPointerOffsets[i], &pNext, sizeof(void*));
+	}
+
+	return BakedStructureChain(std::move(bakedData));
+}
+
+template<typename HeadType>
+inline void StructureChainBuilder<HeadType>::AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	size_t linkDataOffset = (ChainData.size() + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+	ChainData.resize(linkDataOffset + dataSize);
+	memcpy(ChainData.data() + linkDataOffset, data, dataSize);
+
+	InitSType(ChainData.data() + linkDataOffset, dataSTypeOffset, sType);
+
+	LinkOffsets.push_back(linkDataOffset);
+	PNextPointerOffsets.push_back(dataPNextOffset);
+}
+
+//==========================================================================================================================
+
+//Typed location of a structure inside the instances of a chain template
+template<typename Struct>
+class ChainSlot
+{
+public:
+	ChainSlot();
+	ChainSlot(size_t dataOffset);
+	~ChainSlot();
+
+	size_t GetDataOffset() const;
+
+private:
+	size_t DataOffset;
+};
+
+//Chain template instance, living in the caller-provided memory. Doesn't own anything
+template<typename HeadType>
+class ChainInstance
+{
+public:
+	ChainInstance(std::byte* instanceData);
+	~ChainInstance();
+
+	HeadType& GetChainHead();
+
+	template<typename Struct>
+	Struct& GetSlotData(ChainSlot<Struct> slot);
+
+private:
+	std::byte* InstanceData;
+};
+
+//Structure chain that is made once and instantiated many times into caller-provided memory
+//Instantiation is a single memcpy plus the precomputed pNext relocation. The structures that change are accessed through slots
+template<typename HeadType>
+class ChainTemplate
+{
+public:
+	ChainTemplate();
+	ChainTemplate(const HeadType& head);
+	~ChainTemplate();
+
+	ChainSlot<HeadType> GetHeadSlot() const;
+
+	template<typename Struct>
+	ChainSlot<Struct> AppendToChain(const Struct& next);
+
+	//The memory for each instance has to be at least this big and aligned to ChainLinkDataAlignment
+	size_t GetInstanceSize() const;
+
+	ChainInstance<HeadType> Instantiate(void* instanceMemory) const;
+
+private:
+	size_t AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+
+private:
+	std::vector<std::byte> TemplateData;
+	std::vector<size_t>	   LinkOffsets;
+	std::vector<size_t>	   PNextFieldOffsets;
+};
+
+template<typename Struct>
+inline ChainSlot<Struct>::ChainSlot(): DataOffset(0)
+{
+}
+
+template<typename Struct>
+inline ChainSlot<Struct>::ChainSlot(size_t dataOffset): DataOffset(dataOffset)
+{
+}
+
+template<typename Struct>
+inline ChainSlot<Struct>::~ChainSlot()
+{
+}
+
+template<typename Struct>
+inline size_t ChainSlot<Struct>::GetDataOffset() const
+{
+	return DataOffset;
+}
+
+template<typename HeadType>
+inline ChainInstance<HeadType>::ChainInstance(std::byte* instanceData): InstanceData(instanceData)
+{
+}
+
+template<typename HeadType>
+inline ChainInstance<HeadType>::~ChainInstance()
+{
+}
+
+template<typename HeadType>
+inline HeadType& ChainInstance<HeadType>::GetChainHead()
+{
+	HeadType* head = reinterpret_cast<HeadType*>(InstanceData);
+	return *head;
+}
+
+template<typename HeadType>
+template<typename Struct>
+inline Struct& ChainInstance<HeadType>::GetSlotData(ChainSlot<Struct> slot)
+{
+	Struct* structPtr = reinterpret_cast<Struct*>(InstanceData + slot.GetDataOffset());
+	return *structPtr;
+}
+
+template<typename HeadType>
+inline ChainTemplate<HeadType>::ChainTemplate()
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the chain template must be trivially destructible");
+
+	HeadType head = HeadType();
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline ChainTemplate<HeadType>::ChainTemplate(const HeadType& head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the chain template must be trivially destructible");
+
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline ChainTemplate<HeadType>::~ChainTemplate()
+{
+}
+
+template<typename HeadType>
+inline ChainSlot<HeadType> ChainTemplate<HeadType>::GetHeadSlot() const
+{
+	return ChainSlot<HeadType>(0);
+}
+
+template<typename HeadType>
+template<typename Struct>
+inline ChainSlot<Struct> ChainTemplate<HeadType>::AppendToChain(const Struct& next)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the chain template must be trivially destructible");
+
+	size_t linkDataOffset = AppendLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	return ChainSlot<Struct>(linkDataOffset);
+}
+
+template<typename HeadType>
+inline size_t ChainTemplate<HeadType>::GetInstanceSize() const
+{
+	return TemplateData.size();
+}
+
+template<typename HeadType>
+inline ChainInstance<HeadType> ChainTemplate<HeadType>::Instantiate(void* instanceMemory) const
+{
+	assert(((uintptr_t)instanceMemory & (ChainLinkDataAlignment - 1)) == 0);
+
+	std::byte* instanceData = reinterpret_cast<std::byte*>(instanceMemory);
+	memcpy(instanceData, TemplateData.data(), TemplateData.size());
+
+	//All pNext pointers in the template are null, only the pointers between the links need to be set
+	for(size_t i = 1; i < LinkOffsets.size(); i++)
+	{
+		std::byte* linkData = instanceData + LinkOffsets[i];
+		memcpy(instanceData + PNextFieldOffsets[i - 1], &linkData, sizeof(void*));
+	}
+
+	return ChainInstance<HeadType>(instanceData);
+}
+
+template<typename HeadType>
+inline size_t ChainTemplate<HeadType>::AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	size_t linkDataOffset = (TemplateData.size() + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+	TemplateData.resize(linkDataOffset + dataSize);
+	memcpy(TemplateData.data() + linkDataOffset, data, dataSize);
+
+	const void* pNext = nullptr;
+	memcpy(TemplateData.data() + linkDataOffset + dataPNextOffset, &pNext, sizeof(void*));
+
+	InitSType(TemplateData.data() + linkDataOffset, dataSTypeOffset, sType);
+
+	LinkOffsets.push_back(linkDataOffset);
+	PNextFieldOffsets.push_back(linkDataOffset + dataPNextOffset);
+
+	return linkDataOffset;
+}
+
+//==========================================================================================================================
+
+//Number of elements the pointer member points to, read from the count member of the structure
+inline size_t GetPointerMemberElementCount(const std::byte* structureData, const PointerMemberLayout& pointerMember)
+{
+	uint64_t count = 1;
+	if(pointerMember.CountSize == sizeof(uint32_t))
+	{
+		uint32_t count32 = 0;
+		memcpy(&count32, structureData + pointerMember.CountOffset, sizeof(uint32_t));
+
+		count = count32;
+	}
+	else if(pointerMember.CountSize == sizeof(uint64_t))
+	{
+		memcpy(&count, structureData + pointerMember.CountOffset, sizeof(uint64_t));
+	}
+	else
+	{
+		return 1;
+	}
+
+	return (size_t)((count + pointerMember.CountAdd) / pointerMember.CountDivisor);
+}
+
+//Deep copy of a structure together with its pNext chain and all the data its pointer members point to, in a single exact-size blob
+//Pointer members are followed using the generated GetSTypePointerLayout table, the opaque ones (e.g. pUserData) are copied as is
+//Doesn't reference any outside memory, so it can be built on one thread and consumed on another
+class StructureTreeBlob
+{
+public:
+	//Creates an empty tree without a head. Only useful as a placeholder to copy or move another tree into
+	StructureTreeBlob();
+	explicit StructureTreeBlob(const void* head);
+	~StructureTreeBlob();
+
+	//Copying is a single blob copy plus relocation of the tree pointers, so all pointers of the copy point into the copy
+	StructureTreeBlob(const StructureTreeBlob& rhs);
+	StructureTreeBlob& operator=(const StructureTreeBlob& rhs);
+
+	//Moving keeps the blob in place, so all pointers stay valid
+	StructureTreeBlob(StructureTreeBlob&& rhs)			  = default;
+	StructureTreeBlob& operator=(StructureTreeBlob&& rhs) = default;
+
+	const void*			GetTreeHeadData()  const;
+	VulkanStructureType GetTreeHeadSType() const;
+	size_t				GetTreeDataSize()  const;
+
+	template<typename HeadType>
+	const HeadType& GetTreeHeadAs() const;
+
+	//Serializes the whole tree, see SerializeStructures()
+	std::vector<std::byte> Serialize() const;
+
+	//Loads the tree serialized with SerializeStructures(), deep or not. The data is copied once and the pointers are relocated in a single pass
+	//Returns false if the data is not a valid serialized tree
+	static bool Deserialize(const void* serializedData, size_t serializedSize, StructureTreeBlob& outTree);
+
+private:
+	void CopyTree(const void* head);
+	void RelocateTree(const std::byte* oldTreeData);
+
+	//Every copy function runs twice: first with null treeBase to only measure the tree, then to copy it into the allocated blob
+	static std::byte* AllocateTreeData(std::byte* treeBase, size_t& treeSize, size_t dataSize, size_t dataAlignment);
+
+	std::byte* CopyTreeArray(std::byte* treeBase, size_t& treeSize, const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool copyPNext);
+	std::byte* CopyTreeChain(std::byte* treeBase, size_t& treeSize, const void* chainLink);
+	std::byte* CopyTreePointer(std::byte* treeBase, size_t& treeSize, const std::byte* structureData, const PointerMemberLayout& pointerMember);
+	std::byte* CopyTreeString(std::byte* treeBase, size_t& treeSize, const char* string);
+
+	//Writes the pointer into the copied tree and remembers its place for relocation. Does nothing when only measuring
+	void WriteTreePointer(std::byte* treeBase, std::byte* pointerPlace, const void* pointer);
+
+private:
+	std::vector<std::byte> TreeData;
+	std::vector<size_t>	   TreePointerOffsets; //Offsets of all non-null pointers inside TreeData that point into TreeData
+};
+
+inline StructureTreeBlob::StructureTreeBlob()
+{
+}
+
+inline StructureTreeBlob::StructureTreeBlob(const void* head)
+{
+	CopyTree(head);
+}
+
+inline StructureTreeBlob::~StructureTreeBlob()
+{
+}
+
+inline StructureTreeBlob::StructureTreeBlob(const StructureTreeBlob& rhs)
+{
+	*this = rhs;
+}
+
+inline StructureTreeBlob& StructureTreeBlob::operator=(const StructureTreeBlob& rhs)
+{
+	if(this == &rhs)
+	{
+		return *this;
+	}
+
+	TreeData		   = rhs.TreeData;
+	TreePointerOffsets = rhs.TreePointerOffsets;
+
+	RelocateTree(rhs.TreeData.data());
+	return *this;
+}
+
+inline const void* StructureTreeBlob::GetTreeHeadData() const
+{
+	assert(TreeData.size() > 0);
+
+	return TreeData.data();
+}
+
+inline VulkanStructureType StructureTreeBlob::GetTreeHeadSType() const
+{
+	return GetChainLinkSType(GetTreeHeadData());
+}
+
+inline size_t StructureTreeBlob::GetTreeDataSize() const
+{
+	return TreeData.size();
+}
+
+template<typename HeadType>
+inline const HeadType& StructureTreeBlob::GetTreeHeadAs() const
+{
+	assert(GetTreeHeadSType() == ValidStructureType<HeadType>);
+
+	const HeadType* head = reinterpret_cast<const HeadType*>(GetTreeHeadData());
+	return *head;
+}
+
+inline void StructureTreeBlob::CopyTree(const void* head)
+{
+	VulkanStructureType headSType = GetChainLinkSType(head);
+
+	size_t headSize = GetSTypeStructureSize(headSType);
+	assert(headSize != 0);
+
+	const std::byte*			  headData	 = (const std::byte*)head;
+	const StructurePointerLayout* headLayout = GetSTypePointerLayout(headSType);
+
+	size_t treeSize = 0;
+	CopyTreeArray(nullptr, treeSize, headData, headSize, 1, headLayout, true);
+
+	TreeData.clear();
+	TreeData.resize(treeSize);
+	TreePointerOffsets.clear();
+
+	size_t copiedSize = 0;
+	CopyTreeArray(TreeData.data(), copiedSize, headData, headSize, 1, headLayout, true);
+
+	assert(copiedSize == treeSize);
+}
+
+inline void StructureTreeBlob::RelocateTree(const std::byte* oldTreeData)
+{
+	std::byte* newTreeData = TreeData.data();
+	for(size_t pointerOffset: TreePointerOffsets)
+	{
+		const std::byte* pointer = nullptr;
+		memcpy(&pointer, newTreeData + pointerOffset, sizeof(void*));
+
+		pointer = newTreeData + (pointer - oldTreeData);
+		memcpy(newTreeData + pointerOffset, &pointer, sizeof(void*));
+	}
+}
+
+inline std::byte* StructureTreeBlob::AllocateTreeData(std::byte* treeBase, size_t& treeSize, size_t dataSize, size_t dataAlignment)
+{
+	size_t dataOffset = (treeSize + dataAlignment - 1) & ~(dataAlignment - 1);
+	treeSize = dataOffset + dataSize;
+
+	if(treeBase == nullptr)
+	{
+		return nullptr;
+	}
+
+	return treeBase + dataOffset;
+}
+
+inline std::byte* StructureTreeBlob::CopyTreeArray(std::byte* treeBase, size_t& treeSize, const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool copyPNext)
+{
+	std::byte* arrayCopy = AllocateTreeData(treeBase, treeSize, elementSize * elementCount, ChainLinkDataAlignment);
+	if(arrayCopy != nullptr)
+	{
+		memcpy(arrayCopy, arrayData, elementSize * elementCount);
+	}
+
+	for(size_t i = 0; i < elementCount; i++)
+	{
+		const std::byte* elementData = arrayData + i * elementSize;
+		std::byte*		 elementCopy = (arrayCopy != nullptr) ? (arrayCopy + i * elementSize) : nullptr;
+
+		if(elementLayout != nullptr)
+		{
+			for(uint32_t j = 0; j < elementLayout->MemberCount; j++)
+			{
+				const PointerMemberLayout& pointerMember = elementLayout->Members[j];
+
+				std::byte* pointerCopy = CopyTreePointer(treeBase, treeSize, elementData, pointerMember);
+				if(elementCopy != nullptr)
+				{
+					WriteTreePointer(treeBase, elementCopy + pointerMember.Offset, pointerCopy);
+				}
+			}
+		}
+
+		if(copyPNext)
+		{
+			std::byte* chainCopy = CopyTreeChain(treeBase, treeSize, GetChainLinkPNext(elementData));
+			if(elementCopy != nullptr)
+			{
+				WriteTreePointer(treeBase, elementCopy + offsetof(VkBaseInStructure, pNext), chainCopy);
+			}
+		}
+	}
+
+	return arrayCopy;
+}
+
+inline std::byte* StructureTreeBlob::CopyTreeChain(std::byte* treeBase, size_t& treeSize, const void* chainLink)
+{
+	std::byte* firstLinkCopy = nullptr;
+	std::byte* prevLinkCopy  = nullptr;
+
+	//Links with unknown sType are skipped, same as in AnyStructureChainBlob::Linearize()
+	for(const void* link = chainLink; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		VulkanStructureType linkSType = GetChainLinkSType(link);
+
+		size_t linkSize = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		std::byte* linkCopy = CopyTreeArray(treeBase, treeSize, (const std::byte*)link, linkSize, 1, GetSTypePointerLayout(linkSType), false);
+		if(linkCopy != nullptr)
+		{
+			if(prevLinkCopy != nullptr)
+			{
+				WriteTreePointer(treeBase, prevLinkCopy + offsetof(VkBaseInStructure, pNext), linkCopy);
+			}
+			else
+			{
+				firstLinkCopy = linkCopy;
+			}
+
+			const void* pNext = nullptr;
+			memcpy(linkCopy + offsetof(VkBaseInStructure, pNext), &pNext, sizeof(void*));
+		}
+
+		prevLinkCopy = linkCopy;
+	}
+
+	return firstLinkCopy;
+}
+
+inline std::byte* StructureTreeBlob::CopyTreePointer(std::byte* treeBase, size_t& treeSize, const std::byte* structureData, const PointerMemberLayout& pointerMember)
+{
+	const std::byte* pointerData = nullptr;
+	memcpy(&pointerData, structureData + pointerMember.Offset, sizeof(void*));
+
+	if(pointerData == nullptr)
+	{
+		return nullptr;
+	}
+
+	//The pointer is ignored by Vulkan if the count is 0, it's not copied
+	size_t elementCount = GetPointerMemberElementCount(structureData, pointerMember);
+	if(elementCount == 0)
+	{
+		return nullptr;
+	}
+
+	switch(pointerMember.Kind)
+	{
+	case PointerMemberKind::Array:
+	{
+		bool copyElementPNext = pointerMember.ElementLayout != nullptr && pointerMember.ElementLayout->HasPNext;
+		return CopyTreeArray(treeBase, treeSize, pointerData, pointerMember.ElementSize, elementCount, pointerMember.ElementLayout, copyElementPNext);
+	}
+	case PointerMemberKind::String:
+	{
+		return CopyTreeString(treeBase, treeSize, (const char*)pointerData);
+	}
+	case PointerMemberKind::StringArray:
+	{
+		std::byte* stringArrayCopy = AllocateTreeData(treeBase, treeSize, elementCount * sizeof(const char*), alignof(const char*));
+		for(size_t i = 0; i < elementCount; i++)
+		{
+			const char* string = nullptr;
+			memcpy(&string, pointerData + i * sizeof(const char*), sizeof(const char*));
+
+			std::byte* stringCopy = (string != nullptr) ? CopyTreeString(treeBase, treeSize, string) : nullptr;
+			if(stringArrayCopy != nullptr)
+			{
+				WriteTreePointer(treeBase, stringArrayCopy + i * sizeof(const char*), stringCopy);
+			}
+		}
+
+		return stringArrayCopy;
+	}
+	default:
+		return nullptr;
+	}
+}
+
+inline std::byte* StructureTreeBlob::CopyTreeString(std::byte* treeBase, size_t& treeSize, const char* string)
+{
+	size_t stringSize = strlen(string) + 1;
+
+	std::byte* stringCopy = AllocateTreeData(treeBase, treeSize, stringSize, alignof(char));
+	if(stringCopy != nullptr)
+	{
+		memcpy(stringCopy, string, stringSize);
+	}
+
+	return stringCopy;
+}
+
+inline void StructureTreeBlob::WriteTreePointer(std::byte* treeBase, std::byte* pointerPlace, const void* pointer)
+{
+	memcpy(pointerPlace, &pointer, sizeof(void*));
+	if(pointer != nullptr)
+	{
+		TreePointerOffsets.push_back(pointerPlace - treeBase);
+	}
+}
+
+//==========================================================================================================================
+
+//Canonical key of a structure tree: the structure, its pNext chain and all the data its pointer members point to
+//Trees that only differ in pointer values, padding or the order of pNext links get the same key
+struct StructureTreeKey
+{
+	uint64_t			   Hash[2];
+	std::vector<std::byte> KeyData; //Canonical serialized tree, only kept on request. Keys without it are compared by the 128-bit hash alone
+
+	bool operator==(const StructureTreeKey& rhs) const;
+	bool operator!=(const StructureTreeKey& rhs) const;
+};
+
+//Makes StructureTreeKey for structure trees, e.g. VkGraphicsPipelineCreateInfo for pipeline deduplication
+//The scratch memory is kept between the calls, so making a key doesn't allocate once the builder is warmed up. Not thread-safe, use one builder per thread
+class StructureTreeKeyBuilder
+{
+public:
+	StructureTreeKeyBuilder();
+	~StructureTreeKeyBuilder();
+
+	StructureTreeKey MakeKey(const void* head, bool keepKeyData = false);
+
+private:
+	//Returns the offset of the appended data. The key buffer only grows, so appending doesn't allocate once it's big enough
+	size_t AllocateKeyData(size_t dataSize);
+	void   AppendKeyData(const void* data, size_t dataSize);
+
+	//The pNext chains of chain links themselves are walked by AppendChain(), not appended recursively
+	void AppendStructureArray(const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, const StructureMemberRange* elementMemberRanges, size_t elementMemberRangeCount, bool hasPNext, bool appendChain);
+	void AppendChain(const void* chainLink);
+	void AppendPointer(const std::byte* structureData, const PointerMemberLayout& pointerMember);
+	void AppendString(const char* string);
+
+private:
+	std::vector<std::byte> KeyData;
+	size_t				   KeyDataSize;
+
+	//Serialized pNext links are sorted to make the key independent of the link order
+	std::vector<std::pair<size_t, size_t>> LinkSpans;
+	std::vector<std::byte>				   SortedLinkData;
+};
+
+inline bool StructureTreeKey::operator==(const StructureTreeKey& rhs) const
+{
+	if(Hash[0] != rhs.Hash[0] || Hash[1] != rhs.Hash[1])
+	{
+		return false;
+	}
+
+	if(KeyData.size() == 0 || rhs.KeyData.size() == 0)
+	{
+		return true;
+	}
+
+	return KeyData == rhs.KeyData;
+}
+
+inline bool StructureTreeKey::operator!=(const StructureTreeKey& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline StructureTreeKeyBuilder::StructureTreeKeyBuilder(): KeyDataSize(0)
+{
+}
+
+inline StructureTreeKeyBuilder::~StructureTreeKeyBuilder()
+{
+}
+
+inline StructureTreeKey StructureTreeKeyBuilder::MakeKey(const void* head, bool keepKeyData)
+{
+	KeyDataSize = 0;
+
+	//Same as a chain link with unknown sType, the head is only equal to itself
+	VulkanStructureType headSType = GetChainLinkSType(head);
+	size_t				headSize  = GetSTypeStructureSize(headSType);
+	if(headSize == 0)
+	{
+		AppendKeyData(&headSType, sizeof(VulkanStructureType));
+		AppendKeyData(&head, sizeof(void*));
+	}
+	else
+	{
+		AppendStructureArray((const std::byte*)head, headSize, 1, GetSTypePointerLayout(headSType), nullptr, 0, true, true);
+	}
+
+	StructureTreeKey key;
+	HashBytes128(KeyData.data(), KeyDataSize, key.Hash);
+
+	if(keepKeyData)
+	{
+		key.KeyData.assign(KeyData.begin(), KeyData.begin() + KeyDataSize);
+	}
+
+	return key;
+}
+
+inline size_t StructureTreeKeyBuilder::AllocateKeyData(size_t dataSize)
+{
+	size_t keyDataOffset = KeyDataSize;
+
+	KeyDataSize += dataSize;
+	if(KeyDataSize > KeyData.size())
+	{
+		KeyData.resize(KeyDataSize > 2 * KeyData.size() ? KeyDataSize : 2 * KeyData.size());
+	}
+
+	return keyDataOffset;
+}
+
+inline void StructureTreeKeyBuilder::AppendKeyData(const void* data, size_t dataSize)
+{
+	size_t keyDataOffset = AllocateKeyData(dataSize);
+	memcpy(KeyData.data() + keyDataOffset, data, dataSize);
+}
+
+inline void StructureTreeKeyBuilder::AppendStructureArray(const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, const StructureMemberRange* elementMemberRanges, size_t elementMemberRangeCount, bool hasPNext, bool appendChain)
+{
+	for(size_t i = 0; i < elementCount; i++)
+	{
+		const std::byte* elementData = arrayData + i * elementSize;
+
+		//Pointer values are replaced by the data they point to, appended right after the structure
+		size_t	   elementKeyOffset = AllocateKeyData(elementSize);
+		std::byte* elementKeyData = KeyData.data() + elementKeyOffset;
+		if(hasPNext)
+		{
+			CopyMaskedStructure(elementKeyData, elementData, elementSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+		}
+		else if(elementMemberRanges != nullptr)
+		{
+			CopyStructureMemberRanges(elementKeyData, elementData, elementSize, elementMemberRanges, elementMemberRangeCount);
+		}
+		else
+		{
+			memcpy(elementKeyData, elementData, elementSize);
+		}
+
+		if(elementLayout != nullptr)
+		{
+			for(uint32_t j = 0; j < elementLayout->MemberCount; j++)
+			{
+				memset(elementKeyData + elementLayout->Members[j].Offset, 0, sizeof(void*));
+			}
+
+			for(uint32_t j = 0; j < elementLayout->MemberCount; j++)
+			{
+				AppendPointer(elementData, elementLayout->Members[j]);
+			}
+		}
+
+		if(appendChain)
+		{
+			AppendChain(GetChainLinkPNext(elementData));
+		}
+	}
+}
+
+inline void StructureTreeKeyBuilder::AppendChain(const void* chainLink)
+{
+	size_t linkSpanBase = LinkSpans.size();
+
+	//The link count goes first, it's written after the chain is walked
+	uint64_t linkCount		 = 0;
+	size_t	 linkCountOffset = AllocateKeyData(sizeof(uint64_t));
+
+	size_t chainOffset = KeyDataSize;
+
+	for(const void* link = chainLink; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkKeyOffset = KeyDataSize;
+
+		//The contents of the links with unknown sType can't be read, such links are only equal to themselves
+		VulkanStructureType linkSType = GetChainLinkSType(link);
+		size_t				linkSize  = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			AppendKeyData(&linkSType, sizeof(VulkanStructureType));
+			AppendKeyData(&link, sizeof(void*));
+		}
+		else
+		{
+			AppendStructureArray((const std::byte*)link, linkSize, 1, GetSTypePointerLayout(linkSType), nullptr, 0, true, false);
+		}
+
+		LinkSpans.push_back(std::make_pair(linkKeyOffset, KeyDataSize - linkKeyOffset));
+	}
+
+	linkCount = LinkSpans.size() - linkSpanBase;
+	memcpy(KeyData.data() + linkCountOffset, &linkCount, sizeof(uint64_t));
+
+	if(linkCount > 1)
+	{
+		const std::byte* keyData = KeyData.data();
+		std::sort(LinkSpans.begin() + linkSpanBase, LinkSpans.end(), [keyData](const std::pair<size_t, size_t>& lhs, const std::pair<size_t, size_t>& rhs)
+		{
+			if(lhs.second != rhs.second)
+			{
+				return lhs.second < rhs.second;
+			}
+
+			return memcmp(keyData + lhs.first, keyData + rhs.first, lhs.second) < 0;
+		});
+
+		SortedLinkData.clear();
+		for(size_t i = linkSpanBase; i < LinkSpans.size(); i++)
+		{
+			SortedLinkData.insert(SortedLinkData.end(), KeyData.begin() + LinkSpans[i].first, KeyData.begin() + LinkSpans[i].first + LinkSpans[i].second);
+		}
+
+		memcpy(KeyData.data() + chainOffset, SortedLinkData.data(), SortedLinkData.size());
+	}
+
+	LinkSpans.resize(linkSpanBase);
+}
+
+inline void StructureTreeKeyBuilder::AppendPointer(const std::byte* structureData, const PointerMemberLayout& pointerMember)
+{
+	const std::byte* pointerData = nullptr;
+	memcpy(&pointerData, structureData + pointerMember.Offset, sizeof(void*));
+
+	//Null pointers and empty arrays are the same for Vulkan
+	uint64_t elementCount = (pointerData != nullptr) ? GetPointerMemberElementCount(structureData, pointerMember) : 0;
+	AppendKeyData(&elementCount, sizeof(uint64_t));
+
+	if(elementCount == 0)
+	{
+		return;
+	}
+
+	switch(pointerMember.Kind)
+	{
+	case PointerMemberKind::Array:
+	{
+		bool hasElementPNext = pointerMember.ElementLayout != nullptr && pointerMember.ElementLayout->HasPNext;
+		AppendStructureArray(pointerData, pointerMember.ElementSize, (size_t)elementCount, pointerMember.ElementLayout, pointerMember.ElementMemberRanges, pointerMember.ElementMemberRangeCount, hasElementPNext, hasElementPNext);
+		break;
+	}
+	case PointerMemberKind::String:
+	{
+		AppendString((const char*)pointerData);
+		break;
+	}
+	case PointerMemberKind::StringArray:
+	{
+		for(size_t i = 0; i < elementCount; i++)
+		{
+			const char* string = nullptr;
+			memcpy(&string, pointerData + i * sizeof(const char*), sizeof(const char*));
+
+			AppendString(string != nullptr ? string : "");
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+inline void StructureTreeKeyBuilder::AppendString(const char* string)
+{
+	uint64_t stringSize = strlen(string);
+
+	AppendKeyData(&stringSize, sizeof(uint64_t));
+	AppendKeyData(string, (size_t)stringSize);
+}
+
+//==========================================================================================================================
+
+//Flat binary form of a structure chain, optionally with all the data its pointer members point to (deep serialization)
+//The layout is: SerializedStructuresHeader, RecordCount records of the chain structures in the pNext order with the head first,
+//DataSize bytes of the structure data (padded to 8 bytes), RelocationCount uint64_t offsets of the pointers inside the structure data
+//Every relocated pointer is stored as the offset of its target in the structure data plus 1, null pointers are left as 0 and not relocated
+//Pointers that are not relocated (opaque ones like pUserData, or everything except pNext for non-deep serialization) are stored as is and zeroed when loading
+//The format depends on the pointer size and the byte order, the data made on a platform with different ones is rejected
+
+constexpr uint32_t SerializedStructuresMagic   = 0x53534756; //"VGSS"
+constexpr uint16_t SerializedStructuresVersion = 1;
+
+constexpr uint8_t SerializedStructuresDeepFlag		= 0x01;
+constexpr uint8_t SerializedStructuresRelocatedFlag = 0x02; //Set by LoadSerializedStructures(), the pointers are absolute
+
+struct SerializedStructuresHeader
+{
+	uint32_t Magic;
+	uint16_t Version;
+	uint8_t	 PointerSize;
+	uint8_t	 Flags;
+	uint32_t RecordCount;
+	uint32_t Reserved;
+	uint64_t DataSize;
+	uint64_t RelocationCount;
+};
+
+struct SerializedStructureRecord
+{
+	VulkanStructureType SType;
+	uint32_t			Size;
+	uint64_t			Offset; //From the start of the structure data, the head is always at 0
+};
+
+static_assert(sizeof(SerializedStructuresHeader) % ChainLinkDataAlignment == 0, "Structure data must stay aligned after the serialized header");
+static_assert(sizeof(SerializedStructureRecord)	 % ChainLinkDataAlignment == 0, "Structure data must stay aligned after the serialized records");
+
+//Serializes the pNext chain of head. With deep = true also serializes all the data its pointer members point to, same as StructureTreeBlob copies it
+//Links with unknown sType are skipped, the head has to be known
+std::vector<std::byte> SerializeStructures(const void* head, bool deep);
+
+//Zero-copy loading: relocates the pointers of the serialized data in place in a single pass, and returns the head structure right inside the data
+//Meant for memory-mapped files. Map the file copy-on-write (MAP_PRIVATE with PROT_WRITE, or FILE_MAP_COPY on Windows), so only the pages with pointers get copied
+//The data has to be aligned to ChainLinkDataAlignment and can only be loaded once. Returns null if the data is not valid
+const void* LoadSerializedStructures(void* serializedData, size_t serializedSize);
+
+inline size_t GetSerializedDataOffset(const SerializedStructuresHeader& header)
+{
+	return sizeof(SerializedStructuresHeader) + (size_t)header.RecordCount * sizeof(SerializedStructureRecord);
+}
+
+inline size_t GetSerializedRelocationsOffset(const SerializedStructuresHeader& header)
+{
+	return GetSerializedDataOffset(header) + (size_t)((header.DataSize + ChainLinkDataAlignment - 1) & ~(uint64_t)(ChainLinkDataAlignment - 1));
+}
+
+inline SerializedStructureRecord GetSerializedRecord(const std::byte* serializedData, size_t recordIndex)
+{
+	SerializedStructureRecord record;
+	memcpy(&record, serializedData + sizeof(SerializedStructuresHeader) + recordIndex * sizeof(SerializedStructureRecord), sizeof(SerializedStructureRecord));
+
+	return record;
+}
+
+//Checks everything but the pointers, which are checked by SerializedPointerValidator
+inline bool ReadSerializedHeader(const std::byte* serializedData, size_t serializedSize, SerializedStructuresHeader& outHeader)
+{
+	if(serializedData == nullptr || serializedSize < sizeof(SerializedStructuresHeader))
+	{
+		return false;
+	}
+
+	memcpy(&outHeader, serializedData, sizeof(SerializedStructuresHeader));
+	if(outHeader.Magic != SerializedStructuresMagic || outHeader.Version != SerializedStructuresVersion || outHeader.PointerSize != sizeof(void*) || outHeader.RecordCount == 0)
+	{
+		return false;
+	}
+
+	//All sizes are checked against the remaining size first, so nothing can overflow
+	size_t remainingSize = serializedSize - sizeof(SerializedStructuresHeader);
+	if(outHeader.RecordCount > remainingSize / sizeof(SerializedStructureRecord))
+	{
+		return false;
+	}
+
+	remainingSize -= (size_t)outHeader.RecordCount * sizeof(SerializedStructureRecord);
+	if(outHeader.DataSize > remainingSize)
+	{
+		return false;
+	}
+
+	size_t paddedDataSize = GetSerializedRelocationsOffset(outHeader) - GetSerializedDataOffset(outHeader);
+	if(paddedDataSize > remainingSize)
+	{
+		return false;
+	}
+
+	remainingSize -= paddedDataSize;
+	if(outHeader.RelocationCount > remainingSize / sizeof(uint64_t))
+	{
+		return false;
+	}
+
+	for(size_t i = 0; i < outHeader.RecordCount; i++)
+	{
+		SerializedStructureRecord record = GetSerializedRecord(serializedData, i);
+
+		size_t structureSize = GetSTypeStructureSize(record.SType);
+		if(structureSize == 0 || record.Size != structureSize || structureSize > outHeader.DataSize || record.Offset > outHeader.DataSize - structureSize)
+		{
+			return false;
+		}
+
+		if(record.Offset % ChainLinkDataAlignment != 0 || (i == 0 && record.Offset != 0))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//The read-only pass of the loading: walks the serialized structures from the records the same way StructureTreeBlob copies them, and checks every pointer before anything is written
+//Every relocation has to be a pointer the walk reaches, every relocated pNext of the records has to point to the next record, and every pointer without a relocation has to be null
+//The pointers the walk doesn't follow (opaque ones, or everything except pNext for non-deep data) are collected to be zeroed
+class SerializedPointerValidator
+{
+public:
+	SerializedPointerValidator(const std::byte* structureData, size_t dataSize, bool deep);
+	~SerializedPointerValidator();
+
+	//Fills outRelocatedOffsets with the offsets of the pointers to relocate and outClearedOffsets with the offsets of the pointers to zero
+	bool Validate(const std::byte* serializedData, const SerializedStructuresHeader& header, std::vector<size_t>& outRelocatedOffsets, std::vector<size_t>& outClearedOffsets);
+
+private:
+	bool ReadRelocations(const std::byte* relocationData, size_t relocationCount);
+
+	//Reads the pointer as stored: the target offset plus 1, or 0 for null. Every relocated pointer can be taken only once, so the walk can't loop
+	bool TakePointer(size_t pointerOffset, size_t& outStoredTarget);
+	bool ClearPointer(size_t pointerOffset);
+
+	bool ValidateArray(size_t arrayOffset, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool validatePNext);
+	bool ValidateStructure(size_t structureOffset, const StructurePointerLayout* layout);
+	bool ValidateChain(size_t pNextOffset);
+	bool ValidatePointer(size_t structureOffset, const PointerMemberLayout& pointerMember);
+	bool ValidateString(size_t stringOffset);
+
+private:
+	const std::byte* StructureData;
+	size_t			 DataSize;
+	bool			 Deep;
+
+	std::vector<size_t>	 RelocatedOffsets; //In the order of the relocations, so the loaded data serializes the same way
+	std::vector<size_t>	 SortedRelocatedOffsets;
+	std::vector<uint8_t> TakenRelocations;
+	size_t				 TakenRelocationCount;
+
+	std::vector<size_t> ClearedOffsets;
+};
+
+inline SerializedPointerValidator::SerializedPointerValidator(const std::byte* structureData, size_t dataSize, bool deep): StructureData(structureData), DataSize(dataSize), Deep(deep), TakenRelocationCount(0)
+{
+}
+
+inline SerializedPointerValidator::~SerializedPointerValidator()
+{
+}
+
+inline bool SerializedPointerValidator::Validate(const std::byte* serializedData, const SerializedStructuresHeader& header, std::vector<size_t>& outRelocatedOffsets, std::vector<size_t>& outClearedOffsets)
+{
+	if(!ReadRelocations(serializedData + GetSerializedRelocationsOffset(header), (size_t)header.RelocationCount))
+	{
+		return false;
+	}
+
+	for(size_t i = 0; i < header.RecordCount; i++)
+	{
+		SerializedStructureRecord record = GetSerializedRecord(serializedData, i);
+
+		VulkanStructureType structureSType;
+		memcpy(&structureSType, StructureData + record.Offset + offsetof(VkBaseInStructure, sType), sizeof(VulkanStructureType));
+
+		if(structureSType != record.SType || !ValidateStructure((size_t)record.Offset, GetSTypePointerLayout(record.SType)))
+		{
+			return false;
+		}
+
+		size_t storedPNext = 0;
+		if(!TakePointer((size_t)record.Offset + offsetof(VkBaseInStructure, pNext), storedPNext))
+		{
+			return false;
+		}
+
+		size_t expectedPNext = (i + 1 < header.RecordCount) ? (size_t)GetSerializedRecord(serializedData, i + 1).Offset + 1 : 0;
+		if(storedPNext != expectedPNext)
+		{
+			return false;
+		}
+	}
+
+	//A relocation the walk doesn't reach would write to the data that's not a pointer
+	if(TakenRelocationCount != RelocatedOffsets.size())
+	{
+		return false;
+	}
+
+	outRelocatedOffsets.swap(RelocatedOffsets);
+	outClearedOffsets.swap(ClearedOffsets);
+	return true;
+}
+
+inline bool SerializedPointerValidator::ReadRelocations(const std::byte* relocationData, size_t relocationCount)
+{
+	RelocatedOffsets.resize(relocationCount);
+	for(size_t i = 0; i < relocationCount; i++)
+	{
+		uint64_t pointerOffset = 0;
+		memcpy(&pointerOffset, relocationData + i * sizeof(uint64_t), sizeof(uint64_t));
+
+		if(DataSize < sizeof(void*) || pointerOffset > DataSize - sizeof(void*) || pointerOffset % alignof(void*) != 0)
+		{
+			return false;
+		}
+
+		uintptr_t storedTarget = 0;
+		memcpy(&storedTarget, StructureData + pointerOffset, sizeof(void*));
+
+		if(storedTarget == 0 || storedTarget > DataSize)
+		{
+			return false;
+		}
+
+		RelocatedOffsets[i] = (size_t)pointerOffset;
+	}
+
+	SortedRelocatedOffsets = RelocatedOffsets;
+	std::sort(SortedRelocatedOffsets.begin(), SortedRelocatedOffsets.end());
+
+	if(std::adjacent_find(SortedRelocatedOffsets.begin(), SortedRelocatedOffsets.end()) != SortedRelocatedOffsets.end())
+	{
+		return false;
+	}
+
+	TakenRelocations.assign(relocationCount, 0);
+	return true;
+}
+
+inline bool SerializedPointerValidator::TakePointer(size_t pointerOffset, size_t& outStoredTarget)
+{
+	uintptr_t storedTarget = 0;
+	memcpy(&storedTarget, StructureData + pointerOffset, sizeof(void*));
+
+	outStoredTarget = (size_t)storedTarget;
+	if(storedTarget == 0)
+	{
+		return true;
+	}
+
+	std::vector<size_t>::const_iterator relocationIt = std::lower_bound(SortedRelocatedOffsets.cbegin(), SortedRelocatedOffsets.cend(), pointerOffset);
+	if(relocationIt == SortedRelocatedOffsets.cend() || *relocationIt != pointerOffset)
+	{
+		return false;
+	}
+
+	size_t relocationIndex = relocationIt - SortedRelocatedOffsets.cbegin();
+	if(TakenRelocations[relocationIndex] != 0)
+	{
+		return false;
+	}
+
+	TakenRelocations[relocationIndex] = 1;
+	TakenRelocationCount++;
+	return true;
+}
+
+inline bool SerializedPointerValidator::ClearPointer(size_t pointerOffset)
+{
+	if(std::binary_search(SortedRelocatedOffsets.begin(), SortedRelocatedOffsets.end(), pointerOffset))
+	{
+		return false;
+	}
+
+	ClearedOffsets.push_back(pointerOffset);
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidateArray(size_t arrayOffset, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool validatePNext)
+{
+	for(size_t i = 0; i < elementCount; i++)
+	{
+		size_t elementOffset = arrayOffset + i * elementSize;
+		if(!ValidateStructure(elementOffset, elementLayout))
+		{
+			return false;
+		}
+
+		if(validatePNext && !ValidateChain(elementOffset + offsetof(VkBaseInStructure, pNext)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidateStructure(size_t structureOffset, const StructurePointerLayout* layout)
+{
+	if(layout == nullptr)
+	{
+		return true;
+	}
+
+	for(uint32_t i = 0; i < layout->MemberCount; i++)
+	{
+		const PointerMemberLayout& pointerMember = layout->Members[i];
+
+		bool pointerValid = Deep ? ValidatePointer(structureOffset, pointerMember) : ClearPointer(structureOffset + pointerMember.Offset);
+		if(!pointerValid)
+		{
+			return false;
+		}
+	}
+
+	for(uint32_t i = 0; i < layout->OpaquePointerCount; i++)
+	{
+		if(!ClearPointer(structureOffset + layout->OpaquePointerOffsets[i]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidateChain(size_t pNextOffset)
+{
+	size_t storedLink = 0;
+	if(!TakePointer(pNextOffset, storedLink))
+	{
+		return false;
+	}
+
+	while(storedLink != 0)
+	{
+		size_t linkOffset = storedLink - 1;
+		if(linkOffset % ChainLinkDataAlignment != 0 || DataSize - linkOffset < sizeof(VkBaseInStructure))
+		{
+			return false;
+		}
+
+		VulkanStructureType linkSType;
+		memcpy(&linkSType, StructureData + linkOffset + offsetof(VkBaseInStructure, sType), sizeof(VulkanStructureType));
+
+		size_t linkSize = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0 || linkSize > DataSize - linkOffset || !ValidateStructure(linkOffset, GetSTypePointerLayout(linkSType)))
+		{
+			return false;
+		}
+
+		if(!TakePointer(linkOffset + offsetof(VkBaseInStructure, pNext), storedLink))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidatePointer(size_t structureOffset, const PointerMemberLayout& pointerMember)
+{
+	size_t storedTarget = 0;
+	if(!TakePointer(structureOffset + pointerMember.Offset, storedTarget))
+	{
+		return false;
+	}
+
+	if(storedTarget == 0)
+	{
+		return true;
+	}
+
+	//Pointers with the count of 0 are never serialized
+	size_t elementCount = GetPointerMemberElementCount(StructureData + structureOffset, pointerMember);
+	if(elementCount == 0)
+	{
+		return false;
+	}
+
+	size_t targetOffset = storedTarget - 1;
+	switch(pointerMember.Kind)
+	{
+	case PointerMemberKind::Array:
+	{
+		if(targetOffset % ChainLinkDataAlignment != 0 || elementCount > (DataSize - targetOffset) / pointerMember.ElementSize)
+		{
+			return false;
+		}
+
+		bool validateElementPNext = pointerMember.ElementLayout != nullptr && pointerMember.ElementLayout->HasPNext;
+		return ValidateArray(targetOffset, pointerMember.ElementSize, elementCount, pointerMember.ElementLayout, validateElementPNext);
+	}
+	case PointerMemberKind::String:
+	{
+		return ValidateString(targetOffset);
+	}
+	case PointerMemberKind::StringArray:
+	{
+		if(targetOffset % alignof(const char*) != 0 || elementCount > (DataSize - targetOffset) / sizeof(const char*))
+		{
+			return false;
+		}
+
+		for(size_t i = 0; i < elementCount; i++)
+		{
+			size_t storedString = 0;
+			if(!TakePointer(targetOffset + i * sizeof(const char*), storedString))
+			{
+				return false;
+			}
+
+			if(storedString != 0 && !ValidateString(storedString - 1))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+inline bool SerializedPointerValidator::ValidateString(size_t stringOffset)
+{
+	return memchr(StructureData + stringOffset, 0, DataSize - stringOffset) != nullptr;
+}
+
+//The write pass of the loading, can't fail once SerializedPointerValidator has checked the data
+inline void RelocateSerializedPointers(std::byte* structureData, const std::vector<size_t>& relocatedOffsets, const std::vector<size_t>& clearedOffsets)
+{
+	for(size_t pointerOffset: relocatedOffsets)
+	{
+		uintptr_t storedTarget = 0;
+		memcpy(&storedTarget, structureData + pointerOffset, sizeof(void*));
+
+		const std::byte* pointer = structureData + (storedTarget - 1);
+		memcpy(structureData + pointerOffset, &pointer, sizeof(void*));
+	}
+
+	for(size_t pointerOffset: clearedOffsets)
+	{
+		memset(structureData + pointerOffset, 0, sizeof(void*));
+	}
+}
+
+//Serializes the structures of structureData, which has the head at the start and all pointers listed in pointerOffsets pointing inside it
+inline std::vector<std::byte> WriteSerializedStructures(const std::byte* structureData, size_t dataSize, const std::vector<size_t>& pointerOffsets, uint8_t flags)
+{
+	SerializedStructuresHeader header;
+	header.Magic		   = SerializedStructuresMagic;
+	header.Version		   = SerializedStructuresVersion;
+	header.PointerSize	   = sizeof(void*);
+	header.Flags		   = flags;
+	header.RecordCount	   = 0;
+	header.Reserved		   = 0;
+	header.DataSize		   = dataSize;
+	header.RelocationCount = pointerOffsets.size();
+
+	for(const void* link = structureData; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		header.RecordCount++;
+	}
+
+	size_t dataOffset		 = GetSerializedDataOffset(header);
+	size_t relocationsOffset = GetSerializedRelocationsOffset(header);
+
+	std::vector<std::byte> serializedData(relocationsOffset + pointerOffsets.size() * sizeof(uint64_t));
+	memcpy(serializedData.data(), &header, sizeof(SerializedStructuresHeader));
+
+	size_t recordIndex = 0;
+	for(const void* link = structureData; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		SerializedStructureRecord record;
+		record.SType  = GetChainLinkSType(link);
+		record.Size	  = (uint32_t)GetSTypeStructureSize(record.SType);
+		record.Offset = (const std::byte*)link - structureData;
+
+		memcpy(serializedData.data() + sizeof(SerializedStructuresHeader) + recordIndex * sizeof(SerializedStructureRecord), &record, sizeof(SerializedStructureRecord));
+		recordIndex++;
+	}
+
+	memcpy(serializedData.data() + dataOffset, structureData, dataSize);
+	for(size_t i = 0; i < pointerOffsets.size(); i++)
+	{
+		const std::byte* pointer = nullptr;
+		memcpy(&pointer, structureData + pointerOffsets[i], sizeof(void*));
+
+		assert(pointer >= structureData && pointer < structureData + dataSize);
+
+		uintptr_t targetOffset  = (uintptr_t)(pointer - structureData) + 1;
+		uint64_t  pointerOffset = pointerOffsets[i];
+
+		memcpy(serializedData.data() + dataOffset + pointerOffsets[i], &targetOffset, sizeof(void*));
+		memcpy(serializedData.data() + relocationsOffset + i * sizeof(uint64_t), &pointerOffset, sizeof(uint64_t));
+	}
+
+	return serializedData;
+}
+
+inline std::vector<std::byte> SerializeStructures(const void* head, bool deep)
+{
+	if(deep)
+	{
+		StructureTreeBlob structureTree(head);
+		return structureTree.Serialize();
+	}
+
+	VulkanStructureType headSType = GetChainLinkSType(head);
+	size_t				headSize  = GetSTypeStructureSize(headSType);
+	assert(headSize != 0);
+
+	//Measure the chain first, same as AnyStructureChainBlob::Linearize()
+	size_t dataSize  = headSize;
+	size_t linkCount = 1;
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize != 0)
+		{
+			dataSize = ((dataSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1)) + linkSize;
+			linkCount++;
+		}
+	}
+
+	std::vector<std::byte> structureData(dataSize);
+	std::vector<size_t>	   pointerOffsets;
+	pointerOffsets.reserve(linkCount - 1);
+
+	std::byte* prevLinkData = nullptr;
+	size_t	   linkOffset	= 0;
+	for(const void* link = head; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		std::byte* linkData = structureData.data() + linkOffset;
+		memcpy(linkData, link, linkSize);
+
+		const void* pNext = nullptr;
+		memcpy(linkData + offsetof(VkBaseInStructure, pNext), &pNext, sizeof(void*));
+
+		if(prevLinkData != nullptr)
+		{
+			memcpy(prevLinkData + offsetof(VkBaseInStructure, pNext), &linkData, sizeof(void*));
+			pointerOffsets.push_back((prevLinkData - structureData.data()) + offsetof(VkBaseInStructure, pNext));
+		}
+
+		prevLinkData = linkData;
+		linkOffset	 = ((linkOffset + linkSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1));
+	}
+
+	return WriteSerializedStructures(structureData.data(), structureData.size(), pointerOffsets, 0);
+}
+
+inline const void* LoadSerializedStructures(void* serializedData, size_t serializedSize)
+{
+	assert(((uintptr_t)serializedData & (ChainLinkDataAlignment - 1)) == 0);
+
+	std::byte* serializedBytes = (std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & SerializedStructuresRelocatedFlag) != 0)
+	{
+		return nullptr;
+	}
+
+	//Nothing is written until the whole data is checked, so the data that's not valid is left as is
+	std::byte* structureData = serializedBytes + GetSerializedDataOffset(header);
+
+	std::vector<size_t> relocatedOffsets;
+	std::vector<size_t> clearedOffsets;
+
+	SerializedPointerValidator pointerValidator(structureData, (size_t)header.DataSize, (header.Flags & SerializedStructuresDeepFlag) != 0);
+	if(!pointerValidator.Validate(serializedBytes, header, relocatedOffsets, clearedOffsets))
+	{
+		return nullptr;
+	}
+
+	RelocateSerializedPointers(structureData, relocatedOffsets, clearedOffsets);
+
+	header.Flags |= SerializedStructuresRelocatedFlag;
+	memcpy(serializedBytes, &header, sizeof(SerializedStructuresHeader));
+
+	return structureData;
+}
+
+inline std::vector<std::byte> StructureBlob::Serialize() const
+{
+	return SerializeStructures(StructureData, false);
+}
+
+inline bool StructureBlob::Deserialize(const void* serializedData, size_t serializedSize, StructureBlob& outBlob)
+{
+	const std::byte* serializedBytes = (const std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & (SerializedStructuresDeepFlag | SerializedStructuresRelocatedFlag)) != 0)
+	{
+		return false;
+	}
+
+	SerializedStructureRecord headRecord = GetSerializedRecord(serializedBytes, 0);
+	const std::byte*		  headData	 = serializedBytes + GetSerializedDataOffset(header) + headRecord.Offset;
+
+	outBlob.StructureBlobData.assign(headData, headData + headRecord.Size);
+
+	outBlob.PNextPointerOffset = offsetof(VkBaseInStructure, pNext);
+	outBlob.STypeOffset		   = offsetof(VkBaseInStructure, sType);
+
+	outBlob.StructureData = outBlob.StructureBlobData.data();
+	outBlob.StructureSize = outBlob.StructureBlobData.size();
+
+	memset(outBlob.StructureBlobData.data() + outBlob.PNextPointerOffset, 0, sizeof(void*));
+	return true;
+}
+
+inline std::vector<std::byte> GenericStructureChainBase::Serialize(bool deep) const
+{
+	return SerializeStructures(GetChainHeadData(), deep);
+}
+
+inline bool AnyStructureChainBlob::Deserialize(const void* serializedData, size_t serializedSize, AnyStructureChainBlob& outChain)
+{
+	const std::byte* serializedBytes = (const std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & (SerializedStructuresDeepFlag | SerializedStructuresRelocatedFlag)) != 0)
+	{
+		return false;
+	}
+
+	//The records are already in the chain order and aligned, so the chain data is copied as is and only the pNext pointers are set
+	const std::byte* structureData = serializedBytes + GetSerializedDataOffset(header);
+
+	AnyStructureChainBlob chain;
+	chain.StructureChainBlobData.reserve((size_t)header.DataSize);
+
+	chain.StructureDataPointers.reserve(header.RecordCount);
+	chain.STypeOffsets.reserve(header.RecordCount);
+	chain.PNextPointerOffsets.reserve(header.RecordCount);
+	chain.LinkDataCapacities.reserve(header.RecordCount);
+	chain.PrevLinkIndices.reserve(header.RecordCount);
+	chain.NextLinkIndices.reserve(header.RecordCount);
+
+	SerializedStructureRecord headRecord = GetSerializedRecord(serializedBytes, 0);
+	chain.InitChainHead(structureData + headRecord.Offset, headRecord.Size, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), headRecord.SType);
+
+	for(size_t i = 1; i < header.RecordCount; i++)
+	{
+		SerializedStructureRecord record = GetSerializedRecord(serializedBytes, i);
+
+		size_t linkIndex = chain.AddLinkData(structureData + record.Offset, record.Size, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), record.SType);
+		chain.LinkAfter(chain.LastLinkIndex, linkIndex, nullptr);
+	}
+
+	outChain = std::move(chain);
+	return true;
+}
+
+template<typename HeadType>
+inline bool StructureChainBlob<HeadType>::Deserialize(const void* serializedData, size_t serializedSize, StructureChainBlob& outChain)
+{
+	AnyStructureChainBlob chain;
+	if(!AnyStructureChainBlob::Deserialize(serializedData, serializedSize, chain) || chain.GetChainHeadSType() != ValidStructureType<HeadType>)
+	{
+		return false;
+	}
+
+	outChain = StructureChainBlob(std::move(chain));
+	return true;
+}
+
+inline std::vector<std::byte> StructureTreeBlob::Serialize() const
+{
+	return WriteSerializedStructures(TreeData.data(), TreeData.size(), TreePointerOffsets, SerializedStructuresDeepFlag);
+}
+
+inline bool StructureTreeBlob::Deserialize(const void* serializedData, size_t serializedSize, StructureTreeBlob& outTree)
+{
+	const std::byte* serializedBytes = (const std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & SerializedStructuresRelocatedFlag) != 0)
+	{
+		return false;
+	}
+
+	//The tree data is the structure data as is, the relocations become the tree pointers
+	const std::byte* structureData = serializedBytes + GetSerializedDataOffset(header);
+
+	StructureTreeBlob   structureTree;
+	std::vector<size_t> clearedOffsets;
+
+	SerializedPointerValidator pointerValidator(structureData, (size_t)header.DataSize, (header.Flags & SerializedStructuresDeepFlag) != 0);
+	if(!pointerValidator.Validate(serializedBytes, header, structureTree.TreePointerOffsets, clearedOffsets))
+	{
+		return false;
+	}
+
+	structureTree.TreeData.assign(structureData, structureData + header.DataSize);
+	RelocateSerializedPointers(structureTree.TreeData.data(), structureTree.TreePointerOffsets, clearedOffsets);
+
+	outTree = std::move(structureTree);
+	return true;
+}
+
+//==========================================================================================================================
+
+//Identifies the chains queried from one physical device: the same device with the same driver fills the same set of structures the same way
+struct DeviceChainCacheKey
+{
+	uint8_t	 DeviceUUID[VK_UUID_SIZE];
+	uint32_t DriverVersion;
+	uint32_t Reserved;
+	uint64_t STypeSetHash; //Doesn't depend on the order of the structures in the chain
+
+	bool operator==(const DeviceChainCacheKey& rhs) const;
+	bool operator!=(const DeviceChainCacheKey& rhs) const;
+};
+
+//deviceUUID is VkPhysicalDeviceIDProperties::deviceUUID (VK_UUID_SIZE bytes), driverVersion is VkPhysicalDeviceProperties::driverVersion
+//The sType set is taken from the chain that is going to be queried, the contents of its structures don't matter
+DeviceChainCacheKey MakeDeviceChainCacheKey(const uint8_t* deviceUUID, uint32_t driverVersion, const void* chainHead);
+
+constexpr uint32_t DeviceChainCacheMagic   = 0x44534756; //"VGSD"
+constexpr uint32_t DeviceChainCacheVersion = 1;
+
+//Cache data layout: DeviceChainCacheHeader, EntryCount entries, the chains serialized with SerializeStructures() at the entry offsets
+struct DeviceChainCacheHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint64_t EntryCount;
+};
+
+struct DeviceChainCacheEntry
+{
+	DeviceChainCacheKey Key;
+	uint64_t			Offset;
+	uint64_t			Size;
+};
+
+//Cache of the filled physical device chains (e.g. VkPhysicalDeviceFeatures2 and VkPhysicalDeviceProperties2 with everything chained to them), meant to be kept in a file
+//With a warm cache the chains are neither queried nor copied: they are loaded right in the memory-mapped cache data on the first lookup
+//Lookups go through all entries, which is fine for a few devices with a few chains each. Not thread-safe
+class DeviceChainCache
+{
+public:
+	DeviceChainCache();
+	~DeviceChainCache();
+
+	//The found chains point into the cache, so it can't be copied
+	DeviceChainCache(const DeviceChainCache& rhs)			 = delete;
+	DeviceChainCache& operator=(const DeviceChainCache& rhs) = delete;
+
+	DeviceChainCache(DeviceChainCache&& rhs)			= default;
+	DeviceChainCache& operator=(DeviceChainCache&& rhs) = default;
+
+	//Uses the data saved with Save(), e.g. a file mapped copy-on-write. The data has to be aligned to ChainLinkDataAlignment and outlive the cache
+	//The cache has to be empty. Returns false if the data is not a valid cache, e.g. made on a platform with a different pointer size
+	bool Open(void* cacheData, size_t cacheSize);
+
+	//Returns the head of the cached chain, or null if there's none. The returned chain is only valid while the cache and its data are
+	const void* FindChain(const DeviceChainCacheKey& key);
+
+	template<typename HeadType>
+	const HeadType* FindChainAs(const DeviceChainCacheKey& key);
+
+	//Stores the filled chain, replacing the one with the same key. Same as SerializeStructures(), only pNext of all pointer members is followed
+	void StoreChain(const DeviceChainCacheKey& key, const void* chainHead);
+
+	//Writes all the chains, both opened and stored, into the data for a new cache file. The chains found broken by the lookups are dropped
+	std::vector<std::byte> Save() const;
+
+private:
+	struct CacheEntry
+	{
+		DeviceChainCacheKey	  Key;
+		std::byte*			  SerializedData;
+		size_t				  SerializedSize;
+		const void*			  LoadedHead; //Null until the first lookup, the serialized data is relocated in place by it
+		bool				  Broken;	  //Set by the first lookup if the serialized data is not valid, the entry is never loaded again and not saved
+		std::vector<uint64_t> StoredData; //Aligned storage for the stored chains, SerializedData points into it
+	};
+
+	size_t FindEntry(const DeviceChainCacheKey& key) const;
+
+private:
+	static constexpr size_t NoEntry = (size_t)(-1);
+
+	std::vector<CacheEntry> CacheEntries;
+};
+
+inline bool DeviceChainCacheKey::operator==(const DeviceChainCacheKey& rhs) const
+{
+	return memcmp(DeviceUUID, rhs.DeviceUUID, VK_UUID_SIZE) == 0 && DriverVersion == rhs.DriverVersion && STypeSetHash == rhs.STypeSetHash;
+}
+
+inline bool DeviceChainCacheKey::operator!=(const DeviceChainCacheKey& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline DeviceChainCacheKey MakeDeviceChainCacheKey(const uint8_t* deviceUUID, uint32_t driverVersion, const void* chainHead)
+{
+	DeviceChainCacheKey key;
+	memcpy(key.DeviceUUID, deviceUUID, VK_UUID_SIZE);
+
+	key.DriverVersion = driverVersion;
+	key.Reserved	  = 0;
+
+	//Same as HashChain(), the sum doesn't depend on the link order. Links with unknown sType are not stored, so they don't count either
+	uint64_t linksHash = 0;
+	for(const void* link = GetChainLinkPNext(chainHead); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(GetSTypeStructureSize(GetChainLinkSType(link)) != 0)
+		{
+			linksHash += MixHash((uint64_t)GetChainLinkSType(link));
+		}
+	}
+
+	key.STypeSetHash = MixHash(MixHash((uint64_t)GetChainLinkSType(chainHead)) ^ MixHash(linksHash));
+	return key;
+}
+
+inline DeviceChainCache::DeviceChainCache()
+{
+}
+
+inline DeviceChainCache::~DeviceChainCache()
+{
+}
+
+inline bool DeviceChainCache::Open(void* cacheData, size_t cacheSize)
+{
+	assert(CacheEntries.empty());
+	assert(((uintptr_t)cacheData & (ChainLinkDataAlignment - 1)) == 0);
+
+	std::byte* cacheBytes = (std::byte*)cacheData;
+	if(cacheBytes == nullptr || cacheSize < sizeof(DeviceChainCacheHeader))
+	{
+		return false;
+	}
+
+	DeviceChainCacheHeader header;
+	memcpy(&header, cacheBytes, sizeof(DeviceChainCacheHeader));
+
+	if(header.Magic != DeviceChainCacheMagic || header.Version != DeviceChainCacheVersion || header.EntryCount > (cacheSize - sizeof(DeviceChainCacheHeader)) / sizeof(DeviceChainCacheEntry))
+	{
+		return false;
+	}
+
+	//The chains themselves are only checked when loaded
+	std::vector<CacheEntry> cacheEntries((size_t)header.EntryCount);
+	for(size_t i = 0; i < cacheEntries.size(); i++)
+	{
+		DeviceChainCacheEntry entry;
+		memcpy(&entry, cacheBytes + sizeof(DeviceChainCacheHeader) + i * sizeof(DeviceChainCacheEntry), sizeof(DeviceChainCacheEntry));
+
+		if(entry.Offset > cacheSize || entry.Size > cacheSize - entry.Offset || entry.Offset % ChainLinkDataAlignment != 0)
+		{
+			return false;
+		}
+
+		cacheEntries[i].Key			   = entry.Key;
+		cacheEntries[i].SerializedData = cacheBytes + entry.Offset;
+		cacheEntries[i].SerializedSize = (size_t)entry.Size;
+		cacheEntries[i].LoadedHead	   = nullptr;
+		cacheEntries[i].Broken		   = false;
+	}
+
+	CacheEntries = std::move(cacheEntries);
+	return true;
+}
+
+inline const void* DeviceChainCache::FindChain(const DeviceChainCacheKey& key)
+{
+	size_t entryIndex = FindEntry(key);
+	if(entryIndex == NoEntry)
+	{
+		return nullptr;
+	}
+
+	//The data is checked once. Broken data is left untouched and stays not found
+	CacheEntry& entry = CacheEntries[entryIndex];
+	if(entry.LoadedHead == nullptr && !entry.Broken)
+	{
+		entry.LoadedHead = LoadSerializedStructures(entry.SerializedData, entry.SerializedSize);
+		entry.Broken	 = (entry.LoadedHead == nullptr);
+	}
+
+	return entry.LoadedHead;
+}
+
+template<typename HeadType>
+inline const HeadType* DeviceChainCache::FindChainAs(const DeviceChainCacheKey& key)
+{
+	const void* chainHead = FindChain(key);
+	if(chainHead == nullptr || GetChainLinkSType(chainHead) != ValidStructureType<HeadType>)
+	{
+		return nullptr;
+	}
+
+	return reinterpret_cast<const HeadType*>(chainHead);
+}
+
+inline void DeviceChainCache::StoreChain(const DeviceChainCacheKey& key, const void* chainHead)
+{
+	assert(key.STypeSetHash == MakeDeviceChainCacheKey(key.DeviceUUID, key.DriverVersion, chainHead).STypeSetHash);
+
+	size_t entryIndex = FindEntry(key);
+	if(entryIndex == NoEntry)
+	{
+		CacheEntries.emplace_back();
+		entryIndex = CacheEntries.size() - 1;
+	}
+
+	std::vector<std::byte> serializedChain = SerializeStructures(chainHead, false);
+
+	CacheEntry& entry = CacheEntries[entryIndex];
+	entry.StoredData.resize((serializedChain.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	memcpy(entry.StoredData.data(), serializedChain.data(), serializedChain.size());
+
+	entry.Key			 = key;
+	entry.SerializedData = (std::byte*)entry.StoredData.data();
+	entry.SerializedSize = serializedChain.size();
+	entry.LoadedHead	 = nullptr;
+	entry.Broken		 = false;
+}
+
+inline std::vector<std::byte> DeviceChainCache::Save() const
+{
+	//The loaded chains are relocated in place, so they are serialized again. The broken ones are dropped
+	std::vector<size_t>					savedEntryIndices;
+	std::vector<std::vector<std::byte>> reserializedChains(CacheEntries.size());
+	for(size_t i = 0; i < CacheEntries.size(); i++)
+	{
+		if(CacheEntries[i].Broken)
+		{
+			continue;
+		}
+
+		if(CacheEntries[i].LoadedHead != nullptr)
+		{
+			reserializedChains[i] = SerializeStructures(CacheEntries[i].LoadedHead, false);
+		}
+
+		savedEntryIndices.push_back(i);
+	}
+
+	DeviceChainCacheHeader header;
+	header.Magic	  = DeviceChainCacheMagic;
+	header.Version	  = DeviceChainCacheVersion;
+	header.EntryCount = savedEntryIndices.size();
+
+	size_t cacheSize = sizeof(DeviceChainCacheHeader) + savedEntryIndices.size() * sizeof(DeviceChainCacheEntry);
+
+	std::vector<DeviceChainCacheEntry> entries(savedEntryIndices.size());
+	for(size_t i = 0; i < savedEntryIndices.size(); i++)
+	{
+		const CacheEntry& cacheEntry = CacheEntries[savedEntryIndices[i]];
+
+		size_t chainSize = (cacheEntry.LoadedHead != nullptr) ? reserializedChains[savedEntryIndices[i]].size() : cacheEntry.SerializedSize;
+
+		entries[i].Key	  = cacheEntry.Key;
+		entries[i].Offset = (cacheSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+		entries[i].Size	  = chainSize;
+
+		cacheSize = (size_t)entries[i].Offset + chainSize;
+	}
+
+	std::vector<std::byte> cacheData(cacheSize);
+	memcpy(cacheData.data(), &header, sizeof(DeviceChainCacheHeader));
+
+	for(size_t i = 0; i < savedEntryIndices.size(); i++)
+	{
+		const CacheEntry& cacheEntry = CacheEntries[savedEntryIndices[i]];
+
+		memcpy(cacheData.data() + sizeof(DeviceChainCacheHeader) + i * sizeof(DeviceChainCacheEntry), &entries[i], sizeof(DeviceChainCacheEntry));
+
+		const std::byte* chainData = (cacheEntry.LoadedHead != nullptr) ? reserializedChains[savedEntryIndices[i]].data() : cacheEntry.SerializedData;
+		memcpy(cacheData.data() + entries[i].Offset, chainData, (size_t)entries[i].Size);
+	}
+
+	return cacheData;
+}
+
+inline size_t DeviceChainCache::FindEntry(const DeviceChainCacheKey& key) const
+{
+	for(size_t i = 0; i < CacheEntries.size(); i++)
+	{
+		if(CacheEntries[i].Key == key)
+		{
+			return i;
+		}
+	}
+
+	return NoEntry;
+}
+
+//=================================================================================================================================================================
+
+constexpr uint32_t NoFeatureStructure = (uint32_t)(-1);
+
+//Index of the structure in FeatureStructureInfos, or NoFeatureStructure if it doesn't extend VkPhysicalDeviceFeatures2
+constexpr uint32_t GetFeatureStructureOrdinal(VulkanStructureType sType)
+{
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(FeatureStructureInfos[i].SType == sType)
+		{
+			return i;
+		}
+	}
+
+	return NoFeatureStructure;
+}
+
+class FeatureBitset;
+
+//VkPhysicalDeviceFeatures2 chain of every feature structure supported by the API version and the enabled extensions, made with BuildFullFeatureChain()
+//All the structures are zeroed and linked in a single exact-size allocation, in order of FeatureStructureInfos
+//Lookup of a structure is a single array read, its index is known at compile time
+class FullFeatureChain
+{
+public:
+	FullFeatureChain();
+	~FullFeatureChain();
+
+	//A copy is a single blob copy plus relinking
+	FullFeatureChain(const FullFeatureChain& rhs);
+	FullFeatureChain& operator=(const FullFeatureChain& rhs);
+
+	FullFeatureChain(FullFeatureChain&& rhs)			= default;
+	FullFeatureChain& operator=(FullFeatureChain&& rhs) = default;
+
+	template<typename HeadType>
+	HeadType& GetChainHeadAs();
+
+	//The structure has to be in the chain, check it with Contains<Struct>()
+	template<typename Struct>
+	Struct& GetChainLinkDataAs();
+
+	template<typename Struct>
+	bool Contains() const;
+
+	//Number of the structures in the chain, including the head
+	uint32_t GetLinkCount() const;
+
+private:
+	friend FullFeatureChain BuildFullFeatureChain(uint32_t apiVersion, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames);
+	friend FullFeatureChain BuildFeatureChain(const FeatureBitset& features);
+
+	//Lays out the included structures (indexed same as FeatureStructureInfos) in a single zeroed allocation and links them
+	void AllocateChain(const bool* includedStructures);
+	void LinkChain();
+
+private:
+	static constexpr uint32_t NoLink = (uint32_t)(-1);
+
+	std::vector<std::byte> ChainData;
+	uint32_t			   LinkOffsets[FeatureStructureCount]; //Offset of each structure from FeatureStructureInfos in ChainData, or NoLink
+};
+
+//Makes the chain of all feature structures of apiVersion (e.g. VK_API_VERSION_1_2) and the enabled device extensions, to pass to vkGetPhysicalDeviceFeatures2
+//The structures that are not a part of this header (e.g. disabled with the extension defines) are never included
+FullFeatureChain BuildFullFeatureChain(uint32_t apiVersion, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames);
+
+inline FullFeatureChain::FullFeatureChain()
+{
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		LinkOffsets[i] = NoLink;
+	}
+}
+
+inline FullFeatureChain::~FullFeatureChain()
+{
+}
+
+inline FullFeatureChain::FullFeatureChain(const FullFeatureChain& rhs)
+{
+	*this = rhs;
+}
+
+inline FullFeatureChain& FullFeatureChain::operator=(const FullFeatureChain& rhs)
+{
+	ChainData = rhs.ChainData;
+	memcpy(LinkOffsets, rhs.LinkOffsets, sizeof(LinkOffsets));
+
+	LinkChain();
+	return *this;
+}
+
+template<typename HeadType>
+inline HeadType& FullFeatureChain::GetChainHeadAs()
+{
+	static_assert(ValidStructureType<HeadType> == FeatureStructureInfos[0].SType, "The head of the full feature chain is VkPhysicalDeviceFeatures2");
+	assert(!ChainData.empty());
+
+	HeadType* head = reinterpret_cast<HeadType*>(ChainData.data());
+	return *head;
+}
+
+template<typename Struct>
+inline Struct& FullFeatureChain::GetChainLinkDataAs()
+{
+	constexpr uint32_t featureOrdinal = GetFeatureStructureOrdinal(ValidStructureType<Struct>);
+	assert(Contains<Struct>());
+
+	Struct* link = reinterpret_cast<Struct*>(ChainData.data() + LinkOffsets[featureOrdinal]);
+	return *link;
+}
+
+template<typename Struct>
+inline bool FullFeatureChain::Contains() const
+{
+	constexpr uint32_t featureOrdinal = GetFeatureStructureOrdinal(ValidStructureType<Struct>);
+	return featureOrdinal != NoFeatureStructure && LinkOffsets[featureOrdinal] != NoLink;
+}
+
+inline uint32_t FullFeatureChain::GetLinkCount() const
+{
+	uint32_t linkCount = 0;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(LinkOffsets[i] != NoLink)
+		{
+			linkCount++;
+		}
+	}
+
+	return linkCount;
+}
+
+inline void FullFeatureChain::AllocateChain(const bool* includedStructures)
+{
+	//The head is always included
+	size_t chainSize = 0;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		LinkOffsets[i] = NoLink;
+		if(i == 0 || includedStructures[i])
+		{
+			chainSize = (chainSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+			LinkOffsets[i] = (uint32_t)chainSize;
+			chainSize += FeatureStructureInfos[i].Size;
+		}
+	}
+
+	ChainData.assign(chainSize, std::byte(0));
+	LinkChain();
+}
+
+inline void FullFeatureChain::LinkChain()
+{
+	void* prevLink = nullptr;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(LinkOffsets[i] == NoLink)
+		{
+			continue;
+		}
+
+		std::byte* link = ChainData.data() + LinkOffsets[i];
+		memcpy(link + offsetof(VkBaseOutStructure, sType), &FeatureStructureInfos[i].SType, sizeof(VulkanStructureType));
+
+		if(prevLink != nullptr)
+		{
+			memcpy((std::byte*)prevLink + offsetof(VkBaseOutStructure, pNext), &link, sizeof(void*));
+		}
+
+		prevLink = link;
+	}
+
+	if(prevLink != nullptr)
+	{
+		void* chainEnd = nullptr;
+		memcpy((std::byte*)prevLink + offsetof(VkBaseOutStructure, pNext), &chainEnd, sizeof(void*));
+	}
+}
+
+inline bool ExtensionNameLess(const char* lhs, const char* rhs)
+{
+	return strcmp(lhs, rhs) < 0;
+}
+
+inline FullFeatureChain BuildFullFeatureChain(uint32_t apiVersion, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames)
+{
+	std::vector<const char*> sortedExtensionNames(enabledExtensionNames, enabledExtensionNames + enabledExtensionCount);
+	std::sort(sortedExtensionNames.begin(), sortedExtensionNames.end(), ExtensionNameLess);
+
+	bool includedStructures[FeatureStructureCount];
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		const FeatureStructureInfo& featureInfo = FeatureStructureInfos[i];
+
+		bool isSupported = (featureInfo.CoreVersion != 0 && apiVersion >= featureInfo.CoreVersion);
+		for(uint32_t j = 0; j < FeatureStructureMaxExtensions && !isSupported && featureInfo.ExtensionNames[j] != nullptr; j++)
+		{
+			isSupported = std::binary_search(sortedExtensionNames.begin(), sortedExtensionNames.end(), featureInfo.ExtensionNames[j], ExtensionNameLess);
+		}
+
+		includedStructures[i] = isSupported;
+	}
+
+	FullFeatureChain fullFeatureChain;
+	fullFeatureChain.AllocateChain(includedStructures);
+
+	return fullFeatureChain;
+}
+
+//=================================================================================================================================================================
+
+//Feature bits of each structure from FeatureStructureInfos start at FirstBits[ordinal] and go in order of FeatureMemberOffsets, FirstBits[FeatureStructureCount] is the total count
+struct FeatureStructureBitRanges
+{
+	uint32_t FirstBits[FeatureStructureCount + 1];
+};
+
+constexpr FeatureStructureBitRanges MakeFeatureStructureBitRanges()
+{
+	FeatureStructureBitRanges bitRanges = {};
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		bitRanges.FirstBits[i + 1] = bitRanges.FirstBits[i] + FeatureStructureInfos[i].FeatureMemberCount;
+	}
+
+	return bitRanges;
+}
+
+inline constexpr FeatureStructureBitRanges FeatureBitRanges = MakeFeatureStructureBitRanges();
+
+constexpr uint32_t FeatureBitCount = FeatureBitRanges.FirstBits[FeatureStructureCount];
+constexpr uint32_t NoFeatureBit	   = (uint32_t)(-1);
+
+//Members of VkPhysicalDeviceVulkanNNFeatures are the same features as the members of the structures promoted to that version, so they share the bits:
+//e.g. the bit of VkPhysicalDeviceVulkan11Features::multiview is the bit of VkPhysicalDeviceMultiviewFeatures::multiview
+struct FeatureStructureAliases
+{
+	uint32_t CanonicalBits[FeatureBitCount + 1];		 //The bit each feature bit shares, the bit itself if it's not aliased. One more, so the array is never empty
+	uint32_t CoreFeatureOrdinals[FeatureStructureCount]; //Ordinal of VkPhysicalDeviceVulkanNNFeatures that has all the features of the structure, or NoFeatureStructure
+};
+
+constexpr FeatureStructureAliases MakeFeatureStructureAliases()
+{
+	FeatureStructureAliases aliases = {};
+	for(uint32_t i = 0; i < FeatureBitCount; i++)
+	{
+		aliases.CanonicalBits[i] = i;
+	}
+
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		const FeatureStructureInfo& featureInfo = FeatureStructureInfos[i];
+
+		uint32_t coreFeatureOrdinal = (featureInfo.CoreFeaturesSType != featureInfo.SType) ? GetFeatureStructureOrdinal(featureInfo.CoreFeaturesSType) : NoFeatureStructure;
+		aliases.CoreFeatureOrdinals[i] = coreFeatureOrdinal;
+
+		if(coreFeatureOrdinal == NoFeatureStructure)
+		{
+			continue;
+		}
+
+		for(uint32_t j = 0; j < featureInfo.FeatureMemberCount; j++)
+		{
+			aliases.CanonicalBits[FeatureBitRanges.FirstBits[coreFeatureOrdinal] + featureInfo.CoreFeatureMemberIndices[j]] = FeatureBitRanges.FirstBits[i] + j;
+		}
+	}
+
+	return aliases;
+}
+
+inline constexpr FeatureStructureAliases FeatureAliases = MakeFeatureStructureAliases();
+
+//The bitset is made of 256-bit blocks, so the operations over it vectorize without a scalar tail. There's always at least one block
+constexpr uint32_t FeatureBitsetWordCount = (FeatureBitCount == 0) ? 4 : ((FeatureBitCount + 255) / 256) * 4;
+
+//Feature bit of the VkBool32 member at memberOffset of the feature structure, e.g. GetFeatureBit(ValidStructureType<VkPhysicalDeviceVulkan11Features>, offsetof(VkPhysicalDeviceVulkan11Features, multiview))
+//The aliased members get the same bit. Returns NoFeatureBit if there's no such member
+constexpr uint32_t GetFeatureBit(VulkanStructureType sType, uint32_t memberOffset)
+{
+	uint32_t featureOrdinal = GetFeatureStructureOrdinal(sType);
+	if(featureOrdinal == NoFeatureStructure)
+	{
+		return NoFeatureBit;
+	}
+
+	const FeatureStructureInfo& featureInfo = FeatureStructureInfos[featureOrdinal];
+	for(uint32_t i = 0; i < featureInfo.FeatureMemberCount; i++)
+	{
+		if(featureInfo.FeatureMemberOffsets[i] == memberOffset)
+		{
+			return FeatureAliases.CanonicalBits[FeatureBitRanges.FirstBits[featureOrdinal] + i];
+		}
+	}
+
+	return NoFeatureBit;
+}
+
+//Set of the VkBool32 members of all feature structures, one bit per feature, e.g. the features a device supports or the ones an application requires
+//The aliased members share the bit, any of their bits can be passed to Test() and Set()
+//The set operations are plain loops over a fixed number of aligned 64-bit words without early exits, which compilers turn into SIMD code
+class alignas(32) FeatureBitset
+{
+public:
+	FeatureBitset();
+	~FeatureBitset();
+
+	bool Test(uint32_t featureBit) const;
+	void Set(uint32_t featureBit, bool value = true);
+
+	//Number of the set bits
+	uint32_t Count() const;
+	bool	 IsEmpty() const;
+
+	FeatureBitset Intersect(const FeatureBitset& rhs) const;
+
+	//The features of this set that are missing from rhs
+	FeatureBitset Diff(const FeatureBitset& rhs) const;
+
+	bool IsSubsetOf(const FeatureBitset& rhs) const;
+
+	bool operator==(const FeatureBitset& rhs) const;
+	bool operator!=(const FeatureBitset& rhs) const;
+
+private:
+	uint64_t Words[FeatureBitsetWordCount];
+};
+
+//Makes the bitset of the VK_TRUE members of all feature structures in the chain, e.g. the one filled by vkGetPhysicalDeviceFeatures2. Other structures are skipped
+FeatureBitset MakeFeatureBitset(const void* chainHead);
+
+//Makes the VkPhysicalDeviceFeatures2 chain of the structures that have at least one of the features, with these features set to VK_TRUE, e.g. for VkDeviceCreateInfo::pNext
+//Each feature is set in only one structure: VkPhysicalDeviceVulkanNNFeatures is never chained along with the structures promoted to its version
+FullFeatureChain BuildFeatureChain(const FeatureBitset& features);
+
+//Tests the required features against each of the profiles (e.g. stored supported features of thousands of devices), outSupported gets profileCount results
+//Returns the number of the profiles that have all the required features
+size_t EvaluateFeatureProfiles(const FeatureBitset& requiredFeatures, const FeatureBitset* profiles, size_t profileCount, bool* outSupported);
+
+inline FeatureBitset::FeatureBitset()
+{
+	memset(Words, 0, sizeof(Words));
+}
+
+inline FeatureBitset::~FeatureBitset()
+{
+}
+
+inline bool FeatureBitset::Test(uint32_t featureBit) const
+{
+	assert(featureBit < FeatureBitCount);
+
+	featureBit = FeatureAliases.CanonicalBits[featureBit];
+	return (Words[featureBit / 64] >> (featureBit % 64)) & 1;
+}
+
+inline void FeatureBitset::Set(uint32_t featureBit, bool value)
+{
+	assert(featureBit < FeatureBitCount);
+
+	featureBit = FeatureAliases.CanonicalBits[featureBit];
+
+	uint64_t featureMask = 1ull << (featureBit % 64);
+	Words[featureBit / 64] = value ? (Words[featureBit / 64] | featureMask) : (Words[featureBit / 64] & ~featureMask);
+}
+
+inline uint32_t FeatureBitset::Count() const
+{
+	uint32_t setBitCount = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		for(uint64_t word = Words[i]; word != 0; word &= word - 1)
+		{
+			setBitCount++;
+		}
+	}
+
+	return setBitCount;
+}
+
+inline bool FeatureBitset::IsEmpty() const
+{
+	uint64_t setBits = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		setBits |= Words[i];
+	}
+
+	return setBits == 0;
+}
+
+inline FeatureBitset FeatureBitset::Intersect(const FeatureBitset& rhs) const
+{
+	FeatureBitset intersection;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		intersection.Words[i] = Words[i] & rhs.Words[i];
+	}
+
+	return intersection;
+}
+
+inline FeatureBitset FeatureBitset::Diff(const FeatureBitset& rhs) const
+{
+	FeatureBitset difference;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		difference.Words[i] = Words[i] & ~rhs.Words[i];
+	}
+
+	return difference;
+}
+
+inline bool FeatureBitset::IsSubsetOf(const FeatureBitset& rhs) const
+{
+	uint64_t missingBits = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		missingBits |= Words[i] & ~rhs.Words[i];
+	}
+
+	return missingBits == 0;
+}
+
+inline bool FeatureBitset::operator==(const FeatureBitset& rhs) const
+{
+	uint64_t differentBits = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		differentBits |= Words[i] ^ rhs.Words[i];
+	}
+
+	return differentBits == 0;
+}
+
+inline bool FeatureBitset::operator!=(const FeatureBitset& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline FeatureBitset MakeFeatureBitset(const void* chainHead)
+{
+	FeatureBitset features;
+	for(const void* link = chainHead; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		uint32_t featureOrdinal = GetFeatureStructureOrdinal(GetChainLinkSType(link));
+		if(featureOrdinal == NoFeatureStructure)
+		{
+			continue;
+		}
+
+		const FeatureStructureInfo& featureInfo = FeatureStructureInfos[featureOrdinal];
+		for(uint32_t i = 0; i < featureInfo.FeatureMemberCount; i++)
+		{
+			VkBool32 featureValue = VK_FALSE;
+			memcpy(&featureValue, (const std::byte*)link + featureInfo.FeatureMemberOffsets[i], sizeof(VkBool32));
+
+			if(featureValue != VK_FALSE)
+			{
+				features.Set(FeatureBitRanges.FirstBits[featureOrdinal] + i);
+			}
+		}
+	}
+
+	return features;
+}
+
+inline FullFeatureChain BuildFeatureChain(const FeatureBitset& features)
+{
+	//The aliased features only include the promoted structures, so the chain works on the devices of the older versions too
+	bool includedStructures[FeatureStructureCount];
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		includedStructures[i] = false;
+		for(uint32_t featureBit = FeatureBitRanges.FirstBits[i]; featureBit < FeatureBitRanges.FirstBits[i + 1] && !includedStructures[i]; featureBit++)
+		{
+			includedStructures[i] = FeatureAliases.CanonicalBits[featureBit] == featureBit && features.Test(featureBit);
+		}
+	}
+
+	//VkPhysicalDeviceVulkanNNFeatures can't be chained along with the structures promoted to its version (VUID-VkDeviceCreateInfo-pNext-02829 and 02830),
+	//so if it's included for its own features, it takes their features instead
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		uint32_t coreFeatureOrdinal = FeatureAliases.CoreFeatureOrdinals[i];
+		if(coreFeatureOrdinal != NoFeatureStructure && includedStructures[coreFeatureOrdinal])
+		{
+			includedStructures[i] = false;
+		}
+	}
+
+	FullFeatureChain featureChain;
+	featureChain.AllocateChain(includedStructures);
+
+	VkBool32 enabledValue = VK_TRUE;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(featureChain.LinkOffsets[i] == FullFeatureChain::NoLink)
+		{
+			continue;
+		}
+
+		std::byte* link = featureChain.ChainData.data() + featureChain.LinkOffsets[i];
+		for(uint32_t j = 0; j < FeatureStructureInfos[i].FeatureMemberCount; j++)
+		{
+			if(features.Test(FeatureBitRanges.FirstBits[i] + j))
+			{
+				memcpy(link + FeatureStructureInfos[i].FeatureMemberOffsets[j], &enabledValue, sizeof(VkBool32));
+			}
+		}
+	}
+
+	return featureChain;
+}
+
+inline size_t EvaluateFeatureProfiles(const FeatureBitset& requiredFeatures, const FeatureBitset* profiles, size_t profileCount, bool* outSupported)
+{
+	size_t supportedCount = 0;
+	for(size_t i = 0; i < profileCount; i++)
+	{
+		outSupported[i] = requiredFeatures.IsSubsetOf(profiles[i]);
+		supportedCount += outSupported[i] ? 1 : 0;
+	}
+
+	return supportedCount;
+}
+
+//=================================================================================================================================================================
+
+//Member of a structure in a query chain, see QueryChainArray::Diff()
+struct QueryChainMember
+{
+	uint32_t			LinkIndex; //0 for the head
+	VulkanStructureType SType;
+	uint32_t			Offset;
+	uint32_t			Size;
+};
+
+//N chains of the same shape in a single allocation, e.g. VkPhysicalDeviceProperties2 chains for vkGetPhysicalDeviceProperties2 of every physical device
+//The returnedonly structures (see IsSTypeReturnedOnly) are zeroed, the other ones are copied from the template chain
+//A copy is a single blob copy plus re-arming
+template<typename HeadType>
+class QueryChainArray
+{
+public:
+	QueryChainArray();
+
+	//Makes chainCount chains of the same structures as the chain of templateHead, links with unknown sType are skipped
+	QueryChainArray(const HeadType& templateHead, size_t chainCount);
+	~QueryChainArray();
+
+	QueryChainArray(const QueryChainArray& rhs);
+	QueryChainArray& operator=(const QueryChainArray& rhs);
+
+	QueryChainArray(QueryChainArray&& rhs)			  = default;
+	QueryChainArray& operator=(QueryChainArray&& rhs) = default;
+
+	size_t GetChainCount() const;
+
+	HeadType& GetChainHead(size_t chainIndex);
+
+	//Returns the first structure of the type Struct in the chain
+	template<typename Struct>
+	Struct& GetChainLinkDataAs(size_t chainIndex);
+
+	//Restores sType and pNext of all structures of all chains before the next query, the rest of the data is kept
+	void Rearm();
+
+	//Members that are not the same in all chains, compared by the ranges of the GetSTypeMemberRanges table
+	//Structures with unknown layout are compared as a whole, past pNext
+	std::vector<QueryChainMember> Diff() const;
+
+	//Members that differ between the two chains
+	std::vector<QueryChainMember> Diff(size_t lhsChainIndex, size_t rhsChainIndex) const;
+
+private:
+	std::byte*		 GetChainData(size_t chainIndex);
+	const std::byte* GetChainData(size_t chainIndex) const;
+
+	bool CompareMember(const QueryChainMember& member, size_t lhsChainIndex, size_t rhsChainIndex) const;
+
+private:
+	std::vector<std::byte>			 ChainData;
+	std::vector<VulkanStructureType> LinkSTypes;
+	std::vector<size_t>				 LinkOffsets; //Offsets in each chain
+	std::vector<QueryChainMember>	 ChainMembers;
+
+	size_t ChainStride;
+	size_t ChainCount;
+};
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::QueryChainArray(): ChainStride(0), ChainCount(0)
+{
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::QueryChainArray(const HeadType& templateHead, size_t chainCount): ChainStride(0), ChainCount(chainCount)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the query chain array must be trivially destructible");
+
+	std::vector<const void*> templateLinks;
+
+	size_t chainSize = 0;
+	for(const void* link = &templateHead; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		VulkanStructureType linkSType = (link == &templateHead) ? ValidStructureType<HeadType> : GetChainLinkSType(link);
+		size_t				linkSize  = (link == &templateHead) ? sizeof(HeadType) : GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		chainSize = (chainSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+		LinkSTypes.push_back(linkSType);
+		LinkOffsets.push_back(chainSize);
+		templateLinks.push_back(link);
+
+		chainSize += linkSize;
+	}
+
+	ChainStride = (chainSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+	ChainData.resize(ChainStride * ChainCount);
+
+	for(size_t i = 0; i < LinkSTypes.size(); i++)
+	{
+		size_t linkSize = (i == 0) ? sizeof(HeadType) : GetSTypeStructureSize(LinkSTypes[i]);
+
+		size_t						rangeCount   = 0;
+		const StructureMemberRange* memberRanges = GetSTypeMemberRanges(LinkSTypes[i], &rangeCount);
+		if(memberRanges != nullptr && GetSTypeStructureSize(LinkSTypes[i]) == linkSize)
+		{
+			for(size_t j = 0; j < rangeCount; j++)
+			{
+				if(memberRanges[j].Offset != offsetof(VkBaseOutStructure, sType))
+				{
+					ChainMembers.push_back(QueryChainMember{(uint32_t)i, LinkSTypes[i], memberRanges[j].Offset, memberRanges[j].Size});
+				}
+			}
+		}
+		else if(linkSize > sizeof(VkBaseOutStructure))
+		{
+			ChainMembers.push_back(QueryChainMember{(uint32_t)i, LinkSTypes[i], (uint32_t)sizeof(VkBaseOutStructure), (uint32_t)(linkSize - sizeof(VkBaseOutStructure))});
+		}
+
+		if(ChainCount != 0 && !IsSTypeReturnedOnly(LinkSTypes[i]))
+		{
+			memcpy(GetChainData(0) + LinkOffsets[i], templateLinks[i], linkSize);
+		}
+	}
+
+	for(size_t chainIndex = 1; chainIndex < ChainCount; chainIndex++)
+	{
+		memcpy(GetChainData(chainIndex), GetChainData(0), ChainStride);
+	}
+
+	Rearm();
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::~QueryChainArray()
+{
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::QueryChainArray(const QueryChainArray& rhs)
+{
+	*this = rhs;
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>& QueryChainArray<HeadType>::operator=(const QueryChainArray& rhs)
+{
+	ChainData	 = rhs.ChainData;
+	LinkSTypes	 = rhs.LinkSTypes;
+	LinkOffsets	 = rhs.LinkOffsets;
+	ChainMembers = rhs.ChainMembers;
+	ChainStride	 = rhs.ChainStride;
+	ChainCount	 = rhs.ChainCount;
+
+	Rearm();
+	return *this;
+}
+
+template<typename HeadType>
+inline size_t QueryChainArray<HeadType>::GetChainCount() const
+{
+	return ChainCount;
+}
+
+template<typename HeadType>
+inline HeadType& QueryChainArray<HeadType>::GetChainHead(size_t chainIndex)
+{
+	assert(chainIndex < ChainCount);
+
+	HeadType* head = reinterpret_cast<HeadType*>(GetChainData(chainIndex));
+	return *head;
+}
+
+template<typename HeadType>
+template<typename Struct>
+inline Struct& QueryChainArray<HeadType>::GetChainLinkDataAs(size_t chainIndex)
+{
+	assert(chainIndex < ChainCount);
+
+	size_t linkIndex = 0;
+	while(linkIndex < LinkSTypes.size() && LinkSTypes[linkIndex] != ValidStructureType<Struct>)
+	{
+		linkIndex++;
+	}
+
+	assert(linkIndex < LinkSTypes.size());
+
+	Struct* structPtr = reinterpret_cast<Struct*>(GetChainData(chainIndex) + LinkOffsets[linkIndex]);
+	return *structPtr;
+}
+
+template<typename HeadType>
+inline void QueryChainArray<HeadType>::Rearm()
+{
+	for(size_t chainIndex = 0; chainIndex < ChainCount; chainIndex++)
+	{
+		std::byte* chainData = GetChainData(chainIndex);
+		for(size_t i = 0; i < LinkSTypes.size(); i++)
+		{
+			void* pNext = (i + 1 < LinkSTypes.size()) ? chainData + LinkOffsets[i + 1] : nullptr;
+
+			memcpy(chainData + LinkOffsets[i] + offsetof(VkBaseOutStructure, sType), &LinkSTypes[i], sizeof(VulkanStructureType));
+			memcpy(chainData + LinkOffsets[i] + offsetof(VkBaseOutStructure, pNext), &pNext, sizeof(void*));
+		}
+	}
+}
+
+template<typename HeadType>
+inline std::vector<QueryChainMember> QueryChainArray<HeadType>::Diff() const
+{
+	std::vector<QueryChainMember> differentMembers;
+	for(const QueryChainMember& member: ChainMembers)
+	{
+		for(size_t chainIndex = 1; chainIndex < ChainCount; chainIndex++)
+		{
+			if(!CompareMember(member, 0, chainIndex))
+			{
+				differentMembers.push_back(member);
+				break;
+			}
+		}
+	}
+
+	return differentMembers;
+}
+
+template<typename HeadType>
+inline std::vector<QueryChainMember> QueryChainArray<HeadType>::Diff(size_t lhsChainIndex, size_t rhsChainIndex) const
+{
+	assert(lhsChainIndex < ChainCount);
+	assert(rhsChainIndex < ChainCount);
+
+	std::vector<QueryChainMember> differentMembers;
+	for(const QueryChainMember& member: ChainMembers)
+	{
+		if(!CompareMember(member, lhsChainIndex, rhsChainIndex))
+		{
+			differentMembers.push_back(member);
+		}
+	}
+
+	return differentMembers;
+}
+
+template<typename HeadType>
+inline std::byte* QueryChainArray<HeadType>::GetChainData(size_t chainIndex)
+{
+	return ChainData.data() + chainIndex * ChainStride;
+}
+
+template<typename HeadType>
+inline const std::byte* QueryChainArray<HeadType>::GetChainData(size_t chainIndex) const
+{
+	return ChainData.data() + chainIndex * ChainStride;
+}
+
+template<typename HeadType>
+inline bool QueryChainArray<HeadType>::CompareMember(const QueryChainMember& member, size_t lhsChainIndex, size_t rhsChainIndex) const
+{
+	size_t memberOffset = LinkOffsets[member.LinkIndex] + member.Offset;
+	return memcmp(GetChainData(lhsChainIndex) + memberOffset, GetChainData(rhsChainIndex) + memberOffset, member.Size) == 0;
+}
+
+//=================================================================================================================================================================
+
+//Finds the feature member by the hash of "structureName.memberName" with a single probe of the perfect hash table. Returns null if there's no such member
+inline const FeatureMemberNameEntry* FindFeatureMemberName(uint64_t nameHash, const char* structureName, size_t structureNameLength, const char* memberName, size_t memberNameLength)
+{
+	uint32_t nameDisplacement = FeatureMemberNameDisplacements[(nameHash >> 32) % FeatureMemberNameBucketCount];
+
+	const FeatureMemberNameEntry& nameEntry = FeatureMemberNameSlots[MixHash(nameHash ^ nameDisplacement) % FeatureMemberNameSlotCount];
+	if(nameEntry.Name == nullptr)
+	{
+		return nullptr;
+	}
+
+	//The slot can be taken by another name, which is only found out by comparing
+	const char* entryName = nameEntry.Name;
+	if(strncmp(entryName, structureName, structureNameLength) != 0 || entryName[structureNameLength] != '.')
+	{
+		return nullptr;
+	}
+
+	entryName += structureNameLength + 1;
+	if(strncmp(entryName, memberName, memberNameLength) != 0 || entryName[memberNameLength] != '\\0')
+	{
+		return nullptr;
+	}
+
+	return &nameEntry;
+}
+
+//Feature bit of the member by the structure and member names as written in the profiles, e.g. ("VkPhysicalDeviceFeatures", "geometryShader")
+//Returns NoFeatureBit if there's no such member
+inline uint32_t FindFeatureBit(const char* structureName, const char* memberName)
+{
+	size_t structureNameLength = strlen(structureName);
+	size_t memberNameLength	   = strlen(memberName);
+
+	uint64_t nameHash = HashName(NameHashBasis, structureName, structureNameLength);
+	nameHash		  = HashName(nameHash, ".", 1);
+	nameHash		  = HashName(nameHash, memberName, memberNameLength);
+
+	const FeatureMemberNameEntry* nameEntry = FindFeatureMemberName(nameHash, structureName, structureNameLength, memberName, memberNameLength);
+	if(nameEntry == nullptr)
+	{
+		return NoFeatureBit;
+	}
+
+	return FeatureAliases.CanonicalBits[FeatureBitRanges.FirstBits[GetFeatureStructureOrdinal(nameEntry->SType)] + nameEntry->MemberIndex];
+}
+
+//Single-pass reader of the "features" sections of a profile in the JSON format of Vulkan Profiles:
+//{"capabilities": {"baseline": {"features": {"VkPhysicalDeviceFeatures": {"geometryShader": true}, "VkPhysicalDeviceVulkan11Features": {"multiview": true}}}}}
+//Nothing is copied or allocated, the names are looked up right in the data. The rest of the document is only checked to be well-formed
+class FeatureProfileReader
+{
+public:
+	//If capabilityName is not null, only the "features" sections inside its value are read
+	FeatureProfileReader(const char* profileData, size_t profileSize, const char* capabilityName);
+	~FeatureProfileReader();
+
+	//Adds the features set to true. Returns false if the data is not well-formed JSON
+	bool Read(FeatureBitset& features);
+
+	//Number of the members set to true that are not known to this header (e.g. of a newer or a disabled extension)
+	uint32_t GetUnknownFeatureCount() const;
+
+private:
+	bool ReadValue(bool insideCapability, uint32_t depth);
+	bool ReadFeatures(uint32_t depth);
+	bool ReadFeatureStructure(const char* structureName, size_t structureNameLength, uint32_t depth);
+
+	bool ReadString(const char** outString, size_t* outStringLength);
+	bool ReadLiteral(const char* literal);
+	void SkipWhitespace();
+
+	bool MatchesCapabilityName(const char* key, size_t keyLength) const;
+
+private:
+	static constexpr uint32_t MaxDepth = 64;
+
+	const char* Cursor;
+	const char* DataEnd;
+	const char* CapabilityName;
+
+	FeatureBitset* Features;
+	uint32_t	   UnknownFeatureCount;
+
+	//Members of the same structure go in a row, so the structure ordinal is looked up once for all of them
+	VulkanStructureType LastSType;
+	uint32_t			LastFeatureOrdinal;
+};
+
+//Reads the features from the profile data, e.g. a memory-mapped profile file. outFeatures gets the features set to true in all read sections
+bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, FeatureBitset& outFeatures, uint32_t* outUnknownFeatureCount = nullptr);
+
+//Same, but makes the chain of the structures with the features set to true. The chain data is allocated once
+template<typename HeadType>
+bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, StructureChainBlob<HeadType>& outFeatureChain, uint32_t* outUnknownFeatureCount = nullptr);
+
+inline FeatureProfileReader::FeatureProfileReader(const char* profileData, size_t profileSize, const char* capabilityName): Cursor(profileData), DataEnd(profileData + profileSize), CapabilityName(capabilityName), Features(nullptr), UnknownFeatureCount(0), LastSType(FeatureStructureInfos[0].SType), LastFeatureOrdinal(0)
+{
+}
+
+inline FeatureProfileReader::~FeatureProfileReader()
+{
+}
+
+inline bool FeatureProfileReader::Read(FeatureBitset& features)
+{
+	Features = &features;
+
+	if(!ReadValue(CapabilityName == nullptr, 0))
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+	return Cursor == DataEnd;
+}
+
+inline uint32_t FeatureProfileReader::GetUnknownFeatureCount() const
+{
+	return UnknownFeatureCount;
+}
+
+inline bool FeatureProfileReader::ReadValue(bool insideCapability, uint32_t depth)
+{
+	SkipWhitespace();
+	if(Cursor == DataEnd || depth == MaxDepth)
+	{
+		return false;
+	}
+
+	if(*Cursor == '{')
+	{
+		Cursor++;
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == '}')
+		{
+			Cursor++;
+			return true;
+		}
+
+		while(true)
+		{
+			const char* key		  = nullptr;
+			size_t		keyLength = 0;
+
+			SkipWhitespace();
+			if(!ReadString(&key, &keyLength))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if(Cursor == DataEnd || *Cursor != ':')
+			{
+				return false;
+			}
+
+			Cursor++;
+
+			bool valueRead = false;
+			if(insideCapability && keyLength == 8 && memcmp(key, "features", 8) == 0)
+			{
+				valueRead = ReadFeatures(depth + 1);
+			}
+			else
+			{
+				valueRead = ReadValue(insideCapability || MatchesCapabilityName(key, keyLength), depth + 1);
+			}
+
+			if(!valueRead)
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if(Cursor != DataEnd && *Cursor == ',')
+			{
+				Cursor++;
+				continue;
+			}
+
+			if(Cursor != DataEnd && *Cursor == '}')
+			{
+				Cursor++;
+				return true;
+			}
+
+			return false;
+		}
+	}
+	else if(*Cursor == '[')
+	{
+		Cursor++;
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == ']')
+		{
+			Cursor++;
+			return true;
+		}
+
+		while(true)
+		{
+			if(!ReadValue(insideCapability, depth + 1))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if(Cursor != DataEnd && *Cursor == ',')
+			{
+				Cursor++;
+				continue;
+			}
+
+			if(Cursor != DataEnd && *Cursor == ']')
+			{
+				Cursor++;
+				return true;
+			}
+
+			return false;
+		}
+	}
+	else if(*Cursor == '"')
+	{
+		const char* value		= nullptr;
+		size_t		valueLength = 0;
+		return ReadString(&value, &valueLength);
+	}
+	else if(*Cursor == 't')
+	{
+		return ReadLiteral("true");
+	}
+	else if(*Cursor == 'f')
+	{
+		return ReadLiteral("false");
+	}
+	else if(*Cursor == 'n')
+	{
+		return ReadLiteral("null");
+	}
+	else
+	{
+		//Numbers are only skipped, so they are checked loosely
+		const char* numberStart = Cursor;
+		while(Cursor != DataEnd && ((*Cursor >= '0' && *Cursor <= '9') || *Cursor == '-' || *Cursor == '+' || *Cursor == '.' || *Cursor == 'e' || *Cursor == 'E'))
+		{
+			Cursor++;
+		}
+
+		return Cursor != numberStart;
+	}
+}
+
+inline bool FeatureProfileReader::ReadFeatures(uint32_t depth)
+{
+	SkipWhitespace();
+	if(Cursor == DataEnd || *Cursor != '{')
+	{
+		return ReadValue(true, depth);
+	}
+
+	Cursor++;
+
+	SkipWhitespace();
+	if(Cursor != DataEnd && *Cursor == '}')
+	{
+		Cursor++;
+		return true;
+	}
+
+	while(true)
+	{
+		const char* structureName		= nullptr;
+		size_t		structureNameLength = 0;
+
+		SkipWhitespace();
+		if(!ReadString(&structureName, &structureNameLength))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor == DataEnd || *Cursor != ':')
+		{
+			return false;
+		}
+
+		Cursor++;
+		if(!ReadFeatureStructure(structureName, structureNameLength, depth + 1))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == ',')
+		{
+			Cursor++;
+			continue;
+		}
+
+		if(Cursor != DataEnd && *Cursor == '}')
+		{
+			Cursor++;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+inline bool FeatureProfileReader::ReadFeatureStructure(const char* structureName, size_t structureNameLength, uint32_t depth)
+{
+	SkipWhitespace();
+	if(Cursor == DataEnd || *Cursor != '{')
+	{
+		return ReadValue(true, depth);
+	}
+
+	Cursor++;
+
+	SkipWhitespace();
+	if(Cursor != DataEnd && *Cursor == '}')
+	{
+		Cursor++;
+		return true;
+	}
+
+	uint64_t structureNameHash = HashName(NameHashBasis, structureName, structureNameLength);
+	structureNameHash		   = HashName(structureNameHash, ".", 1);
+
+	while(true)
+	{
+		const char* memberName		 = nullptr;
+		size_t		memberNameLength = 0;
+
+		SkipWhitespace();
+		if(!ReadString(&memberName, &memberNameLength))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor == DataEnd || *Cursor != ':')
+		{
+			return false;
+		}
+
+		Cursor++;
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == 't')
+		{
+			if(!ReadLiteral("true"))
+			{
+				return false;
+			}
+
+			uint64_t					  nameHash  = HashName(structureNameHash, memberName, memberNameLength);
+			const FeatureMemberNameEntry* nameEntry = FindFeatureMemberName(nameHash, structureName, structureNameLength, memberName, memberNameLength);
+			if(nameEntry != nullptr)
+			{
+				if(nameEntry->SType != LastSType)
+				{
+					LastSType		   = nameEntry->SType;
+					LastFeatureOrdinal = GetFeatureStructureOrdinal(nameEntry->SType);
+				}
+
+				Features->Set(FeatureBitRanges.FirstBits[LastFeatureOrdinal] + nameEntry->MemberIndex);
+			}
+			else
+			{
+				UnknownFeatureCount++;
+			}
+		}
+		else if(!ReadValue(true, depth + 1))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == ',')
+		{
+			Cursor++;
+			continue;
+		}
+
+		if(Cursor != DataEnd && *Cursor == '}')
+		{
+			Cursor++;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+inline bool FeatureProfileReader::ReadString(const char** outString, size_t* outStringLength)
+{
+	if(Cursor == DataEnd || *Cursor != '"')
+	{
+		return false;
+	}
+
+	Cursor++;
+
+	//Escaped names are returned as is, they don't match any structure or member name anyway
+	const char* stringStart = Cursor;
+	while(Cursor != DataEnd && *Cursor != '"')
+	{
+		if(*Cursor == '\\\\' && DataEnd - Cursor > 1)
+		{
+			Cursor++;
+		}
+
+		Cursor++;
+	}
+
+	if(Cursor == DataEnd)
+	{
+		return false;
+	}
+
+	*outString		 = stringStart;
+	*outStringLength = Cursor - stringStart;
+
+	Cursor++;
+	return true;
+}
+
+inline bool FeatureProfileReader::ReadLiteral(const char* literal)
+{
+	size_t literalLength = strlen(literal);
+	if((size_t)(DataEnd - Cursor) < literalLength || memcmp(Cursor, literal, literalLength) != 0)
+	{
+		return false;
+	}
+
+	Cursor += literalLength;
+	return true;
+}
+
+inline void FeatureProfileReader::SkipWhitespace()
+{
+	while(Cursor != DataEnd && (*Cursor == ' ' || *Cursor == '\\t' || *Cursor == '\\n' || *Cursor == '\\r'))
+	{
+		Cursor++;
+	}
+}
+
+inline bool FeatureProfileReader::MatchesCapabilityName(const char* key, size_t keyLength) const
+{
+	return CapabilityName != nullptr && strncmp(CapabilityName, key, keyLength) == 0 && CapabilityName[keyLength] == '\\0';
+}
+
+inline bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, FeatureBitset& outFeatures, uint32_t* outUnknownFeatureCount)
+{
+	outFeatures = FeatureBitset();
+
+	FeatureProfileReader profileReader((const char*)profileData, profileSize, capabilityName);
+	if(!profileReader.Read(outFeatures))
+	{
+		return false;
+	}
+
+	if(outUnknownFeatureCount != nullptr)
+	{
+		*outUnknownFeatureCount = profileReader.GetUnknownFeatureCount();
+	}
+
+	return true;
 }
 
 template<typename HeadType>
-inline StructureChainBlob<HeadType>::StructureChainBlob(const HeadType& head)
+inline bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, StructureChainBlob<HeadType>& outFeatureChain, uint32_t* outUnknownFeatureCount)
+{
+	static_assert(ValidStructureType<HeadType> == FeatureStructureInfos[0].SType, "Feature profiles are loaded into VkPhysicalDeviceFeatures2 chains");
+
+	FeatureBitset profileFeatures;
+	if(!LoadFeatureProfile(profileData, profileSize, capabilityName, profileFeatures, outUnknownFeatureCount))
+	{
+		return false;
+	}
+
+	FullFeatureChain profileFeatureChain = BuildFeatureChain(profileFeatures);
+	outFeatureChain = StructureChainBlob<HeadType>::Linearize(&profileFeatureChain.GetChainHeadAs<HeadType>());
+
+	return true;
+}
+
+//=================================================================================================================================================================
+
+constexpr bool ExtensionNamesEqual(const char* lhs, const char* rhs)
+{
+	size_t i = 0;
+	while(lhs[i] != '\\0' && lhs[i] == rhs[i])
+	{
+		i++;
+	}
+
+	return lhs[i] == rhs[i];
+}
+
+//Dense index of the extension with the given name (e.g. VK_EXT_DEBUG_REPORT_EXTENSION_NAME) in ExtensionNames, or NoExtensionIndex if the extension is unknown
+//Hashes the name once and does a single probe of the perfect hash table. Can be used in constant expressions
+constexpr uint32_t GetExtensionIndex(const char* extensionName)
+{
+	size_t nameLength = 0;
+	while(extensionName[nameLength] != '\\0')
+	{
+		nameLength++;
+	}
+
+	uint64_t nameHash		  = HashName(NameHashBasis, extensionName, nameLength);
+	uint32_t nameDisplacement = ExtensionNameDisplacements[(nameHash >> 32) % ExtensionNameBucketCount];
+
+	//The slot can be taken by another name, which is only found out by comparing
+	uint32_t extensionIndex = ExtensionNameSlots[MixHash(nameHash ^ nameDisplacement) % ExtensionNameSlotCount];
+	if(extensionIndex == NoExtensionIndex || !ExtensionNamesEqual(ExtensionNames[extensionIndex], extensionName))
+	{
+		return NoExtensionIndex;
+	}
+
+	return extensionIndex;
+}
+
+//Structure to add to a chain for each extension, e.g. VkDebugReportCallbackCreateInfoEXT for VK_EXT_debug_report
+//Stores one blob per extension index, so neither setting nor looking up a structure allocates a node or hashes a name more than once
+class ExtensionStructureTable
+{
+public:
+	ExtensionStructureTable();
+	~ExtensionStructureTable();
+
+	//Returns false if the extension is unknown to this header
+	bool SetStructure(const char* extensionName, const StructureBlob& structure);
+	void SetStructure(uint32_t extensionIndex, const StructureBlob& structure);
+
+	void RemoveStructure(uint32_t extensionIndex);
+
+	//Returns null if there's no structure for the extension
+	const StructureBlob* GetStructure(const char* extensionName) const;
+	const StructureBlob* GetStructure(uint32_t extensionIndex)   const;
+
+	//Appends the structures of the enabled extensions to the chain, in the order of the names. Extensions without a structure are skipped
+	void AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames) const;
+	void AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const uint32_t* enabledExtensionIndices)  const;
+
+private:
+	std::vector<StructureBlob> Structures; //ExtensionCount blobs, empty ones for the extensions without a structure
+};
+
+inline ExtensionStructureTable::ExtensionStructureTable(): Structures(ExtensionCount)
+{
+}
+
+inline ExtensionStructureTable::~ExtensionStructureTable()
+{
+}
+
+inline bool ExtensionStructureTable::SetStructure(const char* extensionName, const StructureBlob& structure)
+{
+	uint32_t extensionIndex = GetExtensionIndex(extensionName);
+	if(extensionIndex == NoExtensionIndex)
+	{
+		return false;
+	}
+
+	SetStructure(extensionIndex, structure);
+	return true;
+}
+
+inline void ExtensionStructureTable::SetStructure(uint32_t extensionIndex, const StructureBlob& structure)
+{
+	assert(extensionIndex < ExtensionCount);
+
+	Structures[extensionIndex] = structure;
+}
+
+inline void ExtensionStructureTable::RemoveStructure(uint32_t extensionIndex)
+{
+	assert(extensionIndex < ExtensionCount);
+
+	Structures[extensionIndex] = StructureBlob();
+}
+
+inline const StructureBlob* ExtensionStructureTable::GetStructure(const char* extensionName) const
+{
+	uint32_t extensionIndex = GetExtensionIndex(extensionName);
+	if(extensionIndex == NoExtensionIndex)
+	{
+		return nullptr;
+	}
+
+	return GetStructure(extensionIndex);
+}
+
+inline const StructureBlob* ExtensionStructureTable::GetStructure(uint32_t extensionIndex) const
+{
+	assert(extensionIndex < ExtensionCount);
+
+	const StructureBlob& structure = Structures[extensionIndex];
+	if(structure.GetStructureSize() == 0)
+	{
+		return nullptr;
+	}
+
+	return &structure;
+}
+
+inline void ExtensionStructureTable::AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames) const
+{
+	for(uint32_t i = 0; i < enabledExtensionCount; i++)
+	{
+		const StructureBlob* structure = GetStructure(enabledExtensionNames[i]);
+		if(structure != nullptr)
+		{
+			chain.AppendToChainGeneric(*structure);
+		}
+	}
+}
+
+inline void ExtensionStructureTable::AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const uint32_t* enabledExtensionIndices) const
+{
+	for(uint32_t i = 0; i < enabledExtensionCount; i++)
+	{
+		const StructureBlob* structure = GetStructure(enabledExtensionIndices[i]);
+		if(structure != nullptr)
+		{
+			chain.AppendToChainGeneric(*structure);
+		}
+	}
+}
+
+//=================================================================================================================================================================
+
+constexpr uint32_t ExtensionBitsetWordCount = (ExtensionCount == 0) ? 1 : (ExtensionCount + 63) / 64;
+
+//Set of the enabled extensions, one bit per extension index
+class ExtensionBitset
+{
+public:
+	ExtensionBitset();
+	ExtensionBitset(uint32_t enabledExtensionCount, const char* const* enabledExtensionNames);
+	~ExtensionBitset();
+
+	bool Test(uint32_t extensionIndex) const;
+	void Set(uint32_t extensionIndex, bool value = true);
+
+	//Returns false if the extension is unknown to this header
+	bool Set(const char* extensionName, bool value = true);
+
+private:
+	uint64_t Words[ExtensionBitsetWordCount];
+};
+
+//Returns true if the structure can be used with apiVersion (e.g. VK_API_VERSION_1_1) and the enabled extensions
+//Structures of unknown sType and the ones that have no known core version or extension to provide them are always supported
+bool IsStructureSupported(VulkanStructureType sType, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+
+//Unlinks all the structures not supported by apiVersion and the enabled extensions from the chain in a single pass, without copying or reallocating anything
+//The head is always kept. Returns the number of the unlinked structures
+size_t FilterByEnabled(void* chainHead, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+size_t FilterByEnabled(AnyStructureChainBlob& chain, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+
+inline ExtensionBitset::ExtensionBitset()
+{
+	memset(Words, 0, sizeof(Words));
+}
+
+inline ExtensionBitset::ExtensionBitset(uint32_t enabledExtensionCount, const char* const* enabledExtensionNames)
+{
+	memset(Words, 0, sizeof(Words));
+
+	for(uint32_t i = 0; i < enabledExtensionCount; i++)
+	{
+		Set(enabledExtensionNames[i]);
+	}
+}
+
+inline ExtensionBitset::~ExtensionBitset()
+{
+}
+
+inline bool ExtensionBitset::Test(uint32_t extensionIndex) const
+{
+	assert(extensionIndex < ExtensionCount);
+
+	return (Words[extensionIndex / 64] >> (extensionIndex % 64)) & 1;
+}
+
+inline void ExtensionBitset::Set(uint32_t extensionIndex, bool value)
+{
+	assert(extensionIndex < ExtensionCount);
+
+	uint64_t extensionMask = 1ull << (extensionIndex % 64);
+	Words[extensionIndex / 64] = value ? (Words[extensionIndex / 64] | extensionMask) : (Words[extensionIndex / 64] & ~extensionMask);
+}
+
+inline bool ExtensionBitset::Set(const char* extensionName, bool value)
+{
+	uint32_t extensionIndex = GetExtensionIndex(extensionName);
+	if(extensionIndex == NoExtensionIndex)
+	{
+		return false;
+	}
+
+	Set(extensionIndex, value);
+	return true;
+}
+
+inline bool IsStructureSupported(VulkanStructureType sType, uint32_t apiVersion, const ExtensionBitset& enabledExtensions)
+{
+	uint32_t ordinal = GetStructureOrdinal(sType);
+	if(ordinal == NoStructureOrdinal)
+	{
+		return true;
+	}
+
+	const StructureRequirement& requirement = StructureRequirements[ordinal];
+	if(requirement.CoreVersion == 0 && requirement.ProviderExtensionCount == 0)
+	{
+		return true;
+	}
+
+	if(requirement.CoreVersion != 0 && apiVersion >= requirement.CoreVersion)
+	{
+		return true;
+	}
+
+	for(uint32_t i = 0; i < requirement.ProviderExtensionCount; i++)
+	{
+		if(enabledExtensions.Test(StructureProviderExtensions[requirement.FirstProviderExtension + i]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+inline size_t FilterByEnabled(void* chainHead, uint32_t apiVersion, const ExtensionBitset& enabledExtensions)
+{
+	size_t removedCount = 0;
+
+	//Only the pNext of the last kept structure is ever written, the unlinked structures are left as they are
+	void*		prevLink = chainHead;
+	const void* link	 = GetChainLinkPNext(chainHead);
+	while(link != nullptr)
+	{
+		const void* nextLink = GetChainLinkPNext(link);
+		if(IsStructureSupported(GetChainLinkSType(link), apiVersion, enabledExtensions))
+		{
+			prevLink = (void*)link;
+		}
+		else
+		{
+			SetChainLinkPNext(prevLink, nextLink);
+			removedCount++;
+		}
+
+		link = nextLink;
+	}
+
+	return removedCount;
+}
+
+inline size_t FilterByEnabled(AnyStructureChainBlob& chain, uint32_t apiVersion, const ExtensionBitset& enabledExtensions)
+{
+	size_t removedCount = 0;
+	if(chain.NextLinkIndices.empty())
+	{
+		return removedCount;
+	}
+
+	//The storage of the unlinked structures is kept for reuse, same as with Remove()
+	size_t linkIndex = chain.NextLinkIndices[0];
+	while(linkIndex != AnyStructureChainBlob::NoLink)
+	{
+		size_t nextLinkIndex = chain.NextLinkIndices[linkIndex];
+		if(!IsStructureSupported(chain.GetLinkSType(linkIndex), apiVersion, enabledExtensions))
+		{
+			chain.RemoveLinkAt(linkIndex);
+			removedCount++;
+		}
+
+		linkIndex = nextLinkIndex;
+	}
+
+	return removedCount;
+}
+
+//=================================================================================================================================================================
+
+enum class ChainIssueKind: uint32_t
+{
+	Cycle,			  //pNext of the link points back to the chain
+	Duplicate,		  //The structure is already in the chain and can't be there more than once
+	InvalidExtension, //The structure can't extend the head of the chain
+	UnknownStructure  //The sType is unknown to this header, the structure is not checked
+};
+
+struct ChainIssue
+{
+	ChainIssueKind		Kind;
+	uint32_t			LinkIndex; //Position in the chain, the head is 0
+	VulkanStructureType SType;
+};
+
+constexpr uint32_t MaxReportedChainIssues = 8;
+
+//IssueCount counts all the found issues, only the first MaxReportedChainIssues of them are stored
+struct ChainValidationReport
+{
+	uint32_t   IssueCount;
+	ChainIssue Issues[MaxReportedChainIssues];
+};
+
+//Checks the pNext chain for a cycle, for the repeated structures that don't allow duplicates and for the structures that can't extend the head, same as the validation layers do
+//Doesn't allocate and takes a single pass over a chain without a cycle. Structures of unknown sType are reported but not checked, structures with unknown chain rule are only checked for a cycle
+ChainValidationReport ValidateChain(const void* chainHead);
+
+//One bit per StructureOrdinal
+constexpr uint32_t StructureOrdinalWordCount = StructureOrdinalCount / 64 + 1;
+
+inline void AddChainIssue(ChainValidationReport& report, ChainIssueKind kind, uint32_t linkIndex, VulkanStructureType sType)
+{
+	if(report.IssueCount < MaxReportedChainIssues)
+	{
+		report.Issues[report.IssueCount] = {kind, linkIndex, sType};
+	}
+
+	report.IssueCount++;
+}
+
+//A structure with unknown rule is assumed to extend anything
+inline bool CanExtendStructure(const StructureChainRule& chainRule, VulkanStructureType sType)
+{
+	if(chainRule.ExtendedSTypes == nullptr)
+	{
+		return true;
+	}
+
+	for(const VulkanStructureType* extendedSType = chainRule.ExtendedSTypes; *extendedSType != (VulkanStructureType)VK_STRUCTURE_TYPE_MAX_ENUM; extendedSType++)
+	{
+		if(*extendedSType == sType)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//Checks the first linkLimit links of the chain, the head included. Returns the length of the cycle the chain ends with, or 0 if there's no cycle
+//The cycle is found with Brent's algorithm: the tortoise jumps to the hare after every power of two steps, and they meet only if the chain loops
+inline uint32_t ValidateChainLinks(const void* chainHead, uint32_t linkLimit, ChainValidationReport& outReport)
+{
+	outReport.IssueCount = 0;
+
+	VulkanStructureType headSType	= GetChainLinkSType(chainHead);
+	uint32_t			headOrdinal = GetStructureOrdinal(headSType);
+
+	uint64_t foundStructures[StructureOrdinalWordCount];
+	memset(foundStructures, 0, sizeof(foundStructures));
+
+	if(headOrdinal != NoStructureOrdinal)
+	{
+		foundStructures[headOrdinal / 64] |= 1ull << (headOrdinal % 64);
+	}
+
+	uint32_t	power		= 1;
+	uint32_t	cycleLength = 1;
+	const void* tortoise	= chainHead;
+
+	const void* link = GetChainLinkPNext(chainHead);
+	for(uint32_t linkIndex = 1; linkIndex < linkLimit && link != nullptr; linkIndex++)
+	{
+		if(link == tortoise)
+		{
+			return cycleLength;
+		}
+
+		VulkanStructureType sType	= GetChainLinkSType(link);
+		uint32_t			ordinal = GetStructureOrdinal(sType);
+		if(ordinal == NoStructureOrdinal)
+		{
+			AddChainIssue(outReport, ChainIssueKind::UnknownStructure, linkIndex, sType);
+		}
+		else if(StructureChainRules[ordinal].ExtendedSTypes != nullptr) //Structures with unknown rule can't be checked
+		{
+			const StructureChainRule& chainRule = StructureChainRules[ordinal];
+
+			uint64_t ordinalMask = 1ull << (ordinal % 64);
+			if((foundStructures[ordinal / 64] & ordinalMask) != 0 && !chainRule.AllowDuplicates)
+			{
+				AddChainIssue(outReport, ChainIssueKind::Duplicate, linkIndex, sType);
+			}
+
+			foundStructures[ordinal / 64] |= ordinalMask;
+
+			if(headOrdinal != NoStructureOrdinal && !CanExtendStructure(chainRule, headSType))
+			{
+				AddChainIssue(outReport, ChainIssueKind::InvalidExtension, linkIndex, sType);
+			}
+		}
+
+		if(cycleLength == power)
+		{
+			tortoise	= link;
+			power	   *= 2;
+			cycleLength = 0;
+		}
+
+		link = GetChainLinkPNext(link);
+		cycleLength++;
+	}
+
+	return 0;
+}
+
+inline ChainValidationReport ValidateChain(const void* chainHead)
+{
+	ChainValidationReport report;
+
+	uint32_t cycleLength = ValidateChainLinks(chainHead, (uint32_t)(-1), report);
+	if(cycleLength == 0)
+	{
+		return report;
+	}
+
+	//The hare walked the cycle more than once, so the links are checked again up to the end of the first lap. The cycle starts where two pointers cycleLength apart meet
+	const void* tortoise = chainHead;
+	const void* hare	 = chainHead;
+	for(uint32_t i = 0; i < cycleLength; i++)
+	{
+		hare = GetChainLinkPNext(hare);
+	}
+
+	uint32_t cycleStart = 0;
+	while(tortoise != hare)
+	{
+		tortoise = GetChainLinkPNext(tortoise);
+		hare	 = GetChainLinkPNext(hare);
+		cycleStart++;
+	}
+
+	uint32_t uniqueLinkCount = cycleStart + cycleLength;
+	ValidateChainLinks(chainHead, uniqueLinkCount, report);
+
+	const void* lastLink = chainHead;
+	for(uint32_t i = 1; i < uniqueLinkCount; i++)
+	{
+		lastLink = GetChainLinkPNext(lastLink);
+	}
+
+	AddChainIssue(report, ChainIssueKind::Cycle, uniqueLinkCount - 1, GetChainLinkSType(lastLink));
+	return report;
+}
+
+//=================================================================================================================================================================
+
+constexpr size_t PNextEditorInlineSize = 512;
+
+//Edits a const pNext chain without modifying it, e.g. in a layer that adds or removes a structure before calling down the chain
+//Only the structures in front of the edits are copied, shallowly: pointer members keep pointing to the original data, and the rest of the chain is shared with the original
+//The copies are stored inside the editor, the heap is only used for the ones that don't fit in PNextEditorInlineSize bytes
+class PNextEditor
+{
+public:
+	explicit PNextEditor(const void* chainHead);
+	~PNextEditor();
+
+	//The copies point to each other and into the editor itself
+	PNextEditor(const PNextEditor& rhs)			   = delete;
+	PNextEditor& operator=(const PNextEditor& rhs) = delete;
+
+	//The edited chain, which is the original one until the first edit
+	const void* GetChainHead() const;
+
+	template<typename HeadType>
+	const HeadType& GetChainHeadAs() const;
+
+	//Copies the structure into the editor and links it right after the head. The head has to be known to this header
+	template<typename Struct>
+	Struct& Insert(const Struct& value);
+
+	//Unlinks the occurrence-th structure of the type Struct
+	//Returns false if there's no such structure, or if there's a structure of unknown sType in front of it that can't be copied
+	template<typename Struct>
+	bool Remove(size_t occurrence = 0);
+
+	bool RemoveGeneric(VulkanStructureType sType, size_t occurrence = 0);
+
+	//Number of the structures at the front of the edited chain that are owned by the editor, the head included
+	uint32_t GetWritableLinkCount() const;
+
+private:
+	void* AllocateLinkData(size_t dataSize);
+
+	//Copies the structures of the original chain up to linkIndex, so their pNext can be changed. Returns the structure at linkIndex, or null if some structure can't be copied
+	void* MakeLinkWritable(uint32_t linkIndex);
+
+private:
+	alignas(ChainLinkDataAlignment) std::byte InlineData[PNextEditorInlineSize];
+	size_t									  InlineDataSize;
+
+	std::vector<std::vector<std::byte>> OverflowData; //One allocation per structure, so the copies never move
+
+	const void* ChainHead;
+	void*		LastWritableLink;
+	uint32_t	WritableLinkCount;
+};
+
+inline PNextEditor::PNextEditor(const void* chainHead): InlineDataSize(0), ChainHead(chainHead), LastWritableLink(nullptr), WritableLinkCount(0)
+{
+	assert(chainHead != nullptr);
+}
+
+inline PNextEditor::~PNextEditor()
+{
+}
+
+inline const void* PNextEditor::GetChainHead() const
+{
+	return ChainHead;
+}
+
+template<typename HeadType>
+inline const HeadType& PNextEditor::GetChainHeadAs() const
+{
+	assert(GetChainLinkSType(ChainHead) == ValidStructureType<HeadType>);
+
+	return *(const HeadType*)ChainHead;
+}
+
+template<typename Struct>
+inline Struct& PNextEditor::Insert(const Struct& value)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "Structures inserted with PNextEditor must be trivially destructible");
+
+	void* head = MakeLinkWritable(0);
+	assert(head != nullptr); //Unknown head
+
+	Struct* link = new(AllocateLinkData(sizeof(Struct))) Struct(value);
+	InitSType(link, offsetof(Struct, sType), ValidStructureType<Struct>);
+
+	SetChainLinkPNext(link, GetChainLinkPNext(head));
+	SetChainLinkPNext(head, link);
+
+	if(WritableLinkCount == 1)
+	{
+		LastWritableLink = link;
+	}
+
+	WritableLinkCount++;
+	return *link;
+}
+
+template<typename Struct>
+inline bool PNextEditor::Remove(size_t occurrence)
 {
-	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+	return RemoveGeneric(ValidStructureType<Struct>, occurrence);
+}
+
+inline bool PNextEditor::RemoveGeneric(VulkanStructureType sType, size_t occurrence)
+{
+	uint32_t	linkIndex = 1;
+	const void* link	  = GetChainLinkPNext(ChainHead);
+	while(link != nullptr)
+	{
+		if(GetChainLinkSType(link) == sType)
+		{
+			if(occurrence == 0)
+			{
+				break;
+			}
+
+			occurrence--;
+		}
+
+		link = GetChainLinkPNext(link);
+		linkIndex++;
+	}
+
+	if(link == nullptr)
+	{
+		return false;
+	}
+
+	void* prevLink = MakeLinkWritable(linkIndex - 1);
+	if(prevLink == nullptr)
+	{
+		return false;
+	}
+
+	//The removed structure itself is never copied, the original one may be shared with the rest of the chain
+	SetChainLinkPNext(prevLink, GetChainLinkPNext(link));
+
+	if(linkIndex < WritableLinkCount)
+	{
+		if(linkIndex == WritableLinkCount - 1)
+		{
+			LastWritableLink = prevLink;
+		}
+
+		WritableLinkCount--;
+	}
+
+	return true;
+}
+
+inline uint32_t PNextEditor::GetWritableLinkCount() const
+{
+	return WritableLinkCount;
+}
+
+inline void* PNextEditor::AllocateLinkData(size_t dataSize)
+{
+	size_t alignedSize = (dataSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+	if(InlineDataSize + alignedSize <= PNextEditorInlineSize)
+	{
+		void* linkData = InlineData + InlineDataSize;
+		InlineDataSize += alignedSize;
+
+		return linkData;
+	}
+
+	OverflowData.emplace_back(alignedSize);
+	return OverflowData.back().data();
+}
+
+inline void* PNextEditor::MakeLinkWritable(uint32_t linkIndex)
+{
+	if(WritableLinkCount == 0)
+	{
+		size_t headSize = GetSTypeStructureSize(GetChainLinkSType(ChainHead));
+		if(headSize == 0)
+		{
+			return nullptr;
+		}
+
+		void* head = AllocateLinkData(headSize);
+		memcpy(head, ChainHead, headSize);
+
+		ChainHead		  = head;
+		LastWritableLink  = head;
+		WritableLinkCount = 1;
+	}
+
+	while(WritableLinkCount <= linkIndex)
+	{
+		const void* link = GetChainLinkPNext(LastWritableLink);
+		assert(link != nullptr);
+
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize == 0)
+		{
+			return nullptr;
+		}
+
+		void* linkCopy = AllocateLinkData(linkSize);
+		memcpy(linkCopy, link, linkSize);
+
+		SetChainLinkPNext(LastWritableLink, linkCopy);
+
+		LastWritableLink = linkCopy;
+		WritableLinkCount++;
+	}
+
+	//The writable links are at the front, so this is a walk over the copies only
+	void* writableLink = (void*)ChainHead;
+	for(uint32_t i = 0; i < linkIndex; i++)
+	{
+		writableLink = (void*)GetChainLinkPNext(writableLink);
+	}
+
+	return writableLink;
+}
+
+}
+
+namespace std
+{
+	template<>
+	struct hash<vgs::StructureTreeKey>
+	{
+		size_t operator()(const vgs::StructureTreeKey& structureTreeKey) const
+		{
+			return (size_t)structureTreeKey.Hash[0];
+		}
+	};
+
+	template<>
+	struct hash<vgs::StructureBlob>
+	{
+		size_t operator()(const vgs::StructureBlob& structureBlob) const
+		{
+			return (size_t)structureBlob.Hash();
+		}
+	};
+
+	template<>
+	struct hash<vgs::AnyStructureChainBlob>
+	{
+		size_t operator()(const vgs::AnyStructureChainBlob& structureChainBlob) const
+		{
+			return (size_t)structureChainBlob.Hash();
+		}
+	};
+
+	template<typename HeadType>
+	struct hash<vgs::StructureChainBlob<HeadType>>
+	{
+		size_t operator()(const vgs::StructureChainBlob<HeadType>& structureChainBlob) const
+		{
+			return (size_t)structureChainBlob.Hash();
+		}
+	};
+}
+
+#endif
+"""
+
+def open_vk_spec(url):
+	with urllib.request.urlopen(url) as response:
+		spec_data = response.read()
+		return spec_data.decode("utf8")
+
+#A local copy of vk.xml, e.g. from the Vulkan-Headers of an SDK, for generating the headers offline
+def open_vk_spec_file(path):
+	with open(path, "r", encoding="utf8") as spec_file:
+		return spec_file.read()
+
+def parse_structs(spec_soup):
+	spec_type_kinds = parse_type_kinds(spec_soup)
+
+	spec_platform_defines = {}
+
+	spec_platforms_block = spec_soup.find("platforms")
+	if spec_platforms_block is not None:
+		spec_platform_tags = spec_platforms_block.find_all("platform")
+		for platform_tag in spec_platform_tags:
+			spec_platform_defines[platform_tag["name"]] = platform_tag["protect"]
+
+	spec_struct_extensions = {}
+	extension_define_names = {}
+
+	#Extensions and core versions that provide each type, for deciding at runtime which structures apply
+	spec_struct_provider_extensions = {}
+	spec_struct_core_versions       = {}
+
+	feature_blocks = spec_soup.find_all("feature")
+	for feature_block in feature_blocks:
+		if "api" in feature_block.attrs and "vulkan" not in feature_block["api"].split(","):
+			continue
+
+		for type_tag in feature_block.find_all("type"):
+			if type_tag["name"] not in spec_struct_core_versions:
+				spec_struct_core_versions[type_tag["name"]] = feature_block["name"]
+
+	extension_blocks = spec_soup.find_all("extension")
+	for extension_block in extension_blocks:
+		extension_name = extension_block["name"]
+
+		extension_define_tag = extension_block.find("enum", {"value": re.compile(".*" + extension_name +".*")})
+		if extension_define_tag is None:
+			continue
+
+		extension_define_name = extension_define_tag["name"]
+		if extension_define_name is None:
+			continue
+
+		extension_define_names[extension_name] = extension_define_name
+
+		extension_require_blocks = extension_block.find_all("require")
+		for extension_require_block in extension_require_blocks:
+			extension_types = []
+
+			extension_type_tags = extension_require_block.find_all("type")
+			for type_tag in extension_type_tags:
+				extension_defined_type = type_tag["name"]
+				if extension_defined_type is not None:
+					extension_types.append(extension_defined_type)
+
+			extension_platform = ""
+			if "platform" in extension_block.attrs:
+				extension_platform = extension_block["platform"]
+
+			extension_platform_define = ""
+			if extension_platform in spec_platform_defines:
+				extension_platform_define = spec_platform_defines[extension_platform]
+
+			extension_names = [extension_name]
+			if "extension" in extension_require_block.attrs:
+				extension_names.append(extension_require_block["extension"])
+
+			for extension_type in extension_types:
+				spec_struct_extensions[extension_type] = (extension_name, extension_names, extension_platform_define)
+
+				provider_extensions = spec_struct_provider_extensions.setdefault(extension_type, [])
+				if extension_block.get("supported") != "disabled" and extension_name not in provider_extensions:
+					provider_extensions.append(extension_name)
+				
+	structs = []
+
+	struct_blocks = spec_soup.find_all("type", {"category": "struct"})
+
+	#Promoted structures are provided by the extensions under their old names, e.g. VkPhysicalDeviceVulkanMemoryModelFeaturesKHR
+	struct_alias_names = {}
+	for struct_block in struct_blocks:
+		if "alias" in struct_block.attrs:
+			struct_alias_names.setdefault(struct_block["alias"], []).append(struct_block["name"])
+
+	for struct_block in struct_blocks:
+		struct_type = struct_block["name"]
+
+		#Structures without sType (e.g. VkAttachmentReference) are kept too, they can be pointed to by other structures
+		stype = ""
+		for member_tag in struct_block.find_all("member"):
+			name_tag = member_tag.find("name")
+			if "values" in member_tag.attrs and name_tag is not None and name_tag.string == "sType":
+				stype = member_tag["values"]
+				break
+
+		#Bitfield members can't be used in offsetof, the layout of such structures is left unknown
+		struct_members = []
+		for member_tag in struct_block.find_all("member"):
+			if "api" in member_tag.attrs and "vulkan" not in member_tag["api"].split(","):
+				continue
+
+			name_tag = member_tag.find("name")
+			if name_tag is None:
+				continue
+
+			if name_tag.next_sibling is not None and str(name_tag.next_sibling).strip().startswith(":"):
+				struct_members = []
+				break
+
+			struct_members.append(parse_struct_member(member_tag, name_tag, spec_type_kinds))
+
+		extension_defines = []
+		platform_define   = ""
+
+		if struct_type in spec_struct_extensions:
+			struct_requires = spec_struct_extensions[struct_type]
+
+			extension_defines = [extension_define_names[extension_name] for extension_name in struct_requires[1]]
+			platform_define   = struct_requires[2]
+
+		struct_extends = []
+		if "structextends" in struct_block.attrs:
+			struct_extends = struct_block["structextends"].split(",")
+
+		core_version        = ""
+		provider_extensions = []
+		for struct_name in [struct_type] + struct_alias_names.get(struct_type, []):
+			if core_version == "" and struct_name in spec_struct_core_versions:
+				core_version = spec_struct_core_versions[struct_name]
+
+			for provider_extension in spec_struct_provider_extensions.get(struct_name, []):
+				if provider_extension not in provider_extensions:
+					provider_extensions.append(provider_extension)
+
+		#Structures that are only ever filled by the implementation, e.g. VkPhysicalDeviceProperties2
+		returned_only = struct_block.get("returnedonly") == "true"
+
+		#Structures that can be in the same chain more than once, e.g. VkDebugUtilsMessengerCreateInfoEXT
+		allow_duplicate = struct_block.get("allowduplicate") == "true"
+
+		structs.append((struct_type, stype, extension_defines, platform_define, struct_members, struct_extends, core_version, provider_extensions, returned_only, struct_alias_names.get(struct_type, []), allow_duplicate))
+
+	return structs
+
+#Names of all the extensions that are not disabled, sorted. The position of a name is its extension index
+def parse_extension_names(spec_soup):
+	extension_names = []
+
+	extension_blocks = spec_soup.find_all("extension")
+	for extension_block in extension_blocks:
+		if "vulkan" not in extension_block.get("supported", "").split(","):
+			continue
+
+		extension_names.append(extension_block["name"])
+
+	return sorted(extension_names)
+
+#Kind of every type of vk.xml that tells what the type holds, for the reflection tables
+def parse_type_kinds(spec_soup):
+	type_kinds   = {}
+	type_aliases = {}
+
+	for type_tag in spec_soup.find_all("type", {"category": True}):
+		type_name = type_tag.get("name")
+		if type_name is None:
+			name_tag = type_tag.find("name")
+			if name_tag is None:
+				continue
+
+			type_name = name_tag.string
+
+		if "alias" in type_tag.attrs:
+			type_aliases[type_name] = type_tag["alias"]
+			continue
+
+		type_category = type_tag["category"]
+		if type_category == "bitmask":
+			base_type_tag = type_tag.find("type")
+			type_kinds[type_name] = "Flags64" if base_type_tag is not None and base_type_tag.string == "VkFlags64" else "Flags"
+		elif type_category == "enum":
+			type_kinds[type_name] = "Enum"
+		elif type_category == "handle":
+			type_kinds[type_name] = "Handle"
+		elif type_category == "funcpointer":
+			type_kinds[type_name] = "FunctionPointer"
+		elif type_category == "struct":
+			type_kinds[type_name] = "Struct"
+		elif type_category == "union":
+			type_kinds[type_name] = "Union"
+
+	for alias_name, alias_target in type_aliases.items():
+		if alias_target in type_kinds:
+			type_kinds[alias_name] = type_kinds[alias_target]
+
+	return type_kinds
+
+#Member declaration as written in vk.xml, e.g. "const <type>char</type>* const* <name>ppEnabledExtensionNames</name>"
+def parse_struct_member(member_tag, name_tag, type_kinds):
+	declaration_prefix = ""
+	for member_part in member_tag.contents:
+		if member_part is name_tag:
+			break
+
+		if member_part.name is None:
+			declaration_prefix += str(member_part)
+		elif member_part.name != "comment":
+			declaration_prefix += member_part.get_text()
+
+	type_tag = member_tag.find("type")
+
+	member_data = {}
+	member_data["name"]          = name_tag.string
+	member_data["type"]          = type_tag.string if type_tag is not None else ""
+	member_data["const"]         = declaration_prefix.strip().startswith("const")
+	member_data["pointer_depth"] = declaration_prefix.count("*")
+	member_data["array"]         = name_tag.next_sibling is not None and str(name_tag.next_sibling).strip().startswith("[")
+	member_data["len"]           = member_tag["len"]    if "len"    in member_tag.attrs else ""
+	member_data["altlen"]        = member_tag["altlen"] if "altlen" in member_tag.attrs else ""
+	member_data["kind"]          = reflection_scalar_kinds.get(member_data["type"], type_kinds.get(member_data["type"], "Other"))
+
+	return member_data
+
+def select_stypes(structs):
+	stypes = [struct for struct in structs if struct[1] != ""]
+
+	stypes = sorted(stypes, key=lambda struct_data: struct_data[2])
+	stypes = sorted(stypes, key=lambda struct_data: struct_data[3])
+
+	return stypes
+
+def compile_stype_guard(stype):
+	guard_data = "#if "
+
+	if len(stype[2]) != 0:
+		guard_data += "defined(" + stype[2][0] + ")"
+
+		for extra_extension_define in stype[2][1:]:
+			guard_data += " && defined(" + extra_extension_define + ")"
+
+		if stype[3] != "":
+			guard_data += " && "
+
+	if stype[3] != "":
+		guard_data += "defined(" + stype[3] + ")"
+
+	return guard_data
+
+#Compiles switch cases for every structure, grouped under extension and platform guards
+def compile_guarded_switch_cases(stypes, compile_case):
+	cpp_data = ""
+
+	current_extension_defines = []
+	current_platform_define   = ""
+	for stype in stypes:
+		if current_extension_defines != stype[2] or current_platform_define != stype[3]:
+			if len(current_extension_defines) != 0 or current_platform_define != "":
+				cpp_data += "#endif\n"
+
+			if len(stype[2]) != 0 or stype[3] != "":
+				cpp_data += compile_stype_guard(stype) + "\n"
+
+			current_extension_defines = stype[2]
+			current_platform_define   = stype[3]
+
+		cpp_data += compile_case(stype)
+
+	if len(current_extension_defines) != 0 or current_platform_define != "":
+		cpp_data += "#endif\n"
+
+	return cpp_data
+
+#The tables are compiled with C structure names for both headers, vulkan.hpp includes vulkan.h
+def compile_structure_size_table(stypes, stype_switch_value):
+	cpp_data = ""
+
+	cpp_data += "\n"
+	cpp_data += "//Returns the size of the structure with the given sType, or 0 if the sType is unknown\n"
+	cpp_data += "inline size_t GetSTypeStructureSize(VulkanStructureType sType)\n"
+	cpp_data += "{\n"
+	cpp_data += "\tswitch(" + stype_switch_value + ")\n"
+	cpp_data += "\t{\n"
+
+	cpp_data += compile_guarded_switch_cases(stypes, lambda stype: "\tcase " + stype[1] + ": return sizeof(" + stype[0] + ");\n")
+
+	cpp_data += "\tdefault: return 0;\n"
+	cpp_data += "\t}\n"
+	cpp_data += "}\n"
+
+	return cpp_data
+
+#Dense ordinals are an enum with guarded enumerators, so they only count the structures available in the current configuration
+#All the tables indexed by the ordinal are emitted under the same guards in the same order
+def compile_structure_visit_table(stypes, type_prefix, stype_value_format):
+	def type_name(struct_name):
+		return type_prefix + struct_name[2:]
+
+	cpp_data = ""
+
+	cpp_data += "\n"
+	cpp_data += "//Dense index of every structure with sType, in the order of the generated tables\n"
+	cpp_data += "enum class StructureOrdinal: uint32_t\n"
+	cpp_data += "{\n"
+
+	cpp_data += compile_guarded_switch_cases(stypes, lambda stype: "\t" + stype[0] + ",\n")
+
+	cpp_data += "\tCount\n"
+	cpp_data += "};\n"
+
+	cpp_data += header_structure_visit
+
+	cpp_data += "\n"
+	cpp_data += "inline constexpr VulkanStructureType StructureOrdinalSTypes[] =\n"
+	cpp_data += "{\n"
+
+	cpp_data += compile_guarded_switch_cases(stypes, lambda stype: "\t" + stype_value_format.format(stype[1]) + ",\n")
+
+	cpp_data += "};\n"
+	cpp_data += "\n"
+	cpp_data += "constexpr STypeOrdinalHashTable MakeSTypeOrdinalHashTable()\n"
+	cpp_data += "{\n"
+	cpp_data += "\tSTypeOrdinalHashTable hashTable = {};\n"
+	cpp_data += "\tfor(uint32_t slot = 0; slot < STypeOrdinalSlotCount; slot++)\n"
+	cpp_data += "\t{\n"
+	cpp_data += "\t\thashTable.SlotOrdinals[slot] = NoStructureOrdinal;\n"
+	cpp_data += "\t}\n"
+	cpp_data += "\n"
+	cpp_data += "\tfor(uint32_t ordinal = 0; ordinal < StructureOrdinalCount; ordinal++)\n"
+	cpp_data += "\t{\n"
+	cpp_data += "\t\tuint32_t sTypeValue = (uint32_t)StructureOrdinalSTypes[ordinal];\n"
+	cpp_data += "\n"
+	cpp_data += "\t\tuint32_t slot = GetSTypeOrdinalSlot(sTypeValue);\n"
+	cpp_data += "\t\twhile(hashTable.SlotOrdinals[slot] != NoStructureOrdinal)\n"
+	cpp_data += "\t\t{\n"
+	cpp_data += "\t\t\tslot = (slot + 1) & (STypeOrdinalSlotCount - 1);\n"
+	cpp_data += "\t\t}\n"
+	cpp_data += "\n"
+	cpp_data += "\t\thashTable.SlotSTypes[slot]   = sTypeValue;\n"
+	cpp_data += "\t\thashTable.SlotOrdinals[slot] = ordinal;\n"
+	cpp_data += "\t}\n"
+	cpp_data += "\n"
+	cpp_data += "\treturn hashTable;\n"
+	cpp_data += "}\n"
+	cpp_data += "\n"
+	cpp_data += "inline constexpr STypeOrdinalHashTable STypeOrdinals = MakeSTypeOrdinalHashTable();\n"
+	cpp_data += "\n"
+	cpp_data += "//Returns the dense ordinal of the structure with the given sType, or NoStructureOrdinal if the sType is unknown\n"
+	cpp_data += "constexpr uint32_t GetStructureOrdinal(VulkanStructureType sType)\n"
+	cpp_data += "{\n"
+	cpp_data += "\tuint32_t sTypeValue = (uint32_t)sType;\n"
+	cpp_data += "\n"
+	cpp_data += "\tuint32_t slot = GetSTypeOrdinalSlot(sTypeValue);\n"
+	cpp_data += "\twhile(STypeOrdinals.SlotOrdinals[slot] != NoStructureOrdinal)\n"
+	cpp_data += "\t{\n"
+	cpp_data += "\t\tif(STypeOrdinals.SlotSTypes[slot] == sTypeValue)\n"
+	cpp_data += "\t\t{\n"
+	cpp_data += "\t\t\treturn STypeOrdinals.SlotOrdinals[slot];\n"
+	cpp_data += "\t\t}\n"
+	cpp_data += "\n"
+	cpp_data += "\t\tslot = (slot + 1) & (STypeOrdinalSlotCount - 1);\n"
+	cpp_data += "\t}\n"
+	cpp_data += "\n"
+	cpp_data += "\treturn NoStructureOrdinal;\n"
+	cpp_data += "}\n"
+
+	cpp_data += "\n"
+	cpp_data += "//Reverse of ValidStructureType: StructureTypeToType<sType>::Type is the structure type\n"
+	cpp_data += "template<VulkanStructureType SType>\n"
+	cpp_data += "struct StructureTypeToType\n"
+	cpp_data += "{\n"
+	cpp_data += "};\n"
+
+	def compile_reverse_mapping(stype):
+		mapping_data = ""
+		mapping_data += "\n"
+		mapping_data += "template<>\n"
+		mapping_data += "struct StructureTypeToType<" + stype_value_format.format(stype[1]) + ">\n"
+		mapping_data += "{\n"
+		mapping_data += "\tusing Type = " + type_name(stype[0]) + ";\n"
+		mapping_data += "\tstatic constexpr StructureOrdinal Ordinal = StructureOrdinal::" + stype[0] + ";\n"
+		mapping_data += "};\n"
+		return mapping_data
+
+	cpp_data += compile_guarded_switch_cases(stypes, compile_reverse_mapping)
+
+	cpp_data += "\n"
+	cpp_data += "template<typename Visitor>\n"
+	cpp_data += "inline constexpr StructureVisitFunction<Visitor> StructureVisitFunctions[] =\n"
+	cpp_data += "{\n"
+
+	cpp_data += compile_guarded_switch_cases(stypes, lambda stype: "\t&VisitStructureAs<" + type_name(stype[0]) + ", Visitor>,\n")
+
+	cpp_data += "};\n"
+
+	return cpp_data
+
+def compile_member_range_case(stype):
+	member_ranges = ["{offsetof(" + stype[0] + ", " + member["name"] + "), sizeof(" + stype[0] + "::" + member["name"] + ")}" for member in stype[4] if member["name"] != "pNext"]
+
+	cpp_data = ""
+	cpp_data += "\tcase " + stype[1] + ":\n"
+	cpp_data += "\t{\n"
+	cpp_data += "\t\tstatic constexpr StructureMemberRange memberRanges[] = {" + ", ".join(member_ranges) + "};\n"
+	cpp_data += "\t\t*outRangeCount = " + str(len(member_ranges)) + ";\n"
+	cpp_data += "\t\treturn memberRanges;\n"
+	cpp_data += "\t}\n"
+
+	return cpp_data
+
+def compile_member_range_table(stypes, stype_switch_value):
+	cpp_data = ""
+
+	cpp_data += header_member_range
+	cpp_data += "\n"
+	known_stypes = [stype for stype in stypes if len(stype[4]) != 0]
+
+	#The parameter is left unnamed if there's no switch to use it in
+	stype_parameter = "VulkanStructureType sType" if len(known_stypes) != 0 else "VulkanStructureType"
+
+	cpp_data += "//Returns the byte ranges of all structure members except pNext, or nullptr if the structure layout is unknown\n"
+	cpp_data += "inline const StructureMemberRange* GetSTypeMemberRanges(" + stype_parameter + ", size_t* outRangeCount)\n"
+	cpp_data += "{\n"
+
+	if len(known_stypes) != 0:
+		cpp_data += "\tswitch(" + stype_switch_value + ")\n"
+		cpp_data += "\t{\n"
+
+		cpp_data += compile_guarded_switch_cases(known_stypes, compile_member_range_case)
+
+		cpp_data += "\tdefault:\n"
+		cpp_data += "\t\tbreak;\n"
+		cpp_data += "\t}\n"
+		cpp_data += "\n"
+
+	cpp_data += "\t*outRangeCount = 0;\n"
+	cpp_data += "\treturn nullptr;\n"
+	cpp_data += "}\n"
+
+	return cpp_data
+
+def compile_returned_only_table(stypes, stype_switch_value):
+	returned_only_stypes = [stype for stype in stypes if stype[8]]
+
+	cpp_data = ""
+
+	cpp_data += "\n"
+	cpp_data += "//Returns true if the structure is only ever filled by the implementation (returnedonly in vk.xml), e.g. VkPhysicalDeviceProperties2\n"
+	cpp_data += "inline bool IsSTypeReturnedOnly(VulkanStructureType sType)\n"
+	cpp_data += "{\n"
+	cpp_data += "\tswitch(" + stype_switch_value + ")\n"
+	cpp_data += "\t{\n"
+
+	if len(returned_only_stypes) != 0:
+		cpp_data += compile_guarded_switch_cases(returned_only_stypes, lambda stype: "\tcase " + stype[1] + ":\n")
+		cpp_data += "\t\treturn true;\n"
+
+	cpp_data += "\tdefault:\n"
+	cpp_data += "\t\treturn false;\n"
+	cpp_data += "\t}\n"
+	cpp_data += "}\n"
+
+	return cpp_data
+
+#Returns (kind, count member, count add, count divisor) for a pointer member that can be deep-copied, or None
+#Opaque pointers (void* without len), non-const pointers and pointers to pointers other than string arrays are left as is
+def classify_pointer_member(struct_members, member):
+	if member["name"] == "pNext" or member["pointer_depth"] == 0 or not member["const"] or member["array"]:
+		return None
+
+	count_members = [count_member["name"] for count_member in struct_members if count_member["pointer_depth"] == 0 and not count_member["array"]]
+
+	len_parts = member["len"].split(",") if member["len"] != "" else []
+	if member["type"] == "char":
+		if member["pointer_depth"] == 1 and len_parts == ["null-terminated"]:
+			return ("String", "", 0, 1)
+
+		if member["pointer_depth"] == 2 and len(len_parts) == 2 and len_parts[0] in count_members and len_parts[1] == "null-terminated":
+			return ("StringArray", len_parts[0], 0, 1)
+
+		return None
+
+	if member["pointer_depth"] != 1:
+		return None
+
+	if len(len_parts) == 0:
+		if member["type"] == "void":
+			return None
+
+		return ("Array", "", 0, 1)
+
+	if len(len_parts) == 1 and len_parts[0] in count_members:
+		return ("Array", len_parts[0], 0, 1)
+
+	#Lengths like "codeSize / 4" or "(rasterizationSamples + 31) / 32" are only given in altlen
+	altlen_match = re.fullmatch(r"\(?(\w+)(?: \+ (\d+))?\)? / (\d+)", member["altlen"])
+	if altlen_match is not None and altlen_match.group(1) in count_members:
+		return ("Array", altlen_match.group(1), int(altlen_match.group(2) or "0"), int(altlen_match.group(3)))
+
+	return None
 
-	//Store head in the blob
-	StructureChainBlobData.resize(sizeof(HeadType));
+def is_guard_subset(inner_struct, outer_struct):
+	return set(inner_struct[2]).issubset(set(outer_struct[2])) and (inner_struct[3] == "" or inner_struct[3] == outer_struct[3])
 
-	memcpy(StructureChainBlobData.data(), &head, sizeof(HeadType));
+def compile_pointer_member(struct, member, pointer_kind, element_layout_name, element_ranges):
+	if pointer_kind[0] == "String":
+		element_size = "sizeof(char)"
+	elif pointer_kind[0] == "StringArray":
+		element_size = "sizeof(const char*)"
+	elif member["type"] == "void":
+		element_size = "1"
+	else:
+		element_size = "sizeof(" + member["type"] + ")"
 
-	StructureDataPointers.push_back(StructureChainBlobData.data());
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	count_offset = "0"
+	count_size   = "0"
+	if pointer_kind[1] != "":
+		count_offset = "offsetof(" + struct[0] + ", " + pointer_kind[1] + ")"
+		count_size   = "sizeof(" + struct[0] + "::" + pointer_kind[1] + ")"
 
-	VulkanStructureType headSType = ValidStructureType<HeadType>;
-	void*			   headPNext = nullptr;
+	element_layout = "&" + element_layout_name if element_layout_name != "" else "nullptr"
 
-	InitSType(StructureDataPointers.back(), STypeOffsets.back(), headSType);
-	memcpy(StructureDataPointers.back() + PNextPointerOffsets.back(), &headPNext, sizeof(void*));
+	return "{offsetof(" + struct[0] + ", " + member["name"] + "), " + element_size + ", " + count_offset + ", " + count_size + ", " + str(pointer_kind[2]) + ", " + str(pointer_kind[3]) + ", PointerMemberKind::" + pointer_kind[0] + ", " + element_layout + ", " + element_ranges + "}"
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
-}
+#Byte ranges of the members of a structure without sType, for masking out the padding of the array elements a pointer member points to
+def compile_element_member_ranges(struct):
+	member_ranges = ["{offsetof(" + struct[0] + ", " + member["name"] + "), sizeof(" + struct[0] + "::" + member["name"] + ")}" for member in struct[4]]
+	return "inline constexpr StructureMemberRange " + struct[0] + "MemberRanges[] = {" + ", ".join(member_ranges) + "};\n"
 
-template<typename HeadType>
-inline StructureChainBlob<HeadType>::~StructureChainBlob()
-{
-}
+#Pointer layouts are emitted for the structures with pointer members and for the structures with pNext they point to
+#Every layout is emitted after the layouts it references, a reference that would make a cycle is left null
+def compile_pointer_layout_table(stypes, structs, stype_switch_value):
+	structs_by_name = {struct[0]: struct for struct in structs}
 
-template<typename HeadType>
-inline void StructureChainBlob<HeadType>::Clear()
-{
-	//Save the head
-	HeadType& headData = GenericStructureChainBase<HeadType>::GetChainHead();
-	std::vector<std::byte> oldHead(sizeof(HeadType));
-	memcpy(oldHead.data(), &headData, sizeof(HeadType));
+	pointer_members = {}
+	opaque_pointers = {}
+	for struct in structs:
+		struct_pointer_members = []
+		struct_opaque_pointers = []
+		for member in struct[4]:
+			pointer_kind = classify_pointer_member(struct[4], member)
+			if pointer_kind is not None:
+				struct_pointer_members.append((member, pointer_kind))
+			elif member["name"] != "pNext" and not member["array"] and (member["pointer_depth"] != 0 or member["kind"] == "FunctionPointer"):
+				struct_opaque_pointers.append(member)
 
-	//Clear everything
-	StructureChainBlobData.clear();
+		if len(struct_pointer_members) != 0:
+			pointer_members[struct[0]] = struct_pointer_members
 
-	StructureDataPointers.clear();
-	STypeOffsets.clear();
-	PNextPointerOffsets.clear();
+		if len(struct_opaque_pointers) != 0:
+			opaque_pointers[struct[0]] = struct_opaque_pointers
 
-	StructureDataIndices.clear();
+	def has_pnext(struct):
+		return any(member["name"] == "pNext" for member in struct[4])
 
-	//Reinit 
-	StructureChainBlobData.resize(sizeof(HeadType));
+	layout_struct_names = set(pointer_members.keys()) | set(opaque_pointers.keys())
+	for struct_name in pointer_members:
+		for member, pointer_kind in pointer_members[struct_name]:
+			if member["type"] in structs_by_name and has_pnext(structs_by_name[member["type"]]):
+				layout_struct_names.add(member["type"])
 
-	memcpy(StructureChainBlobData.data(), oldHead.data(), sizeof(HeadType));
+	layout_order    = []
+	visit_state     = {}
+	element_layouts = {}
 
-	StructureDataPointers.push_back(StructureChainBlobData.data());
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	def visit_struct(struct_name):
+		visit_state[struct_name] = "visiting"
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
-}
+		struct = structs_by_name[struct_name]
+		for member, pointer_kind in pointer_members.get(struct_name, []):
+			element_type = member["type"]
+			element_layouts[(struct_name, member["name"])] = ""
 
-template<typename HeadType>
-template<typename Struct>
-inline void StructureChainBlob<HeadType>::AppendToChain(const Struct& next)
-{
-	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+			if element_type not in layout_struct_names or not is_guard_subset(structs_by_name[element_type], struct):
+				continue
 
-	AppendDataToBlob((const std::byte*)(&next), sizeof(Struct), next.pNext, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
-}
+			if visit_state.get(element_type) is None:
+				visit_struct(element_type)
 
-template<typename HeadType>
-inline void StructureChainBlob<HeadType>::AppendToChainGeneric(const GenericStructBase& nextBlobData)
-{
-	AppendDataToBlob(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetPNext(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
-}
+			if visit_state[element_type] == "visited":
+				element_layouts[(struct_name, member["name"])] = element_type + "PointerLayout"
 
-template<typename HeadType>
-inline void StructureChainBlob<HeadType>::AppendDataToBlob(const std::byte* data, size_t dataSize, const void* dataPNext, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
-{
-	size_t prevDataSize   = StructureChainBlobData.size();
-	size_t nextDataOffset = prevDataSize;
+		visit_state[struct_name] = "visited"
+		layout_order.append(struct)
 
-	//Copy all current structures to the new chain, and append new structure
-	std::vector<std::byte> newStructureChainData(prevDataSize + dataSize);
-	memcpy(newStructureChainData.data(),				StructureChainBlobData.data(), prevDataSize);
-	memcpy(newStructureChainData.data() + prevDataSize, data,						  dataSize);
+	for struct in structs:
+		if struct[0] in layout_struct_names and visit_state.get(struct[0]) is None:
+			visit_struct(struct[0])
 
-	//Initialize sType
-	InitSType(newStructureChainData.data() + prevDataSize, dataSTypeOffset, sType);
+	#Elements without sType can't be masked by GetSTypeMemberRanges, their member ranges are referenced from the pointer members
+	range_struct_names = set()
+	element_ranges     = {}
+	for struct_name in pointer_members:
+		for member, pointer_kind in pointer_members[struct_name]:
+			element_ranges[(struct_name, member["name"])] = "nullptr, 0"
+
+			element_struct = structs_by_name.get(member["type"])
+			if pointer_kind[0] != "Array" or element_struct is None or has_pnext(element_struct) or len(element_struct[4]) == 0:
+				continue
+
+			if not is_guard_subset(element_struct, structs_by_name[struct_name]):
+				continue
+
+			range_struct_names.add(element_struct[0])
+			element_ranges[(struct_name, member["name"])] = element_struct[0] + "MemberRanges, " + str(len(element_struct[4]))
 
-	//Rebuild StructureDataPointers
-	std::vector<ptrdiff_t> structureDataOffsets(StructureDataPointers.size());
-	for(size_t i = 0; i < StructureDataPointers.size(); i++)
-	{
-		structureDataOffsets[i] = (StructureDataPointers[i] - &StructureChainBlobData[0]);
-	}
+	cpp_data = ""
 
-	StructureDataPointers.clear();
-	for(size_t i = 0; i < structureDataOffsets.size(); i++)
-	{
-		StructureDataPointers.push_back(newStructureChainData.data() + structureDataOffsets[i]);
-	}
+	cpp_data += header_pointer_layout
 
-	StructureDataPointers.push_back(newStructureChainData.data() + nextDataOffset);
-	STypeOffsets.push_back(dataSTypeOffset);
-	PNextPointerOffsets.push_back(dataPNextOffset);
+	for struct in structs:
+		if struct[0] not in range_struct_names:
+			continue
 
-	//Invalidate pNext pointers
-	for(size_t i = 0; i < PNextPointerOffsets.size() - 1; i++)
-	{
-		void** currPPNext = (void**)(StructureDataPointers[i] + PNextPointerOffsets[i]);
-		memcpy(currPPNext, &StructureDataPointers[i + 1], sizeof(void*));
-	}
+		cpp_data += "\n"
 
-	//Invalidate the last pNext pointer with the provided one
-	std::byte* pLastStruct = StructureDataPointers.back();
-	memcpy(pLastStruct + dataPNextOffset, &dataPNext, sizeof(void*));
+		guarded = len(struct[2]) != 0 or struct[3] != ""
+		if guarded:
+			cpp_data += compile_stype_guard(struct) + "\n"
 
-	//Only use move semantics, because copy semantics will make pNext pointers invalid once again
-	StructureChainBlobData = std::move(newStructureChainData);
+		cpp_data += compile_element_member_ranges(struct)
 
-	//Make sure all pNext point to inside of StructureChainBlobData. The last pointer can point to whatever the user specified
-	for(size_t i = 0; i < PNextPointerOffsets.size() - 1; i++)
-	{
-		void* pNextPointer = nullptr;
-		memcpy(&pNextPointer, StructureDataPointers[i] + PNextPointerOffsets[i], sizeof(void*)); //Init the pointer data
+		if guarded:
+			cpp_data += "#endif\n"
 
-		assert(pNextPointer >= &StructureChainBlobData[0] && pNextPointer < (&StructureChainBlobData[0] + StructureChainBlobData.size())); //Move semantics should never break pNext pointers, they should always point to inside the blob
-	}
+	for struct in layout_order:
+		cpp_data += "\n"
 
-	StructureDataIndices[sType] = StructureDataPointers.size() - 1;
-}
+		guarded = len(struct[2]) != 0 or struct[3] != ""
+		if guarded:
+			cpp_data += compile_stype_guard(struct) + "\n"
 
-}
+		struct_pointer_members = pointer_members.get(struct[0], [])
+		struct_opaque_pointers = opaque_pointers.get(struct[0], [])
 
-#endif
-"""
+		layout_members = "nullptr, 0"
+		if len(struct_pointer_members) != 0:
+			cpp_data += "inline constexpr PointerMemberLayout " + struct[0] + "PointerMembers[] =\n"
+			cpp_data += "{\n"
 
-def open_vk_spec(url):
-	with urllib.request.urlopen(url) as response:
-		spec_data = response.read()
-		return spec_data.decode("utf8")
+			for member, pointer_kind in struct_pointer_members:
+				cpp_data += "\t" + compile_pointer_member(struct, member, pointer_kind, element_layouts[(struct[0], member["name"])], element_ranges[(struct[0], member["name"])]) + ",\n"
 
-def parse_stypes(spec_contents):
-	spec_soup   = BeautifulSoup(spec_contents, features="xml")
+			cpp_data += "};\n"
+			cpp_data += "\n"
 
-	spec_platform_defines = {}
+			layout_members = struct[0] + "PointerMembers, " + str(len(struct_pointer_members))
 
-	spec_platforms_block = spec_soup.find("platforms")
-	if spec_platforms_block is not None:
-		spec_platform_tags = spec_platforms_block.find_all("platform")
-		for platform_tag in spec_platform_tags:
-			spec_platform_defines[platform_tag["name"]] = platform_tag["protect"]
+		layout_opaque_pointers = "nullptr, 0"
+		if len(struct_opaque_pointers) != 0:
+			opaque_offsets = ["offsetof(" + struct[0] + ", " + member["name"] + ")" for member in struct_opaque_pointers]
+			cpp_data += "inline constexpr uint32_t " + struct[0] + "OpaquePointerOffsets[] = {" + ", ".join(opaque_offsets) + "};\n"
+			cpp_data += "\n"
 
-	spec_struct_extensions = {}
-	extension_define_names = {}
+			layout_opaque_pointers = struct[0] + "OpaquePointerOffsets, " + str(len(struct_opaque_pointers))
 
-	extension_blocks = spec_soup.find_all("extension")
-	for extension_block in extension_blocks:
-		extension_name = extension_block["name"]
+		cpp_data += "inline constexpr StructurePointerLayout " + struct[0] + "PointerLayout = {" + layout_members + ", " + layout_opaque_pointers + ", " + ("true" if has_pnext(struct) else "false") + "};\n"
 
-		extension_define_tag = extension_block.find("enum", {"value": re.compile(".*" + extension_name +".*")})
-		if extension_define_tag is None:
+		if guarded:
+			cpp_data += "#endif\n"
+
+	pointer_stypes = [stype for stype in stypes if stype[0] in pointer_members or stype[0] in opaque_pointers]
+
+	#The parameter is left unnamed if there's no switch to use it in
+	stype_parameter = "VulkanStructureType sType" if len(pointer_stypes) != 0 else "VulkanStructureType"
+
+	cpp_data += "\n"
+	cpp_data += "//Returns the pointer members of the structure with the given sType, or nullptr if the structure has none except pNext\n"
+	cpp_data += "inline const StructurePointerLayout* GetSTypePointerLayout(" + stype_parameter + ")\n"
+	cpp_data += "{\n"
+
+	if len(pointer_stypes) != 0:
+		cpp_data += "\tswitch(" + stype_switch_value + ")\n"
+		cpp_data += "\t{\n"
+
+		cpp_data += compile_guarded_switch_cases(pointer_stypes, lambda stype: "\tcase " + stype[1] + ": return &" + stype[0] + "PointerLayout;\n")
+
+		cpp_data += "\tdefault:\n"
+		cpp_data += "\t\tbreak;\n"
+		cpp_data += "\t}\n"
+		cpp_data += "\n"
+
+	cpp_data += "\treturn nullptr;\n"
+	cpp_data += "}\n"
+
+	return cpp_data
+
+def compile_feature_structure_info(stype, feature_member_count, core_feature_alias, stype_value_format):
+	core_version = "0"
+
+	core_version_match = re.match(r"VK_VERSION_(\d+)_(\d+)$", stype[6])
+	if core_version_match is not None:
+		core_version = "VK_MAKE_VERSION(" + core_version_match.group(1) + ", " + core_version_match.group(2) + ", 0)"
+
+	if len(stype[7]) > 4:
+		raise ValueError(stype[0] + " is provided by more extensions than FeatureStructureMaxExtensions")
+
+	feature_members = "nullptr, 0"
+	if feature_member_count != 0:
+		feature_members = stype[0] + "FeatureMemberOffsets, " + str(feature_member_count)
+
+	core_feature_members = stype_value_format.format(stype[1]) + ", nullptr"
+	if core_feature_alias is not None:
+		core_feature_members = stype_value_format.format(core_feature_alias[0][1]) + ", " + stype[0] + "CoreFeatureMemberIndices"
+
+	extension_names = ", ".join("\"" + extension_name + "\"" for extension_name in stype[7])
+	return "{" + stype_value_format.format(stype[1]) + ", sizeof(" + stype[0] + "), " + core_version + ", {" + extension_names + "}, " + feature_members + ", " + core_feature_members + "}"
+
+#All VkBool32 members of the structure as (offset expression, structure that declares the member, member name)
+#e.g. ("offsetof(VkPhysicalDeviceFeatures2, features) + offsetof(VkPhysicalDeviceFeatures, geometryShader)", VkPhysicalDeviceFeatures, "geometryShader")
+def collect_feature_members(struct, structs_by_name):
+	feature_members = []
+	for member in struct[4]:
+		if member["pointer_depth"] != 0 or member["array"]:
 			continue
 
-		extension_define_name = extension_define_tag["name"]
-		if extension_define_name is None:
+		member_offset = "offsetof(" + struct[0] + ", " + member["name"] + ")"
+		if member["type"] == "VkBool32":
+			feature_members.append((member_offset, struct, member["name"]))
+		elif member["type"] in structs_by_name:
+			for nested_member_offset, nested_struct, nested_member_name in collect_feature_members(structs_by_name[member["type"]], structs_by_name):
+				feature_members.append((member_offset + " + " + nested_member_offset, nested_struct, nested_member_name))
+
+	return feature_members
+
+#VkPhysicalDeviceFeatures2 goes first, so the table is never empty and the head of the chain always has ordinal 0
+def compile_feature_structure_table(stypes, structs, stype_value_format):
+	structs_by_name = {struct[0]: struct for struct in structs}
+
+	head_stypes    = [stype for stype in stypes if stype[0] == "VkPhysicalDeviceFeatures2"]
+	feature_stypes = [stype for stype in stypes if "VkPhysicalDeviceFeatures2" in stype[5]]
+
+	feature_member_offsets = {}
+	feature_member_names   = {}
+	for stype in head_stypes + feature_stypes:
+		feature_members = collect_feature_members(stype, structs_by_name)
+
+		feature_member_offsets[stype[0]] = [feature_member[0] for feature_member in feature_members]
+		feature_member_names[stype[0]]   = [feature_member[2] for feature_member in feature_members]
+
+	#The members of VkPhysicalDeviceVulkanNNFeatures are the same features as the members of the structures promoted to version N.N, e.g. multiview of VkPhysicalDeviceMultiviewFeatures
+	#A structure is aliased only if all of its members are there, so VkPhysicalDeviceVulkanNNFeatures can always be chained instead of it
+	core_feature_stypes = {}
+	for stype in feature_stypes:
+		core_features_match = re.fullmatch(r"VkPhysicalDeviceVulkan(\d)(\d)Features", stype[0])
+		if core_features_match is not None:
+			core_feature_stypes["VK_VERSION_" + core_features_match.group(1) + "_" + core_features_match.group(2)] = stype
+
+	core_feature_aliases = {}
+	for stype in feature_stypes:
+		core_stype = core_feature_stypes.get(stype[6])
+		if core_stype is None or stype[0] in [core_feature_stype[0] for core_feature_stype in core_feature_stypes.values()]:
 			continue
 
-		extension_define_names[extension_name] = extension_define_name
+		member_names      = feature_member_names[stype[0]]
+		core_member_names = feature_member_names[core_stype[0]]
+		if len(member_names) == 0 or any(member_name not in core_member_names for member_name in member_names):
+			continue
 
-		extension_require_blocks = extension_block.find_all("require")
-		for extension_require_block in extension_require_blocks:
-			extension_types = []
+		core_feature_aliases[stype[0]] = (core_stype, [core_member_names.index(member_name) for member_name in member_names])
 
-			extension_type_tags = extension_require_block.find_all("type")
-			for type_tag in extension_type_tags:
-				extension_defined_type = type_tag["name"]
-				if extension_defined_type is not None:
-					extension_types.append(extension_defined_type)
+	cpp_data = ""
 
-			extension_platform = ""
-			if "platform" in extension_block.attrs:
-				extension_platform = extension_block["platform"]
+	cpp_data += header_feature_structures
 
-			extension_platform_define = ""
-			if extension_platform in spec_platform_defines:
-				extension_platform_define = spec_platform_defines[extension_platform]
+	for stype in head_stypes + feature_stypes:
+		if len(feature_member_offsets[stype[0]]) == 0:
+			continue
 
-			extension_names = [extension_name]
-			if "extension" in extension_require_block.attrs:
-				extension_names.append(extension_require_block["extension"])
+		cpp_data += "\n"
 
-			for extension_type in extension_types:
-				spec_struct_extensions[extension_type] = (extension_name, extension_names, extension_platform_define)
-				
-	stypes = []
+		guarded = len(stype[2]) != 0 or stype[3] != ""
+		if guarded:
+			cpp_data += compile_stype_guard(stype) + "\n"
 
-	struct_blocks = spec_soup.find_all("type", {"category": "struct"})
-	for struct_block in struct_blocks:
-		struct_type = struct_block["name"]
+		cpp_data += "inline constexpr uint32_t " + stype[0] + "FeatureMemberOffsets[] =\n"
+		cpp_data += "{\n"
 
-		#Find only structs that have <member> tag with "values" attibute
-		struct_stype_member_tags = [member_tag for member_tag in struct_block.find_all("member") if "values" in member_tag.attrs]
-		if len(struct_stype_member_tags) == 0:
-			continue
+		for feature_member_offset in feature_member_offsets[stype[0]]:
+			cpp_data += "\t(uint32_t)(" + feature_member_offset + "),\n"
 
-		stype = ""
-		for member_tag in struct_stype_member_tags:
-			name_tag = member_tag.find("name")
-			if name_tag is not None and name_tag.string == "sType":
-				stype = member_tag["values"]
+		cpp_data += "};\n"
+
+		if stype[0] in core_feature_aliases:
+			core_member_indices = core_feature_aliases[stype[0]][1]
+			cpp_data += "\n"
+			cpp_data += "inline constexpr uint32_t " + stype[0] + "CoreFeatureMemberIndices[] = {" + ", ".join(str(core_member_index) for core_member_index in core_member_indices) + "};\n"
+
+		if guarded:
+			cpp_data += "#endif\n"
+
+	cpp_data += "\n"
+	cpp_data += "//Every structure that extends VkPhysicalDeviceFeatures2, VkPhysicalDeviceFeatures2 itself is the first\n"
+	cpp_data += "inline constexpr FeatureStructureInfo FeatureStructureInfos[] =\n"
+	cpp_data += "{\n"
+
+	if len(head_stypes) != 0:
+		head_stype = head_stypes[0]
+		if head_stype[6] == "":
+			head_stype = head_stype[:6] + ("VK_VERSION_1_1", ["VK_KHR_get_physical_device_properties2"]) + head_stype[8:]
+
+		cpp_data += "\t" + compile_feature_structure_info(head_stype, len(feature_member_offsets[head_stype[0]]), None, stype_value_format) + ",\n"
+
+	cpp_data += compile_guarded_switch_cases(feature_stypes, lambda stype: "\t" + compile_feature_structure_info(stype, len(feature_member_offsets[stype[0]]), core_feature_aliases.get(stype[0]), stype_value_format) + ",\n")
+
+	cpp_data += "};\n"
+	cpp_data += "\n"
+	cpp_data += "constexpr uint32_t FeatureStructureCount = (uint32_t)(sizeof(FeatureStructureInfos) / sizeof(FeatureStructureInfos[0]));\n"
+
+	return cpp_data
+
+def hash_name(name):
+	name_hash = 0xCBF29CE484222325
+	for name_byte in name.encode("utf-8"):
+		name_hash = ((name_hash ^ name_byte) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+
+	return name_hash
+
+def mix_hash(value):
+	value ^= value >> 33
+	value  = (value * 0xFF51AFD7ED558CCD) & 0xFFFFFFFFFFFFFFFF
+	value ^= value >> 33
+	value  = (value * 0xC4CEB9FE1A85EC53) & 0xFFFFFFFFFFFFFFFF
+	value ^= value >> 33
+
+	return value
+
+#Power of two slot count with the load factor of at most 0.8, and 4 slots per bucket
+def choose_perfect_hash_size(key_count):
+	slot_count = 1
+	while slot_count * 4 < key_count * 5:
+		slot_count *= 2
+
+	bucket_count = max(1, slot_count // 4)
+
+	return (bucket_count, slot_count)
+
+#Hash-and-displace perfect hash: bucket = (hash >> 32) % bucket_count, slot = MixHash(hash ^ displacements[bucket]) % slot_count
+#Returns (displacements, slot index of each key)
+def build_perfect_hash(key_hashes, bucket_count, slot_count):
+	buckets = [[] for bucket_index in range(bucket_count)]
+	for key_index, key_hash in enumerate(key_hashes):
+		buckets[(key_hash >> 32) % bucket_count].append(key_index)
+
+	displacements = [0] * bucket_count
+	key_slots     = [0] * len(key_hashes)
+	used_slots    = set()
+
+	for bucket_index in sorted(range(bucket_count), key=lambda index: len(buckets[index]), reverse=True):
+		if len(buckets[bucket_index]) == 0:
+			break
+
+		displacement = 0
+		while True:
+			bucket_slots = [mix_hash(key_hashes[key_index] ^ displacement) % slot_count for key_index in buckets[bucket_index]]
+			if len(set(bucket_slots)) == len(bucket_slots) and used_slots.isdisjoint(bucket_slots):
 				break
 
-		extension_defines = []
-		platform_define   = ""
+			displacement += 1
 
-		if struct_type in spec_struct_extensions:
-			struct_requires = spec_struct_extensions[struct_type]
+		displacements[bucket_index] = displacement
+		for key_index, bucket_slot in zip(buckets[bucket_index], bucket_slots):
+			key_slots[key_index] = bucket_slot
+			used_slots.add(bucket_slot)
 
-			extension_defines = [extension_define_names[extension_name] for extension_name in struct_requires[1]]
-			platform_define   = struct_requires[2]
+	return (displacements, key_slots)
 
-		stypes.append((struct_type, stype, extension_defines, platform_define))
+#Names of the feature members as written in the profiles, the structure aliases (e.g. VkPhysicalDeviceVulkanMemoryModelFeaturesKHR) included
+#The slots of the guarded structures are left empty when the guard is not defined, so the positions don't depend on the defines
+def compile_feature_member_name_table(stypes, structs, stype_value_format):
+	structs_by_name = {struct[0]: struct for struct in structs}
 
-		stypes = sorted(stypes, key=lambda struct_data: struct_data[2])
-		stypes = sorted(stypes, key=lambda struct_data: struct_data[3])
+	feature_stypes = [stype for stype in stypes if stype[0] == "VkPhysicalDeviceFeatures2"][:1] + [stype for stype in stypes if "VkPhysicalDeviceFeatures2" in stype[5]]
 
-	return stypes
+	member_names = []
+	for stype in feature_stypes:
+		for member_index, (member_offset, member_struct, member_name) in enumerate(collect_feature_members(stype, structs_by_name)):
+			for struct_name in [member_struct[0]] + member_struct[9]:
+				member_names.append((struct_name + "." + member_name, stype, member_index))
+
+	name_hashes = [hash_name(member_name[0]) for member_name in member_names]
+	if len(set(name_hashes)) != len(name_hashes):
+		raise ValueError("Feature member names have colliding hashes")
+
+	bucket_count, slot_count = choose_perfect_hash_size(len(member_names))
+
+	displacements, name_slots = build_perfect_hash(name_hashes, bucket_count, slot_count)
+
+	slot_names = [None] * slot_count
+	for member_name, name_slot in zip(member_names, name_slots):
+		slot_names[name_slot] = member_name
+
+	cpp_data = ""
+
+	cpp_data += header_feature_member_names
+
+	cpp_data += "\n"
+	cpp_data += "constexpr uint32_t FeatureMemberNameBucketCount = " + str(bucket_count) + ";\n"
+	cpp_data += "constexpr uint32_t FeatureMemberNameSlotCount   = " + str(slot_count)   + ";\n"
+	cpp_data += "\n"
+	cpp_data += "inline constexpr uint32_t FeatureMemberNameDisplacements[FeatureMemberNameBucketCount] =\n"
+	cpp_data += "{\n"
+
+	for line_start in range(0, bucket_count, 16):
+		cpp_data += "\t" + " ".join(str(displacement) + "," for displacement in displacements[line_start:line_start + 16]) + "\n"
+
+	cpp_data += "};\n"
+	cpp_data += "\n"
+	cpp_data += "inline constexpr FeatureMemberNameEntry FeatureMemberNameSlots[FeatureMemberNameSlotCount] =\n"
+	cpp_data += "{\n"
+
+	for slot_name in slot_names:
+		if slot_name is None:
+			cpp_data += "\t{},\n"
+			continue
+
+		guarded = len(slot_name[1][2]) != 0 or slot_name[1][3] != ""
+		if guarded:
+			cpp_data += compile_stype_guard(slot_name[1]) + "\n"
+
+		cpp_data += "\t{\"" + slot_name[0] + "\", " + stype_value_format.format(slot_name[1][1]) + ", " + str(slot_name[2]) + "},\n"
+
+		if guarded:
+			cpp_data += "#else\n"
+			cpp_data += "\t{},\n"
+			cpp_data += "#endif\n"
+
+	cpp_data += "};\n"
+
+	return cpp_data
+
+#The extension index is the position of the name in ExtensionNames. The names don't depend on the defines, so neither do the indices
+def compile_extension_name_table(extension_names):
+	name_hashes = [hash_name(extension_name) for extension_name in extension_names]
+	if len(set(name_hashes)) != len(name_hashes):
+		raise ValueError("Extension names have colliding hashes")
+
+	bucket_count, slot_count = choose_perfect_hash_size(len(extension_names))
+
+	displacements, name_slots = build_perfect_hash(name_hashes, bucket_count, slot_count)
+
+	slot_indices = ["NoExtensionIndex"] * slot_count
+	for extension_index, name_slot in enumerate(name_slots):
+		slot_indices[name_slot] = str(extension_index)
+
+	cpp_data = ""
+
+	cpp_data += "\n"
+	cpp_data += "constexpr uint32_t ExtensionCount   = " + str(len(extension_names)) + ";\n"
+	cpp_data += "constexpr uint32_t NoExtensionIndex = 0xffffffff;\n"
+	cpp_data += "\n"
+	cpp_data += "//Names of all the extensions in vk.xml that are not disabled, sorted, followed by nullptr\n"
+	cpp_data += "inline constexpr const char* ExtensionNames[ExtensionCount + 1] =\n"
+	cpp_data += "{\n"
+
+	for extension_name in extension_names:
+		cpp_data += "\t\"" + extension_name + "\",\n"
+
+	cpp_data += "\tnullptr\n"
+	cpp_data += "};\n"
+	cpp_data += "\n"
+	cpp_data += "constexpr uint32_t ExtensionNameBucketCount = " + str(bucket_count) + ";\n"
+	cpp_data += "constexpr uint32_t ExtensionNameSlotCount   = " + str(slot_count)   + ";\n"
+	cpp_data += "\n"
+	cpp_data += "inline constexpr uint32_t ExtensionNameDisplacements[ExtensionNameBucketCount] =\n"
+	cpp_data += "{\n"
+
+	for line_start in range(0, bucket_count, 16):
+		cpp_data += "\t" + " ".join(str(displacement) + "," for displacement in displacements[line_start:line_start + 16]) + "\n"
+
+	cpp_data += "};\n"
+	cpp_data += "\n"
+	cpp_data += "//Extension index of each slot of the perfect hash table, NoExtensionIndex for an empty slot\n"
+	cpp_data += "inline constexpr uint32_t ExtensionNameSlots[ExtensionNameSlotCount] =\n"
+	cpp_data += "{\n"
+
+	for line_start in range(0, slot_count, 8):
+		cpp_data += "\t" + " ".join(slot_index + "," for slot_index in slot_indices[line_start:line_start + 8]) + "\n"
+
+	cpp_data += "};\n"
+
+	return cpp_data
+
+def compile_structure_requirement_table(stypes, extension_names):
+	extension_indices = {extension_name: extension_index for extension_index, extension_name in enumerate(extension_names)}
+
+	provider_extension_indices = []
+	provider_extension_ranges  = {}
+	for stype in stypes:
+		first_provider_extension = len(provider_extension_indices)
+		for provider_extension in stype[7]:
+			if provider_extension in extension_indices:
+				provider_extension_indices.append(extension_indices[provider_extension])
+
+		provider_extension_count = len(provider_extension_indices) - first_provider_extension
+		if provider_extension_count == 0:
+			first_provider_extension = 0
+
+		provider_extension_ranges[stype[0]] = (first_provider_extension, provider_extension_count)
+
+	def compile_structure_requirement(stype):
+		core_version = "0"
+
+		core_version_match = re.match(r"VK_VERSION_(\d+)_(\d+)$", stype[6])
+		if core_version_match is not None:
+			core_version = "VK_MAKE_VERSION(" + core_version_match.group(1) + ", " + core_version_match.group(2) + ", 0)"
+
+		provider_extension_range = provider_extension_ranges[stype[0]]
+		return "\t{" + core_version + ", " + str(provider_extension_range[0]) + ", " + str(provider_extension_range[1]) + "}, //" + stype[0] + "\n"
+
+	cpp_data = ""
+
+	cpp_data += "\n"
+	cpp_data += "//Core version and extensions that provide a structure. It can be used if apiVersion >= CoreVersion (when CoreVersion is not 0) or any of the extensions is enabled\n"
+	cpp_data += "struct StructureRequirement\n"
+	cpp_data += "{\n"
+	cpp_data += "\tuint32_t CoreVersion;\n"
+	cpp_data += "\tuint32_t FirstProviderExtension; //Index in StructureProviderExtensions\n"
+	cpp_data += "\tuint32_t ProviderExtensionCount;\n"
+	cpp_data += "};\n"
+	cpp_data += "\n"
+	cpp_data += "//Extension indices of the extensions that provide each structure, in ranges pointed to by StructureRequirements\n"
+	cpp_data += "inline constexpr uint32_t StructureProviderExtensions[] =\n"
+	cpp_data += "{\n"
+
+	if len(provider_extension_indices) == 0:
+		cpp_data += "\tNoExtensionIndex\n"
+
+	for line_start in range(0, len(provider_extension_indices), 16):
+		cpp_data += "\t" + " ".join(str(extension_index) + "," for extension_index in provider_extension_indices[line_start:line_start + 16]) + "\n"
+
+	cpp_data += "};\n"
+	cpp_data += "\n"
+	cpp_data += "//Requirements of each structure indexed by StructureOrdinal, followed by an empty entry so the table is never empty\n"
+	cpp_data += "inline constexpr StructureRequirement StructureRequirements[StructureOrdinalCount + 1] =\n"
+	cpp_data += "{\n"
+
+	cpp_data += compile_guarded_switch_cases(stypes, compile_structure_requirement)
+
+	cpp_data += "\t{0, 0, 0}\n"
+	cpp_data += "};\n"
+
+	return cpp_data
+
+#Every structure that extends other structures gets the list of their sTypes, ended with VK_STRUCTURE_TYPE_MAX_ENUM
+#An extended structure that needs a guard of its own is guarded inside the list
+def compile_structure_chain_rule_table(stypes, stype_value_format):
+	stypes_by_name = {stype[0]: stype for stype in stypes}
+
+	def extended_stypes(stype):
+		return [stypes_by_name[struct_name] for struct_name in stype[5] if struct_name in stypes_by_name]
+
+	cpp_data = ""
+
+	cpp_data += "\n"
+	cpp_data += "//What a structure can be chained to, used by ValidateChain()\n"
+	cpp_data += "struct StructureChainRule\n"
+	cpp_data += "{\n"
+	cpp_data += "\tconst VulkanStructureType*\tExtendedSTypes;\t\t//sTypes of the structures it can extend, ended with VK_STRUCTURE_TYPE_MAX_ENUM. Null if the rule is unknown\n"
+	cpp_data += "\tbool\t\t\t\t\t\tAllowDuplicates;\t//Can be in a chain more than once\n"
+	cpp_data += "};\n"
+
+	#A structure list without any structextends wasn't parsed from vk.xml, so nothing is known about the rules and they are all left null
+	has_chain_rules = any(len(extended_stypes(stype)) != 0 for stype in stypes)
+	if has_chain_rules:
+		cpp_data += "\n"
+		cpp_data += "//For the structures that can't extend any other\n"
+		cpp_data += "inline constexpr VulkanStructureType NoExtendedSTypes[] = {" + stype_value_format.format("VK_STRUCTURE_TYPE_MAX_ENUM") + "};\n"
+
+	for stype in stypes:
+		if len(extended_stypes(stype)) == 0:
+			continue
+
+		cpp_data += "\n"
+
+		guarded = len(stype[2]) != 0 or stype[3] != ""
+		if guarded:
+			cpp_data += compile_stype_guard(stype) + "\n"
+
+		cpp_data += "inline constexpr VulkanStructureType " + stype[0] + "ExtendedSTypes[] =\n"
+		cpp_data += "{\n"
+
+		for extended_stype in extended_stypes(stype):
+			if is_guard_subset(extended_stype, stype):
+				cpp_data += "\t" + stype_value_format.format(extended_stype[1]) + ",\n"
+			else:
+				cpp_data += compile_stype_guard(extended_stype) + "\n"
+				cpp_data += "\t" + stype_value_format.format(extended_stype[1]) + ",\n"
+				cpp_data += "#endif\n"
+
+		cpp_data += "\t" + stype_value_format.format("VK_STRUCTURE_TYPE_MAX_ENUM") + "\n"
+		cpp_data += "};\n"
+
+		if guarded:
+			cpp_data += "#endif\n"
+
+	def compile_chain_rule(stype):
+		extended_stypes_name = "nullptr"
+		if len(extended_stypes(stype)) != 0:
+			extended_stypes_name = stype[0] + "ExtendedSTypes"
+		elif has_chain_rules:
+			extended_stypes_name = "NoExtendedSTypes"
+
+		return "\t{" + extended_stypes_name + ", " + ("true" if stype[10] else "false") + "}, //" + stype[0] + "\n"
+
+	cpp_data += "\n"
+	cpp_data += "//Chain rules of each structure indexed by StructureOrdinal, followed by an empty entry so the table is never empty\n"
+	cpp_data += "inline constexpr StructureChainRule StructureChainRules[StructureOrdinalCount + 1] =\n"
+	cpp_data += "{\n"
+
+	cpp_data += compile_guarded_switch_cases(stypes, compile_chain_rule)
+
+	cpp_data += "\t{nullptr, false}\n"
+	cpp_data += "};\n"
+
+	return cpp_data
 
-def compile_cpp_header_h(stypes):
+def compile_cpp_header_h(stypes, structs, extension_names):
 	cpp_data = ""
 
 	cpp_data += header_license
@@ -786,19 +7763,7 @@ def compile_cpp_header_h(stypes):
 			if len(stype[2]) != 0 or stype[3] != "":
 				tab_level = "\t"
 
-				cpp_data += "\n#if "
-
-				if len(stype[2]) != 0:
-					cpp_data += "defined(" + stype[2][0] + ")"
-
-					for extra_extension_define in stype[2][1:]:
-						cpp_data += " && defined(" + extra_extension_define + ")"
-
-					if stype[3] != "":
-						cpp_data += " && "
-
-				if stype[3] != "":
-					cpp_data += "defined(" + stype[3] + ")"
+				cpp_data += "\n" + compile_stype_guard(stype)
 
 			current_extension_defines = stype[2]
 			current_platform_define   = stype[3]
@@ -811,30 +7776,188 @@ def compile_cpp_header_h(stypes):
 		cpp_data += "#endif\n\n"
 
 	cpp_data += header_stype_init_h
+	cpp_data += compile_structure_size_table(stypes, "sType")
+	cpp_data += compile_structure_visit_table(stypes, "Vk", "{}")
+	cpp_data += compile_member_range_table(stypes, "sType")
+	cpp_data += compile_returned_only_table(stypes, "sType")
+	cpp_data += compile_pointer_layout_table(stypes, structs, "sType")
+	cpp_data += compile_feature_structure_table(stypes, structs, "{}")
+	cpp_data += compile_feature_member_name_table(stypes, structs, "{}")
+	cpp_data += compile_extension_name_table(extension_names)
+	cpp_data += compile_structure_requirement_table(stypes, extension_names)
+	cpp_data += compile_structure_chain_rule_table(stypes, "{}")
 	cpp_data += header_end
 
 	return cpp_data
 
-def compile_cpp_header_hpp(stypes):
+def compile_cpp_header_hpp(stypes, structs, extension_names):
 	cpp_data = ""
 
 	cpp_data += header_license
 	cpp_data += header_start_hpp
 	cpp_data += header_stype_init_hpp
+	cpp_data += compile_structure_size_table(stypes, "static_cast<VkStructureType>(sType)")
+	cpp_data += compile_structure_visit_table(stypes, "vk::", "static_cast<VulkanStructureType>({})")
+	cpp_data += compile_member_range_table(stypes, "static_cast<VkStructureType>(sType)")
+	cpp_data += compile_returned_only_table(stypes, "static_cast<VkStructureType>(sType)")
+	cpp_data += compile_pointer_layout_table(stypes, structs, "static_cast<VkStructureType>(sType)")
+	cpp_data += compile_feature_structure_table(stypes, structs, "static_cast<VulkanStructureType>({})")
+	cpp_data += compile_feature_member_name_table(stypes, structs, "static_cast<VulkanStructureType>({})")
+	cpp_data += compile_extension_name_table(extension_names)
+	cpp_data += compile_structure_requirement_table(stypes, extension_names)
+	cpp_data += compile_structure_chain_rule_table(stypes, "static_cast<VulkanStructureType>({})")
 	cpp_data += header_end
 
 	return cpp_data
 
+#Scalar types that are named directly or typedef'd in vk.xml without a category that tells what they are
+reflection_scalar_kinds = {"void": "Void", "VkBool32": "Bool32", "char": "Char", "int8_t": "Int8", "uint8_t": "Uint8", "int16_t": "Int16", "uint16_t": "Uint16",
+                           "int": "Int32", "int32_t": "Int32", "uint32_t": "Uint32", "int64_t": "Int64", "uint64_t": "Uint64", "size_t": "Size", "float": "Float", "double": "Double",
+                           "VkSampleMask": "Uint32", "VkDeviceSize": "Uint64", "VkDeviceAddress": "Uint64", "VkFlags": "Flags", "VkFlags64": "Flags64"}
+
+def compile_reflection_member(struct, member, element_reflection):
+	member_names = [struct_member["name"] for struct_member in struct[4]]
+
+	len_text = member["altlen"] if member["altlen"] != "" else member["len"]
+
+	len_string       = "nullptr"
+	len_member_index = "NoMemberIndex"
+	if len_text != "":
+		len_string = "\"" + len_text.replace("\\", "\\\\").replace("\"", "\\\"") + "\""
+
+		#Lengths like "enabledExtensionCount,null-terminated" or "(rasterizationSamples + 31) / 32" start with the count member
+		len_member_match = re.match(r"\(?(\w+)", len_text)
+		if len_member_match is not None and len_member_match.group(1) in member_names:
+			len_member_index = str(member_names.index(len_member_match.group(1)))
+
+	array_length = "0"
+	if member["array"] and member["type"] != "":
+		array_length = "sizeof(" + struct[0] + "::" + member["name"] + ") / sizeof(" + member["type"] + ")"
+
+	return "{\"" + member["name"] + "\", offsetof(" + struct[0] + ", " + member["name"] + "), sizeof(" + struct[0] + "::" + member["name"] + "), MemberScalarKind::" + member["kind"] + ", " + str(member["pointer_depth"]) + ", " + array_length + ", " + len_string + ", " + len_member_index + ", " + element_reflection + "}"
+
+#Reflections are emitted for every structure with known layout, each after the reflections of the structures its members hold or point to
+#A reference that would make a cycle (only possible through pointers) is left null
+def compile_reflection_header(stypes, structs, header_start, type_prefix, stype_value_format, stype_switch_value):
+	reflected_structs = {struct[0]: struct for struct in structs if len(struct[4]) != 0}
+
+	def reflection_type_name(struct_name):
+		return type_prefix + struct_name[2:]
+
+	reflection_order    = []
+	visit_state         = {}
+	element_reflections = {}
+
+	def visit_struct(struct_name):
+		visit_state[struct_name] = "visiting"
+
+		struct = reflected_structs[struct_name]
+		for member in struct[4]:
+			element_type = member["type"]
+			element_reflections[(struct_name, member["name"])] = "nullptr"
+
+			if element_type not in reflected_structs or not is_guard_subset(reflected_structs[element_type], struct):
+				continue
+
+			if visit_state.get(element_type) is None:
+				visit_struct(element_type)
+
+			if visit_state[element_type] == "visited":
+				element_reflections[(struct_name, member["name"])] = "&StructureReflectionOf<" + reflection_type_name(element_type) + ">"
+
+		visit_state[struct_name] = "visited"
+		reflection_order.append(struct)
+
+	for struct in structs:
+		if struct[0] in reflected_structs and visit_state.get(struct[0]) is None:
+			visit_struct(struct[0])
+
+	cpp_data = ""
+
+	cpp_data += header_license
+	cpp_data += header_start
+	cpp_data += header_reflection_types
+	cpp_data += "\n"
+	cpp_data += "//Member table of a structure type, e.g. StructureReflectionOf<" + reflection_type_name("VkApplicationInfo") + ">.Members\n"
+	cpp_data += "template<typename VkStruct>\n"
+	cpp_data += "inline constexpr StructureReflection StructureReflectionOf = {nullptr, " + stype_value_format.format("VK_STRUCTURE_TYPE_MAX_ENUM") + ", 0, nullptr, 0};\n"
+
+	for struct in reflection_order:
+		cpp_data += "\n"
+
+		guarded = len(struct[2]) != 0 or struct[3] != ""
+		if guarded:
+			cpp_data += compile_stype_guard(struct) + "\n"
+
+		stype_value = struct[1] if struct[1] != "" else "VK_STRUCTURE_TYPE_MAX_ENUM"
+
+		cpp_data += "inline constexpr StructureMemberInfo " + struct[0] + "Members[] =\n"
+		cpp_data += "{\n"
+
+		for member in struct[4]:
+			cpp_data += "\t" + compile_reflection_member(struct, member, element_reflections[(struct[0], member["name"])]) + ",\n"
+
+		cpp_data += "};\n"
+		cpp_data += "\n"
+		cpp_data += "template<>\n"
+		cpp_data += "inline constexpr StructureReflection StructureReflectionOf<" + reflection_type_name(struct[0]) + "> = {\"" + struct[0] + "\", " + stype_value_format.format(stype_value) + ", sizeof(" + struct[0] + "), " + struct[0] + "Members, " + str(len(struct[4])) + "};\n"
+
+		if guarded:
+			cpp_data += "#endif\n"
+
+	cpp_data += "\n"
+	cpp_data += "//Returns the member table of the structure with the given sType, or nullptr if the sType or the structure layout is unknown\n"
+	cpp_data += "inline const StructureReflection* GetSTypeReflection(VulkanStructureType sType)\n"
+	cpp_data += "{\n"
+
+	reflected_stypes = [stype for stype in stypes if stype[0] in reflected_structs]
+	if len(reflected_stypes) != 0:
+		cpp_data += "\tswitch(" + stype_switch_value + ")\n"
+		cpp_data += "\t{\n"
+
+		cpp_data += compile_guarded_switch_cases(reflected_stypes, lambda stype: "\tcase " + stype[1] + ": return &StructureReflectionOf<" + reflection_type_name(stype[0]) + ">;\n")
+
+		cpp_data += "\tdefault:\n"
+		cpp_data += "\t\tbreak;\n"
+		cpp_data += "\t}\n"
+		cpp_data += "\n"
+
+	cpp_data += "\treturn nullptr;\n"
+	cpp_data += "}\n"
+
+	cpp_data += header_reflection_end
+
+	return cpp_data
+
+def compile_reflection_header_h(stypes, structs):
+	return compile_reflection_header(stypes, structs, header_reflection_start_h, "Vk", "{}", "sType")
+
+def compile_reflection_header_hpp(stypes, structs):
+	return compile_reflection_header(stypes, structs, header_reflection_start_hpp, "vk::", "static_cast<VulkanStructureType>({})", "static_cast<VkStructureType>(sType)")
+
 def save_file(contents, filename):
 	with open(filename, "w", encoding="utf-8") as out_file:
 		out_file.write(contents)
 
 if __name__ == "__main__":
-	spec_text = open_vk_spec("https://raw.githubusercontent.com/KhronosGroup/Vulkan-Docs/main/xml/vk.xml") #Get it directly from the master branch
-	stypes	= parse_stypes(spec_text)
+	if len(sys.argv) > 1:
+		spec_text = open_vk_spec_file(sys.argv[1])
+	else:
+		spec_text = open_vk_spec("https://raw.githubusercontent.com/KhronosGroup/Vulkan-Docs/main/xml/vk.xml") #Get it directly from the master branch
+	spec_soup = BeautifulSoup(spec_text, features="xml")
+
+	structs			= parse_structs(spec_soup)
+	stypes			= select_stypes(structs)
+	extension_names = parse_extension_names(spec_soup)
 
-	cpp_header_data_h   = compile_cpp_header_h(stypes)
-	cpp_header_data_hpp = compile_cpp_header_hpp(stypes)
+	cpp_header_data_h   = compile_cpp_header_h(stypes, structs, extension_names)
+	cpp_header_data_hpp = compile_cpp_header_hpp(stypes, structs, extension_names)
 
 	save_file(cpp_header_data_h,   "./Include/VulkanGenericStructures.h")
-	save_file(cpp_header_data_hpp, "./Include/VulkanGenericStructures.hpp")
\ No newline at end of file
+	save_file(cpp_header_data_hpp, "./Include/VulkanGenericStructures.hpp")
+
+	reflection_header_data_h   = compile_reflection_header_h(stypes, structs)
+	reflection_header_data_hpp = compile_reflection_header_hpp(stypes, structs)
+
+	save_file(reflection_header_data_h,   "./Include/VulkanGenericStructuresReflection.h")
+	save_file(reflection_header_data_hpp, "./Include/VulkanGenericStructuresReflection.hpp")
\ No newline at end of file
@@ -29,6 +29,12 @@ SOFTWARE.
 #include <vector>
 #include <unordered_map>
 #include <cassert>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <algorithm>
 
 namespace vgs
 {
@@ -2212,575 +2218,16912 @@ inline void InitSType(void* ptr, ptrdiff_t offset, VulkanStructureType value)
 	memcpy((std::byte*)ptr + offset, &value, sizeof(VulkanStructureType));
 }
 
+//Returns the size of the structure with the given sType, or 0 if the sType is unknown
+inline size_t GetSTypeStructureSize(VulkanStructureType sType)
+{
+	switch(sType)
+	{
+	case VK_STRUCTURE_TYPE_APPLICATION_INFO: return sizeof(VkApplicationInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO: return sizeof(VkDeviceQueueCreateInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO: return sizeof(VkDeviceCreateInfo);
+	case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO: return sizeof(VkInstanceCreateInfo);
+	case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO: return sizeof(VkMemoryAllocateInfo);
+	case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE: return sizeof(VkMappedMemoryRange);
+	case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET: return sizeof(VkWriteDescriptorSet);
+	case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET: return sizeof(VkCopyDescriptorSet);
+	case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO: return sizeof(VkBufferCreateInfo);
+	case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO: return sizeof(VkBufferViewCreateInfo);
+	case VK_STRUCTURE_TYPE_MEMORY_BARRIER: return sizeof(VkMemoryBarrier);
+	case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER: return sizeof(VkBufferMemoryBarrier);
+	case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER: return sizeof(VkImageMemoryBarrier);
+	case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO: return sizeof(VkImageCreateInfo);
+	case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO: return sizeof(VkImageViewCreateInfo);
+	case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO: return sizeof(VkBindSparseInfo);
+	case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO: return sizeof(VkShaderModuleCreateInfo);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO: return sizeof(VkDescriptorSetLayoutCreateInfo);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO: return sizeof(VkDescriptorPoolCreateInfo);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO: return sizeof(VkDescriptorSetAllocateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO: return sizeof(VkPipelineShaderStageCreateInfo);
+	case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO: return sizeof(VkComputePipelineCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO: return sizeof(VkPipelineVertexInputStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO: return sizeof(VkPipelineInputAssemblyStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO: return sizeof(VkPipelineTessellationStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO: return sizeof(VkPipelineViewportStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO: return sizeof(VkPipelineRasterizationStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO: return sizeof(VkPipelineMultisampleStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO: return sizeof(VkPipelineColorBlendStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO: return sizeof(VkPipelineDynamicStateCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO: return sizeof(VkPipelineDepthStencilStateCreateInfo);
+	case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO: return sizeof(VkGraphicsPipelineCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO: return sizeof(VkPipelineCacheCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO: return sizeof(VkPipelineLayoutCreateInfo);
+	case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO: return sizeof(VkSamplerCreateInfo);
+	case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO: return sizeof(VkCommandPoolCreateInfo);
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO: return sizeof(VkCommandBufferAllocateInfo);
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO: return sizeof(VkCommandBufferInheritanceInfo);
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO: return sizeof(VkCommandBufferBeginInfo);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO: return sizeof(VkRenderPassBeginInfo);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO: return sizeof(VkRenderPassCreateInfo);
+	case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO: return sizeof(VkEventCreateInfo);
+	case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO: return sizeof(VkFenceCreateInfo);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO: return sizeof(VkSemaphoreCreateInfo);
+	case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO: return sizeof(VkQueryPoolCreateInfo);
+	case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO: return sizeof(VkFramebufferCreateInfo);
+	case VK_STRUCTURE_TYPE_SUBMIT_INFO: return sizeof(VkSubmitInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2: return sizeof(VkPhysicalDeviceFeatures2);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2: return sizeof(VkPhysicalDeviceProperties2);
+	case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2: return sizeof(VkFormatProperties2);
+	case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2: return sizeof(VkImageFormatProperties2);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2: return sizeof(VkPhysicalDeviceImageFormatInfo2);
+	case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2: return sizeof(VkQueueFamilyProperties2);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2: return sizeof(VkPhysicalDeviceMemoryProperties2);
+	case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2: return sizeof(VkSparseImageFormatProperties2);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2: return sizeof(VkPhysicalDeviceSparseImageFormatInfo2);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES: return sizeof(VkPhysicalDeviceDriverProperties);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES: return sizeof(VkPhysicalDeviceVariablePointersFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO: return sizeof(VkPhysicalDeviceExternalImageFormatInfo);
+	case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES: return sizeof(VkExternalImageFormatProperties);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO: return sizeof(VkPhysicalDeviceExternalBufferInfo);
+	case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES: return sizeof(VkExternalBufferProperties);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES: return sizeof(VkPhysicalDeviceIDProperties);
+	case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO: return sizeof(VkExternalMemoryImageCreateInfo);
+	case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO: return sizeof(VkExternalMemoryBufferCreateInfo);
+	case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO: return sizeof(VkExportMemoryAllocateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO: return sizeof(VkPhysicalDeviceExternalSemaphoreInfo);
+	case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES: return sizeof(VkExternalSemaphoreProperties);
+	case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO: return sizeof(VkExportSemaphoreCreateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO: return sizeof(VkPhysicalDeviceExternalFenceInfo);
+	case VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES: return sizeof(VkExternalFenceProperties);
+	case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO: return sizeof(VkExportFenceCreateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES: return sizeof(VkPhysicalDeviceMultiviewFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES: return sizeof(VkPhysicalDeviceMultiviewProperties);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO: return sizeof(VkRenderPassMultiviewCreateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES: return sizeof(VkPhysicalDeviceGroupProperties);
+	case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO: return sizeof(VkMemoryAllocateFlagsInfo);
+	case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO: return sizeof(VkBindBufferMemoryInfo);
+	case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO: return sizeof(VkBindBufferMemoryDeviceGroupInfo);
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO: return sizeof(VkBindImageMemoryInfo);
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO: return sizeof(VkBindImageMemoryDeviceGroupInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO: return sizeof(VkDeviceGroupRenderPassBeginInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO: return sizeof(VkDeviceGroupCommandBufferBeginInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO: return sizeof(VkDeviceGroupSubmitInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO: return sizeof(VkDeviceGroupBindSparseInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO: return sizeof(VkDeviceGroupDeviceCreateInfo);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO: return sizeof(VkDescriptorUpdateTemplateCreateInfo);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO: return sizeof(VkRenderPassInputAttachmentAspectCreateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES: return sizeof(VkPhysicalDevice16BitStorageFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES: return sizeof(VkPhysicalDeviceSubgroupProperties);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES: return sizeof(VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures);
+	case VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2: return sizeof(VkBufferMemoryRequirementsInfo2);
+	case VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2: return sizeof(VkImageMemoryRequirementsInfo2);
+	case VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2: return sizeof(VkImageSparseMemoryRequirementsInfo2);
+	case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2: return sizeof(VkMemoryRequirements2);
+	case VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2: return sizeof(VkSparseImageMemoryRequirements2);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES: return sizeof(VkPhysicalDevicePointClippingProperties);
+	case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS: return sizeof(VkMemoryDedicatedRequirements);
+	case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO: return sizeof(VkMemoryDedicatedAllocateInfo);
+	case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO: return sizeof(VkImageViewUsageCreateInfo);
+	case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO: return sizeof(VkPipelineTessellationDomainOriginStateCreateInfo);
+	case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: return sizeof(VkSamplerYcbcrConversionInfo);
+	case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO: return sizeof(VkSamplerYcbcrConversionCreateInfo);
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO: return sizeof(VkBindImagePlaneMemoryInfo);
+	case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO: return sizeof(VkImagePlaneMemoryRequirementsInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES: return sizeof(VkPhysicalDeviceSamplerYcbcrConversionFeatures);
+	case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES: return sizeof(VkSamplerYcbcrConversionImageFormatProperties);
+	case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO: return sizeof(VkProtectedSubmitInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES: return sizeof(VkPhysicalDeviceProtectedMemoryFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES: return sizeof(VkPhysicalDeviceProtectedMemoryProperties);
+	case VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2: return sizeof(VkDeviceQueueInfo2);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES: return sizeof(VkPhysicalDeviceSamplerFilterMinmaxProperties);
+	case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO: return sizeof(VkSamplerReductionModeCreateInfo);
+	case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: return sizeof(VkImageFormatListCreateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES: return sizeof(VkPhysicalDeviceMaintenance3Properties);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT: return sizeof(VkDescriptorSetLayoutSupport);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES: return sizeof(VkPhysicalDeviceShaderDrawParametersFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES: return sizeof(VkPhysicalDeviceShaderFloat16Int8Features);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES: return sizeof(VkPhysicalDeviceFloatControlsProperties);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES: return sizeof(VkPhysicalDeviceHostQueryResetFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES: return sizeof(VkPhysicalDeviceDescriptorIndexingFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES: return sizeof(VkPhysicalDeviceDescriptorIndexingProperties);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO: return sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfo);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO: return sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfo);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT: return sizeof(VkDescriptorSetVariableDescriptorCountLayoutSupport);
+	case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2: return sizeof(VkAttachmentDescription2);
+	case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2: return sizeof(VkAttachmentReference2);
+	case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2: return sizeof(VkSubpassDescription2);
+	case VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2: return sizeof(VkSubpassDependency2);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2: return sizeof(VkRenderPassCreateInfo2);
+	case VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO: return sizeof(VkSubpassBeginInfo);
+	case VK_STRUCTURE_TYPE_SUBPASS_END_INFO: return sizeof(VkSubpassEndInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES: return sizeof(VkPhysicalDeviceTimelineSemaphoreFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES: return sizeof(VkPhysicalDeviceTimelineSemaphoreProperties);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO: return sizeof(VkSemaphoreTypeCreateInfo);
+	case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO: return sizeof(VkTimelineSemaphoreSubmitInfo);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO: return sizeof(VkSemaphoreWaitInfo);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO: return sizeof(VkSemaphoreSignalInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES: return sizeof(VkPhysicalDevice8BitStorageFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES: return sizeof(VkPhysicalDeviceVulkanMemoryModelFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES: return sizeof(VkPhysicalDeviceShaderAtomicInt64Features);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES: return sizeof(VkPhysicalDeviceDepthStencilResolveProperties);
+	case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE: return sizeof(VkSubpassDescriptionDepthStencilResolve);
+	case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO: return sizeof(VkImageStencilUsageCreateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES: return sizeof(VkPhysicalDeviceScalarBlockLayoutFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES: return sizeof(VkPhysicalDeviceUniformBufferStandardLayoutFeatures);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES: return sizeof(VkPhysicalDeviceBufferDeviceAddressFeatures);
+	case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO: return sizeof(VkBufferDeviceAddressInfo);
+	case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO: return sizeof(VkBufferOpaqueCaptureAddressCreateInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES: return sizeof(VkPhysicalDeviceImagelessFramebufferFeatures);
+	case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO: return sizeof(VkFramebufferAttachmentsCreateInfo);
+	case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO: return sizeof(VkFramebufferAttachmentImageInfo);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO: return sizeof(VkRenderPassAttachmentBeginInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES: return sizeof(VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures);
+	case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT: return sizeof(VkAttachmentReferenceStencilLayout);
+	case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT: return sizeof(VkAttachmentDescriptionStencilLayout);
+	case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO: return sizeof(VkMemoryOpaqueCaptureAddressAllocateInfo);
+	case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO: return sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES: return sizeof(VkPhysicalDeviceVulkan11Features);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES: return sizeof(VkPhysicalDeviceVulkan11Properties);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES: return sizeof(VkPhysicalDeviceVulkan12Features);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES: return sizeof(VkPhysicalDeviceVulkan12Properties);
+#if defined(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD: return sizeof(VkPhysicalDeviceCoherentMemoryFeaturesAMD);
+#endif
+#if defined(VK_AMD_DISPLAY_NATIVE_HDR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD: return sizeof(VkDisplayNativeHdrSurfaceCapabilitiesAMD);
+	case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD: return sizeof(VkSwapchainDisplayNativeHdrCreateInfoAMD);
+#endif
+#if defined(VK_AMD_MEMORY_OVERALLOCATION_BEHAVIOR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD: return sizeof(VkDeviceMemoryOverallocationCreateInfoAMD);
+#endif
+#if defined(VK_AMD_PIPELINE_COMPILER_CONTROL_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD: return sizeof(VkPipelineCompilerControlCreateInfoAMD);
+#endif
+#if defined(VK_AMD_RASTERIZATION_ORDER_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD: return sizeof(VkPipelineRasterizationStateRasterizationOrderAMD);
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD: return sizeof(VkPhysicalDeviceShaderCoreProperties2AMD);
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD: return sizeof(VkPhysicalDeviceShaderCorePropertiesAMD);
+#endif
+#if defined(VK_AMD_TEXTURE_GATHER_BIAS_LOD_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD: return sizeof(VkTextureLODGatherFormatPropertiesAMD);
+#endif
+#if defined(VK_EXT_4444_FORMATS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT: return sizeof(VkPhysicalDevice4444FormatsFeaturesEXT);
+#endif
+#if defined(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT: return sizeof(VkImageViewASTCDecodeModeEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT: return sizeof(VkPhysicalDeviceASTCDecodeFeaturesEXT);
+#endif
+#if defined(VK_EXT_BLEND_OPERATION_ADVANCED_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT: return sizeof(VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineColorBlendAdvancedStateCreateInfoEXT);
+#endif
+#if defined(VK_EXT_BORDER_COLOR_SWIZZLE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: return sizeof(VkSamplerBorderColorComponentMappingCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT: return sizeof(VkPhysicalDeviceBorderColorSwizzleFeaturesEXT);
+#endif
+#if defined(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT: return sizeof(VkPhysicalDeviceBufferDeviceAddressFeaturesEXT);
+	case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT: return sizeof(VkBufferDeviceAddressCreateInfoEXT);
+#endif
+#if defined(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT: return sizeof(VkCalibratedTimestampInfoEXT);
+#endif
+#if defined(VK_EXT_COLOR_WRITE_ENABLE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT: return sizeof(VkPhysicalDeviceColorWriteEnableFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT: return sizeof(VkPipelineColorWriteCreateInfoEXT);
+#endif
+#if defined(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT: return sizeof(VkConditionalRenderingBeginInfoEXT);
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT: return sizeof(VkCommandBufferInheritanceConditionalRenderingInfoEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT: return sizeof(VkPhysicalDeviceConditionalRenderingFeaturesEXT);
+#endif
+#if defined(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceConservativeRasterizationPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineRasterizationConservativeStateCreateInfoEXT);
+#endif
+#if defined(VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT: return sizeof(VkSamplerCustomBorderColorCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceCustomBorderColorPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT: return sizeof(VkPhysicalDeviceCustomBorderColorFeaturesEXT);
+#endif
+#if defined(VK_EXT_DEBUG_MARKER_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT: return sizeof(VkDebugMarkerObjectNameInfoEXT);
+	case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT: return sizeof(VkDebugMarkerObjectTagInfoEXT);
+	case VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT: return sizeof(VkDebugMarkerMarkerInfoEXT);
+#endif
+#if defined(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT: return sizeof(VkDebugReportCallbackCreateInfoEXT);
+#endif
+#if defined(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT: return sizeof(VkDebugUtilsObjectNameInfoEXT);
+	case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT: return sizeof(VkDebugUtilsObjectTagInfoEXT);
+	case VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT: return sizeof(VkDebugUtilsLabelEXT);
+	case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT: return sizeof(VkDebugUtilsMessengerCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT: return sizeof(VkDebugUtilsMessengerCallbackDataEXT);
+#endif
+#if defined(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT: return sizeof(VkPhysicalDeviceDepthClipEnableFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineRasterizationDepthClipStateCreateInfoEXT);
+#endif
+#if defined(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT: return sizeof(VkPhysicalDeviceDeviceMemoryReportFeaturesEXT);
+	case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT: return sizeof(VkDeviceDeviceMemoryReportCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT: return sizeof(VkDeviceMemoryReportCallbackDataEXT);
+#endif
+#if defined(VK_EXT_DISCARD_RECTANGLES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceDiscardRectanglePropertiesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineDiscardRectangleStateCreateInfoEXT);
+#endif
+#if defined(VK_EXT_DISPLAY_CONTROL_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT: return sizeof(VkDisplayPowerInfoEXT);
+	case VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT: return sizeof(VkDeviceEventInfoEXT);
+	case VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT: return sizeof(VkDisplayEventInfoEXT);
+	case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT: return sizeof(VkSwapchainCounterCreateInfoEXT);
+#endif
+#if defined(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT: return sizeof(VkSurfaceCapabilities2EXT);
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT: return sizeof(VkPhysicalDeviceExtendedDynamicState2FeaturesEXT);
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT: return sizeof(VkPhysicalDeviceExtendedDynamicStateFeaturesEXT);
+#endif
+#if defined(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT: return sizeof(VkImportMemoryHostPointerInfoEXT);
+	case VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT: return sizeof(VkMemoryHostPointerPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceExternalMemoryHostPropertiesEXT);
+#endif
+#if defined(VK_EXT_FILTER_CUBIC_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT: return sizeof(VkPhysicalDeviceImageViewImageFormatInfoEXT);
+	case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT: return sizeof(VkFilterCubicImageViewImageFormatPropertiesEXT);
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT: return sizeof(VkPhysicalDeviceFragmentDensityMap2FeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceFragmentDensityMap2PropertiesEXT);
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT: return sizeof(VkPhysicalDeviceFragmentDensityMapFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceFragmentDensityMapPropertiesEXT);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT: return sizeof(VkRenderPassFragmentDensityMapCreateInfoEXT);
+#endif
+#if defined(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT: return sizeof(VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT);
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT: return sizeof(VkDeviceQueueGlobalPriorityCreateInfoEXT);
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_QUERY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_EXT: return sizeof(VkPhysicalDeviceGlobalPriorityQueryFeaturesEXT);
+	case VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_EXT: return sizeof(VkQueueFamilyGlobalPriorityPropertiesEXT);
+#endif
+#if defined(VK_EXT_HDR_METADATA_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_HDR_METADATA_EXT: return sizeof(VkHdrMetadataEXT);
+#endif
+#if defined(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT: return sizeof(VkHeadlessSurfaceCreateInfoEXT);
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT: return sizeof(VkDrmFormatModifierPropertiesListEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT: return sizeof(VkPhysicalDeviceImageDrmFormatModifierInfoEXT);
+	case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT: return sizeof(VkImageDrmFormatModifierListCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT: return sizeof(VkImageDrmFormatModifierExplicitCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT: return sizeof(VkImageDrmFormatModifierPropertiesEXT);
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT: return sizeof(VkDrmFormatModifierPropertiesList2EXT);
+#endif
+#if defined(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES_EXT: return sizeof(VkPhysicalDeviceImageRobustnessFeaturesEXT);
+#endif
+#if defined(VK_EXT_INDEX_TYPE_UINT8_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT: return sizeof(VkPhysicalDeviceIndexTypeUint8FeaturesEXT);
+#endif
+#if defined(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES_EXT: return sizeof(VkPhysicalDeviceInlineUniformBlockFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceInlineUniformBlockPropertiesEXT);
+	case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT: return sizeof(VkWriteDescriptorSetInlineUniformBlockEXT);
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT: return sizeof(VkDescriptorPoolInlineUniformBlockCreateInfoEXT);
+#endif
+#if defined(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT: return sizeof(VkPhysicalDeviceLineRasterizationFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceLineRasterizationPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineRasterizationLineStateCreateInfoEXT);
+#endif
+#if defined(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceMemoryBudgetPropertiesEXT);
+#endif
+#if defined(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT: return sizeof(VkPhysicalDeviceMemoryPriorityFeaturesEXT);
+	case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT: return sizeof(VkMemoryPriorityAllocateInfoEXT);
+#endif
+#if defined(VK_EXT_MULTI_DRAW_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceMultiDrawPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT: return sizeof(VkPhysicalDeviceMultiDrawFeaturesEXT);
+#endif
+#if defined(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT: return sizeof(VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT);
+#endif
+#if defined(VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT: return sizeof(VkPhysicalDevicePCIBusInfoPropertiesEXT);
+#endif
+#if defined(VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceDrmPropertiesEXT);
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES_EXT: return sizeof(VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT);
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT: return sizeof(VkPipelineCreationFeedbackCreateInfoEXT);
+#endif
+#if defined(VK_EXT_PRIMITIVE_TOPOLOGY_LIST_RESTART_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT: return sizeof(VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT);
+#endif
+#if defined(VK_EXT_PRIVATE_DATA_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT: return sizeof(VkDevicePrivateDataCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO_EXT: return sizeof(VkPrivateDataSlotCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES_EXT: return sizeof(VkPhysicalDevicePrivateDataFeaturesEXT);
+#endif
+#if defined(VK_EXT_PROVOKING_VERTEX_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT: return sizeof(VkPhysicalDeviceProvokingVertexFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceProvokingVertexPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineRasterizationProvokingVertexStateCreateInfoEXT);
+#endif
+#if defined(VK_EXT_RGBA10X6_FORMATS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT: return sizeof(VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT);
+#endif
+#if defined(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT: return sizeof(VkPhysicalDeviceRobustness2FeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceRobustness2PropertiesEXT);
+#endif
+#if defined(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT: return sizeof(VkSampleLocationsInfoEXT);
+	case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT: return sizeof(VkRenderPassSampleLocationsBeginInfoEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineSampleLocationsStateCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceSampleLocationsPropertiesEXT);
+	case VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT: return sizeof(VkMultisamplePropertiesEXT);
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT: return sizeof(VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT);
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT: return sizeof(VkPhysicalDeviceShaderAtomicFloatFeaturesEXT);
+#endif
+#if defined(VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES_EXT: return sizeof(VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT);
+#endif
+#if defined(VK_EXT_SHADER_IMAGE_ATOMIC_INT64_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT: return sizeof(VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT);
+#endif
+#if defined(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT: return sizeof(VkPhysicalDeviceSubgroupSizeControlFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceSubgroupSizeControlPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT: return sizeof(VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT);
+#endif
+#if defined(VK_EXT_TEXEL_BUFFER_ALIGNMENT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT: return sizeof(VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT);
+#endif
+#if defined(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES_EXT: return sizeof(VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT);
+#endif
+#if defined(VK_EXT_TOOLING_INFO_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceToolPropertiesEXT);
+#endif
+#if defined(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT: return sizeof(VkPhysicalDeviceTransformFeedbackFeaturesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceTransformFeedbackPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT: return sizeof(VkPipelineRasterizationStateStreamCreateInfoEXT);
+#endif
+#if defined(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT: return sizeof(VkValidationCacheCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT: return sizeof(VkShaderModuleValidationCacheCreateInfoEXT);
+#endif
+#if defined(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT: return sizeof(VkValidationFeaturesEXT);
+#endif
+#if defined(VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT: return sizeof(VkValidationFlagsEXT);
+#endif
+#if defined(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT: return sizeof(VkPipelineVertexInputDivisorStateCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT: return sizeof(VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT: return sizeof(VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT);
+#endif
+#if defined(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT: return sizeof(VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT);
+	case VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT: return sizeof(VkVertexInputBindingDescription2EXT);
+	case VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT: return sizeof(VkVertexInputAttributeDescription2EXT);
+#endif
+#if defined(VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT: return sizeof(VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT);
+#endif
+#if defined(VK_EXT_YCBCR_IMAGE_ARRAYS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT: return sizeof(VkPhysicalDeviceYcbcrImageArraysFeaturesEXT);
+#endif
+#if defined(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE: return sizeof(VkPresentTimesInfoGOOGLE);
+#endif
+#if defined(VK_HUAWEI_INVOCATION_MASK_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI: return sizeof(VkPhysicalDeviceInvocationMaskFeaturesHUAWEI);
+#endif
+#if defined(VK_HUAWEI_SUBPASS_SHADING_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI: return sizeof(VkSubpassShadingPipelineCreateInfoHUAWEI);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI: return sizeof(VkPhysicalDeviceSubpassShadingPropertiesHUAWEI);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI: return sizeof(VkPhysicalDeviceSubpassShadingFeaturesHUAWEI);
+#endif
+#if defined(VK_INTEL_PERFORMANCE_QUERY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL: return sizeof(VkInitializePerformanceApiInfoINTEL);
+	case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL: return sizeof(VkQueryPoolPerformanceQueryCreateInfoINTEL);
+	case VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL: return sizeof(VkPerformanceMarkerInfoINTEL);
+	case VK_STRUCTURE_TYPE_PERFORMANCE_STREAM_MARKER_INFO_INTEL: return sizeof(VkPerformanceStreamMarkerInfoINTEL);
+	case VK_STRUCTURE_TYPE_PERFORMANCE_OVERRIDE_INFO_INTEL: return sizeof(VkPerformanceOverrideInfoINTEL);
+	case VK_STRUCTURE_TYPE_PERFORMANCE_CONFIGURATION_ACQUIRE_INFO_INTEL: return sizeof(VkPerformanceConfigurationAcquireInfoINTEL);
+#endif
+#if defined(VK_INTEL_SHADER_INTEGER_FUNCTIONS_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL: return sizeof(VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL);
+#endif
+#if defined(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR: return sizeof(VkWriteDescriptorSetAccelerationStructureKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR: return sizeof(VkPhysicalDeviceAccelerationStructureFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR: return sizeof(VkPhysicalDeviceAccelerationStructurePropertiesKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR: return sizeof(VkAccelerationStructureGeometryTrianglesDataKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR: return sizeof(VkAccelerationStructureGeometryAabbsDataKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR: return sizeof(VkAccelerationStructureGeometryInstancesDataKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR: return sizeof(VkAccelerationStructureGeometryKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR: return sizeof(VkAccelerationStructureBuildGeometryInfoKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR: return sizeof(VkAccelerationStructureCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR: return sizeof(VkAccelerationStructureDeviceAddressInfoKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR: return sizeof(VkAccelerationStructureVersionInfoKHR);
+	case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR: return sizeof(VkCopyAccelerationStructureInfoKHR);
+	case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR: return sizeof(VkCopyAccelerationStructureToMemoryInfoKHR);
+	case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR: return sizeof(VkCopyMemoryToAccelerationStructureInfoKHR);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR: return sizeof(VkAccelerationStructureBuildSizesInfoKHR);
+#endif
+#if defined(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR: return sizeof(VkBufferCopy2KHR);
+	case VK_STRUCTURE_TYPE_IMAGE_COPY_2_KHR: return sizeof(VkImageCopy2KHR);
+	case VK_STRUCTURE_TYPE_IMAGE_BLIT_2_KHR: return sizeof(VkImageBlit2KHR);
+	case VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2_KHR: return sizeof(VkBufferImageCopy2KHR);
+	case VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2_KHR: return sizeof(VkImageResolve2KHR);
+	case VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR: return sizeof(VkCopyBufferInfo2KHR);
+	case VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2_KHR: return sizeof(VkCopyImageInfo2KHR);
+	case VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2_KHR: return sizeof(VkBlitImageInfo2KHR);
+	case VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2_KHR: return sizeof(VkCopyBufferToImageInfo2KHR);
+	case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2_KHR: return sizeof(VkCopyImageToBufferInfo2KHR);
+	case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2_KHR: return sizeof(VkResolveImageInfo2KHR);
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SURFACE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR: return sizeof(VkDeviceGroupPresentCapabilitiesKHR);
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR: return sizeof(VkImageSwapchainCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR: return sizeof(VkBindImageMemorySwapchainInfoKHR);
+	case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR: return sizeof(VkAcquireNextImageInfoKHR);
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR: return sizeof(VkDeviceGroupPresentInfoKHR);
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR: return sizeof(VkDeviceGroupSwapchainCreateInfoKHR);
+#endif
+#if defined(VK_KHR_DISPLAY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR: return sizeof(VkDisplayModeCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR: return sizeof(VkDisplaySurfaceCreateInfoKHR);
+#endif
+#if defined(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR: return sizeof(VkDisplayPresentInfoKHR);
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR: return sizeof(VkImportFenceFdInfoKHR);
+	case VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR: return sizeof(VkFenceGetFdInfoKHR);
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR: return sizeof(VkImportMemoryFdInfoKHR);
+	case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR: return sizeof(VkMemoryFdPropertiesKHR);
+	case VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR: return sizeof(VkMemoryGetFdInfoKHR);
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR: return sizeof(VkImportSemaphoreFdInfoKHR);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR: return sizeof(VkSemaphoreGetFdInfoKHR);
+#endif
+#if defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR: return sizeof(VkFormatProperties3KHR);
+#endif
+#if defined(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR: return sizeof(VkFragmentShadingRateAttachmentInfoKHR);
+	case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR: return sizeof(VkPipelineFragmentShadingRateStateCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR: return sizeof(VkPhysicalDeviceFragmentShadingRateFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR: return sizeof(VkPhysicalDeviceFragmentShadingRatePropertiesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR: return sizeof(VkPhysicalDeviceFragmentShadingRateKHR);
+#endif
+#if defined(VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR: return sizeof(VkDisplayProperties2KHR);
+	case VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR: return sizeof(VkDisplayPlaneProperties2KHR);
+	case VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR: return sizeof(VkDisplayModeProperties2KHR);
+	case VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR: return sizeof(VkDisplayPlaneInfo2KHR);
+	case VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR: return sizeof(VkDisplayPlaneCapabilities2KHR);
+#endif
+#if defined(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR: return sizeof(VkPhysicalDeviceSurfaceInfo2KHR);
+	case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR: return sizeof(VkSurfaceCapabilities2KHR);
+	case VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR: return sizeof(VkSurfaceFormat2KHR);
+#endif
+#if defined(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR: return sizeof(VkPresentRegionsKHR);
+#endif
+#if defined(VK_KHR_MAINTENANCE_4_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS_KHR: return sizeof(VkDeviceBufferMemoryRequirementsKHR);
+	case VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS_KHR: return sizeof(VkDeviceImageMemoryRequirementsKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES_KHR: return sizeof(VkPhysicalDeviceMaintenance4FeaturesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES_KHR: return sizeof(VkPhysicalDeviceMaintenance4PropertiesKHR);
+#endif
+#if defined(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR: return sizeof(VkPhysicalDevicePerformanceQueryFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR: return sizeof(VkPhysicalDevicePerformanceQueryPropertiesKHR);
+	case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR: return sizeof(VkPerformanceCounterKHR);
+	case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR: return sizeof(VkPerformanceCounterDescriptionKHR);
+	case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR: return sizeof(VkQueryPoolPerformanceCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR: return sizeof(VkAcquireProfilingLockInfoKHR);
+	case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR: return sizeof(VkPerformanceQuerySubmitInfoKHR);
+#endif
+#if defined(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR: return sizeof(VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR: return sizeof(VkPipelineInfoKHR);
+	case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR: return sizeof(VkPipelineExecutablePropertiesKHR);
+	case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR: return sizeof(VkPipelineExecutableInfoKHR);
+	case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR: return sizeof(VkPipelineExecutableStatisticKHR);
+	case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR: return sizeof(VkPipelineExecutableInternalRepresentationKHR);
+#endif
+#if defined(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR: return sizeof(VkPipelineLibraryCreateInfoKHR);
+#endif
+#if defined(VK_KHR_PRESENT_ID_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR: return sizeof(VkPhysicalDevicePresentIdFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PRESENT_ID_KHR: return sizeof(VkPresentIdKHR);
+#endif
+#if defined(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR: return sizeof(VkPhysicalDevicePresentWaitFeaturesKHR);
+#endif
+#if defined(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR: return sizeof(VkPhysicalDevicePushDescriptorPropertiesKHR);
+#endif
+#if defined(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR: return sizeof(VkPhysicalDeviceRayQueryFeaturesKHR);
+#endif
+#if defined(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR: return sizeof(VkRayTracingShaderGroupCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR: return sizeof(VkRayTracingPipelineCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR: return sizeof(VkPhysicalDeviceRayTracingPipelineFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR: return sizeof(VkPhysicalDeviceRayTracingPipelinePropertiesKHR);
+	case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR: return sizeof(VkRayTracingPipelineInterfaceCreateInfoKHR);
+#endif
+#if defined(VK_KHR_SHADER_CLOCK_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR: return sizeof(VkPhysicalDeviceShaderClockFeaturesKHR);
+#endif
+#if defined(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES_KHR: return sizeof(VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES_KHR: return sizeof(VkPhysicalDeviceShaderIntegerDotProductPropertiesKHR);
+#endif
+#if defined(VK_KHR_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR: return sizeof(VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR);
+#endif
+#if defined(VK_KHR_SHADER_TERMINATE_INVOCATION_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES_KHR: return sizeof(VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR);
+#endif
+#if defined(VK_KHR_SHARED_PRESENTABLE_IMAGE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR: return sizeof(VkSharedPresentSurfaceCapabilitiesKHR);
+#endif
+#if defined(VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR: return sizeof(VkSurfaceProtectedCapabilitiesKHR);
+#endif
+#if defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR: return sizeof(VkSwapchainCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR: return sizeof(VkPresentInfoKHR);
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR: return sizeof(VkMemoryBarrier2KHR);
+	case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR: return sizeof(VkImageMemoryBarrier2KHR);
+	case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR: return sizeof(VkBufferMemoryBarrier2KHR);
+	case VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR: return sizeof(VkDependencyInfoKHR);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR: return sizeof(VkSemaphoreSubmitInfoKHR);
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR: return sizeof(VkCommandBufferSubmitInfoKHR);
+	case VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR: return sizeof(VkSubmitInfo2KHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR: return sizeof(VkPhysicalDeviceSynchronization2FeaturesKHR);
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) && defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV: return sizeof(VkQueueFamilyCheckpointProperties2NV);
+	case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV: return sizeof(VkCheckpointData2NV);
+#endif
+#if defined(VK_KHR_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR: return sizeof(VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR);
+#endif
+#if defined(VK_KHR_ZERO_INITIALIZE_WORKGROUP_MEMORY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES_KHR: return sizeof(VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR);
+#endif
+#if defined(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_CU_MODULE_CREATE_INFO_NVX: return sizeof(VkCuModuleCreateInfoNVX);
+	case VK_STRUCTURE_TYPE_CU_FUNCTION_CREATE_INFO_NVX: return sizeof(VkCuFunctionCreateInfoNVX);
+	case VK_STRUCTURE_TYPE_CU_LAUNCH_INFO_NVX: return sizeof(VkCuLaunchInfoNVX);
+#endif
+#if defined(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_IMAGE_VIEW_HANDLE_INFO_NVX: return sizeof(VkImageViewHandleInfoNVX);
+	case VK_STRUCTURE_TYPE_IMAGE_VIEW_ADDRESS_PROPERTIES_NVX: return sizeof(VkImageViewAddressPropertiesNVX);
+#endif
+#if defined(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX: return sizeof(VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX);
+#endif
+#if defined(VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV: return sizeof(VkPipelineViewportWScalingStateCreateInfoNV);
+#endif
+#if defined(VK_NV_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV: return sizeof(VkPhysicalDeviceComputeShaderDerivativesFeaturesNV);
+#endif
+#if defined(VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV: return sizeof(VkPhysicalDeviceCooperativeMatrixFeaturesNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV: return sizeof(VkPhysicalDeviceCooperativeMatrixPropertiesNV);
+	case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV: return sizeof(VkCooperativeMatrixPropertiesNV);
+#endif
+#if defined(VK_NV_CORNER_SAMPLED_IMAGE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV: return sizeof(VkPhysicalDeviceCornerSampledImageFeaturesNV);
+#endif
+#if defined(VK_NV_COVERAGE_REDUCTION_MODE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV: return sizeof(VkPhysicalDeviceCoverageReductionModeFeaturesNV);
+	case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV: return sizeof(VkPipelineCoverageReductionStateCreateInfoNV);
+	case VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV: return sizeof(VkFramebufferMixedSamplesCombinationNV);
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV: return sizeof(VkDedicatedAllocationImageCreateInfoNV);
+	case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV: return sizeof(VkDedicatedAllocationBufferCreateInfoNV);
+	case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV: return sizeof(VkDedicatedAllocationMemoryAllocateInfoNV);
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_IMAGE_ALIASING_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV: return sizeof(VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV);
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTICS_CONFIG_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV: return sizeof(VkPhysicalDeviceDiagnosticsConfigFeaturesNV);
+	case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV: return sizeof(VkDeviceDiagnosticsConfigCreateInfoNV);
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV: return sizeof(VkQueueFamilyCheckpointPropertiesNV);
+	case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV: return sizeof(VkCheckpointDataNV);
+#endif
+#if defined(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV: return sizeof(VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV: return sizeof(VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV);
+	case VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV: return sizeof(VkGraphicsShaderGroupCreateInfoNV);
+	case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV: return sizeof(VkGraphicsPipelineShaderGroupsCreateInfoNV);
+	case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV: return sizeof(VkIndirectCommandsLayoutTokenNV);
+	case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV: return sizeof(VkIndirectCommandsLayoutCreateInfoNV);
+	case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV: return sizeof(VkGeneratedCommandsInfoNV);
+	case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV: return sizeof(VkGeneratedCommandsMemoryRequirementsInfoNV);
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV: return sizeof(VkExternalMemoryImageCreateInfoNV);
+	case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV: return sizeof(VkExportMemoryAllocateInfoNV);
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_RDMA_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV: return sizeof(VkPhysicalDeviceExternalMemoryRDMAFeaturesNV);
+	case VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV: return sizeof(VkMemoryGetRemoteAddressInfoNV);
+#endif
+#if defined(VK_NV_FRAGMENT_COVERAGE_TO_COLOR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV: return sizeof(VkPipelineCoverageToColorStateCreateInfoNV);
+#endif
+#if defined(VK_NV_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV: return sizeof(VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV);
+#endif
+#if defined(VK_NV_FRAGMENT_SHADING_RATE_ENUMS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV: return sizeof(VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV: return sizeof(VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV);
+	case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV: return sizeof(VkPipelineFragmentShadingRateEnumStateCreateInfoNV);
+#endif
+#if defined(VK_NV_FRAMEBUFFER_MIXED_SAMPLES_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV: return sizeof(VkPipelineCoverageModulationStateCreateInfoNV);
+#endif
+#if defined(VK_NV_INHERITED_VIEWPORT_SCISSOR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV: return sizeof(VkPhysicalDeviceInheritedViewportScissorFeaturesNV);
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV: return sizeof(VkCommandBufferInheritanceViewportScissorInfoNV);
+#endif
+#if defined(VK_NV_MESH_SHADER_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV: return sizeof(VkPhysicalDeviceMeshShaderFeaturesNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV: return sizeof(VkPhysicalDeviceMeshShaderPropertiesNV);
+#endif
+#if defined(VK_NV_RAY_TRACING_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV: return sizeof(VkRayTracingShaderGroupCreateInfoNV);
+	case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV: return sizeof(VkRayTracingPipelineCreateInfoNV);
+	case VK_STRUCTURE_TYPE_GEOMETRY_TRIANGLES_NV: return sizeof(VkGeometryTrianglesNV);
+	case VK_STRUCTURE_TYPE_GEOMETRY_AABB_NV: return sizeof(VkGeometryAABBNV);
+	case VK_STRUCTURE_TYPE_GEOMETRY_NV: return sizeof(VkGeometryNV);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_INFO_NV: return sizeof(VkAccelerationStructureInfoNV);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV: return sizeof(VkAccelerationStructureCreateInfoNV);
+	case VK_STRUCTURE_TYPE_BIND_ACCELERATION_STRUCTURE_MEMORY_INFO_NV: return sizeof(VkBindAccelerationStructureMemoryInfoNV);
+	case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV: return sizeof(VkWriteDescriptorSetAccelerationStructureNV);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV: return sizeof(VkAccelerationStructureMemoryRequirementsInfoNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV: return sizeof(VkPhysicalDeviceRayTracingPropertiesNV);
+#endif
+#if defined(VK_NV_RAY_TRACING_MOTION_BLUR_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV: return sizeof(VkPhysicalDeviceRayTracingMotionBlurFeaturesNV);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV: return sizeof(VkAccelerationStructureGeometryMotionTrianglesDataNV);
+	case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV: return sizeof(VkAccelerationStructureMotionInfoNV);
+#endif
+#if defined(VK_NV_REPRESENTATIVE_FRAGMENT_TEST_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV: return sizeof(VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV);
+	case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV: return sizeof(VkPipelineRepresentativeFragmentTestStateCreateInfoNV);
+#endif
+#if defined(VK_NV_SCISSOR_EXCLUSIVE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV: return sizeof(VkPhysicalDeviceExclusiveScissorFeaturesNV);
+	case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV: return sizeof(VkPipelineViewportExclusiveScissorStateCreateInfoNV);
+#endif
+#if defined(VK_NV_SHADER_IMAGE_FOOTPRINT_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV: return sizeof(VkPhysicalDeviceShaderImageFootprintFeaturesNV);
+#endif
+#if defined(VK_NV_SHADER_SM_BUILTINS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV: return sizeof(VkPhysicalDeviceShaderSMBuiltinsPropertiesNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV: return sizeof(VkPhysicalDeviceShaderSMBuiltinsFeaturesNV);
+#endif
+#if defined(VK_NV_SHADING_RATE_IMAGE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV: return sizeof(VkPipelineViewportShadingRateImageStateCreateInfoNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV: return sizeof(VkPhysicalDeviceShadingRateImageFeaturesNV);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV: return sizeof(VkPhysicalDeviceShadingRateImagePropertiesNV);
+	case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV: return sizeof(VkPipelineViewportCoarseSampleOrderStateCreateInfoNV);
+#endif
+#if defined(VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV: return sizeof(VkPipelineViewportSwizzleStateCreateInfoNV);
+#endif
+#if defined(VK_QCOM_RENDER_PASS_TRANSFORM_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM: return sizeof(VkRenderPassTransformBeginInfoQCOM);
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM: return sizeof(VkCommandBufferInheritanceRenderPassTransformInfoQCOM);
+#endif
+#if defined(VK_QCOM_ROTATED_COPY_COMMANDS_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM: return sizeof(VkCopyCommandTransformInfoQCOM);
+#endif
+#if defined(VK_VALVE_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_VALVE: return sizeof(VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE);
+	case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE: return sizeof(VkMutableDescriptorTypeCreateInfoVALVE);
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_EXT: return sizeof(VkVideoDecodeH264ProfileEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_EXT: return sizeof(VkVideoDecodeH264CapabilitiesEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_CREATE_INFO_EXT: return sizeof(VkVideoDecodeH264SessionCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT: return sizeof(VkVideoDecodeH264SessionParametersAddInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT: return sizeof(VkVideoDecodeH264SessionParametersCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_EXT: return sizeof(VkVideoDecodeH264PictureInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_EXT: return sizeof(VkVideoDecodeH264DpbSlotInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_MVC_EXT: return sizeof(VkVideoDecodeH264MvcEXT);
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_EXT: return sizeof(VkVideoDecodeH265ProfileEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_EXT: return sizeof(VkVideoDecodeH265CapabilitiesEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_CREATE_INFO_EXT: return sizeof(VkVideoDecodeH265SessionCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT: return sizeof(VkVideoDecodeH265SessionParametersAddInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT: return sizeof(VkVideoDecodeH265SessionParametersCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_EXT: return sizeof(VkVideoDecodeH265PictureInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_EXT: return sizeof(VkVideoDecodeH265DpbSlotInfoEXT);
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT: return sizeof(VkVideoEncodeH264CapabilitiesEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_CREATE_INFO_EXT: return sizeof(VkVideoEncodeH264SessionCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT: return sizeof(VkVideoEncodeH264SessionParametersAddInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT: return sizeof(VkVideoEncodeH264SessionParametersCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_EXT: return sizeof(VkVideoEncodeH264DpbSlotInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_VCL_FRAME_INFO_EXT: return sizeof(VkVideoEncodeH264VclFrameInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_EMIT_PICTURE_PARAMETERS_EXT: return sizeof(VkVideoEncodeH264EmitPictureParametersEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_EXT: return sizeof(VkVideoEncodeH264ProfileEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_NALU_SLICE_EXT: return sizeof(VkVideoEncodeH264NaluSliceEXT);
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT: return sizeof(VkVideoEncodeH265CapabilitiesEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_CREATE_INFO_EXT: return sizeof(VkVideoEncodeH265SessionCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT: return sizeof(VkVideoEncodeH265SessionParametersAddInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT: return sizeof(VkVideoEncodeH265SessionParametersCreateInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_VCL_FRAME_INFO_EXT: return sizeof(VkVideoEncodeH265VclFrameInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_EMIT_PICTURE_PARAMETERS_EXT: return sizeof(VkVideoEncodeH265EmitPictureParametersEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_NALU_SLICE_EXT: return sizeof(VkVideoEncodeH265NaluSliceEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_EXT: return sizeof(VkVideoEncodeH265ProfileEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_EXT: return sizeof(VkVideoEncodeH265DpbSlotInfoEXT);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_REFERENCE_LISTS_EXT: return sizeof(VkVideoEncodeH265ReferenceListsEXT);
+#endif
+#if defined(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR: return sizeof(VkPhysicalDevicePortabilitySubsetFeaturesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR: return sizeof(VkPhysicalDevicePortabilitySubsetPropertiesKHR);
+#endif
+#if defined(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR: return sizeof(VkVideoDecodeInfoKHR);
+#endif
+#if defined(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR: return sizeof(VkVideoEncodeInfoKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR: return sizeof(VkVideoEncodeRateControlInfoKHR);
+#endif
+#if defined(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	case VK_STRUCTURE_TYPE_VIDEO_QUEUE_FAMILY_PROPERTIES_2_KHR: return sizeof(VkVideoQueueFamilyProperties2KHR);
+	case VK_STRUCTURE_TYPE_VIDEO_PROFILES_KHR: return sizeof(VkVideoProfilesKHR);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_FORMAT_INFO_KHR: return sizeof(VkPhysicalDeviceVideoFormatInfoKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR: return sizeof(VkVideoFormatPropertiesKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_PROFILE_KHR: return sizeof(VkVideoProfileKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR: return sizeof(VkVideoCapabilitiesKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_GET_MEMORY_PROPERTIES_KHR: return sizeof(VkVideoGetMemoryPropertiesKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_BIND_MEMORY_KHR: return sizeof(VkVideoBindMemoryKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_PICTURE_RESOURCE_KHR: return sizeof(VkVideoPictureResourceKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_REFERENCE_SLOT_KHR: return sizeof(VkVideoReferenceSlotKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_SESSION_CREATE_INFO_KHR: return sizeof(VkVideoSessionCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_CREATE_INFO_KHR: return sizeof(VkVideoSessionParametersCreateInfoKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_UPDATE_INFO_KHR: return sizeof(VkVideoSessionParametersUpdateInfoKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_BEGIN_CODING_INFO_KHR: return sizeof(VkVideoBeginCodingInfoKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_END_CODING_INFO_KHR: return sizeof(VkVideoEndCodingInfoKHR);
+	case VK_STRUCTURE_TYPE_VIDEO_CODING_CONTROL_INFO_KHR: return sizeof(VkVideoCodingControlInfoKHR);
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return sizeof(VkImportAndroidHardwareBufferInfoANDROID);
+	case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID: return sizeof(VkAndroidHardwareBufferUsageANDROID);
+	case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID: return sizeof(VkAndroidHardwareBufferPropertiesANDROID);
+	case VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return sizeof(VkMemoryGetAndroidHardwareBufferInfoANDROID);
+	case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID: return sizeof(VkAndroidHardwareBufferFormatPropertiesANDROID);
+	case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID: return sizeof(VkExternalFormatANDROID);
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID: return sizeof(VkAndroidHardwareBufferFormatProperties2ANDROID);
+#endif
+#if defined(VK_ANDROID_NATIVE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	case VK_STRUCTURE_TYPE_NATIVE_BUFFER_ANDROID: return sizeof(VkNativeBufferANDROID);
+	case VK_STRUCTURE_TYPE_SWAPCHAIN_IMAGE_CREATE_INFO_ANDROID: return sizeof(VkSwapchainImageCreateInfoANDROID);
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENTATION_PROPERTIES_ANDROID: return sizeof(VkPhysicalDevicePresentationPropertiesANDROID);
+#endif
+#if defined(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	case VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR: return sizeof(VkAndroidSurfaceCreateInfoKHR);
+#endif
+#if defined(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+	case VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT: return sizeof(VkDirectFBSurfaceCreateInfoEXT);
+#endif
+#if defined(VK_FUCHSIA_BUFFER_COLLECTION_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA: return sizeof(VkImportMemoryBufferCollectionFUCHSIA);
+	case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA: return sizeof(VkBufferCollectionImageCreateInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA: return sizeof(VkBufferCollectionBufferCreateInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CREATE_INFO_FUCHSIA: return sizeof(VkBufferCollectionCreateInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_PROPERTIES_FUCHSIA: return sizeof(VkBufferCollectionPropertiesFUCHSIA);
+	case VK_STRUCTURE_TYPE_BUFFER_CONSTRAINTS_INFO_FUCHSIA: return sizeof(VkBufferConstraintsInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA: return sizeof(VkSysmemColorSpaceFUCHSIA);
+	case VK_STRUCTURE_TYPE_IMAGE_FORMAT_CONSTRAINTS_INFO_FUCHSIA: return sizeof(VkImageFormatConstraintsInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_IMAGE_CONSTRAINTS_INFO_FUCHSIA: return sizeof(VkImageConstraintsInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA: return sizeof(VkBufferCollectionConstraintsInfoFUCHSIA);
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_MEMORY_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	case VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA: return sizeof(VkImportMemoryZirconHandleInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA: return sizeof(VkMemoryZirconHandlePropertiesFUCHSIA);
+	case VK_STRUCTURE_TYPE_MEMORY_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return sizeof(VkMemoryGetZirconHandleInfoFUCHSIA);
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_SEMAPHORE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_ZIRCON_HANDLE_INFO_FUCHSIA: return sizeof(VkImportSemaphoreZirconHandleInfoFUCHSIA);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return sizeof(VkSemaphoreGetZirconHandleInfoFUCHSIA);
+#endif
+#if defined(VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	case VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA: return sizeof(VkImagePipeSurfaceCreateInfoFUCHSIA);
+#endif
+#if defined(VK_GGP_FRAME_TOKEN_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP: return sizeof(VkPresentFrameTokenGGP);
+#endif
+#if defined(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	case VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP: return sizeof(VkStreamDescriptorSurfaceCreateInfoGGP);
+#endif
+#if defined(VK_MVK_IOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_IOS_MVK)
+	case VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK: return sizeof(VkIOSSurfaceCreateInfoMVK);
+#endif
+#if defined(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_MACOS_MVK)
+	case VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK: return sizeof(VkMacOSSurfaceCreateInfoMVK);
+#endif
+#if defined(VK_EXT_METAL_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_METAL_EXT)
+	case VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT: return sizeof(VkMetalSurfaceCreateInfoEXT);
+#endif
+#if defined(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_SCREEN_QNX)
+	case VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX: return sizeof(VkScreenSurfaceCreateInfoQNX);
+#endif
+#if defined(VK_NN_VI_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_VI_NN)
+	case VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN: return sizeof(VkViSurfaceCreateInfoNN);
+#endif
+#if defined(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WAYLAND_KHR)
+	case VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR: return sizeof(VkWaylandSurfaceCreateInfoKHR);
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT: return sizeof(VkSurfaceFullScreenExclusiveInfoEXT);
+	case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT: return sizeof(VkSurfaceCapabilitiesFullScreenExclusiveEXT);
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT: return sizeof(VkSurfaceFullScreenExclusiveWin32InfoEXT);
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR: return sizeof(VkImportFenceWin32HandleInfoKHR);
+	case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR: return sizeof(VkExportFenceWin32HandleInfoKHR);
+	case VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR: return sizeof(VkFenceGetWin32HandleInfoKHR);
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return sizeof(VkImportMemoryWin32HandleInfoKHR);
+	case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return sizeof(VkExportMemoryWin32HandleInfoKHR);
+	case VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR: return sizeof(VkMemoryWin32HandlePropertiesKHR);
+	case VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR: return sizeof(VkMemoryGetWin32HandleInfoKHR);
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return sizeof(VkImportSemaphoreWin32HandleInfoKHR);
+	case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return sizeof(VkExportSemaphoreWin32HandleInfoKHR);
+	case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR: return sizeof(VkD3D12FenceSubmitInfoKHR);
+	case VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR: return sizeof(VkSemaphoreGetWin32HandleInfoKHR);
+#endif
+#if defined(VK_KHR_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR: return sizeof(VkWin32KeyedMutexAcquireReleaseInfoKHR);
+#endif
+#if defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR: return sizeof(VkWin32SurfaceCreateInfoKHR);
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV: return sizeof(VkImportMemoryWin32HandleInfoNV);
+	case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV: return sizeof(VkExportMemoryWin32HandleInfoNV);
+#endif
+#if defined(VK_NV_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV: return sizeof(VkWin32KeyedMutexAcquireReleaseInfoNV);
+#endif
+#if defined(VK_KHR_XCB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XCB_KHR)
+	case VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR: return sizeof(VkXcbSurfaceCreateInfoKHR);
+#endif
+#if defined(VK_KHR_XLIB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XLIB_KHR)
+	case VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR: return sizeof(VkXlibSurfaceCreateInfoKHR);
+#endif
+	default: return 0;
+	}
+}
+
+//Dense index of every structure with sType, in the order of the generated tables
+enum class StructureOrdinal: uint32_t
+{
+	VkApplicationInfo,
+	VkDeviceQueueCreateInfo,
+	VkDeviceCreateInfo,
+	VkInstanceCreateInfo,
+	VkMemoryAllocateInfo,
+	VkMappedMemoryRange,
+	VkWriteDescriptorSet,
+	VkCopyDescriptorSet,
+	VkBufferCreateInfo,
+	VkBufferViewCreateInfo,
+	VkMemoryBarrier,
+	VkBufferMemoryBarrier,
+	VkImageMemoryBarrier,
+	VkImageCreateInfo,
+	VkImageViewCreateInfo,
+	VkBindSparseInfo,
+	VkShaderModuleCreateInfo,
+	VkDescriptorSetLayoutCreateInfo,
+	VkDescriptorPoolCreateInfo,
+	VkDescriptorSetAllocateInfo,
+	VkPipelineShaderStageCreateInfo,
+	VkComputePipelineCreateInfo,
+	VkPipelineVertexInputStateCreateInfo,
+	VkPipelineInputAssemblyStateCreateInfo,
+	VkPipelineTessellationStateCreateInfo,
+	VkPipelineViewportStateCreateInfo,
+	VkPipelineRasterizationStateCreateInfo,
+	VkPipelineMultisampleStateCreateInfo,
+	VkPipelineColorBlendStateCreateInfo,
+	VkPipelineDynamicStateCreateInfo,
+	VkPipelineDepthStencilStateCreateInfo,
+	VkGraphicsPipelineCreateInfo,
+	VkPipelineCacheCreateInfo,
+	VkPipelineLayoutCreateInfo,
+	VkSamplerCreateInfo,
+	VkCommandPoolCreateInfo,
+	VkCommandBufferAllocateInfo,
+	VkCommandBufferInheritanceInfo,
+	VkCommandBufferBeginInfo,
+	VkRenderPassBeginInfo,
+	VkRenderPassCreateInfo,
+	VkEventCreateInfo,
+	VkFenceCreateInfo,
+	VkSemaphoreCreateInfo,
+	VkQueryPoolCreateInfo,
+	VkFramebufferCreateInfo,
+	VkSubmitInfo,
+	VkPhysicalDeviceFeatures2,
+	VkPhysicalDeviceProperties2,
+	VkFormatProperties2,
+	VkImageFormatProperties2,
+	VkPhysicalDeviceImageFormatInfo2,
+	VkQueueFamilyProperties2,
+	VkPhysicalDeviceMemoryProperties2,
+	VkSparseImageFormatProperties2,
+	VkPhysicalDeviceSparseImageFormatInfo2,
+	VkPhysicalDeviceDriverProperties,
+	VkPhysicalDeviceVariablePointersFeatures,
+	VkPhysicalDeviceExternalImageFormatInfo,
+	VkExternalImageFormatProperties,
+	VkPhysicalDeviceExternalBufferInfo,
+	VkExternalBufferProperties,
+	VkPhysicalDeviceIDProperties,
+	VkExternalMemoryImageCreateInfo,
+	VkExternalMemoryBufferCreateInfo,
+	VkExportMemoryAllocateInfo,
+	VkPhysicalDeviceExternalSemaphoreInfo,
+	VkExternalSemaphoreProperties,
+	VkExportSemaphoreCreateInfo,
+	VkPhysicalDeviceExternalFenceInfo,
+	VkExternalFenceProperties,
+	VkExportFenceCreateInfo,
+	VkPhysicalDeviceMultiviewFeatures,
+	VkPhysicalDeviceMultiviewProperties,
+	VkRenderPassMultiviewCreateInfo,
+	VkPhysicalDeviceGroupProperties,
+	VkMemoryAllocateFlagsInfo,
+	VkBindBufferMemoryInfo,
+	VkBindBufferMemoryDeviceGroupInfo,
+	VkBindImageMemoryInfo,
+	VkBindImageMemoryDeviceGroupInfo,
+	VkDeviceGroupRenderPassBeginInfo,
+	VkDeviceGroupCommandBufferBeginInfo,
+	VkDeviceGroupSubmitInfo,
+	VkDeviceGroupBindSparseInfo,
+	VkDeviceGroupDeviceCreateInfo,
+	VkDescriptorUpdateTemplateCreateInfo,
+	VkRenderPassInputAttachmentAspectCreateInfo,
+	VkPhysicalDevice16BitStorageFeatures,
+	VkPhysicalDeviceSubgroupProperties,
+	VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures,
+	VkBufferMemoryRequirementsInfo2,
+	VkImageMemoryRequirementsInfo2,
+	VkImageSparseMemoryRequirementsInfo2,
+	VkMemoryRequirements2,
+	VkSparseImageMemoryRequirements2,
+	VkPhysicalDevicePointClippingProperties,
+	VkMemoryDedicatedRequirements,
+	VkMemoryDedicatedAllocateInfo,
+	VkImageViewUsageCreateInfo,
+	VkPipelineTessellationDomainOriginStateCreateInfo,
+	VkSamplerYcbcrConversionInfo,
+	VkSamplerYcbcrConversionCreateInfo,
+	VkBindImagePlaneMemoryInfo,
+	VkImagePlaneMemoryRequirementsInfo,
+	VkPhysicalDeviceSamplerYcbcrConversionFeatures,
+	VkSamplerYcbcrConversionImageFormatProperties,
+	VkProtectedSubmitInfo,
+	VkPhysicalDeviceProtectedMemoryFeatures,
+	VkPhysicalDeviceProtectedMemoryProperties,
+	VkDeviceQueueInfo2,
+	VkPhysicalDeviceSamplerFilterMinmaxProperties,
+	VkSamplerReductionModeCreateInfo,
+	VkImageFormatListCreateInfo,
+	VkPhysicalDeviceMaintenance3Properties,
+	VkDescriptorSetLayoutSupport,
+	VkPhysicalDeviceShaderDrawParametersFeatures,
+	VkPhysicalDeviceShaderFloat16Int8Features,
+	VkPhysicalDeviceFloatControlsProperties,
+	VkPhysicalDeviceHostQueryResetFeatures,
+	VkPhysicalDeviceDescriptorIndexingFeatures,
+	VkPhysicalDeviceDescriptorIndexingProperties,
+	VkDescriptorSetLayoutBindingFlagsCreateInfo,
+	VkDescriptorSetVariableDescriptorCountAllocateInfo,
+	VkDescriptorSetVariableDescriptorCountLayoutSupport,
+	VkAttachmentDescription2,
+	VkAttachmentReference2,
+	VkSubpassDescription2,
+	VkSubpassDependency2,
+	VkRenderPassCreateInfo2,
+	VkSubpassBeginInfo,
+	VkSubpassEndInfo,
+	VkPhysicalDeviceTimelineSemaphoreFeatures,
+	VkPhysicalDeviceTimelineSemaphoreProperties,
+	VkSemaphoreTypeCreateInfo,
+	VkTimelineSemaphoreSubmitInfo,
+	VkSemaphoreWaitInfo,
+	VkSemaphoreSignalInfo,
+	VkPhysicalDevice8BitStorageFeatures,
+	VkPhysicalDeviceVulkanMemoryModelFeatures,
+	VkPhysicalDeviceShaderAtomicInt64Features,
+	VkPhysicalDeviceDepthStencilResolveProperties,
+	VkSubpassDescriptionDepthStencilResolve,
+	VkImageStencilUsageCreateInfo,
+	VkPhysicalDeviceScalarBlockLayoutFeatures,
+	VkPhysicalDeviceUniformBufferStandardLayoutFeatures,
+	VkPhysicalDeviceBufferDeviceAddressFeatures,
+	VkBufferDeviceAddressInfo,
+	VkBufferOpaqueCaptureAddressCreateInfo,
+	VkPhysicalDeviceImagelessFramebufferFeatures,
+	VkFramebufferAttachmentsCreateInfo,
+	VkFramebufferAttachmentImageInfo,
+	VkRenderPassAttachmentBeginInfo,
+	VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures,
+	VkAttachmentReferenceStencilLayout,
+	VkAttachmentDescriptionStencilLayout,
+	VkMemoryOpaqueCaptureAddressAllocateInfo,
+	VkDeviceMemoryOpaqueCaptureAddressInfo,
+	VkPhysicalDeviceVulkan11Features,
+	VkPhysicalDeviceVulkan11Properties,
+	VkPhysicalDeviceVulkan12Features,
+	VkPhysicalDeviceVulkan12Properties,
+#if defined(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME)
+	VkPhysicalDeviceCoherentMemoryFeaturesAMD,
+#endif
+#if defined(VK_AMD_DISPLAY_NATIVE_HDR_EXTENSION_NAME)
+	VkDisplayNativeHdrSurfaceCapabilitiesAMD,
+	VkSwapchainDisplayNativeHdrCreateInfoAMD,
+#endif
+#if defined(VK_AMD_MEMORY_OVERALLOCATION_BEHAVIOR_EXTENSION_NAME)
+	VkDeviceMemoryOverallocationCreateInfoAMD,
+#endif
+#if defined(VK_AMD_PIPELINE_COMPILER_CONTROL_EXTENSION_NAME)
+	VkPipelineCompilerControlCreateInfoAMD,
+#endif
+#if defined(VK_AMD_RASTERIZATION_ORDER_EXTENSION_NAME)
+	VkPipelineRasterizationStateRasterizationOrderAMD,
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME)
+	VkPhysicalDeviceShaderCoreProperties2AMD,
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME)
+	VkPhysicalDeviceShaderCorePropertiesAMD,
+#endif
+#if defined(VK_AMD_TEXTURE_GATHER_BIAS_LOD_EXTENSION_NAME)
+	VkTextureLODGatherFormatPropertiesAMD,
+#endif
+#if defined(VK_EXT_4444_FORMATS_EXTENSION_NAME)
+	VkPhysicalDevice4444FormatsFeaturesEXT,
+#endif
+#if defined(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME)
+	VkImageViewASTCDecodeModeEXT,
+	VkPhysicalDeviceASTCDecodeFeaturesEXT,
+#endif
+#if defined(VK_EXT_BLEND_OPERATION_ADVANCED_EXTENSION_NAME)
+	VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT,
+	VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT,
+	VkPipelineColorBlendAdvancedStateCreateInfoEXT,
+#endif
+#if defined(VK_EXT_BORDER_COLOR_SWIZZLE_EXTENSION_NAME)
+	VkSamplerBorderColorComponentMappingCreateInfoEXT,
+	VkPhysicalDeviceBorderColorSwizzleFeaturesEXT,
+#endif
+#if defined(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)
+	VkPhysicalDeviceBufferDeviceAddressFeaturesEXT,
+	VkBufferDeviceAddressCreateInfoEXT,
+#endif
+#if defined(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+	VkCalibratedTimestampInfoEXT,
+#endif
+#if defined(VK_EXT_COLOR_WRITE_ENABLE_EXTENSION_NAME)
+	VkPhysicalDeviceColorWriteEnableFeaturesEXT,
+	VkPipelineColorWriteCreateInfoEXT,
+#endif
+#if defined(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME)
+	VkConditionalRenderingBeginInfoEXT,
+	VkCommandBufferInheritanceConditionalRenderingInfoEXT,
+	VkPhysicalDeviceConditionalRenderingFeaturesEXT,
+#endif
+#if defined(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)
+	VkPhysicalDeviceConservativeRasterizationPropertiesEXT,
+	VkPipelineRasterizationConservativeStateCreateInfoEXT,
+#endif
+#if defined(VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME)
+	VkSamplerCustomBorderColorCreateInfoEXT,
+	VkPhysicalDeviceCustomBorderColorPropertiesEXT,
+	VkPhysicalDeviceCustomBorderColorFeaturesEXT,
+#endif
+#if defined(VK_EXT_DEBUG_MARKER_EXTENSION_NAME)
+	VkDebugMarkerObjectNameInfoEXT,
+	VkDebugMarkerObjectTagInfoEXT,
+	VkDebugMarkerMarkerInfoEXT,
+#endif
+#if defined(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+	VkDebugReportCallbackCreateInfoEXT,
+#endif
+#if defined(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+	VkDebugUtilsObjectNameInfoEXT,
+	VkDebugUtilsObjectTagInfoEXT,
+	VkDebugUtilsLabelEXT,
+	VkDebugUtilsMessengerCreateInfoEXT,
+	VkDebugUtilsMessengerCallbackDataEXT,
+#endif
+#if defined(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME)
+	VkPhysicalDeviceDepthClipEnableFeaturesEXT,
+	VkPipelineRasterizationDepthClipStateCreateInfoEXT,
+#endif
+#if defined(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME)
+	VkPhysicalDeviceDeviceMemoryReportFeaturesEXT,
+	VkDeviceDeviceMemoryReportCreateInfoEXT,
+	VkDeviceMemoryReportCallbackDataEXT,
+#endif
+#if defined(VK_EXT_DISCARD_RECTANGLES_EXTENSION_NAME)
+	VkPhysicalDeviceDiscardRectanglePropertiesEXT,
+	VkPipelineDiscardRectangleStateCreateInfoEXT,
+#endif
+#if defined(VK_EXT_DISPLAY_CONTROL_EXTENSION_NAME)
+	VkDisplayPowerInfoEXT,
+	VkDeviceEventInfoEXT,
+	VkDisplayEventInfoEXT,
+	VkSwapchainCounterCreateInfoEXT,
+#endif
+#if defined(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)
+	VkSurfaceCapabilities2EXT,
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)
+	VkPhysicalDeviceExtendedDynamicState2FeaturesEXT,
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+	VkPhysicalDeviceExtendedDynamicStateFeaturesEXT,
+#endif
+#if defined(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)
+	VkImportMemoryHostPointerInfoEXT,
+	VkMemoryHostPointerPropertiesEXT,
+	VkPhysicalDeviceExternalMemoryHostPropertiesEXT,
+#endif
+#if defined(VK_EXT_FILTER_CUBIC_EXTENSION_NAME)
+	VkPhysicalDeviceImageViewImageFormatInfoEXT,
+	VkFilterCubicImageViewImageFormatPropertiesEXT,
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_2_EXTENSION_NAME)
+	VkPhysicalDeviceFragmentDensityMap2FeaturesEXT,
+	VkPhysicalDeviceFragmentDensityMap2PropertiesEXT,
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME)
+	VkPhysicalDeviceFragmentDensityMapFeaturesEXT,
+	VkPhysicalDeviceFragmentDensityMapPropertiesEXT,
+	VkRenderPassFragmentDensityMapCreateInfoEXT,
+#endif
+#if defined(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME)
+	VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT,
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)
+	VkDeviceQueueGlobalPriorityCreateInfoEXT,
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_QUERY_EXTENSION_NAME)
+	VkPhysicalDeviceGlobalPriorityQueryFeaturesEXT,
+	VkQueueFamilyGlobalPriorityPropertiesEXT,
+#endif
+#if defined(VK_EXT_HDR_METADATA_EXTENSION_NAME)
+	VkHdrMetadataEXT,
+#endif
+#if defined(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+	VkHeadlessSurfaceCreateInfoEXT,
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME)
+	VkDrmFormatModifierPropertiesListEXT,
+	VkPhysicalDeviceImageDrmFormatModifierInfoEXT,
+	VkImageDrmFormatModifierListCreateInfoEXT,
+	VkImageDrmFormatModifierExplicitCreateInfoEXT,
+	VkImageDrmFormatModifierPropertiesEXT,
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	VkDrmFormatModifierPropertiesList2EXT,
+#endif
+#if defined(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME)
+	VkPhysicalDeviceImageRobustnessFeaturesEXT,
+#endif
+#if defined(VK_EXT_INDEX_TYPE_UINT8_EXTENSION_NAME)
+	VkPhysicalDeviceIndexTypeUint8FeaturesEXT,
+#endif
+#if defined(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME)
+	VkPhysicalDeviceInlineUniformBlockFeaturesEXT,
+	VkPhysicalDeviceInlineUniformBlockPropertiesEXT,
+	VkWriteDescriptorSetInlineUniformBlockEXT,
+	VkDescriptorPoolInlineUniformBlockCreateInfoEXT,
+#endif
+#if defined(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)
+	VkPhysicalDeviceLineRasterizationFeaturesEXT,
+	VkPhysicalDeviceLineRasterizationPropertiesEXT,
+	VkPipelineRasterizationLineStateCreateInfoEXT,
+#endif
+#if defined(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+	VkPhysicalDeviceMemoryBudgetPropertiesEXT,
+#endif
+#if defined(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)
+	VkPhysicalDeviceMemoryPriorityFeaturesEXT,
+	VkMemoryPriorityAllocateInfoEXT,
+#endif
+#if defined(VK_EXT_MULTI_DRAW_EXTENSION_NAME)
+	VkPhysicalDeviceMultiDrawPropertiesEXT,
+	VkPhysicalDeviceMultiDrawFeaturesEXT,
+#endif
+#if defined(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME)
+	VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT,
+#endif
+#if defined(VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)
+	VkPhysicalDevicePCIBusInfoPropertiesEXT,
+#endif
+#if defined(VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME)
+	VkPhysicalDeviceDrmPropertiesEXT,
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)
+	VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT,
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+	VkPipelineCreationFeedbackCreateInfoEXT,
+#endif
+#if defined(VK_EXT_PRIMITIVE_TOPOLOGY_LIST_RESTART_EXTENSION_NAME)
+	VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT,
+#endif
+#if defined(VK_EXT_PRIVATE_DATA_EXTENSION_NAME)
+	VkDevicePrivateDataCreateInfoEXT,
+	VkPrivateDataSlotCreateInfoEXT,
+	VkPhysicalDevicePrivateDataFeaturesEXT,
+#endif
+#if defined(VK_EXT_PROVOKING_VERTEX_EXTENSION_NAME)
+	VkPhysicalDeviceProvokingVertexFeaturesEXT,
+	VkPhysicalDeviceProvokingVertexPropertiesEXT,
+	VkPipelineRasterizationProvokingVertexStateCreateInfoEXT,
+#endif
+#if defined(VK_EXT_RGBA10X6_FORMATS_EXTENSION_NAME)
+	VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT,
+#endif
+#if defined(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)
+	VkPhysicalDeviceRobustness2FeaturesEXT,
+	VkPhysicalDeviceRobustness2PropertiesEXT,
+#endif
+#if defined(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME)
+	VkSampleLocationsInfoEXT,
+	VkRenderPassSampleLocationsBeginInfoEXT,
+	VkPipelineSampleLocationsStateCreateInfoEXT,
+	VkPhysicalDeviceSampleLocationsPropertiesEXT,
+	VkMultisamplePropertiesEXT,
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME)
+	VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT,
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME)
+	VkPhysicalDeviceShaderAtomicFloatFeaturesEXT,
+#endif
+#if defined(VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME)
+	VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT,
+#endif
+#if defined(VK_EXT_SHADER_IMAGE_ATOMIC_INT64_EXTENSION_NAME)
+	VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT,
+#endif
+#if defined(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)
+	VkPhysicalDeviceSubgroupSizeControlFeaturesEXT,
+	VkPhysicalDeviceSubgroupSizeControlPropertiesEXT,
+	VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT,
+#endif
+#if defined(VK_EXT_TEXEL_BUFFER_ALIGNMENT_EXTENSION_NAME)
+	VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT,
+	VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT,
+#endif
+#if defined(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME)
+	VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT,
+#endif
+#if defined(VK_EXT_TOOLING_INFO_EXTENSION_NAME)
+	VkPhysicalDeviceToolPropertiesEXT,
+#endif
+#if defined(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME)
+	VkPhysicalDeviceTransformFeedbackFeaturesEXT,
+	VkPhysicalDeviceTransformFeedbackPropertiesEXT,
+	VkPipelineRasterizationStateStreamCreateInfoEXT,
+#endif
+#if defined(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)
+	VkValidationCacheCreateInfoEXT,
+	VkShaderModuleValidationCacheCreateInfoEXT,
+#endif
+#if defined(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME)
+	VkValidationFeaturesEXT,
+#endif
+#if defined(VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME)
+	VkValidationFlagsEXT,
+#endif
+#if defined(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME)
+	VkPipelineVertexInputDivisorStateCreateInfoEXT,
+	VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT,
+	VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT,
+#endif
+#if defined(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME)
+	VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT,
+	VkVertexInputBindingDescription2EXT,
+	VkVertexInputAttributeDescription2EXT,
+#endif
+#if defined(VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME)
+	VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT,
+#endif
+#if defined(VK_EXT_YCBCR_IMAGE_ARRAYS_EXTENSION_NAME)
+	VkPhysicalDeviceYcbcrImageArraysFeaturesEXT,
+#endif
+#if defined(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)
+	VkPresentTimesInfoGOOGLE,
+#endif
+#if defined(VK_HUAWEI_INVOCATION_MASK_EXTENSION_NAME)
+	VkPhysicalDeviceInvocationMaskFeaturesHUAWEI,
+#endif
+#if defined(VK_HUAWEI_SUBPASS_SHADING_EXTENSION_NAME)
+	VkSubpassShadingPipelineCreateInfoHUAWEI,
+	VkPhysicalDeviceSubpassShadingPropertiesHUAWEI,
+	VkPhysicalDeviceSubpassShadingFeaturesHUAWEI,
+#endif
+#if defined(VK_INTEL_PERFORMANCE_QUERY_EXTENSION_NAME)
+	VkInitializePerformanceApiInfoINTEL,
+	VkQueryPoolPerformanceQueryCreateInfoINTEL,
+	VkPerformanceMarkerInfoINTEL,
+	VkPerformanceStreamMarkerInfoINTEL,
+	VkPerformanceOverrideInfoINTEL,
+	VkPerformanceConfigurationAcquireInfoINTEL,
+#endif
+#if defined(VK_INTEL_SHADER_INTEGER_FUNCTIONS_2_EXTENSION_NAME)
+	VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL,
+#endif
+#if defined(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)
+	VkWriteDescriptorSetAccelerationStructureKHR,
+	VkPhysicalDeviceAccelerationStructureFeaturesKHR,
+	VkPhysicalDeviceAccelerationStructurePropertiesKHR,
+	VkAccelerationStructureGeometryTrianglesDataKHR,
+	VkAccelerationStructureGeometryAabbsDataKHR,
+	VkAccelerationStructureGeometryInstancesDataKHR,
+	VkAccelerationStructureGeometryKHR,
+	VkAccelerationStructureBuildGeometryInfoKHR,
+	VkAccelerationStructureCreateInfoKHR,
+	VkAccelerationStructureDeviceAddressInfoKHR,
+	VkAccelerationStructureVersionInfoKHR,
+	VkCopyAccelerationStructureInfoKHR,
+	VkCopyAccelerationStructureToMemoryInfoKHR,
+	VkCopyMemoryToAccelerationStructureInfoKHR,
+	VkAccelerationStructureBuildSizesInfoKHR,
+#endif
+#if defined(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME)
+	VkBufferCopy2KHR,
+	VkImageCopy2KHR,
+	VkImageBlit2KHR,
+	VkBufferImageCopy2KHR,
+	VkImageResolve2KHR,
+	VkCopyBufferInfo2KHR,
+	VkCopyImageInfo2KHR,
+	VkBlitImageInfo2KHR,
+	VkCopyBufferToImageInfo2KHR,
+	VkCopyImageToBufferInfo2KHR,
+	VkResolveImageInfo2KHR,
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SURFACE_EXTENSION_NAME)
+	VkDeviceGroupPresentCapabilitiesKHR,
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	VkImageSwapchainCreateInfoKHR,
+	VkBindImageMemorySwapchainInfoKHR,
+	VkAcquireNextImageInfoKHR,
+	VkDeviceGroupPresentInfoKHR,
+	VkDeviceGroupSwapchainCreateInfoKHR,
+#endif
+#if defined(VK_KHR_DISPLAY_EXTENSION_NAME)
+	VkDisplayModeCreateInfoKHR,
+	VkDisplaySurfaceCreateInfoKHR,
+#endif
+#if defined(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME)
+	VkDisplayPresentInfoKHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME)
+	VkImportFenceFdInfoKHR,
+	VkFenceGetFdInfoKHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)
+	VkImportMemoryFdInfoKHR,
+	VkMemoryFdPropertiesKHR,
+	VkMemoryGetFdInfoKHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME)
+	VkImportSemaphoreFdInfoKHR,
+	VkSemaphoreGetFdInfoKHR,
+#endif
+#if defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	VkFormatProperties3KHR,
+#endif
+#if defined(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME)
+	VkFragmentShadingRateAttachmentInfoKHR,
+	VkPipelineFragmentShadingRateStateCreateInfoKHR,
+	VkPhysicalDeviceFragmentShadingRateFeaturesKHR,
+	VkPhysicalDeviceFragmentShadingRatePropertiesKHR,
+	VkPhysicalDeviceFragmentShadingRateKHR,
+#endif
+#if defined(VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME)
+	VkDisplayProperties2KHR,
+	VkDisplayPlaneProperties2KHR,
+	VkDisplayModeProperties2KHR,
+	VkDisplayPlaneInfo2KHR,
+	VkDisplayPlaneCapabilities2KHR,
+#endif
+#if defined(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+	VkPhysicalDeviceSurfaceInfo2KHR,
+	VkSurfaceCapabilities2KHR,
+	VkSurfaceFormat2KHR,
+#endif
+#if defined(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)
+	VkPresentRegionsKHR,
+#endif
+#if defined(VK_KHR_MAINTENANCE_4_EXTENSION_NAME)
+	VkDeviceBufferMemoryRequirementsKHR,
+	VkDeviceImageMemoryRequirementsKHR,
+	VkPhysicalDeviceMaintenance4FeaturesKHR,
+	VkPhysicalDeviceMaintenance4PropertiesKHR,
+#endif
+#if defined(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)
+	VkPhysicalDevicePerformanceQueryFeaturesKHR,
+	VkPhysicalDevicePerformanceQueryPropertiesKHR,
+	VkPerformanceCounterKHR,
+	VkPerformanceCounterDescriptionKHR,
+	VkQueryPoolPerformanceCreateInfoKHR,
+	VkAcquireProfilingLockInfoKHR,
+	VkPerformanceQuerySubmitInfoKHR,
+#endif
+#if defined(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)
+	VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR,
+	VkPipelineInfoKHR,
+	VkPipelineExecutablePropertiesKHR,
+	VkPipelineExecutableInfoKHR,
+	VkPipelineExecutableStatisticKHR,
+	VkPipelineExecutableInternalRepresentationKHR,
+#endif
+#if defined(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+	VkPipelineLibraryCreateInfoKHR,
+#endif
+#if defined(VK_KHR_PRESENT_ID_EXTENSION_NAME)
+	VkPhysicalDevicePresentIdFeaturesKHR,
+	VkPresentIdKHR,
+#endif
+#if defined(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+	VkPhysicalDevicePresentWaitFeaturesKHR,
+#endif
+#if defined(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+	VkPhysicalDevicePushDescriptorPropertiesKHR,
+#endif
+#if defined(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+	VkPhysicalDeviceRayQueryFeaturesKHR,
+#endif
+#if defined(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME)
+	VkRayTracingShaderGroupCreateInfoKHR,
+	VkRayTracingPipelineCreateInfoKHR,
+	VkPhysicalDeviceRayTracingPipelineFeaturesKHR,
+	VkPhysicalDeviceRayTracingPipelinePropertiesKHR,
+	VkRayTracingPipelineInterfaceCreateInfoKHR,
+#endif
+#if defined(VK_KHR_SHADER_CLOCK_EXTENSION_NAME)
+	VkPhysicalDeviceShaderClockFeaturesKHR,
+#endif
+#if defined(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)
+	VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR,
+	VkPhysicalDeviceShaderIntegerDotProductPropertiesKHR,
+#endif
+#if defined(VK_KHR_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_EXTENSION_NAME)
+	VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR,
+#endif
+#if defined(VK_KHR_SHADER_TERMINATE_INVOCATION_EXTENSION_NAME)
+	VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR,
+#endif
+#if defined(VK_KHR_SHARED_PRESENTABLE_IMAGE_EXTENSION_NAME)
+	VkSharedPresentSurfaceCapabilitiesKHR,
+#endif
+#if defined(VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME)
+	VkSurfaceProtectedCapabilitiesKHR,
+#endif
+#if defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	VkSwapchainCreateInfoKHR,
+	VkPresentInfoKHR,
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
+	VkMemoryBarrier2KHR,
+	VkImageMemoryBarrier2KHR,
+	VkBufferMemoryBarrier2KHR,
+	VkDependencyInfoKHR,
+	VkSemaphoreSubmitInfoKHR,
+	VkCommandBufferSubmitInfoKHR,
+	VkSubmitInfo2KHR,
+	VkPhysicalDeviceSynchronization2FeaturesKHR,
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) && defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	VkQueueFamilyCheckpointProperties2NV,
+	VkCheckpointData2NV,
+#endif
+#if defined(VK_KHR_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_EXTENSION_NAME)
+	VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR,
+#endif
+#if defined(VK_KHR_ZERO_INITIALIZE_WORKGROUP_MEMORY_EXTENSION_NAME)
+	VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR,
+#endif
+#if defined(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)
+	VkCuModuleCreateInfoNVX,
+	VkCuFunctionCreateInfoNVX,
+	VkCuLaunchInfoNVX,
+#endif
+#if defined(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)
+	VkImageViewHandleInfoNVX,
+	VkImageViewAddressPropertiesNVX,
+#endif
+#if defined(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)
+	VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX,
+#endif
+#if defined(VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME)
+	VkPipelineViewportWScalingStateCreateInfoNV,
+#endif
+#if defined(VK_NV_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME)
+	VkPhysicalDeviceComputeShaderDerivativesFeaturesNV,
+#endif
+#if defined(VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME)
+	VkPhysicalDeviceCooperativeMatrixFeaturesNV,
+	VkPhysicalDeviceCooperativeMatrixPropertiesNV,
+	VkCooperativeMatrixPropertiesNV,
+#endif
+#if defined(VK_NV_CORNER_SAMPLED_IMAGE_EXTENSION_NAME)
+	VkPhysicalDeviceCornerSampledImageFeaturesNV,
+#endif
+#if defined(VK_NV_COVERAGE_REDUCTION_MODE_EXTENSION_NAME)
+	VkPhysicalDeviceCoverageReductionModeFeaturesNV,
+	VkPipelineCoverageReductionStateCreateInfoNV,
+	VkFramebufferMixedSamplesCombinationNV,
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME)
+	VkDedicatedAllocationImageCreateInfoNV,
+	VkDedicatedAllocationBufferCreateInfoNV,
+	VkDedicatedAllocationMemoryAllocateInfoNV,
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_IMAGE_ALIASING_EXTENSION_NAME)
+	VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV,
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTICS_CONFIG_EXTENSION_NAME)
+	VkPhysicalDeviceDiagnosticsConfigFeaturesNV,
+	VkDeviceDiagnosticsConfigCreateInfoNV,
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	VkQueueFamilyCheckpointPropertiesNV,
+	VkCheckpointDataNV,
+#endif
+#if defined(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME)
+	VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV,
+	VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV,
+	VkGraphicsShaderGroupCreateInfoNV,
+	VkGraphicsPipelineShaderGroupsCreateInfoNV,
+	VkIndirectCommandsLayoutTokenNV,
+	VkIndirectCommandsLayoutCreateInfoNV,
+	VkGeneratedCommandsInfoNV,
+	VkGeneratedCommandsMemoryRequirementsInfoNV,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_EXTENSION_NAME)
+	VkExternalMemoryImageCreateInfoNV,
+	VkExportMemoryAllocateInfoNV,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_RDMA_EXTENSION_NAME)
+	VkPhysicalDeviceExternalMemoryRDMAFeaturesNV,
+	VkMemoryGetRemoteAddressInfoNV,
+#endif
+#if defined(VK_NV_FRAGMENT_COVERAGE_TO_COLOR_EXTENSION_NAME)
+	VkPipelineCoverageToColorStateCreateInfoNV,
+#endif
+#if defined(VK_NV_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME)
+	VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV,
+#endif
+#if defined(VK_NV_FRAGMENT_SHADING_RATE_ENUMS_EXTENSION_NAME)
+	VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV,
+	VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV,
+	VkPipelineFragmentShadingRateEnumStateCreateInfoNV,
+#endif
+#if defined(VK_NV_FRAMEBUFFER_MIXED_SAMPLES_EXTENSION_NAME)
+	VkPipelineCoverageModulationStateCreateInfoNV,
+#endif
+#if defined(VK_NV_INHERITED_VIEWPORT_SCISSOR_EXTENSION_NAME)
+	VkPhysicalDeviceInheritedViewportScissorFeaturesNV,
+	VkCommandBufferInheritanceViewportScissorInfoNV,
+#endif
+#if defined(VK_NV_MESH_SHADER_EXTENSION_NAME)
+	VkPhysicalDeviceMeshShaderFeaturesNV,
+	VkPhysicalDeviceMeshShaderPropertiesNV,
+#endif
+#if defined(VK_NV_RAY_TRACING_EXTENSION_NAME)
+	VkRayTracingShaderGroupCreateInfoNV,
+	VkRayTracingPipelineCreateInfoNV,
+	VkGeometryTrianglesNV,
+	VkGeometryAABBNV,
+	VkGeometryNV,
+	VkAccelerationStructureInfoNV,
+	VkAccelerationStructureCreateInfoNV,
+	VkBindAccelerationStructureMemoryInfoNV,
+	VkWriteDescriptorSetAccelerationStructureNV,
+	VkAccelerationStructureMemoryRequirementsInfoNV,
+	VkPhysicalDeviceRayTracingPropertiesNV,
+#endif
+#if defined(VK_NV_RAY_TRACING_MOTION_BLUR_EXTENSION_NAME)
+	VkPhysicalDeviceRayTracingMotionBlurFeaturesNV,
+	VkAccelerationStructureGeometryMotionTrianglesDataNV,
+	VkAccelerationStructureMotionInfoNV,
+#endif
+#if defined(VK_NV_REPRESENTATIVE_FRAGMENT_TEST_EXTENSION_NAME)
+	VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV,
+	VkPipelineRepresentativeFragmentTestStateCreateInfoNV,
+#endif
+#if defined(VK_NV_SCISSOR_EXCLUSIVE_EXTENSION_NAME)
+	VkPhysicalDeviceExclusiveScissorFeaturesNV,
+	VkPipelineViewportExclusiveScissorStateCreateInfoNV,
+#endif
+#if defined(VK_NV_SHADER_IMAGE_FOOTPRINT_EXTENSION_NAME)
+	VkPhysicalDeviceShaderImageFootprintFeaturesNV,
+#endif
+#if defined(VK_NV_SHADER_SM_BUILTINS_EXTENSION_NAME)
+	VkPhysicalDeviceShaderSMBuiltinsPropertiesNV,
+	VkPhysicalDeviceShaderSMBuiltinsFeaturesNV,
+#endif
+#if defined(VK_NV_SHADING_RATE_IMAGE_EXTENSION_NAME)
+	VkPipelineViewportShadingRateImageStateCreateInfoNV,
+	VkPhysicalDeviceShadingRateImageFeaturesNV,
+	VkPhysicalDeviceShadingRateImagePropertiesNV,
+	VkPipelineViewportCoarseSampleOrderStateCreateInfoNV,
+#endif
+#if defined(VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME)
+	VkPipelineViewportSwizzleStateCreateInfoNV,
+#endif
+#if defined(VK_QCOM_RENDER_PASS_TRANSFORM_EXTENSION_NAME)
+	VkRenderPassTransformBeginInfoQCOM,
+	VkCommandBufferInheritanceRenderPassTransformInfoQCOM,
+#endif
+#if defined(VK_QCOM_ROTATED_COPY_COMMANDS_EXTENSION_NAME)
+	VkCopyCommandTransformInfoQCOM,
+#endif
+#if defined(VK_VALVE_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)
+	VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE,
+	VkMutableDescriptorTypeCreateInfoVALVE,
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkVideoDecodeH264ProfileEXT,
+	VkVideoDecodeH264CapabilitiesEXT,
+	VkVideoDecodeH264SessionCreateInfoEXT,
+	VkVideoDecodeH264SessionParametersAddInfoEXT,
+	VkVideoDecodeH264SessionParametersCreateInfoEXT,
+	VkVideoDecodeH264PictureInfoEXT,
+	VkVideoDecodeH264DpbSlotInfoEXT,
+	VkVideoDecodeH264MvcEXT,
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkVideoDecodeH265ProfileEXT,
+	VkVideoDecodeH265CapabilitiesEXT,
+	VkVideoDecodeH265SessionCreateInfoEXT,
+	VkVideoDecodeH265SessionParametersAddInfoEXT,
+	VkVideoDecodeH265SessionParametersCreateInfoEXT,
+	VkVideoDecodeH265PictureInfoEXT,
+	VkVideoDecodeH265DpbSlotInfoEXT,
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkVideoEncodeH264CapabilitiesEXT,
+	VkVideoEncodeH264SessionCreateInfoEXT,
+	VkVideoEncodeH264SessionParametersAddInfoEXT,
+	VkVideoEncodeH264SessionParametersCreateInfoEXT,
+	VkVideoEncodeH264DpbSlotInfoEXT,
+	VkVideoEncodeH264VclFrameInfoEXT,
+	VkVideoEncodeH264EmitPictureParametersEXT,
+	VkVideoEncodeH264ProfileEXT,
+	VkVideoEncodeH264NaluSliceEXT,
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkVideoEncodeH265CapabilitiesEXT,
+	VkVideoEncodeH265SessionCreateInfoEXT,
+	VkVideoEncodeH265SessionParametersAddInfoEXT,
+	VkVideoEncodeH265SessionParametersCreateInfoEXT,
+	VkVideoEncodeH265VclFrameInfoEXT,
+	VkVideoEncodeH265EmitPictureParametersEXT,
+	VkVideoEncodeH265NaluSliceEXT,
+	VkVideoEncodeH265ProfileEXT,
+	VkVideoEncodeH265DpbSlotInfoEXT,
+	VkVideoEncodeH265ReferenceListsEXT,
+#endif
+#if defined(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkPhysicalDevicePortabilitySubsetFeaturesKHR,
+	VkPhysicalDevicePortabilitySubsetPropertiesKHR,
+#endif
+#if defined(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkVideoDecodeInfoKHR,
+#endif
+#if defined(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkVideoEncodeInfoKHR,
+	VkVideoEncodeRateControlInfoKHR,
+#endif
+#if defined(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VkVideoQueueFamilyProperties2KHR,
+	VkVideoProfilesKHR,
+	VkPhysicalDeviceVideoFormatInfoKHR,
+	VkVideoFormatPropertiesKHR,
+	VkVideoProfileKHR,
+	VkVideoCapabilitiesKHR,
+	VkVideoGetMemoryPropertiesKHR,
+	VkVideoBindMemoryKHR,
+	VkVideoPictureResourceKHR,
+	VkVideoReferenceSlotKHR,
+	VkVideoSessionCreateInfoKHR,
+	VkVideoSessionParametersCreateInfoKHR,
+	VkVideoSessionParametersUpdateInfoKHR,
+	VkVideoBeginCodingInfoKHR,
+	VkVideoEndCodingInfoKHR,
+	VkVideoCodingControlInfoKHR,
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VkImportAndroidHardwareBufferInfoANDROID,
+	VkAndroidHardwareBufferUsageANDROID,
+	VkAndroidHardwareBufferPropertiesANDROID,
+	VkMemoryGetAndroidHardwareBufferInfoANDROID,
+	VkAndroidHardwareBufferFormatPropertiesANDROID,
+	VkExternalFormatANDROID,
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VkAndroidHardwareBufferFormatProperties2ANDROID,
+#endif
+#if defined(VK_ANDROID_NATIVE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VkNativeBufferANDROID,
+	VkSwapchainImageCreateInfoANDROID,
+	VkPhysicalDevicePresentationPropertiesANDROID,
+#endif
+#if defined(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VkAndroidSurfaceCreateInfoKHR,
+#endif
+#if defined(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+	VkDirectFBSurfaceCreateInfoEXT,
+#endif
+#if defined(VK_FUCHSIA_BUFFER_COLLECTION_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VkImportMemoryBufferCollectionFUCHSIA,
+	VkBufferCollectionImageCreateInfoFUCHSIA,
+	VkBufferCollectionBufferCreateInfoFUCHSIA,
+	VkBufferCollectionCreateInfoFUCHSIA,
+	VkBufferCollectionPropertiesFUCHSIA,
+	VkBufferConstraintsInfoFUCHSIA,
+	VkSysmemColorSpaceFUCHSIA,
+	VkImageFormatConstraintsInfoFUCHSIA,
+	VkImageConstraintsInfoFUCHSIA,
+	VkBufferCollectionConstraintsInfoFUCHSIA,
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_MEMORY_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VkImportMemoryZirconHandleInfoFUCHSIA,
+	VkMemoryZirconHandlePropertiesFUCHSIA,
+	VkMemoryGetZirconHandleInfoFUCHSIA,
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_SEMAPHORE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VkImportSemaphoreZirconHandleInfoFUCHSIA,
+	VkSemaphoreGetZirconHandleInfoFUCHSIA,
+#endif
+#if defined(VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VkImagePipeSurfaceCreateInfoFUCHSIA,
+#endif
+#if defined(VK_GGP_FRAME_TOKEN_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	VkPresentFrameTokenGGP,
+#endif
+#if defined(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	VkStreamDescriptorSurfaceCreateInfoGGP,
+#endif
+#if defined(VK_MVK_IOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_IOS_MVK)
+	VkIOSSurfaceCreateInfoMVK,
+#endif
+#if defined(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_MACOS_MVK)
+	VkMacOSSurfaceCreateInfoMVK,
+#endif
+#if defined(VK_EXT_METAL_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_METAL_EXT)
+	VkMetalSurfaceCreateInfoEXT,
+#endif
+#if defined(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_SCREEN_QNX)
+	VkScreenSurfaceCreateInfoQNX,
+#endif
+#if defined(VK_NN_VI_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_VI_NN)
+	VkViSurfaceCreateInfoNN,
+#endif
+#if defined(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WAYLAND_KHR)
+	VkWaylandSurfaceCreateInfoKHR,
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkSurfaceFullScreenExclusiveInfoEXT,
+	VkSurfaceCapabilitiesFullScreenExclusiveEXT,
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkSurfaceFullScreenExclusiveWin32InfoEXT,
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkImportFenceWin32HandleInfoKHR,
+	VkExportFenceWin32HandleInfoKHR,
+	VkFenceGetWin32HandleInfoKHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkImportMemoryWin32HandleInfoKHR,
+	VkExportMemoryWin32HandleInfoKHR,
+	VkMemoryWin32HandlePropertiesKHR,
+	VkMemoryGetWin32HandleInfoKHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkImportSemaphoreWin32HandleInfoKHR,
+	VkExportSemaphoreWin32HandleInfoKHR,
+	VkD3D12FenceSubmitInfoKHR,
+	VkSemaphoreGetWin32HandleInfoKHR,
+#endif
+#if defined(VK_KHR_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkWin32KeyedMutexAcquireReleaseInfoKHR,
+#endif
+#if defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkWin32SurfaceCreateInfoKHR,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkImportMemoryWin32HandleInfoNV,
+	VkExportMemoryWin32HandleInfoNV,
+#endif
+#if defined(VK_NV_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VkWin32KeyedMutexAcquireReleaseInfoNV,
+#endif
+#if defined(VK_KHR_XCB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XCB_KHR)
+	VkXcbSurfaceCreateInfoKHR,
+#endif
+#if defined(VK_KHR_XLIB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XLIB_KHR)
+	VkXlibSurfaceCreateInfoKHR,
+#endif
+	Count
+};
+
+constexpr uint32_t StructureOrdinalCount = (uint32_t)StructureOrdinal::Count;
+constexpr uint32_t NoStructureOrdinal	= 0xffffffff;
+
+//Open addressing table from sType to StructureOrdinal, with at least twice as many slots as there are structures
+constexpr uint32_t GetSTypeOrdinalSlotBits()
+{
+	uint32_t slotBits = 1;
+	while((1u << slotBits) < 2 * StructureOrdinalCount)
+	{
+		slotBits++;
+	}
+
+	return slotBits;
+}
+
+constexpr uint32_t STypeOrdinalSlotBits  = GetSTypeOrdinalSlotBits();
+constexpr uint32_t STypeOrdinalSlotCount = 1u << STypeOrdinalSlotBits;
+
+struct STypeOrdinalHashTable
+{
+	uint32_t SlotSTypes[STypeOrdinalSlotCount];
+	uint32_t SlotOrdinals[STypeOrdinalSlotCount]; //NoStructureOrdinal for an empty slot
+};
+
+//Fibonacci hashing, sType values are either small or 1000000000 + 1000 * extension number + offset
+constexpr uint32_t GetSTypeOrdinalSlot(uint32_t sTypeValue)
+{
+	return (uint32_t)(((uint64_t)sTypeValue * 0x9e3779b97f4a7c15ull) >> (64 - STypeOrdinalSlotBits));
+}
+
+template<typename VkStruct, typename Visitor>
+inline void VisitStructureAs(void* structure, Visitor& visitor)
+{
+	visitor(*reinterpret_cast<VkStruct*>(structure));
+}
+
+template<typename Visitor>
+using StructureVisitFunction = void(*)(void*, Visitor&);
+
+inline constexpr VulkanStructureType StructureOrdinalSTypes[] =
+{
+	VK_STRUCTURE_TYPE_APPLICATION_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+	VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+	VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+	VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET,
+	VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+	VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO,
+	VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+	VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+	VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+	VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+	VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+	VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+	VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+	VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+	VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+	VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+	VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+	VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+	VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+	VK_STRUCTURE_TYPE_EVENT_CREATE_INFO,
+	VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+	VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+	VK_STRUCTURE_TYPE_SUBMIT_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+	VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2,
+	VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2,
+	VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2,
+	VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO,
+	VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO,
+	VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES,
+	VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO,
+	VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO,
+	VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES,
+	VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO,
+	VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES,
+	VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES,
+	VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES,
+	VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
+	VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO,
+	VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO,
+	VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO,
+	VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES,
+	VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2,
+	VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2,
+	VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2,
+	VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+	VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES,
+	VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS,
+	VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+	VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO,
+	VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO,
+	VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO,
+	VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES,
+	VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES,
+	VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES,
+	VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES,
+	VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT,
+	VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2,
+	VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2,
+	VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2,
+	VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2,
+	VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2,
+	VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO,
+	VK_STRUCTURE_TYPE_SUBPASS_END_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES,
+	VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+	VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+	VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES,
+	VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE,
+	VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES,
+	VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+	VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES,
+	VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO,
+	VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO,
+	VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES,
+	VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT,
+	VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT,
+	VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO,
+	VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES,
+#if defined(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD,
+#endif
+#if defined(VK_AMD_DISPLAY_NATIVE_HDR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD,
+	VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD,
+#endif
+#if defined(VK_AMD_MEMORY_OVERALLOCATION_BEHAVIOR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD,
+#endif
+#if defined(VK_AMD_PIPELINE_COMPILER_CONTROL_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD,
+#endif
+#if defined(VK_AMD_RASTERIZATION_ORDER_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD,
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD,
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD,
+#endif
+#if defined(VK_AMD_TEXTURE_GATHER_BIAS_LOD_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD,
+#endif
+#if defined(VK_EXT_4444_FORMATS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_BLEND_OPERATION_ADVANCED_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_BORDER_COLOR_SWIZZLE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT,
+#endif
+#if defined(VK_EXT_COLOR_WRITE_ENABLE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT,
+	VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_DEBUG_MARKER_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT,
+	VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT,
+	VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT,
+#endif
+#if defined(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
+	VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT,
+	VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT,
+	VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT,
+#endif
+#if defined(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT,
+#endif
+#if defined(VK_EXT_DISCARD_RECTANGLES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_DISPLAY_CONTROL_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT,
+	VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT,
+	VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT,
+	VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT,
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT,
+	VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_FILTER_CUBIC_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT,
+	VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_QUERY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_HDR_METADATA_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_HDR_METADATA_EXT,
+#endif
+#if defined(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT,
+	VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT,
+#endif
+#if defined(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_INDEX_TYPE_UINT8_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT,
+	VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_MULTI_DRAW_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_PRIMITIVE_TOPOLOGY_LIST_RESTART_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_PRIVATE_DATA_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_PROVOKING_VERTEX_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_RGBA10X6_FORMATS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT,
+	VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_SHADER_IMAGE_ATOMIC_INT64_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_TEXEL_BUFFER_ALIGNMENT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_TOOLING_INFO_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT,
+#endif
+#if defined(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT,
+#endif
+#if defined(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT,
+	VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT,
+	VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT,
+#endif
+#if defined(VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT,
+#endif
+#if defined(VK_EXT_YCBCR_IMAGE_ARRAYS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT,
+#endif
+#if defined(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE,
+#endif
+#if defined(VK_HUAWEI_INVOCATION_MASK_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI,
+#endif
+#if defined(VK_HUAWEI_SUBPASS_SHADING_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI,
+#endif
+#if defined(VK_INTEL_PERFORMANCE_QUERY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL,
+	VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL,
+	VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL,
+	VK_STRUCTURE_TYPE_PERFORMANCE_STREAM_MARKER_INFO_INTEL,
+	VK_STRUCTURE_TYPE_PERFORMANCE_OVERRIDE_INFO_INTEL,
+	VK_STRUCTURE_TYPE_PERFORMANCE_CONFIGURATION_ACQUIRE_INFO_INTEL,
+#endif
+#if defined(VK_INTEL_SHADER_INTEGER_FUNCTIONS_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL,
+#endif
+#if defined(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR,
+	VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR,
+	VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR,
+	VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR,
+#endif
+#if defined(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR,
+	VK_STRUCTURE_TYPE_IMAGE_COPY_2_KHR,
+	VK_STRUCTURE_TYPE_IMAGE_BLIT_2_KHR,
+	VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2_KHR,
+	VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2_KHR,
+	VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2_KHR,
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SURFACE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR,
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR,
+	VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR,
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR,
+	VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR,
+#endif
+#if defined(VK_KHR_DISPLAY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR,
+#endif
+#if defined(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR,
+	VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR,
+	VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR,
+	VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR,
+#endif
+#if defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR,
+#endif
+#if defined(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR,
+	VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR,
+#endif
+#if defined(VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR,
+	VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR,
+	VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR,
+	VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR,
+#endif
+#if defined(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR,
+	VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR,
+#endif
+#if defined(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR,
+#endif
+#if defined(VK_KHR_MAINTENANCE_4_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS_KHR,
+	VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES_KHR,
+#endif
+#if defined(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR,
+	VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR,
+	VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR,
+	VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR,
+#endif
+#if defined(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR,
+	VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR,
+	VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR,
+	VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR,
+#endif
+#if defined(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+#endif
+#if defined(VK_KHR_PRESENT_ID_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+#endif
+#if defined(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+#endif
+#if defined(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR,
+#endif
+#if defined(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR,
+#endif
+#if defined(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR,
+#endif
+#if defined(VK_KHR_SHADER_CLOCK_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR,
+#endif
+#if defined(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES_KHR,
+#endif
+#if defined(VK_KHR_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR,
+#endif
+#if defined(VK_KHR_SHADER_TERMINATE_INVOCATION_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES_KHR,
+#endif
+#if defined(VK_KHR_SHARED_PRESENTABLE_IMAGE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR,
+#endif
+#if defined(VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR,
+#endif
+#if defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR,
+	VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR,
+	VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR,
+	VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR,
+	VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR,
+	VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR,
+	VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR,
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) && defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV,
+	VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV,
+#endif
+#if defined(VK_KHR_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR,
+#endif
+#if defined(VK_KHR_ZERO_INITIALIZE_WORKGROUP_MEMORY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES_KHR,
+#endif
+#if defined(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_CU_MODULE_CREATE_INFO_NVX,
+	VK_STRUCTURE_TYPE_CU_FUNCTION_CREATE_INFO_NVX,
+	VK_STRUCTURE_TYPE_CU_LAUNCH_INFO_NVX,
+#endif
+#if defined(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_IMAGE_VIEW_HANDLE_INFO_NVX,
+	VK_STRUCTURE_TYPE_IMAGE_VIEW_ADDRESS_PROPERTIES_NVX,
+#endif
+#if defined(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX,
+#endif
+#if defined(VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV,
+#endif
+#if defined(VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV,
+	VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV,
+#endif
+#if defined(VK_NV_CORNER_SAMPLED_IMAGE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV,
+#endif
+#if defined(VK_NV_COVERAGE_REDUCTION_MODE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV,
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV,
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_IMAGE_ALIASING_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV,
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTICS_CONFIG_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV,
+	VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV,
+	VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV,
+#endif
+#if defined(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV,
+	VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV,
+	VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV,
+	VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_RDMA_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV,
+	VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV,
+#endif
+#if defined(VK_NV_FRAGMENT_COVERAGE_TO_COLOR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV,
+#endif
+#if defined(VK_NV_FRAGMENT_SHADING_RATE_ENUMS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV,
+	VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_FRAMEBUFFER_MIXED_SAMPLES_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_INHERITED_VIEWPORT_SCISSOR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV,
+	VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV,
+#endif
+#if defined(VK_NV_MESH_SHADER_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV,
+#endif
+#if defined(VK_NV_RAY_TRACING_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_GEOMETRY_TRIANGLES_NV,
+	VK_STRUCTURE_TYPE_GEOMETRY_AABB_NV,
+	VK_STRUCTURE_TYPE_GEOMETRY_NV,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_INFO_NV,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_BIND_ACCELERATION_STRUCTURE_MEMORY_INFO_NV,
+	VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV,
+#endif
+#if defined(VK_NV_RAY_TRACING_MOTION_BLUR_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV,
+	VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV,
+#endif
+#if defined(VK_NV_REPRESENTATIVE_FRAGMENT_TEST_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_SCISSOR_EXCLUSIVE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_SHADER_IMAGE_FOOTPRINT_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV,
+#endif
+#if defined(VK_NV_SHADER_SM_BUILTINS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV,
+#endif
+#if defined(VK_NV_SHADING_RATE_IMAGE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV,
+	VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV,
+#endif
+#if defined(VK_QCOM_RENDER_PASS_TRANSFORM_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM,
+	VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM,
+#endif
+#if defined(VK_QCOM_ROTATED_COPY_COMMANDS_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM,
+#endif
+#if defined(VK_VALVE_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_VALVE,
+	VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE,
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_MVC_EXT,
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_EXT,
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_VCL_FRAME_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_EMIT_PICTURE_PARAMETERS_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_NALU_SLICE_EXT,
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_VCL_FRAME_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_EMIT_PICTURE_PARAMETERS_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_NALU_SLICE_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_EXT,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_REFERENCE_LISTS_EXT,
+#endif
+#if defined(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR,
+#endif
+#if defined(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR,
+#endif
+#if defined(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR,
+#endif
+#if defined(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	VK_STRUCTURE_TYPE_VIDEO_QUEUE_FAMILY_PROPERTIES_2_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_PROFILES_KHR,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_FORMAT_INFO_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_PROFILE_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_GET_MEMORY_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_BIND_MEMORY_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_PICTURE_RESOURCE_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_REFERENCE_SLOT_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_SESSION_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_CREATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_UPDATE_INFO_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_BEGIN_CODING_INFO_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_END_CODING_INFO_KHR,
+	VK_STRUCTURE_TYPE_VIDEO_CODING_CONTROL_INFO_KHR,
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID,
+	VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID,
+	VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID,
+	VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID,
+	VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID,
+	VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID,
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID,
+#endif
+#if defined(VK_ANDROID_NATIVE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VK_STRUCTURE_TYPE_NATIVE_BUFFER_ANDROID,
+	VK_STRUCTURE_TYPE_SWAPCHAIN_IMAGE_CREATE_INFO_ANDROID,
+	VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENTATION_PROPERTIES_ANDROID,
+#endif
+#if defined(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR,
+#endif
+#if defined(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+	VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_FUCHSIA_BUFFER_COLLECTION_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA,
+	VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CREATE_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_BUFFER_COLLECTION_PROPERTIES_FUCHSIA,
+	VK_STRUCTURE_TYPE_BUFFER_CONSTRAINTS_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA,
+	VK_STRUCTURE_TYPE_IMAGE_FORMAT_CONSTRAINTS_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_IMAGE_CONSTRAINTS_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA,
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_MEMORY_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA,
+	VK_STRUCTURE_TYPE_MEMORY_GET_ZIRCON_HANDLE_INFO_FUCHSIA,
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_SEMAPHORE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_ZIRCON_HANDLE_INFO_FUCHSIA,
+	VK_STRUCTURE_TYPE_SEMAPHORE_GET_ZIRCON_HANDLE_INFO_FUCHSIA,
+#endif
+#if defined(VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA,
+#endif
+#if defined(VK_GGP_FRAME_TOKEN_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP,
+#endif
+#if defined(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP,
+#endif
+#if defined(VK_MVK_IOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_IOS_MVK)
+	VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK,
+#endif
+#if defined(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_MACOS_MVK)
+	VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK,
+#endif
+#if defined(VK_EXT_METAL_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_METAL_EXT)
+	VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT,
+#endif
+#if defined(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_SCREEN_QNX)
+	VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX,
+#endif
+#if defined(VK_NN_VI_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_VI_NN)
+	VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN,
+#endif
+#if defined(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WAYLAND_KHR)
+	VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR,
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT,
+	VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT,
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT,
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR,
+	VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR,
+	VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR,
+	VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR,
+	VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR,
+	VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR,
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR,
+	VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR,
+	VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR,
+	VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR,
+#endif
+#if defined(VK_KHR_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR,
+#endif
+#if defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV,
+	VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV,
+#endif
+#if defined(VK_NV_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV,
+#endif
+#if defined(VK_KHR_XCB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XCB_KHR)
+	VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR,
+#endif
+#if defined(VK_KHR_XLIB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XLIB_KHR)
+	VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR,
+#endif
+};
+
+constexpr STypeOrdinalHashTable MakeSTypeOrdinalHashTable()
+{
+	STypeOrdinalHashTable hashTable = {};
+	for(uint32_t slot = 0; slot < STypeOrdinalSlotCount; slot++)
+	{
+		hashTable.SlotOrdinals[slot] = NoStructureOrdinal;
+	}
+
+	for(uint32_t ordinal = 0; ordinal < StructureOrdinalCount; ordinal++)
+	{
+		uint32_t sTypeValue = (uint32_t)StructureOrdinalSTypes[ordinal];
+
+		uint32_t slot = GetSTypeOrdinalSlot(sTypeValue);
+		while(hashTable.SlotOrdinals[slot] != NoStructureOrdinal)
+		{
+			slot = (slot + 1) & (STypeOrdinalSlotCount - 1);
+		}
+
+		hashTable.SlotSTypes[slot]   = sTypeValue;
+		hashTable.SlotOrdinals[slot] = ordinal;
+	}
+
+	return hashTable;
+}
+
+inline constexpr STypeOrdinalHashTable STypeOrdinals = MakeSTypeOrdinalHashTable();
+
+//Returns the dense ordinal of the structure with the given sType, or NoStructureOrdinal if the sType is unknown
+constexpr uint32_t GetStructureOrdinal(VulkanStructureType sType)
+{
+	uint32_t sTypeValue = (uint32_t)sType;
+
+	uint32_t slot = GetSTypeOrdinalSlot(sTypeValue);
+	while(STypeOrdinals.SlotOrdinals[slot] != NoStructureOrdinal)
+	{
+		if(STypeOrdinals.SlotSTypes[slot] == sTypeValue)
+		{
+			return STypeOrdinals.SlotOrdinals[slot];
+		}
+
+		slot = (slot + 1) & (STypeOrdinalSlotCount - 1);
+	}
+
+	return NoStructureOrdinal;
+}
+
+//Reverse of ValidStructureType: StructureTypeToType<sType>::Type is the structure type
+template<VulkanStructureType SType>
+struct StructureTypeToType
+{
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_APPLICATION_INFO>
+{
+	using Type = VkApplicationInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkApplicationInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO>
+{
+	using Type = VkDeviceQueueCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceQueueCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO>
+{
+	using Type = VkDeviceCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO>
+{
+	using Type = VkInstanceCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkInstanceCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO>
+{
+	using Type = VkMemoryAllocateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryAllocateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE>
+{
+	using Type = VkMappedMemoryRange;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMappedMemoryRange;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET>
+{
+	using Type = VkWriteDescriptorSet;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWriteDescriptorSet;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET>
+{
+	using Type = VkCopyDescriptorSet;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyDescriptorSet;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO>
+{
+	using Type = VkBufferCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO>
+{
+	using Type = VkBufferViewCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferViewCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_BARRIER>
+{
+	using Type = VkMemoryBarrier;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryBarrier;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER>
+{
+	using Type = VkBufferMemoryBarrier;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferMemoryBarrier;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER>
+{
+	using Type = VkImageMemoryBarrier;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageMemoryBarrier;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO>
+{
+	using Type = VkImageCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO>
+{
+	using Type = VkImageViewCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageViewCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_SPARSE_INFO>
+{
+	using Type = VkBindSparseInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindSparseInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO>
+{
+	using Type = VkShaderModuleCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkShaderModuleCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO>
+{
+	using Type = VkDescriptorSetLayoutCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorSetLayoutCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO>
+{
+	using Type = VkDescriptorPoolCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorPoolCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO>
+{
+	using Type = VkDescriptorSetAllocateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorSetAllocateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO>
+{
+	using Type = VkPipelineShaderStageCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineShaderStageCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO>
+{
+	using Type = VkComputePipelineCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkComputePipelineCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineVertexInputStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineVertexInputStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineInputAssemblyStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineInputAssemblyStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineTessellationStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineTessellationStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineViewportStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineViewportStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineRasterizationStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRasterizationStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineMultisampleStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineMultisampleStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineColorBlendStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineColorBlendStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineDynamicStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineDynamicStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineDepthStencilStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineDepthStencilStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO>
+{
+	using Type = VkGraphicsPipelineCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGraphicsPipelineCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO>
+{
+	using Type = VkPipelineCacheCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineCacheCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO>
+{
+	using Type = VkPipelineLayoutCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineLayoutCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO>
+{
+	using Type = VkSamplerCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSamplerCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO>
+{
+	using Type = VkCommandPoolCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandPoolCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO>
+{
+	using Type = VkCommandBufferAllocateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandBufferAllocateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO>
+{
+	using Type = VkCommandBufferInheritanceInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandBufferInheritanceInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO>
+{
+	using Type = VkCommandBufferBeginInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandBufferBeginInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO>
+{
+	using Type = VkRenderPassBeginInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassBeginInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO>
+{
+	using Type = VkRenderPassCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EVENT_CREATE_INFO>
+{
+	using Type = VkEventCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkEventCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FENCE_CREATE_INFO>
+{
+	using Type = VkFenceCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFenceCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO>
+{
+	using Type = VkSemaphoreCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO>
+{
+	using Type = VkQueryPoolCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkQueryPoolCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO>
+{
+	using Type = VkFramebufferCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFramebufferCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBMIT_INFO>
+{
+	using Type = VkSubmitInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubmitInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2>
+{
+	using Type = VkPhysicalDeviceFeatures2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFeatures2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2>
+{
+	using Type = VkPhysicalDeviceProperties2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceProperties2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2>
+{
+	using Type = VkFormatProperties2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFormatProperties2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2>
+{
+	using Type = VkImageFormatProperties2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageFormatProperties2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2>
+{
+	using Type = VkPhysicalDeviceImageFormatInfo2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceImageFormatInfo2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2>
+{
+	using Type = VkQueueFamilyProperties2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkQueueFamilyProperties2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2>
+{
+	using Type = VkPhysicalDeviceMemoryProperties2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMemoryProperties2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2>
+{
+	using Type = VkSparseImageFormatProperties2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSparseImageFormatProperties2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2>
+{
+	using Type = VkPhysicalDeviceSparseImageFormatInfo2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSparseImageFormatInfo2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceDriverProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDriverProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES>
+{
+	using Type = VkPhysicalDeviceVariablePointersFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVariablePointersFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO>
+{
+	using Type = VkPhysicalDeviceExternalImageFormatInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExternalImageFormatInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES>
+{
+	using Type = VkExternalImageFormatProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalImageFormatProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO>
+{
+	using Type = VkPhysicalDeviceExternalBufferInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExternalBufferInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES>
+{
+	using Type = VkExternalBufferProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalBufferProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceIDProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceIDProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO>
+{
+	using Type = VkExternalMemoryImageCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalMemoryImageCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO>
+{
+	using Type = VkExternalMemoryBufferCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalMemoryBufferCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO>
+{
+	using Type = VkExportMemoryAllocateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportMemoryAllocateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO>
+{
+	using Type = VkPhysicalDeviceExternalSemaphoreInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExternalSemaphoreInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES>
+{
+	using Type = VkExternalSemaphoreProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalSemaphoreProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO>
+{
+	using Type = VkExportSemaphoreCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportSemaphoreCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO>
+{
+	using Type = VkPhysicalDeviceExternalFenceInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExternalFenceInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES>
+{
+	using Type = VkExternalFenceProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalFenceProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO>
+{
+	using Type = VkExportFenceCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportFenceCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES>
+{
+	using Type = VkPhysicalDeviceMultiviewFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMultiviewFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceMultiviewProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMultiviewProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO>
+{
+	using Type = VkRenderPassMultiviewCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassMultiviewCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceGroupProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceGroupProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO>
+{
+	using Type = VkMemoryAllocateFlagsInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryAllocateFlagsInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO>
+{
+	using Type = VkBindBufferMemoryInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindBufferMemoryInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO>
+{
+	using Type = VkBindBufferMemoryDeviceGroupInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindBufferMemoryDeviceGroupInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO>
+{
+	using Type = VkBindImageMemoryInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindImageMemoryInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO>
+{
+	using Type = VkBindImageMemoryDeviceGroupInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindImageMemoryDeviceGroupInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO>
+{
+	using Type = VkDeviceGroupRenderPassBeginInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupRenderPassBeginInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO>
+{
+	using Type = VkDeviceGroupCommandBufferBeginInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupCommandBufferBeginInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO>
+{
+	using Type = VkDeviceGroupSubmitInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupSubmitInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO>
+{
+	using Type = VkDeviceGroupBindSparseInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupBindSparseInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO>
+{
+	using Type = VkDeviceGroupDeviceCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupDeviceCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO>
+{
+	using Type = VkDescriptorUpdateTemplateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorUpdateTemplateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO>
+{
+	using Type = VkRenderPassInputAttachmentAspectCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassInputAttachmentAspectCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES>
+{
+	using Type = VkPhysicalDevice16BitStorageFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevice16BitStorageFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceSubgroupProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSubgroupProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES>
+{
+	using Type = VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2>
+{
+	using Type = VkBufferMemoryRequirementsInfo2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferMemoryRequirementsInfo2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2>
+{
+	using Type = VkImageMemoryRequirementsInfo2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageMemoryRequirementsInfo2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2>
+{
+	using Type = VkImageSparseMemoryRequirementsInfo2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageSparseMemoryRequirementsInfo2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2>
+{
+	using Type = VkMemoryRequirements2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryRequirements2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2>
+{
+	using Type = VkSparseImageMemoryRequirements2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSparseImageMemoryRequirements2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES>
+{
+	using Type = VkPhysicalDevicePointClippingProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePointClippingProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS>
+{
+	using Type = VkMemoryDedicatedRequirements;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryDedicatedRequirements;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO>
+{
+	using Type = VkMemoryDedicatedAllocateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryDedicatedAllocateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO>
+{
+	using Type = VkImageViewUsageCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageViewUsageCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO>
+{
+	using Type = VkPipelineTessellationDomainOriginStateCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineTessellationDomainOriginStateCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO>
+{
+	using Type = VkSamplerYcbcrConversionInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSamplerYcbcrConversionInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO>
+{
+	using Type = VkSamplerYcbcrConversionCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSamplerYcbcrConversionCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO>
+{
+	using Type = VkBindImagePlaneMemoryInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindImagePlaneMemoryInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO>
+{
+	using Type = VkImagePlaneMemoryRequirementsInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImagePlaneMemoryRequirementsInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES>
+{
+	using Type = VkPhysicalDeviceSamplerYcbcrConversionFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSamplerYcbcrConversionFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES>
+{
+	using Type = VkSamplerYcbcrConversionImageFormatProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSamplerYcbcrConversionImageFormatProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO>
+{
+	using Type = VkProtectedSubmitInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkProtectedSubmitInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES>
+{
+	using Type = VkPhysicalDeviceProtectedMemoryFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceProtectedMemoryFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceProtectedMemoryProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceProtectedMemoryProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2>
+{
+	using Type = VkDeviceQueueInfo2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceQueueInfo2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceSamplerFilterMinmaxProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSamplerFilterMinmaxProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO>
+{
+	using Type = VkSamplerReductionModeCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSamplerReductionModeCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO>
+{
+	using Type = VkImageFormatListCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageFormatListCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceMaintenance3Properties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMaintenance3Properties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT>
+{
+	using Type = VkDescriptorSetLayoutSupport;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorSetLayoutSupport;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES>
+{
+	using Type = VkPhysicalDeviceShaderDrawParametersFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderDrawParametersFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES>
+{
+	using Type = VkPhysicalDeviceShaderFloat16Int8Features;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderFloat16Int8Features;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceFloatControlsProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFloatControlsProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES>
+{
+	using Type = VkPhysicalDeviceHostQueryResetFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceHostQueryResetFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES>
+{
+	using Type = VkPhysicalDeviceDescriptorIndexingFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDescriptorIndexingFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceDescriptorIndexingProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDescriptorIndexingProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO>
+{
+	using Type = VkDescriptorSetLayoutBindingFlagsCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorSetLayoutBindingFlagsCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO>
+{
+	using Type = VkDescriptorSetVariableDescriptorCountAllocateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorSetVariableDescriptorCountAllocateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT>
+{
+	using Type = VkDescriptorSetVariableDescriptorCountLayoutSupport;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorSetVariableDescriptorCountLayoutSupport;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2>
+{
+	using Type = VkAttachmentDescription2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAttachmentDescription2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2>
+{
+	using Type = VkAttachmentReference2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAttachmentReference2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2>
+{
+	using Type = VkSubpassDescription2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubpassDescription2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2>
+{
+	using Type = VkSubpassDependency2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubpassDependency2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2>
+{
+	using Type = VkRenderPassCreateInfo2;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassCreateInfo2;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO>
+{
+	using Type = VkSubpassBeginInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubpassBeginInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBPASS_END_INFO>
+{
+	using Type = VkSubpassEndInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubpassEndInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES>
+{
+	using Type = VkPhysicalDeviceTimelineSemaphoreFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceTimelineSemaphoreFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceTimelineSemaphoreProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceTimelineSemaphoreProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO>
+{
+	using Type = VkSemaphoreTypeCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreTypeCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO>
+{
+	using Type = VkTimelineSemaphoreSubmitInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkTimelineSemaphoreSubmitInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO>
+{
+	using Type = VkSemaphoreWaitInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreWaitInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO>
+{
+	using Type = VkSemaphoreSignalInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreSignalInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES>
+{
+	using Type = VkPhysicalDevice8BitStorageFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevice8BitStorageFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES>
+{
+	using Type = VkPhysicalDeviceVulkanMemoryModelFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVulkanMemoryModelFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES>
+{
+	using Type = VkPhysicalDeviceShaderAtomicInt64Features;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderAtomicInt64Features;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceDepthStencilResolveProperties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDepthStencilResolveProperties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE>
+{
+	using Type = VkSubpassDescriptionDepthStencilResolve;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubpassDescriptionDepthStencilResolve;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO>
+{
+	using Type = VkImageStencilUsageCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageStencilUsageCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES>
+{
+	using Type = VkPhysicalDeviceScalarBlockLayoutFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceScalarBlockLayoutFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES>
+{
+	using Type = VkPhysicalDeviceUniformBufferStandardLayoutFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceUniformBufferStandardLayoutFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES>
+{
+	using Type = VkPhysicalDeviceBufferDeviceAddressFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceBufferDeviceAddressFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO>
+{
+	using Type = VkBufferDeviceAddressInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferDeviceAddressInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO>
+{
+	using Type = VkBufferOpaqueCaptureAddressCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferOpaqueCaptureAddressCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES>
+{
+	using Type = VkPhysicalDeviceImagelessFramebufferFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceImagelessFramebufferFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO>
+{
+	using Type = VkFramebufferAttachmentsCreateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFramebufferAttachmentsCreateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO>
+{
+	using Type = VkFramebufferAttachmentImageInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFramebufferAttachmentImageInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO>
+{
+	using Type = VkRenderPassAttachmentBeginInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassAttachmentBeginInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES>
+{
+	using Type = VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT>
+{
+	using Type = VkAttachmentReferenceStencilLayout;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAttachmentReferenceStencilLayout;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT>
+{
+	using Type = VkAttachmentDescriptionStencilLayout;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAttachmentDescriptionStencilLayout;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO>
+{
+	using Type = VkMemoryOpaqueCaptureAddressAllocateInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryOpaqueCaptureAddressAllocateInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO>
+{
+	using Type = VkDeviceMemoryOpaqueCaptureAddressInfo;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceMemoryOpaqueCaptureAddressInfo;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES>
+{
+	using Type = VkPhysicalDeviceVulkan11Features;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVulkan11Features;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceVulkan11Properties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVulkan11Properties;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES>
+{
+	using Type = VkPhysicalDeviceVulkan12Features;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVulkan12Features;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES>
+{
+	using Type = VkPhysicalDeviceVulkan12Properties;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVulkan12Properties;
+};
+#if defined(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD>
+{
+	using Type = VkPhysicalDeviceCoherentMemoryFeaturesAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceCoherentMemoryFeaturesAMD;
+};
+#endif
+#if defined(VK_AMD_DISPLAY_NATIVE_HDR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD>
+{
+	using Type = VkDisplayNativeHdrSurfaceCapabilitiesAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayNativeHdrSurfaceCapabilitiesAMD;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD>
+{
+	using Type = VkSwapchainDisplayNativeHdrCreateInfoAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSwapchainDisplayNativeHdrCreateInfoAMD;
+};
+#endif
+#if defined(VK_AMD_MEMORY_OVERALLOCATION_BEHAVIOR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD>
+{
+	using Type = VkDeviceMemoryOverallocationCreateInfoAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceMemoryOverallocationCreateInfoAMD;
+};
+#endif
+#if defined(VK_AMD_PIPELINE_COMPILER_CONTROL_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD>
+{
+	using Type = VkPipelineCompilerControlCreateInfoAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineCompilerControlCreateInfoAMD;
+};
+#endif
+#if defined(VK_AMD_RASTERIZATION_ORDER_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD>
+{
+	using Type = VkPipelineRasterizationStateRasterizationOrderAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRasterizationStateRasterizationOrderAMD;
+};
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD>
+{
+	using Type = VkPhysicalDeviceShaderCoreProperties2AMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderCoreProperties2AMD;
+};
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD>
+{
+	using Type = VkPhysicalDeviceShaderCorePropertiesAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderCorePropertiesAMD;
+};
+#endif
+#if defined(VK_AMD_TEXTURE_GATHER_BIAS_LOD_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD>
+{
+	using Type = VkTextureLODGatherFormatPropertiesAMD;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkTextureLODGatherFormatPropertiesAMD;
+};
+#endif
+#if defined(VK_EXT_4444_FORMATS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT>
+{
+	using Type = VkPhysicalDevice4444FormatsFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevice4444FormatsFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT>
+{
+	using Type = VkImageViewASTCDecodeModeEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageViewASTCDecodeModeEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceASTCDecodeFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceASTCDecodeFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_BLEND_OPERATION_ADVANCED_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineColorBlendAdvancedStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineColorBlendAdvancedStateCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_BORDER_COLOR_SWIZZLE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT>
+{
+	using Type = VkSamplerBorderColorComponentMappingCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSamplerBorderColorComponentMappingCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceBorderColorSwizzleFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceBorderColorSwizzleFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceBufferDeviceAddressFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceBufferDeviceAddressFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT>
+{
+	using Type = VkBufferDeviceAddressCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferDeviceAddressCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT>
+{
+	using Type = VkCalibratedTimestampInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCalibratedTimestampInfoEXT;
+};
+#endif
+#if defined(VK_EXT_COLOR_WRITE_ENABLE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceColorWriteEnableFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceColorWriteEnableFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineColorWriteCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineColorWriteCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT>
+{
+	using Type = VkConditionalRenderingBeginInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkConditionalRenderingBeginInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT>
+{
+	using Type = VkCommandBufferInheritanceConditionalRenderingInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandBufferInheritanceConditionalRenderingInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceConditionalRenderingFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceConditionalRenderingFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceConservativeRasterizationPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceConservativeRasterizationPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineRasterizationConservativeStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRasterizationConservativeStateCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT>
+{
+	using Type = VkSamplerCustomBorderColorCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSamplerCustomBorderColorCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceCustomBorderColorPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceCustomBorderColorPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceCustomBorderColorFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceCustomBorderColorFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_DEBUG_MARKER_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT>
+{
+	using Type = VkDebugMarkerObjectNameInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugMarkerObjectNameInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT>
+{
+	using Type = VkDebugMarkerObjectTagInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugMarkerObjectTagInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT>
+{
+	using Type = VkDebugMarkerMarkerInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugMarkerMarkerInfoEXT;
+};
+#endif
+#if defined(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT>
+{
+	using Type = VkDebugReportCallbackCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugReportCallbackCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT>
+{
+	using Type = VkDebugUtilsObjectNameInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugUtilsObjectNameInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT>
+{
+	using Type = VkDebugUtilsObjectTagInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugUtilsObjectTagInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT>
+{
+	using Type = VkDebugUtilsLabelEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugUtilsLabelEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT>
+{
+	using Type = VkDebugUtilsMessengerCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugUtilsMessengerCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT>
+{
+	using Type = VkDebugUtilsMessengerCallbackDataEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDebugUtilsMessengerCallbackDataEXT;
+};
+#endif
+#if defined(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceDepthClipEnableFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDepthClipEnableFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineRasterizationDepthClipStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRasterizationDepthClipStateCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceDeviceMemoryReportFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDeviceMemoryReportFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT>
+{
+	using Type = VkDeviceDeviceMemoryReportCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceDeviceMemoryReportCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT>
+{
+	using Type = VkDeviceMemoryReportCallbackDataEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceMemoryReportCallbackDataEXT;
+};
+#endif
+#if defined(VK_EXT_DISCARD_RECTANGLES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceDiscardRectanglePropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDiscardRectanglePropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineDiscardRectangleStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineDiscardRectangleStateCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_DISPLAY_CONTROL_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT>
+{
+	using Type = VkDisplayPowerInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayPowerInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT>
+{
+	using Type = VkDeviceEventInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceEventInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT>
+{
+	using Type = VkDisplayEventInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayEventInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT>
+{
+	using Type = VkSwapchainCounterCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSwapchainCounterCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT>
+{
+	using Type = VkSurfaceCapabilities2EXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSurfaceCapabilities2EXT;
+};
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceExtendedDynamicState2FeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExtendedDynamicState2FeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceExtendedDynamicStateFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExtendedDynamicStateFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT>
+{
+	using Type = VkImportMemoryHostPointerInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportMemoryHostPointerInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT>
+{
+	using Type = VkMemoryHostPointerPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryHostPointerPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceExternalMemoryHostPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExternalMemoryHostPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_FILTER_CUBIC_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT>
+{
+	using Type = VkPhysicalDeviceImageViewImageFormatInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceImageViewImageFormatInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT>
+{
+	using Type = VkFilterCubicImageViewImageFormatPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFilterCubicImageViewImageFormatPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceFragmentDensityMap2FeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentDensityMap2FeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceFragmentDensityMap2PropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentDensityMap2PropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceFragmentDensityMapFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentDensityMapFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceFragmentDensityMapPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentDensityMapPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT>
+{
+	using Type = VkRenderPassFragmentDensityMapCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassFragmentDensityMapCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT>
+{
+	using Type = VkDeviceQueueGlobalPriorityCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceQueueGlobalPriorityCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_QUERY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceGlobalPriorityQueryFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceGlobalPriorityQueryFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_EXT>
+{
+	using Type = VkQueueFamilyGlobalPriorityPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkQueueFamilyGlobalPriorityPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_HDR_METADATA_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_HDR_METADATA_EXT>
+{
+	using Type = VkHdrMetadataEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkHdrMetadataEXT;
+};
+#endif
+#if defined(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT>
+{
+	using Type = VkHeadlessSurfaceCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkHeadlessSurfaceCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT>
+{
+	using Type = VkDrmFormatModifierPropertiesListEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDrmFormatModifierPropertiesListEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT>
+{
+	using Type = VkPhysicalDeviceImageDrmFormatModifierInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceImageDrmFormatModifierInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT>
+{
+	using Type = VkImageDrmFormatModifierListCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageDrmFormatModifierListCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT>
+{
+	using Type = VkImageDrmFormatModifierExplicitCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageDrmFormatModifierExplicitCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT>
+{
+	using Type = VkImageDrmFormatModifierPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageDrmFormatModifierPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT>
+{
+	using Type = VkDrmFormatModifierPropertiesList2EXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDrmFormatModifierPropertiesList2EXT;
+};
+#endif
+#if defined(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceImageRobustnessFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceImageRobustnessFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_INDEX_TYPE_UINT8_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceIndexTypeUint8FeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceIndexTypeUint8FeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceInlineUniformBlockFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceInlineUniformBlockFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceInlineUniformBlockPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceInlineUniformBlockPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT>
+{
+	using Type = VkWriteDescriptorSetInlineUniformBlockEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWriteDescriptorSetInlineUniformBlockEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT>
+{
+	using Type = VkDescriptorPoolInlineUniformBlockCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDescriptorPoolInlineUniformBlockCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceLineRasterizationFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceLineRasterizationFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceLineRasterizationPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceLineRasterizationPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineRasterizationLineStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRasterizationLineStateCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceMemoryBudgetPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMemoryBudgetPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceMemoryPriorityFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMemoryPriorityFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT>
+{
+	using Type = VkMemoryPriorityAllocateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryPriorityAllocateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_MULTI_DRAW_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceMultiDrawPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMultiDrawPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceMultiDrawFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMultiDrawFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT>
+{
+	using Type = VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDevicePCIBusInfoPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePCIBusInfoPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceDrmPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDrmPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES_EXT>
+{
+	using Type = VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineCreationFeedbackCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineCreationFeedbackCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_PRIMITIVE_TOPOLOGY_LIST_RESTART_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT>
+{
+	using Type = VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_PRIVATE_DATA_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT>
+{
+	using Type = VkDevicePrivateDataCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDevicePrivateDataCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO_EXT>
+{
+	using Type = VkPrivateDataSlotCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPrivateDataSlotCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES_EXT>
+{
+	using Type = VkPhysicalDevicePrivateDataFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePrivateDataFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_PROVOKING_VERTEX_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceProvokingVertexFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceProvokingVertexFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceProvokingVertexPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceProvokingVertexPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineRasterizationProvokingVertexStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRasterizationProvokingVertexStateCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_RGBA10X6_FORMATS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceRobustness2FeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRobustness2FeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceRobustness2PropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRobustness2PropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT>
+{
+	using Type = VkSampleLocationsInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSampleLocationsInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT>
+{
+	using Type = VkRenderPassSampleLocationsBeginInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassSampleLocationsBeginInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineSampleLocationsStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineSampleLocationsStateCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceSampleLocationsPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSampleLocationsPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT>
+{
+	using Type = VkMultisamplePropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMultisamplePropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceShaderAtomicFloatFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderAtomicFloatFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_SHADER_IMAGE_ATOMIC_INT64_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceSubgroupSizeControlFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSubgroupSizeControlFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceSubgroupSizeControlPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSubgroupSizeControlPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_TEXEL_BUFFER_ALIGNMENT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_TOOLING_INFO_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceToolPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceToolPropertiesEXT;
+};
+#endif
+#if defined(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceTransformFeedbackFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceTransformFeedbackFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceTransformFeedbackPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceTransformFeedbackPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineRasterizationStateStreamCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRasterizationStateStreamCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT>
+{
+	using Type = VkValidationCacheCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkValidationCacheCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT>
+{
+	using Type = VkShaderModuleValidationCacheCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkShaderModuleValidationCacheCreateInfoEXT;
+};
+#endif
+#if defined(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT>
+{
+	using Type = VkValidationFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkValidationFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT>
+{
+	using Type = VkValidationFlagsEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkValidationFlagsEXT;
+};
+#endif
+#if defined(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT>
+{
+	using Type = VkPipelineVertexInputDivisorStateCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineVertexInputDivisorStateCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT>
+{
+	using Type = VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT>
+{
+	using Type = VkVertexInputBindingDescription2EXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVertexInputBindingDescription2EXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT>
+{
+	using Type = VkVertexInputAttributeDescription2EXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVertexInputAttributeDescription2EXT;
+};
+#endif
+#if defined(VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT;
+};
+#endif
+#if defined(VK_EXT_YCBCR_IMAGE_ARRAYS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT>
+{
+	using Type = VkPhysicalDeviceYcbcrImageArraysFeaturesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceYcbcrImageArraysFeaturesEXT;
+};
+#endif
+#if defined(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE>
+{
+	using Type = VkPresentTimesInfoGOOGLE;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPresentTimesInfoGOOGLE;
+};
+#endif
+#if defined(VK_HUAWEI_INVOCATION_MASK_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI>
+{
+	using Type = VkPhysicalDeviceInvocationMaskFeaturesHUAWEI;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceInvocationMaskFeaturesHUAWEI;
+};
+#endif
+#if defined(VK_HUAWEI_SUBPASS_SHADING_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI>
+{
+	using Type = VkSubpassShadingPipelineCreateInfoHUAWEI;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubpassShadingPipelineCreateInfoHUAWEI;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI>
+{
+	using Type = VkPhysicalDeviceSubpassShadingPropertiesHUAWEI;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSubpassShadingPropertiesHUAWEI;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI>
+{
+	using Type = VkPhysicalDeviceSubpassShadingFeaturesHUAWEI;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSubpassShadingFeaturesHUAWEI;
+};
+#endif
+#if defined(VK_INTEL_PERFORMANCE_QUERY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL>
+{
+	using Type = VkInitializePerformanceApiInfoINTEL;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkInitializePerformanceApiInfoINTEL;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL>
+{
+	using Type = VkQueryPoolPerformanceQueryCreateInfoINTEL;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkQueryPoolPerformanceQueryCreateInfoINTEL;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL>
+{
+	using Type = VkPerformanceMarkerInfoINTEL;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPerformanceMarkerInfoINTEL;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PERFORMANCE_STREAM_MARKER_INFO_INTEL>
+{
+	using Type = VkPerformanceStreamMarkerInfoINTEL;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPerformanceStreamMarkerInfoINTEL;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PERFORMANCE_OVERRIDE_INFO_INTEL>
+{
+	using Type = VkPerformanceOverrideInfoINTEL;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPerformanceOverrideInfoINTEL;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PERFORMANCE_CONFIGURATION_ACQUIRE_INFO_INTEL>
+{
+	using Type = VkPerformanceConfigurationAcquireInfoINTEL;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPerformanceConfigurationAcquireInfoINTEL;
+};
+#endif
+#if defined(VK_INTEL_SHADER_INTEGER_FUNCTIONS_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL>
+{
+	using Type = VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL;
+};
+#endif
+#if defined(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR>
+{
+	using Type = VkWriteDescriptorSetAccelerationStructureKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWriteDescriptorSetAccelerationStructureKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceAccelerationStructureFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceAccelerationStructureFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDeviceAccelerationStructurePropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceAccelerationStructurePropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR>
+{
+	using Type = VkAccelerationStructureGeometryTrianglesDataKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureGeometryTrianglesDataKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR>
+{
+	using Type = VkAccelerationStructureGeometryAabbsDataKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureGeometryAabbsDataKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR>
+{
+	using Type = VkAccelerationStructureGeometryInstancesDataKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureGeometryInstancesDataKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR>
+{
+	using Type = VkAccelerationStructureGeometryKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureGeometryKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR>
+{
+	using Type = VkAccelerationStructureBuildGeometryInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureBuildGeometryInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR>
+{
+	using Type = VkAccelerationStructureCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR>
+{
+	using Type = VkAccelerationStructureDeviceAddressInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureDeviceAddressInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR>
+{
+	using Type = VkAccelerationStructureVersionInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureVersionInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR>
+{
+	using Type = VkCopyAccelerationStructureInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyAccelerationStructureInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR>
+{
+	using Type = VkCopyAccelerationStructureToMemoryInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyAccelerationStructureToMemoryInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR>
+{
+	using Type = VkCopyMemoryToAccelerationStructureInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyMemoryToAccelerationStructureInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR>
+{
+	using Type = VkAccelerationStructureBuildSizesInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureBuildSizesInfoKHR;
+};
+#endif
+#if defined(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR>
+{
+	using Type = VkBufferCopy2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferCopy2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_COPY_2_KHR>
+{
+	using Type = VkImageCopy2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageCopy2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_BLIT_2_KHR>
+{
+	using Type = VkImageBlit2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageBlit2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2_KHR>
+{
+	using Type = VkBufferImageCopy2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferImageCopy2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2_KHR>
+{
+	using Type = VkImageResolve2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageResolve2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR>
+{
+	using Type = VkCopyBufferInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyBufferInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2_KHR>
+{
+	using Type = VkCopyImageInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyImageInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2_KHR>
+{
+	using Type = VkBlitImageInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBlitImageInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2_KHR>
+{
+	using Type = VkCopyBufferToImageInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyBufferToImageInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2_KHR>
+{
+	using Type = VkCopyImageToBufferInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyImageToBufferInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2_KHR>
+{
+	using Type = VkResolveImageInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkResolveImageInfo2KHR;
+};
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SURFACE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR>
+{
+	using Type = VkDeviceGroupPresentCapabilitiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupPresentCapabilitiesKHR;
+};
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR>
+{
+	using Type = VkImageSwapchainCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageSwapchainCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR>
+{
+	using Type = VkBindImageMemorySwapchainInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindImageMemorySwapchainInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR>
+{
+	using Type = VkAcquireNextImageInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAcquireNextImageInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR>
+{
+	using Type = VkDeviceGroupPresentInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupPresentInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR>
+{
+	using Type = VkDeviceGroupSwapchainCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceGroupSwapchainCreateInfoKHR;
+};
+#endif
+#if defined(VK_KHR_DISPLAY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR>
+{
+	using Type = VkDisplayModeCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayModeCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR>
+{
+	using Type = VkDisplaySurfaceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplaySurfaceCreateInfoKHR;
+};
+#endif
+#if defined(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR>
+{
+	using Type = VkDisplayPresentInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayPresentInfoKHR;
+};
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR>
+{
+	using Type = VkImportFenceFdInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportFenceFdInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR>
+{
+	using Type = VkFenceGetFdInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFenceGetFdInfoKHR;
+};
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR>
+{
+	using Type = VkImportMemoryFdInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportMemoryFdInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR>
+{
+	using Type = VkMemoryFdPropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryFdPropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR>
+{
+	using Type = VkMemoryGetFdInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryGetFdInfoKHR;
+};
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR>
+{
+	using Type = VkImportSemaphoreFdInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportSemaphoreFdInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR>
+{
+	using Type = VkSemaphoreGetFdInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreGetFdInfoKHR;
+};
+#endif
+#if defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR>
+{
+	using Type = VkFormatProperties3KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFormatProperties3KHR;
+};
+#endif
+#if defined(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR>
+{
+	using Type = VkFragmentShadingRateAttachmentInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFragmentShadingRateAttachmentInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR>
+{
+	using Type = VkPipelineFragmentShadingRateStateCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineFragmentShadingRateStateCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceFragmentShadingRateFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentShadingRateFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDeviceFragmentShadingRatePropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentShadingRatePropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR>
+{
+	using Type = VkPhysicalDeviceFragmentShadingRateKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentShadingRateKHR;
+};
+#endif
+#if defined(VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR>
+{
+	using Type = VkDisplayProperties2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayProperties2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR>
+{
+	using Type = VkDisplayPlaneProperties2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayPlaneProperties2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR>
+{
+	using Type = VkDisplayModeProperties2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayModeProperties2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR>
+{
+	using Type = VkDisplayPlaneInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayPlaneInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR>
+{
+	using Type = VkDisplayPlaneCapabilities2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDisplayPlaneCapabilities2KHR;
+};
+#endif
+#if defined(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR>
+{
+	using Type = VkPhysicalDeviceSurfaceInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSurfaceInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR>
+{
+	using Type = VkSurfaceCapabilities2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSurfaceCapabilities2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR>
+{
+	using Type = VkSurfaceFormat2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSurfaceFormat2KHR;
+};
+#endif
+#if defined(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR>
+{
+	using Type = VkPresentRegionsKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPresentRegionsKHR;
+};
+#endif
+#if defined(VK_KHR_MAINTENANCE_4_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS_KHR>
+{
+	using Type = VkDeviceBufferMemoryRequirementsKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceBufferMemoryRequirementsKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS_KHR>
+{
+	using Type = VkDeviceImageMemoryRequirementsKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceImageMemoryRequirementsKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceMaintenance4FeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMaintenance4FeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDeviceMaintenance4PropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMaintenance4PropertiesKHR;
+};
+#endif
+#if defined(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR>
+{
+	using Type = VkPhysicalDevicePerformanceQueryFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePerformanceQueryFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDevicePerformanceQueryPropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePerformanceQueryPropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR>
+{
+	using Type = VkPerformanceCounterKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPerformanceCounterKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR>
+{
+	using Type = VkPerformanceCounterDescriptionKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPerformanceCounterDescriptionKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR>
+{
+	using Type = VkQueryPoolPerformanceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkQueryPoolPerformanceCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR>
+{
+	using Type = VkAcquireProfilingLockInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAcquireProfilingLockInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR>
+{
+	using Type = VkPerformanceQuerySubmitInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPerformanceQuerySubmitInfoKHR;
+};
+#endif
+#if defined(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR>
+{
+	using Type = VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR>
+{
+	using Type = VkPipelineInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR>
+{
+	using Type = VkPipelineExecutablePropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineExecutablePropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR>
+{
+	using Type = VkPipelineExecutableInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineExecutableInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR>
+{
+	using Type = VkPipelineExecutableStatisticKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineExecutableStatisticKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR>
+{
+	using Type = VkPipelineExecutableInternalRepresentationKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineExecutableInternalRepresentationKHR;
+};
+#endif
+#if defined(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR>
+{
+	using Type = VkPipelineLibraryCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineLibraryCreateInfoKHR;
+};
+#endif
+#if defined(VK_KHR_PRESENT_ID_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR>
+{
+	using Type = VkPhysicalDevicePresentIdFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePresentIdFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PRESENT_ID_KHR>
+{
+	using Type = VkPresentIdKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPresentIdKHR;
+};
+#endif
+#if defined(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR>
+{
+	using Type = VkPhysicalDevicePresentWaitFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePresentWaitFeaturesKHR;
+};
+#endif
+#if defined(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDevicePushDescriptorPropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePushDescriptorPropertiesKHR;
+};
+#endif
+#if defined(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceRayQueryFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRayQueryFeaturesKHR;
+};
+#endif
+#if defined(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR>
+{
+	using Type = VkRayTracingShaderGroupCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRayTracingShaderGroupCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR>
+{
+	using Type = VkRayTracingPipelineCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRayTracingPipelineCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceRayTracingPipelineFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRayTracingPipelineFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDeviceRayTracingPipelinePropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRayTracingPipelinePropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR>
+{
+	using Type = VkRayTracingPipelineInterfaceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRayTracingPipelineInterfaceCreateInfoKHR;
+};
+#endif
+#if defined(VK_KHR_SHADER_CLOCK_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceShaderClockFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderClockFeaturesKHR;
+};
+#endif
+#if defined(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDeviceShaderIntegerDotProductPropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderIntegerDotProductPropertiesKHR;
+};
+#endif
+#if defined(VK_KHR_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR;
+};
+#endif
+#if defined(VK_KHR_SHADER_TERMINATE_INVOCATION_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR;
+};
+#endif
+#if defined(VK_KHR_SHARED_PRESENTABLE_IMAGE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR>
+{
+	using Type = VkSharedPresentSurfaceCapabilitiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSharedPresentSurfaceCapabilitiesKHR;
+};
+#endif
+#if defined(VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR>
+{
+	using Type = VkSurfaceProtectedCapabilitiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSurfaceProtectedCapabilitiesKHR;
+};
+#endif
+#if defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR>
+{
+	using Type = VkSwapchainCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSwapchainCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PRESENT_INFO_KHR>
+{
+	using Type = VkPresentInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPresentInfoKHR;
+};
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR>
+{
+	using Type = VkMemoryBarrier2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryBarrier2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR>
+{
+	using Type = VkImageMemoryBarrier2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageMemoryBarrier2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR>
+{
+	using Type = VkBufferMemoryBarrier2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferMemoryBarrier2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR>
+{
+	using Type = VkDependencyInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDependencyInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR>
+{
+	using Type = VkSemaphoreSubmitInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreSubmitInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR>
+{
+	using Type = VkCommandBufferSubmitInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandBufferSubmitInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR>
+{
+	using Type = VkSubmitInfo2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSubmitInfo2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceSynchronization2FeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceSynchronization2FeaturesKHR;
+};
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) && defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV>
+{
+	using Type = VkQueueFamilyCheckpointProperties2NV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkQueueFamilyCheckpointProperties2NV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV>
+{
+	using Type = VkCheckpointData2NV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCheckpointData2NV;
+};
+#endif
+#if defined(VK_KHR_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR;
+};
+#endif
+#if defined(VK_KHR_ZERO_INITIALIZE_WORKGROUP_MEMORY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES_KHR>
+{
+	using Type = VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR;
+};
+#endif
+#if defined(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_CU_MODULE_CREATE_INFO_NVX>
+{
+	using Type = VkCuModuleCreateInfoNVX;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCuModuleCreateInfoNVX;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_CU_FUNCTION_CREATE_INFO_NVX>
+{
+	using Type = VkCuFunctionCreateInfoNVX;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCuFunctionCreateInfoNVX;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_CU_LAUNCH_INFO_NVX>
+{
+	using Type = VkCuLaunchInfoNVX;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCuLaunchInfoNVX;
+};
+#endif
+#if defined(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_VIEW_HANDLE_INFO_NVX>
+{
+	using Type = VkImageViewHandleInfoNVX;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageViewHandleInfoNVX;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_VIEW_ADDRESS_PROPERTIES_NVX>
+{
+	using Type = VkImageViewAddressPropertiesNVX;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageViewAddressPropertiesNVX;
+};
+#endif
+#if defined(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX>
+{
+	using Type = VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX;
+};
+#endif
+#if defined(VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineViewportWScalingStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineViewportWScalingStateCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceComputeShaderDerivativesFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceComputeShaderDerivativesFeaturesNV;
+};
+#endif
+#if defined(VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceCooperativeMatrixFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceCooperativeMatrixFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV>
+{
+	using Type = VkPhysicalDeviceCooperativeMatrixPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceCooperativeMatrixPropertiesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV>
+{
+	using Type = VkCooperativeMatrixPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCooperativeMatrixPropertiesNV;
+};
+#endif
+#if defined(VK_NV_CORNER_SAMPLED_IMAGE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceCornerSampledImageFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceCornerSampledImageFeaturesNV;
+};
+#endif
+#if defined(VK_NV_COVERAGE_REDUCTION_MODE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceCoverageReductionModeFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceCoverageReductionModeFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineCoverageReductionStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineCoverageReductionStateCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV>
+{
+	using Type = VkFramebufferMixedSamplesCombinationNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFramebufferMixedSamplesCombinationNV;
+};
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV>
+{
+	using Type = VkDedicatedAllocationImageCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDedicatedAllocationImageCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV>
+{
+	using Type = VkDedicatedAllocationBufferCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDedicatedAllocationBufferCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV>
+{
+	using Type = VkDedicatedAllocationMemoryAllocateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDedicatedAllocationMemoryAllocateInfoNV;
+};
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_IMAGE_ALIASING_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV;
+};
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTICS_CONFIG_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceDiagnosticsConfigFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDiagnosticsConfigFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV>
+{
+	using Type = VkDeviceDiagnosticsConfigCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDeviceDiagnosticsConfigCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV>
+{
+	using Type = VkQueueFamilyCheckpointPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkQueueFamilyCheckpointPropertiesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV>
+{
+	using Type = VkCheckpointDataNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCheckpointDataNV;
+};
+#endif
+#if defined(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV>
+{
+	using Type = VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV>
+{
+	using Type = VkGraphicsShaderGroupCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGraphicsShaderGroupCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV>
+{
+	using Type = VkGraphicsPipelineShaderGroupsCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGraphicsPipelineShaderGroupsCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV>
+{
+	using Type = VkIndirectCommandsLayoutTokenNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkIndirectCommandsLayoutTokenNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV>
+{
+	using Type = VkIndirectCommandsLayoutCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkIndirectCommandsLayoutCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV>
+{
+	using Type = VkGeneratedCommandsInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGeneratedCommandsInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV>
+{
+	using Type = VkGeneratedCommandsMemoryRequirementsInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGeneratedCommandsMemoryRequirementsInfoNV;
+};
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV>
+{
+	using Type = VkExternalMemoryImageCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalMemoryImageCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV>
+{
+	using Type = VkExportMemoryAllocateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportMemoryAllocateInfoNV;
+};
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_RDMA_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceExternalMemoryRDMAFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExternalMemoryRDMAFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV>
+{
+	using Type = VkMemoryGetRemoteAddressInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryGetRemoteAddressInfoNV;
+};
+#endif
+#if defined(VK_NV_FRAGMENT_COVERAGE_TO_COLOR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineCoverageToColorStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineCoverageToColorStateCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV;
+};
+#endif
+#if defined(VK_NV_FRAGMENT_SHADING_RATE_ENUMS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV>
+{
+	using Type = VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineFragmentShadingRateEnumStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineFragmentShadingRateEnumStateCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_FRAMEBUFFER_MIXED_SAMPLES_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineCoverageModulationStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineCoverageModulationStateCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_INHERITED_VIEWPORT_SCISSOR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceInheritedViewportScissorFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceInheritedViewportScissorFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV>
+{
+	using Type = VkCommandBufferInheritanceViewportScissorInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandBufferInheritanceViewportScissorInfoNV;
+};
+#endif
+#if defined(VK_NV_MESH_SHADER_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceMeshShaderFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMeshShaderFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV>
+{
+	using Type = VkPhysicalDeviceMeshShaderPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMeshShaderPropertiesNV;
+};
+#endif
+#if defined(VK_NV_RAY_TRACING_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV>
+{
+	using Type = VkRayTracingShaderGroupCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRayTracingShaderGroupCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV>
+{
+	using Type = VkRayTracingPipelineCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRayTracingPipelineCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GEOMETRY_TRIANGLES_NV>
+{
+	using Type = VkGeometryTrianglesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGeometryTrianglesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GEOMETRY_AABB_NV>
+{
+	using Type = VkGeometryAABBNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGeometryAABBNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_GEOMETRY_NV>
+{
+	using Type = VkGeometryNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkGeometryNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_INFO_NV>
+{
+	using Type = VkAccelerationStructureInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV>
+{
+	using Type = VkAccelerationStructureCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BIND_ACCELERATION_STRUCTURE_MEMORY_INFO_NV>
+{
+	using Type = VkBindAccelerationStructureMemoryInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBindAccelerationStructureMemoryInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV>
+{
+	using Type = VkWriteDescriptorSetAccelerationStructureNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWriteDescriptorSetAccelerationStructureNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV>
+{
+	using Type = VkAccelerationStructureMemoryRequirementsInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureMemoryRequirementsInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV>
+{
+	using Type = VkPhysicalDeviceRayTracingPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRayTracingPropertiesNV;
+};
+#endif
+#if defined(VK_NV_RAY_TRACING_MOTION_BLUR_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceRayTracingMotionBlurFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRayTracingMotionBlurFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV>
+{
+	using Type = VkAccelerationStructureGeometryMotionTrianglesDataNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureGeometryMotionTrianglesDataNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV>
+{
+	using Type = VkAccelerationStructureMotionInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAccelerationStructureMotionInfoNV;
+};
+#endif
+#if defined(VK_NV_REPRESENTATIVE_FRAGMENT_TEST_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineRepresentativeFragmentTestStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineRepresentativeFragmentTestStateCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_SCISSOR_EXCLUSIVE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceExclusiveScissorFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceExclusiveScissorFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineViewportExclusiveScissorStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineViewportExclusiveScissorStateCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_SHADER_IMAGE_FOOTPRINT_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceShaderImageFootprintFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderImageFootprintFeaturesNV;
+};
+#endif
+#if defined(VK_NV_SHADER_SM_BUILTINS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV>
+{
+	using Type = VkPhysicalDeviceShaderSMBuiltinsPropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderSMBuiltinsPropertiesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceShaderSMBuiltinsFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShaderSMBuiltinsFeaturesNV;
+};
+#endif
+#if defined(VK_NV_SHADING_RATE_IMAGE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineViewportShadingRateImageStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineViewportShadingRateImageStateCreateInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV>
+{
+	using Type = VkPhysicalDeviceShadingRateImageFeaturesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShadingRateImageFeaturesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV>
+{
+	using Type = VkPhysicalDeviceShadingRateImagePropertiesNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceShadingRateImagePropertiesNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineViewportCoarseSampleOrderStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineViewportCoarseSampleOrderStateCreateInfoNV;
+};
+#endif
+#if defined(VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV>
+{
+	using Type = VkPipelineViewportSwizzleStateCreateInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPipelineViewportSwizzleStateCreateInfoNV;
+};
+#endif
+#if defined(VK_QCOM_RENDER_PASS_TRANSFORM_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM>
+{
+	using Type = VkRenderPassTransformBeginInfoQCOM;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkRenderPassTransformBeginInfoQCOM;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM>
+{
+	using Type = VkCommandBufferInheritanceRenderPassTransformInfoQCOM;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCommandBufferInheritanceRenderPassTransformInfoQCOM;
+};
+#endif
+#if defined(VK_QCOM_ROTATED_COPY_COMMANDS_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM>
+{
+	using Type = VkCopyCommandTransformInfoQCOM;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkCopyCommandTransformInfoQCOM;
+};
+#endif
+#if defined(VK_VALVE_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_VALVE>
+{
+	using Type = VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE>
+{
+	using Type = VkMutableDescriptorTypeCreateInfoVALVE;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMutableDescriptorTypeCreateInfoVALVE;
+};
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_EXT>
+{
+	using Type = VkVideoDecodeH264ProfileEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264ProfileEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_EXT>
+{
+	using Type = VkVideoDecodeH264CapabilitiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264CapabilitiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_CREATE_INFO_EXT>
+{
+	using Type = VkVideoDecodeH264SessionCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264SessionCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT>
+{
+	using Type = VkVideoDecodeH264SessionParametersAddInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264SessionParametersAddInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT>
+{
+	using Type = VkVideoDecodeH264SessionParametersCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264SessionParametersCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_EXT>
+{
+	using Type = VkVideoDecodeH264PictureInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264PictureInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_EXT>
+{
+	using Type = VkVideoDecodeH264DpbSlotInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264DpbSlotInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_MVC_EXT>
+{
+	using Type = VkVideoDecodeH264MvcEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH264MvcEXT;
+};
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_EXT>
+{
+	using Type = VkVideoDecodeH265ProfileEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH265ProfileEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_EXT>
+{
+	using Type = VkVideoDecodeH265CapabilitiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH265CapabilitiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_CREATE_INFO_EXT>
+{
+	using Type = VkVideoDecodeH265SessionCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH265SessionCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT>
+{
+	using Type = VkVideoDecodeH265SessionParametersAddInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH265SessionParametersAddInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT>
+{
+	using Type = VkVideoDecodeH265SessionParametersCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH265SessionParametersCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_EXT>
+{
+	using Type = VkVideoDecodeH265PictureInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH265PictureInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_EXT>
+{
+	using Type = VkVideoDecodeH265DpbSlotInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeH265DpbSlotInfoEXT;
+};
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT>
+{
+	using Type = VkVideoEncodeH264CapabilitiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264CapabilitiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_CREATE_INFO_EXT>
+{
+	using Type = VkVideoEncodeH264SessionCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264SessionCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT>
+{
+	using Type = VkVideoEncodeH264SessionParametersAddInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264SessionParametersAddInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT>
+{
+	using Type = VkVideoEncodeH264SessionParametersCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264SessionParametersCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_EXT>
+{
+	using Type = VkVideoEncodeH264DpbSlotInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264DpbSlotInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_VCL_FRAME_INFO_EXT>
+{
+	using Type = VkVideoEncodeH264VclFrameInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264VclFrameInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_EMIT_PICTURE_PARAMETERS_EXT>
+{
+	using Type = VkVideoEncodeH264EmitPictureParametersEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264EmitPictureParametersEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_EXT>
+{
+	using Type = VkVideoEncodeH264ProfileEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264ProfileEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_NALU_SLICE_EXT>
+{
+	using Type = VkVideoEncodeH264NaluSliceEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH264NaluSliceEXT;
+};
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT>
+{
+	using Type = VkVideoEncodeH265CapabilitiesEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265CapabilitiesEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_CREATE_INFO_EXT>
+{
+	using Type = VkVideoEncodeH265SessionCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265SessionCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT>
+{
+	using Type = VkVideoEncodeH265SessionParametersAddInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265SessionParametersAddInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT>
+{
+	using Type = VkVideoEncodeH265SessionParametersCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265SessionParametersCreateInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_VCL_FRAME_INFO_EXT>
+{
+	using Type = VkVideoEncodeH265VclFrameInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265VclFrameInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_EMIT_PICTURE_PARAMETERS_EXT>
+{
+	using Type = VkVideoEncodeH265EmitPictureParametersEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265EmitPictureParametersEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_NALU_SLICE_EXT>
+{
+	using Type = VkVideoEncodeH265NaluSliceEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265NaluSliceEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_EXT>
+{
+	using Type = VkVideoEncodeH265ProfileEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265ProfileEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_EXT>
+{
+	using Type = VkVideoEncodeH265DpbSlotInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265DpbSlotInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_REFERENCE_LISTS_EXT>
+{
+	using Type = VkVideoEncodeH265ReferenceListsEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeH265ReferenceListsEXT;
+};
+#endif
+#if defined(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR>
+{
+	using Type = VkPhysicalDevicePortabilitySubsetFeaturesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePortabilitySubsetFeaturesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR>
+{
+	using Type = VkPhysicalDevicePortabilitySubsetPropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePortabilitySubsetPropertiesKHR;
+};
+#endif
+#if defined(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR>
+{
+	using Type = VkVideoDecodeInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoDecodeInfoKHR;
+};
+#endif
+#if defined(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR>
+{
+	using Type = VkVideoEncodeInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR>
+{
+	using Type = VkVideoEncodeRateControlInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEncodeRateControlInfoKHR;
+};
+#endif
+#if defined(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_QUEUE_FAMILY_PROPERTIES_2_KHR>
+{
+	using Type = VkVideoQueueFamilyProperties2KHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoQueueFamilyProperties2KHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_PROFILES_KHR>
+{
+	using Type = VkVideoProfilesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoProfilesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_FORMAT_INFO_KHR>
+{
+	using Type = VkPhysicalDeviceVideoFormatInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDeviceVideoFormatInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR>
+{
+	using Type = VkVideoFormatPropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoFormatPropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_PROFILE_KHR>
+{
+	using Type = VkVideoProfileKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoProfileKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR>
+{
+	using Type = VkVideoCapabilitiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoCapabilitiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_GET_MEMORY_PROPERTIES_KHR>
+{
+	using Type = VkVideoGetMemoryPropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoGetMemoryPropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_BIND_MEMORY_KHR>
+{
+	using Type = VkVideoBindMemoryKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoBindMemoryKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_PICTURE_RESOURCE_KHR>
+{
+	using Type = VkVideoPictureResourceKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoPictureResourceKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_REFERENCE_SLOT_KHR>
+{
+	using Type = VkVideoReferenceSlotKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoReferenceSlotKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_SESSION_CREATE_INFO_KHR>
+{
+	using Type = VkVideoSessionCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoSessionCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_CREATE_INFO_KHR>
+{
+	using Type = VkVideoSessionParametersCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoSessionParametersCreateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_UPDATE_INFO_KHR>
+{
+	using Type = VkVideoSessionParametersUpdateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoSessionParametersUpdateInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_BEGIN_CODING_INFO_KHR>
+{
+	using Type = VkVideoBeginCodingInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoBeginCodingInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_END_CODING_INFO_KHR>
+{
+	using Type = VkVideoEndCodingInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoEndCodingInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VIDEO_CODING_CONTROL_INFO_KHR>
+{
+	using Type = VkVideoCodingControlInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkVideoCodingControlInfoKHR;
+};
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID>
+{
+	using Type = VkImportAndroidHardwareBufferInfoANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportAndroidHardwareBufferInfoANDROID;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID>
+{
+	using Type = VkAndroidHardwareBufferUsageANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAndroidHardwareBufferUsageANDROID;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID>
+{
+	using Type = VkAndroidHardwareBufferPropertiesANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAndroidHardwareBufferPropertiesANDROID;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID>
+{
+	using Type = VkMemoryGetAndroidHardwareBufferInfoANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryGetAndroidHardwareBufferInfoANDROID;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID>
+{
+	using Type = VkAndroidHardwareBufferFormatPropertiesANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAndroidHardwareBufferFormatPropertiesANDROID;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID>
+{
+	using Type = VkExternalFormatANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExternalFormatANDROID;
+};
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID>
+{
+	using Type = VkAndroidHardwareBufferFormatProperties2ANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAndroidHardwareBufferFormatProperties2ANDROID;
+};
+#endif
+#if defined(VK_ANDROID_NATIVE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_NATIVE_BUFFER_ANDROID>
+{
+	using Type = VkNativeBufferANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkNativeBufferANDROID;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SWAPCHAIN_IMAGE_CREATE_INFO_ANDROID>
+{
+	using Type = VkSwapchainImageCreateInfoANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSwapchainImageCreateInfoANDROID;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENTATION_PROPERTIES_ANDROID>
+{
+	using Type = VkPhysicalDevicePresentationPropertiesANDROID;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPhysicalDevicePresentationPropertiesANDROID;
+};
+#endif
+#if defined(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR>
+{
+	using Type = VkAndroidSurfaceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkAndroidSurfaceCreateInfoKHR;
+};
+#endif
+#if defined(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT>
+{
+	using Type = VkDirectFBSurfaceCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkDirectFBSurfaceCreateInfoEXT;
+};
+#endif
+#if defined(VK_FUCHSIA_BUFFER_COLLECTION_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA>
+{
+	using Type = VkImportMemoryBufferCollectionFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportMemoryBufferCollectionFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA>
+{
+	using Type = VkBufferCollectionImageCreateInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferCollectionImageCreateInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA>
+{
+	using Type = VkBufferCollectionBufferCreateInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferCollectionBufferCreateInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CREATE_INFO_FUCHSIA>
+{
+	using Type = VkBufferCollectionCreateInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferCollectionCreateInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_COLLECTION_PROPERTIES_FUCHSIA>
+{
+	using Type = VkBufferCollectionPropertiesFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferCollectionPropertiesFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_CONSTRAINTS_INFO_FUCHSIA>
+{
+	using Type = VkBufferConstraintsInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferConstraintsInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA>
+{
+	using Type = VkSysmemColorSpaceFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSysmemColorSpaceFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_FORMAT_CONSTRAINTS_INFO_FUCHSIA>
+{
+	using Type = VkImageFormatConstraintsInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageFormatConstraintsInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGE_CONSTRAINTS_INFO_FUCHSIA>
+{
+	using Type = VkImageConstraintsInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImageConstraintsInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA>
+{
+	using Type = VkBufferCollectionConstraintsInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkBufferCollectionConstraintsInfoFUCHSIA;
+};
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_MEMORY_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA>
+{
+	using Type = VkImportMemoryZirconHandleInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportMemoryZirconHandleInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA>
+{
+	using Type = VkMemoryZirconHandlePropertiesFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryZirconHandlePropertiesFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_GET_ZIRCON_HANDLE_INFO_FUCHSIA>
+{
+	using Type = VkMemoryGetZirconHandleInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryGetZirconHandleInfoFUCHSIA;
+};
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_SEMAPHORE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_ZIRCON_HANDLE_INFO_FUCHSIA>
+{
+	using Type = VkImportSemaphoreZirconHandleInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportSemaphoreZirconHandleInfoFUCHSIA;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_GET_ZIRCON_HANDLE_INFO_FUCHSIA>
+{
+	using Type = VkSemaphoreGetZirconHandleInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreGetZirconHandleInfoFUCHSIA;
+};
+#endif
+#if defined(VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA>
+{
+	using Type = VkImagePipeSurfaceCreateInfoFUCHSIA;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImagePipeSurfaceCreateInfoFUCHSIA;
+};
+#endif
+#if defined(VK_GGP_FRAME_TOKEN_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP>
+{
+	using Type = VkPresentFrameTokenGGP;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkPresentFrameTokenGGP;
+};
+#endif
+#if defined(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP>
+{
+	using Type = VkStreamDescriptorSurfaceCreateInfoGGP;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkStreamDescriptorSurfaceCreateInfoGGP;
+};
+#endif
+#if defined(VK_MVK_IOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_IOS_MVK)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK>
+{
+	using Type = VkIOSSurfaceCreateInfoMVK;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkIOSSurfaceCreateInfoMVK;
+};
+#endif
+#if defined(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_MACOS_MVK)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK>
+{
+	using Type = VkMacOSSurfaceCreateInfoMVK;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMacOSSurfaceCreateInfoMVK;
+};
+#endif
+#if defined(VK_EXT_METAL_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_METAL_EXT)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT>
+{
+	using Type = VkMetalSurfaceCreateInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMetalSurfaceCreateInfoEXT;
+};
+#endif
+#if defined(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_SCREEN_QNX)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX>
+{
+	using Type = VkScreenSurfaceCreateInfoQNX;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkScreenSurfaceCreateInfoQNX;
+};
+#endif
+#if defined(VK_NN_VI_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_VI_NN)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN>
+{
+	using Type = VkViSurfaceCreateInfoNN;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkViSurfaceCreateInfoNN;
+};
+#endif
+#if defined(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WAYLAND_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR>
+{
+	using Type = VkWaylandSurfaceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWaylandSurfaceCreateInfoKHR;
+};
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT>
+{
+	using Type = VkSurfaceFullScreenExclusiveInfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSurfaceFullScreenExclusiveInfoEXT;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT>
+{
+	using Type = VkSurfaceCapabilitiesFullScreenExclusiveEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSurfaceCapabilitiesFullScreenExclusiveEXT;
+};
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT>
+{
+	using Type = VkSurfaceFullScreenExclusiveWin32InfoEXT;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSurfaceFullScreenExclusiveWin32InfoEXT;
+};
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkImportFenceWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportFenceWin32HandleInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkExportFenceWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportFenceWin32HandleInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkFenceGetWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkFenceGetWin32HandleInfoKHR;
+};
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkImportMemoryWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportMemoryWin32HandleInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkExportMemoryWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportMemoryWin32HandleInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR>
+{
+	using Type = VkMemoryWin32HandlePropertiesKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryWin32HandlePropertiesKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkMemoryGetWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkMemoryGetWin32HandleInfoKHR;
+};
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkImportSemaphoreWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportSemaphoreWin32HandleInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkExportSemaphoreWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportSemaphoreWin32HandleInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR>
+{
+	using Type = VkD3D12FenceSubmitInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkD3D12FenceSubmitInfoKHR;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR>
+{
+	using Type = VkSemaphoreGetWin32HandleInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkSemaphoreGetWin32HandleInfoKHR;
+};
+#endif
+#if defined(VK_KHR_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR>
+{
+	using Type = VkWin32KeyedMutexAcquireReleaseInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWin32KeyedMutexAcquireReleaseInfoKHR;
+};
+#endif
+#if defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR>
+{
+	using Type = VkWin32SurfaceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWin32SurfaceCreateInfoKHR;
+};
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV>
+{
+	using Type = VkImportMemoryWin32HandleInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkImportMemoryWin32HandleInfoNV;
+};
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV>
+{
+	using Type = VkExportMemoryWin32HandleInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkExportMemoryWin32HandleInfoNV;
+};
+#endif
+#if defined(VK_NV_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV>
+{
+	using Type = VkWin32KeyedMutexAcquireReleaseInfoNV;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkWin32KeyedMutexAcquireReleaseInfoNV;
+};
+#endif
+#if defined(VK_KHR_XCB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XCB_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR>
+{
+	using Type = VkXcbSurfaceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkXcbSurfaceCreateInfoKHR;
+};
+#endif
+#if defined(VK_KHR_XLIB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XLIB_KHR)
+
+template<>
+struct StructureTypeToType<VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR>
+{
+	using Type = VkXlibSurfaceCreateInfoKHR;
+	static constexpr StructureOrdinal Ordinal = StructureOrdinal::VkXlibSurfaceCreateInfoKHR;
+};
+#endif
+
+template<typename Visitor>
+inline constexpr StructureVisitFunction<Visitor> StructureVisitFunctions[] =
+{
+	&VisitStructureAs<VkApplicationInfo, Visitor>,
+	&VisitStructureAs<VkDeviceQueueCreateInfo, Visitor>,
+	&VisitStructureAs<VkDeviceCreateInfo, Visitor>,
+	&VisitStructureAs<VkInstanceCreateInfo, Visitor>,
+	&VisitStructureAs<VkMemoryAllocateInfo, Visitor>,
+	&VisitStructureAs<VkMappedMemoryRange, Visitor>,
+	&VisitStructureAs<VkWriteDescriptorSet, Visitor>,
+	&VisitStructureAs<VkCopyDescriptorSet, Visitor>,
+	&VisitStructureAs<VkBufferCreateInfo, Visitor>,
+	&VisitStructureAs<VkBufferViewCreateInfo, Visitor>,
+	&VisitStructureAs<VkMemoryBarrier, Visitor>,
+	&VisitStructureAs<VkBufferMemoryBarrier, Visitor>,
+	&VisitStructureAs<VkImageMemoryBarrier, Visitor>,
+	&VisitStructureAs<VkImageCreateInfo, Visitor>,
+	&VisitStructureAs<VkImageViewCreateInfo, Visitor>,
+	&VisitStructureAs<VkBindSparseInfo, Visitor>,
+	&VisitStructureAs<VkShaderModuleCreateInfo, Visitor>,
+	&VisitStructureAs<VkDescriptorSetLayoutCreateInfo, Visitor>,
+	&VisitStructureAs<VkDescriptorPoolCreateInfo, Visitor>,
+	&VisitStructureAs<VkDescriptorSetAllocateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineShaderStageCreateInfo, Visitor>,
+	&VisitStructureAs<VkComputePipelineCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineVertexInputStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineInputAssemblyStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineTessellationStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineViewportStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineRasterizationStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineMultisampleStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineColorBlendStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineDynamicStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineDepthStencilStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkGraphicsPipelineCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineCacheCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineLayoutCreateInfo, Visitor>,
+	&VisitStructureAs<VkSamplerCreateInfo, Visitor>,
+	&VisitStructureAs<VkCommandPoolCreateInfo, Visitor>,
+	&VisitStructureAs<VkCommandBufferAllocateInfo, Visitor>,
+	&VisitStructureAs<VkCommandBufferInheritanceInfo, Visitor>,
+	&VisitStructureAs<VkCommandBufferBeginInfo, Visitor>,
+	&VisitStructureAs<VkRenderPassBeginInfo, Visitor>,
+	&VisitStructureAs<VkRenderPassCreateInfo, Visitor>,
+	&VisitStructureAs<VkEventCreateInfo, Visitor>,
+	&VisitStructureAs<VkFenceCreateInfo, Visitor>,
+	&VisitStructureAs<VkSemaphoreCreateInfo, Visitor>,
+	&VisitStructureAs<VkQueryPoolCreateInfo, Visitor>,
+	&VisitStructureAs<VkFramebufferCreateInfo, Visitor>,
+	&VisitStructureAs<VkSubmitInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFeatures2, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceProperties2, Visitor>,
+	&VisitStructureAs<VkFormatProperties2, Visitor>,
+	&VisitStructureAs<VkImageFormatProperties2, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceImageFormatInfo2, Visitor>,
+	&VisitStructureAs<VkQueueFamilyProperties2, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMemoryProperties2, Visitor>,
+	&VisitStructureAs<VkSparseImageFormatProperties2, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSparseImageFormatInfo2, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceDriverProperties, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVariablePointersFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceExternalImageFormatInfo, Visitor>,
+	&VisitStructureAs<VkExternalImageFormatProperties, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceExternalBufferInfo, Visitor>,
+	&VisitStructureAs<VkExternalBufferProperties, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceIDProperties, Visitor>,
+	&VisitStructureAs<VkExternalMemoryImageCreateInfo, Visitor>,
+	&VisitStructureAs<VkExternalMemoryBufferCreateInfo, Visitor>,
+	&VisitStructureAs<VkExportMemoryAllocateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceExternalSemaphoreInfo, Visitor>,
+	&VisitStructureAs<VkExternalSemaphoreProperties, Visitor>,
+	&VisitStructureAs<VkExportSemaphoreCreateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceExternalFenceInfo, Visitor>,
+	&VisitStructureAs<VkExternalFenceProperties, Visitor>,
+	&VisitStructureAs<VkExportFenceCreateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMultiviewFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMultiviewProperties, Visitor>,
+	&VisitStructureAs<VkRenderPassMultiviewCreateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceGroupProperties, Visitor>,
+	&VisitStructureAs<VkMemoryAllocateFlagsInfo, Visitor>,
+	&VisitStructureAs<VkBindBufferMemoryInfo, Visitor>,
+	&VisitStructureAs<VkBindBufferMemoryDeviceGroupInfo, Visitor>,
+	&VisitStructureAs<VkBindImageMemoryInfo, Visitor>,
+	&VisitStructureAs<VkBindImageMemoryDeviceGroupInfo, Visitor>,
+	&VisitStructureAs<VkDeviceGroupRenderPassBeginInfo, Visitor>,
+	&VisitStructureAs<VkDeviceGroupCommandBufferBeginInfo, Visitor>,
+	&VisitStructureAs<VkDeviceGroupSubmitInfo, Visitor>,
+	&VisitStructureAs<VkDeviceGroupBindSparseInfo, Visitor>,
+	&VisitStructureAs<VkDeviceGroupDeviceCreateInfo, Visitor>,
+	&VisitStructureAs<VkDescriptorUpdateTemplateCreateInfo, Visitor>,
+	&VisitStructureAs<VkRenderPassInputAttachmentAspectCreateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDevice16BitStorageFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSubgroupProperties, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures, Visitor>,
+	&VisitStructureAs<VkBufferMemoryRequirementsInfo2, Visitor>,
+	&VisitStructureAs<VkImageMemoryRequirementsInfo2, Visitor>,
+	&VisitStructureAs<VkImageSparseMemoryRequirementsInfo2, Visitor>,
+	&VisitStructureAs<VkMemoryRequirements2, Visitor>,
+	&VisitStructureAs<VkSparseImageMemoryRequirements2, Visitor>,
+	&VisitStructureAs<VkPhysicalDevicePointClippingProperties, Visitor>,
+	&VisitStructureAs<VkMemoryDedicatedRequirements, Visitor>,
+	&VisitStructureAs<VkMemoryDedicatedAllocateInfo, Visitor>,
+	&VisitStructureAs<VkImageViewUsageCreateInfo, Visitor>,
+	&VisitStructureAs<VkPipelineTessellationDomainOriginStateCreateInfo, Visitor>,
+	&VisitStructureAs<VkSamplerYcbcrConversionInfo, Visitor>,
+	&VisitStructureAs<VkSamplerYcbcrConversionCreateInfo, Visitor>,
+	&VisitStructureAs<VkBindImagePlaneMemoryInfo, Visitor>,
+	&VisitStructureAs<VkImagePlaneMemoryRequirementsInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSamplerYcbcrConversionFeatures, Visitor>,
+	&VisitStructureAs<VkSamplerYcbcrConversionImageFormatProperties, Visitor>,
+	&VisitStructureAs<VkProtectedSubmitInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceProtectedMemoryFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceProtectedMemoryProperties, Visitor>,
+	&VisitStructureAs<VkDeviceQueueInfo2, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSamplerFilterMinmaxProperties, Visitor>,
+	&VisitStructureAs<VkSamplerReductionModeCreateInfo, Visitor>,
+	&VisitStructureAs<VkImageFormatListCreateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMaintenance3Properties, Visitor>,
+	&VisitStructureAs<VkDescriptorSetLayoutSupport, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShaderDrawParametersFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShaderFloat16Int8Features, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFloatControlsProperties, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceHostQueryResetFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceDescriptorIndexingFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceDescriptorIndexingProperties, Visitor>,
+	&VisitStructureAs<VkDescriptorSetLayoutBindingFlagsCreateInfo, Visitor>,
+	&VisitStructureAs<VkDescriptorSetVariableDescriptorCountAllocateInfo, Visitor>,
+	&VisitStructureAs<VkDescriptorSetVariableDescriptorCountLayoutSupport, Visitor>,
+	&VisitStructureAs<VkAttachmentDescription2, Visitor>,
+	&VisitStructureAs<VkAttachmentReference2, Visitor>,
+	&VisitStructureAs<VkSubpassDescription2, Visitor>,
+	&VisitStructureAs<VkSubpassDependency2, Visitor>,
+	&VisitStructureAs<VkRenderPassCreateInfo2, Visitor>,
+	&VisitStructureAs<VkSubpassBeginInfo, Visitor>,
+	&VisitStructureAs<VkSubpassEndInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceTimelineSemaphoreFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceTimelineSemaphoreProperties, Visitor>,
+	&VisitStructureAs<VkSemaphoreTypeCreateInfo, Visitor>,
+	&VisitStructureAs<VkTimelineSemaphoreSubmitInfo, Visitor>,
+	&VisitStructureAs<VkSemaphoreWaitInfo, Visitor>,
+	&VisitStructureAs<VkSemaphoreSignalInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDevice8BitStorageFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVulkanMemoryModelFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShaderAtomicInt64Features, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceDepthStencilResolveProperties, Visitor>,
+	&VisitStructureAs<VkSubpassDescriptionDepthStencilResolve, Visitor>,
+	&VisitStructureAs<VkImageStencilUsageCreateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceScalarBlockLayoutFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceUniformBufferStandardLayoutFeatures, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceBufferDeviceAddressFeatures, Visitor>,
+	&VisitStructureAs<VkBufferDeviceAddressInfo, Visitor>,
+	&VisitStructureAs<VkBufferOpaqueCaptureAddressCreateInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceImagelessFramebufferFeatures, Visitor>,
+	&VisitStructureAs<VkFramebufferAttachmentsCreateInfo, Visitor>,
+	&VisitStructureAs<VkFramebufferAttachmentImageInfo, Visitor>,
+	&VisitStructureAs<VkRenderPassAttachmentBeginInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures, Visitor>,
+	&VisitStructureAs<VkAttachmentReferenceStencilLayout, Visitor>,
+	&VisitStructureAs<VkAttachmentDescriptionStencilLayout, Visitor>,
+	&VisitStructureAs<VkMemoryOpaqueCaptureAddressAllocateInfo, Visitor>,
+	&VisitStructureAs<VkDeviceMemoryOpaqueCaptureAddressInfo, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVulkan11Features, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVulkan11Properties, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVulkan12Features, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVulkan12Properties, Visitor>,
+#if defined(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceCoherentMemoryFeaturesAMD, Visitor>,
+#endif
+#if defined(VK_AMD_DISPLAY_NATIVE_HDR_EXTENSION_NAME)
+	&VisitStructureAs<VkDisplayNativeHdrSurfaceCapabilitiesAMD, Visitor>,
+	&VisitStructureAs<VkSwapchainDisplayNativeHdrCreateInfoAMD, Visitor>,
+#endif
+#if defined(VK_AMD_MEMORY_OVERALLOCATION_BEHAVIOR_EXTENSION_NAME)
+	&VisitStructureAs<VkDeviceMemoryOverallocationCreateInfoAMD, Visitor>,
+#endif
+#if defined(VK_AMD_PIPELINE_COMPILER_CONTROL_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineCompilerControlCreateInfoAMD, Visitor>,
+#endif
+#if defined(VK_AMD_RASTERIZATION_ORDER_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineRasterizationStateRasterizationOrderAMD, Visitor>,
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderCoreProperties2AMD, Visitor>,
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderCorePropertiesAMD, Visitor>,
+#endif
+#if defined(VK_AMD_TEXTURE_GATHER_BIAS_LOD_EXTENSION_NAME)
+	&VisitStructureAs<VkTextureLODGatherFormatPropertiesAMD, Visitor>,
+#endif
+#if defined(VK_EXT_4444_FORMATS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevice4444FormatsFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME)
+	&VisitStructureAs<VkImageViewASTCDecodeModeEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceASTCDecodeFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_BLEND_OPERATION_ADVANCED_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineColorBlendAdvancedStateCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_BORDER_COLOR_SWIZZLE_EXTENSION_NAME)
+	&VisitStructureAs<VkSamplerBorderColorComponentMappingCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkBufferDeviceAddressCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+	&VisitStructureAs<VkCalibratedTimestampInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_COLOR_WRITE_ENABLE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceColorWriteEnableFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineColorWriteCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME)
+	&VisitStructureAs<VkConditionalRenderingBeginInfoEXT, Visitor>,
+	&VisitStructureAs<VkCommandBufferInheritanceConditionalRenderingInfoEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceConditionalRenderingFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceConservativeRasterizationPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineRasterizationConservativeStateCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME)
+	&VisitStructureAs<VkSamplerCustomBorderColorCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceCustomBorderColorPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceCustomBorderColorFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DEBUG_MARKER_EXTENSION_NAME)
+	&VisitStructureAs<VkDebugMarkerObjectNameInfoEXT, Visitor>,
+	&VisitStructureAs<VkDebugMarkerObjectTagInfoEXT, Visitor>,
+	&VisitStructureAs<VkDebugMarkerMarkerInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+	&VisitStructureAs<VkDebugReportCallbackCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+	&VisitStructureAs<VkDebugUtilsObjectNameInfoEXT, Visitor>,
+	&VisitStructureAs<VkDebugUtilsObjectTagInfoEXT, Visitor>,
+	&VisitStructureAs<VkDebugUtilsLabelEXT, Visitor>,
+	&VisitStructureAs<VkDebugUtilsMessengerCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkDebugUtilsMessengerCallbackDataEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceDepthClipEnableFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineRasterizationDepthClipStateCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkDeviceDeviceMemoryReportCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkDeviceMemoryReportCallbackDataEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DISCARD_RECTANGLES_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceDiscardRectanglePropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineDiscardRectangleStateCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DISPLAY_CONTROL_EXTENSION_NAME)
+	&VisitStructureAs<VkDisplayPowerInfoEXT, Visitor>,
+	&VisitStructureAs<VkDeviceEventInfoEXT, Visitor>,
+	&VisitStructureAs<VkDisplayEventInfoEXT, Visitor>,
+	&VisitStructureAs<VkSwapchainCounterCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)
+	&VisitStructureAs<VkSurfaceCapabilities2EXT, Visitor>,
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)
+	&VisitStructureAs<VkImportMemoryHostPointerInfoEXT, Visitor>,
+	&VisitStructureAs<VkMemoryHostPointerPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceExternalMemoryHostPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_FILTER_CUBIC_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceImageViewImageFormatInfoEXT, Visitor>,
+	&VisitStructureAs<VkFilterCubicImageViewImageFormatPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_2_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceFragmentDensityMapFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFragmentDensityMapPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkRenderPassFragmentDensityMapCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)
+	&VisitStructureAs<VkDeviceQueueGlobalPriorityCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_QUERY_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceGlobalPriorityQueryFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkQueueFamilyGlobalPriorityPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_HDR_METADATA_EXTENSION_NAME)
+	&VisitStructureAs<VkHdrMetadataEXT, Visitor>,
+#endif
+#if defined(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+	&VisitStructureAs<VkHeadlessSurfaceCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME)
+	&VisitStructureAs<VkDrmFormatModifierPropertiesListEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceImageDrmFormatModifierInfoEXT, Visitor>,
+	&VisitStructureAs<VkImageDrmFormatModifierListCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkImageDrmFormatModifierExplicitCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkImageDrmFormatModifierPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	&VisitStructureAs<VkDrmFormatModifierPropertiesList2EXT, Visitor>,
+#endif
+#if defined(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceImageRobustnessFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_INDEX_TYPE_UINT8_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceIndexTypeUint8FeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceInlineUniformBlockFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceInlineUniformBlockPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkWriteDescriptorSetInlineUniformBlockEXT, Visitor>,
+	&VisitStructureAs<VkDescriptorPoolInlineUniformBlockCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceLineRasterizationFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceLineRasterizationPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineRasterizationLineStateCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceMemoryBudgetPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceMemoryPriorityFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkMemoryPriorityAllocateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_MULTI_DRAW_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceMultiDrawPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMultiDrawFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePCIBusInfoPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceDrmPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineCreationFeedbackCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PRIMITIVE_TOPOLOGY_LIST_RESTART_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PRIVATE_DATA_EXTENSION_NAME)
+	&VisitStructureAs<VkDevicePrivateDataCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkPrivateDataSlotCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDevicePrivateDataFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_PROVOKING_VERTEX_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceProvokingVertexFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceProvokingVertexPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_RGBA10X6_FORMATS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceRobustness2FeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceRobustness2PropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME)
+	&VisitStructureAs<VkSampleLocationsInfoEXT, Visitor>,
+	&VisitStructureAs<VkRenderPassSampleLocationsBeginInfoEXT, Visitor>,
+	&VisitStructureAs<VkPipelineSampleLocationsStateCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSampleLocationsPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkMultisamplePropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_SHADER_IMAGE_ATOMIC_INT64_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceSubgroupSizeControlFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSubgroupSizeControlPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_TEXEL_BUFFER_ALIGNMENT_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_TOOLING_INFO_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceToolPropertiesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceTransformFeedbackFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceTransformFeedbackPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPipelineRasterizationStateStreamCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)
+	&VisitStructureAs<VkValidationCacheCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkShaderModuleValidationCacheCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME)
+	&VisitStructureAs<VkValidationFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME)
+	&VisitStructureAs<VkValidationFlagsEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineVertexInputDivisorStateCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT, Visitor>,
+	&VisitStructureAs<VkVertexInputBindingDescription2EXT, Visitor>,
+	&VisitStructureAs<VkVertexInputAttributeDescription2EXT, Visitor>,
+#endif
+#if defined(VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_EXT_YCBCR_IMAGE_ARRAYS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT, Visitor>,
+#endif
+#if defined(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)
+	&VisitStructureAs<VkPresentTimesInfoGOOGLE, Visitor>,
+#endif
+#if defined(VK_HUAWEI_INVOCATION_MASK_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI, Visitor>,
+#endif
+#if defined(VK_HUAWEI_SUBPASS_SHADING_EXTENSION_NAME)
+	&VisitStructureAs<VkSubpassShadingPipelineCreateInfoHUAWEI, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI, Visitor>,
+#endif
+#if defined(VK_INTEL_PERFORMANCE_QUERY_EXTENSION_NAME)
+	&VisitStructureAs<VkInitializePerformanceApiInfoINTEL, Visitor>,
+	&VisitStructureAs<VkQueryPoolPerformanceQueryCreateInfoINTEL, Visitor>,
+	&VisitStructureAs<VkPerformanceMarkerInfoINTEL, Visitor>,
+	&VisitStructureAs<VkPerformanceStreamMarkerInfoINTEL, Visitor>,
+	&VisitStructureAs<VkPerformanceOverrideInfoINTEL, Visitor>,
+	&VisitStructureAs<VkPerformanceConfigurationAcquireInfoINTEL, Visitor>,
+#endif
+#if defined(VK_INTEL_SHADER_INTEGER_FUNCTIONS_2_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL, Visitor>,
+#endif
+#if defined(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)
+	&VisitStructureAs<VkWriteDescriptorSetAccelerationStructureKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceAccelerationStructureFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceAccelerationStructurePropertiesKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureGeometryTrianglesDataKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureGeometryAabbsDataKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureGeometryInstancesDataKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureGeometryKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureBuildGeometryInfoKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureDeviceAddressInfoKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureVersionInfoKHR, Visitor>,
+	&VisitStructureAs<VkCopyAccelerationStructureInfoKHR, Visitor>,
+	&VisitStructureAs<VkCopyAccelerationStructureToMemoryInfoKHR, Visitor>,
+	&VisitStructureAs<VkCopyMemoryToAccelerationStructureInfoKHR, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureBuildSizesInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME)
+	&VisitStructureAs<VkBufferCopy2KHR, Visitor>,
+	&VisitStructureAs<VkImageCopy2KHR, Visitor>,
+	&VisitStructureAs<VkImageBlit2KHR, Visitor>,
+	&VisitStructureAs<VkBufferImageCopy2KHR, Visitor>,
+	&VisitStructureAs<VkImageResolve2KHR, Visitor>,
+	&VisitStructureAs<VkCopyBufferInfo2KHR, Visitor>,
+	&VisitStructureAs<VkCopyImageInfo2KHR, Visitor>,
+	&VisitStructureAs<VkBlitImageInfo2KHR, Visitor>,
+	&VisitStructureAs<VkCopyBufferToImageInfo2KHR, Visitor>,
+	&VisitStructureAs<VkCopyImageToBufferInfo2KHR, Visitor>,
+	&VisitStructureAs<VkResolveImageInfo2KHR, Visitor>,
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SURFACE_EXTENSION_NAME)
+	&VisitStructureAs<VkDeviceGroupPresentCapabilitiesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	&VisitStructureAs<VkImageSwapchainCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkBindImageMemorySwapchainInfoKHR, Visitor>,
+	&VisitStructureAs<VkAcquireNextImageInfoKHR, Visitor>,
+	&VisitStructureAs<VkDeviceGroupPresentInfoKHR, Visitor>,
+	&VisitStructureAs<VkDeviceGroupSwapchainCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_DISPLAY_EXTENSION_NAME)
+	&VisitStructureAs<VkDisplayModeCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkDisplaySurfaceCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME)
+	&VisitStructureAs<VkDisplayPresentInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME)
+	&VisitStructureAs<VkImportFenceFdInfoKHR, Visitor>,
+	&VisitStructureAs<VkFenceGetFdInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)
+	&VisitStructureAs<VkImportMemoryFdInfoKHR, Visitor>,
+	&VisitStructureAs<VkMemoryFdPropertiesKHR, Visitor>,
+	&VisitStructureAs<VkMemoryGetFdInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME)
+	&VisitStructureAs<VkImportSemaphoreFdInfoKHR, Visitor>,
+	&VisitStructureAs<VkSemaphoreGetFdInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	&VisitStructureAs<VkFormatProperties3KHR, Visitor>,
+#endif
+#if defined(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME)
+	&VisitStructureAs<VkFragmentShadingRateAttachmentInfoKHR, Visitor>,
+	&VisitStructureAs<VkPipelineFragmentShadingRateStateCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFragmentShadingRateFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFragmentShadingRatePropertiesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFragmentShadingRateKHR, Visitor>,
+#endif
+#if defined(VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME)
+	&VisitStructureAs<VkDisplayProperties2KHR, Visitor>,
+	&VisitStructureAs<VkDisplayPlaneProperties2KHR, Visitor>,
+	&VisitStructureAs<VkDisplayModeProperties2KHR, Visitor>,
+	&VisitStructureAs<VkDisplayPlaneInfo2KHR, Visitor>,
+	&VisitStructureAs<VkDisplayPlaneCapabilities2KHR, Visitor>,
+#endif
+#if defined(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceSurfaceInfo2KHR, Visitor>,
+	&VisitStructureAs<VkSurfaceCapabilities2KHR, Visitor>,
+	&VisitStructureAs<VkSurfaceFormat2KHR, Visitor>,
+#endif
+#if defined(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)
+	&VisitStructureAs<VkPresentRegionsKHR, Visitor>,
+#endif
+#if defined(VK_KHR_MAINTENANCE_4_EXTENSION_NAME)
+	&VisitStructureAs<VkDeviceBufferMemoryRequirementsKHR, Visitor>,
+	&VisitStructureAs<VkDeviceImageMemoryRequirementsKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMaintenance4FeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMaintenance4PropertiesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePerformanceQueryFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDevicePerformanceQueryPropertiesKHR, Visitor>,
+	&VisitStructureAs<VkPerformanceCounterKHR, Visitor>,
+	&VisitStructureAs<VkPerformanceCounterDescriptionKHR, Visitor>,
+	&VisitStructureAs<VkQueryPoolPerformanceCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkAcquireProfilingLockInfoKHR, Visitor>,
+	&VisitStructureAs<VkPerformanceQuerySubmitInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPipelineInfoKHR, Visitor>,
+	&VisitStructureAs<VkPipelineExecutablePropertiesKHR, Visitor>,
+	&VisitStructureAs<VkPipelineExecutableInfoKHR, Visitor>,
+	&VisitStructureAs<VkPipelineExecutableStatisticKHR, Visitor>,
+	&VisitStructureAs<VkPipelineExecutableInternalRepresentationKHR, Visitor>,
+#endif
+#if defined(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineLibraryCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_PRESENT_ID_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePresentIdFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPresentIdKHR, Visitor>,
+#endif
+#if defined(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePresentWaitFeaturesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDevicePushDescriptorPropertiesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceRayQueryFeaturesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME)
+	&VisitStructureAs<VkRayTracingShaderGroupCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkRayTracingPipelineCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceRayTracingPipelineFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceRayTracingPipelinePropertiesKHR, Visitor>,
+	&VisitStructureAs<VkRayTracingPipelineInterfaceCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SHADER_CLOCK_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderClockFeaturesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShaderIntegerDotProductPropertiesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SHADER_TERMINATE_INVOCATION_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SHARED_PRESENTABLE_IMAGE_EXTENSION_NAME)
+	&VisitStructureAs<VkSharedPresentSurfaceCapabilitiesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME)
+	&VisitStructureAs<VkSurfaceProtectedCapabilitiesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	&VisitStructureAs<VkSwapchainCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkPresentInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
+	&VisitStructureAs<VkMemoryBarrier2KHR, Visitor>,
+	&VisitStructureAs<VkImageMemoryBarrier2KHR, Visitor>,
+	&VisitStructureAs<VkBufferMemoryBarrier2KHR, Visitor>,
+	&VisitStructureAs<VkDependencyInfoKHR, Visitor>,
+	&VisitStructureAs<VkSemaphoreSubmitInfoKHR, Visitor>,
+	&VisitStructureAs<VkCommandBufferSubmitInfoKHR, Visitor>,
+	&VisitStructureAs<VkSubmitInfo2KHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceSynchronization2FeaturesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) && defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	&VisitStructureAs<VkQueueFamilyCheckpointProperties2NV, Visitor>,
+	&VisitStructureAs<VkCheckpointData2NV, Visitor>,
+#endif
+#if defined(VK_KHR_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_ZERO_INITIALIZE_WORKGROUP_MEMORY_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR, Visitor>,
+#endif
+#if defined(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)
+	&VisitStructureAs<VkCuModuleCreateInfoNVX, Visitor>,
+	&VisitStructureAs<VkCuFunctionCreateInfoNVX, Visitor>,
+	&VisitStructureAs<VkCuLaunchInfoNVX, Visitor>,
+#endif
+#if defined(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)
+	&VisitStructureAs<VkImageViewHandleInfoNVX, Visitor>,
+	&VisitStructureAs<VkImageViewAddressPropertiesNVX, Visitor>,
+#endif
+#if defined(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX, Visitor>,
+#endif
+#if defined(VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineViewportWScalingStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV, Visitor>,
+#endif
+#if defined(VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceCooperativeMatrixFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceCooperativeMatrixPropertiesNV, Visitor>,
+	&VisitStructureAs<VkCooperativeMatrixPropertiesNV, Visitor>,
+#endif
+#if defined(VK_NV_CORNER_SAMPLED_IMAGE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceCornerSampledImageFeaturesNV, Visitor>,
+#endif
+#if defined(VK_NV_COVERAGE_REDUCTION_MODE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceCoverageReductionModeFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPipelineCoverageReductionStateCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkFramebufferMixedSamplesCombinationNV, Visitor>,
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME)
+	&VisitStructureAs<VkDedicatedAllocationImageCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkDedicatedAllocationBufferCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkDedicatedAllocationMemoryAllocateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_IMAGE_ALIASING_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV, Visitor>,
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTICS_CONFIG_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceDiagnosticsConfigFeaturesNV, Visitor>,
+	&VisitStructureAs<VkDeviceDiagnosticsConfigCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	&VisitStructureAs<VkQueueFamilyCheckpointPropertiesNV, Visitor>,
+	&VisitStructureAs<VkCheckpointDataNV, Visitor>,
+#endif
+#if defined(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV, Visitor>,
+	&VisitStructureAs<VkGraphicsShaderGroupCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkGraphicsPipelineShaderGroupsCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkIndirectCommandsLayoutTokenNV, Visitor>,
+	&VisitStructureAs<VkIndirectCommandsLayoutCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkGeneratedCommandsInfoNV, Visitor>,
+	&VisitStructureAs<VkGeneratedCommandsMemoryRequirementsInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_EXTENSION_NAME)
+	&VisitStructureAs<VkExternalMemoryImageCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkExportMemoryAllocateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_RDMA_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV, Visitor>,
+	&VisitStructureAs<VkMemoryGetRemoteAddressInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_FRAGMENT_COVERAGE_TO_COLOR_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineCoverageToColorStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV, Visitor>,
+#endif
+#if defined(VK_NV_FRAGMENT_SHADING_RATE_ENUMS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV, Visitor>,
+	&VisitStructureAs<VkPipelineFragmentShadingRateEnumStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_FRAMEBUFFER_MIXED_SAMPLES_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineCoverageModulationStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_INHERITED_VIEWPORT_SCISSOR_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceInheritedViewportScissorFeaturesNV, Visitor>,
+	&VisitStructureAs<VkCommandBufferInheritanceViewportScissorInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_MESH_SHADER_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceMeshShaderFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceMeshShaderPropertiesNV, Visitor>,
+#endif
+#if defined(VK_NV_RAY_TRACING_EXTENSION_NAME)
+	&VisitStructureAs<VkRayTracingShaderGroupCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkRayTracingPipelineCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkGeometryTrianglesNV, Visitor>,
+	&VisitStructureAs<VkGeometryAABBNV, Visitor>,
+	&VisitStructureAs<VkGeometryNV, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureInfoNV, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkBindAccelerationStructureMemoryInfoNV, Visitor>,
+	&VisitStructureAs<VkWriteDescriptorSetAccelerationStructureNV, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureMemoryRequirementsInfoNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceRayTracingPropertiesNV, Visitor>,
+#endif
+#if defined(VK_NV_RAY_TRACING_MOTION_BLUR_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureGeometryMotionTrianglesDataNV, Visitor>,
+	&VisitStructureAs<VkAccelerationStructureMotionInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_REPRESENTATIVE_FRAGMENT_TEST_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPipelineRepresentativeFragmentTestStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_SCISSOR_EXCLUSIVE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceExclusiveScissorFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPipelineViewportExclusiveScissorStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_SHADER_IMAGE_FOOTPRINT_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderImageFootprintFeaturesNV, Visitor>,
+#endif
+#if defined(VK_NV_SHADER_SM_BUILTINS_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV, Visitor>,
+#endif
+#if defined(VK_NV_SHADING_RATE_IMAGE_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineViewportShadingRateImageStateCreateInfoNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShadingRateImageFeaturesNV, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceShadingRateImagePropertiesNV, Visitor>,
+	&VisitStructureAs<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME)
+	&VisitStructureAs<VkPipelineViewportSwizzleStateCreateInfoNV, Visitor>,
+#endif
+#if defined(VK_QCOM_RENDER_PASS_TRANSFORM_EXTENSION_NAME)
+	&VisitStructureAs<VkRenderPassTransformBeginInfoQCOM, Visitor>,
+	&VisitStructureAs<VkCommandBufferInheritanceRenderPassTransformInfoQCOM, Visitor>,
+#endif
+#if defined(VK_QCOM_ROTATED_COPY_COMMANDS_EXTENSION_NAME)
+	&VisitStructureAs<VkCopyCommandTransformInfoQCOM, Visitor>,
+#endif
+#if defined(VK_VALVE_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)
+	&VisitStructureAs<VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE, Visitor>,
+	&VisitStructureAs<VkMutableDescriptorTypeCreateInfoVALVE, Visitor>,
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkVideoDecodeH264ProfileEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH264CapabilitiesEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH264SessionCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH264SessionParametersAddInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH264SessionParametersCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH264PictureInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH264DpbSlotInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH264MvcEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkVideoDecodeH265ProfileEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH265CapabilitiesEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH265SessionCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH265SessionParametersAddInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH265SessionParametersCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH265PictureInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoDecodeH265DpbSlotInfoEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkVideoEncodeH264CapabilitiesEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264SessionCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264SessionParametersAddInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264SessionParametersCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264DpbSlotInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264VclFrameInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264EmitPictureParametersEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264ProfileEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH264NaluSliceEXT, Visitor>,
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkVideoEncodeH265CapabilitiesEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265SessionCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265SessionParametersAddInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265SessionParametersCreateInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265VclFrameInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265EmitPictureParametersEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265NaluSliceEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265ProfileEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265DpbSlotInfoEXT, Visitor>,
+	&VisitStructureAs<VkVideoEncodeH265ReferenceListsEXT, Visitor>,
+#endif
+#if defined(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkPhysicalDevicePortabilitySubsetFeaturesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDevicePortabilitySubsetPropertiesKHR, Visitor>,
+#endif
+#if defined(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkVideoDecodeInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkVideoEncodeInfoKHR, Visitor>,
+	&VisitStructureAs<VkVideoEncodeRateControlInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	&VisitStructureAs<VkVideoQueueFamilyProperties2KHR, Visitor>,
+	&VisitStructureAs<VkVideoProfilesKHR, Visitor>,
+	&VisitStructureAs<VkPhysicalDeviceVideoFormatInfoKHR, Visitor>,
+	&VisitStructureAs<VkVideoFormatPropertiesKHR, Visitor>,
+	&VisitStructureAs<VkVideoProfileKHR, Visitor>,
+	&VisitStructureAs<VkVideoCapabilitiesKHR, Visitor>,
+	&VisitStructureAs<VkVideoGetMemoryPropertiesKHR, Visitor>,
+	&VisitStructureAs<VkVideoBindMemoryKHR, Visitor>,
+	&VisitStructureAs<VkVideoPictureResourceKHR, Visitor>,
+	&VisitStructureAs<VkVideoReferenceSlotKHR, Visitor>,
+	&VisitStructureAs<VkVideoSessionCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkVideoSessionParametersCreateInfoKHR, Visitor>,
+	&VisitStructureAs<VkVideoSessionParametersUpdateInfoKHR, Visitor>,
+	&VisitStructureAs<VkVideoBeginCodingInfoKHR, Visitor>,
+	&VisitStructureAs<VkVideoEndCodingInfoKHR, Visitor>,
+	&VisitStructureAs<VkVideoCodingControlInfoKHR, Visitor>,
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	&VisitStructureAs<VkImportAndroidHardwareBufferInfoANDROID, Visitor>,
+	&VisitStructureAs<VkAndroidHardwareBufferUsageANDROID, Visitor>,
+	&VisitStructureAs<VkAndroidHardwareBufferPropertiesANDROID, Visitor>,
+	&VisitStructureAs<VkMemoryGetAndroidHardwareBufferInfoANDROID, Visitor>,
+	&VisitStructureAs<VkAndroidHardwareBufferFormatPropertiesANDROID, Visitor>,
+	&VisitStructureAs<VkExternalFormatANDROID, Visitor>,
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	&VisitStructureAs<VkAndroidHardwareBufferFormatProperties2ANDROID, Visitor>,
+#endif
+#if defined(VK_ANDROID_NATIVE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	&VisitStructureAs<VkNativeBufferANDROID, Visitor>,
+	&VisitStructureAs<VkSwapchainImageCreateInfoANDROID, Visitor>,
+	&VisitStructureAs<VkPhysicalDevicePresentationPropertiesANDROID, Visitor>,
+#endif
+#if defined(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	&VisitStructureAs<VkAndroidSurfaceCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+	&VisitStructureAs<VkDirectFBSurfaceCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_FUCHSIA_BUFFER_COLLECTION_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	&VisitStructureAs<VkImportMemoryBufferCollectionFUCHSIA, Visitor>,
+	&VisitStructureAs<VkBufferCollectionImageCreateInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkBufferCollectionBufferCreateInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkBufferCollectionCreateInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkBufferCollectionPropertiesFUCHSIA, Visitor>,
+	&VisitStructureAs<VkBufferConstraintsInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkSysmemColorSpaceFUCHSIA, Visitor>,
+	&VisitStructureAs<VkImageFormatConstraintsInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkImageConstraintsInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkBufferCollectionConstraintsInfoFUCHSIA, Visitor>,
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_MEMORY_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	&VisitStructureAs<VkImportMemoryZirconHandleInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkMemoryZirconHandlePropertiesFUCHSIA, Visitor>,
+	&VisitStructureAs<VkMemoryGetZirconHandleInfoFUCHSIA, Visitor>,
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_SEMAPHORE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	&VisitStructureAs<VkImportSemaphoreZirconHandleInfoFUCHSIA, Visitor>,
+	&VisitStructureAs<VkSemaphoreGetZirconHandleInfoFUCHSIA, Visitor>,
+#endif
+#if defined(VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	&VisitStructureAs<VkImagePipeSurfaceCreateInfoFUCHSIA, Visitor>,
+#endif
+#if defined(VK_GGP_FRAME_TOKEN_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	&VisitStructureAs<VkPresentFrameTokenGGP, Visitor>,
+#endif
+#if defined(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	&VisitStructureAs<VkStreamDescriptorSurfaceCreateInfoGGP, Visitor>,
+#endif
+#if defined(VK_MVK_IOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_IOS_MVK)
+	&VisitStructureAs<VkIOSSurfaceCreateInfoMVK, Visitor>,
+#endif
+#if defined(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_MACOS_MVK)
+	&VisitStructureAs<VkMacOSSurfaceCreateInfoMVK, Visitor>,
+#endif
+#if defined(VK_EXT_METAL_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_METAL_EXT)
+	&VisitStructureAs<VkMetalSurfaceCreateInfoEXT, Visitor>,
+#endif
+#if defined(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_SCREEN_QNX)
+	&VisitStructureAs<VkScreenSurfaceCreateInfoQNX, Visitor>,
+#endif
+#if defined(VK_NN_VI_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_VI_NN)
+	&VisitStructureAs<VkViSurfaceCreateInfoNN, Visitor>,
+#endif
+#if defined(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WAYLAND_KHR)
+	&VisitStructureAs<VkWaylandSurfaceCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkSurfaceFullScreenExclusiveInfoEXT, Visitor>,
+	&VisitStructureAs<VkSurfaceCapabilitiesFullScreenExclusiveEXT, Visitor>,
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkSurfaceFullScreenExclusiveWin32InfoEXT, Visitor>,
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkImportFenceWin32HandleInfoKHR, Visitor>,
+	&VisitStructureAs<VkExportFenceWin32HandleInfoKHR, Visitor>,
+	&VisitStructureAs<VkFenceGetWin32HandleInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkImportMemoryWin32HandleInfoKHR, Visitor>,
+	&VisitStructureAs<VkExportMemoryWin32HandleInfoKHR, Visitor>,
+	&VisitStructureAs<VkMemoryWin32HandlePropertiesKHR, Visitor>,
+	&VisitStructureAs<VkMemoryGetWin32HandleInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkImportSemaphoreWin32HandleInfoKHR, Visitor>,
+	&VisitStructureAs<VkExportSemaphoreWin32HandleInfoKHR, Visitor>,
+	&VisitStructureAs<VkD3D12FenceSubmitInfoKHR, Visitor>,
+	&VisitStructureAs<VkSemaphoreGetWin32HandleInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkWin32KeyedMutexAcquireReleaseInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkWin32SurfaceCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkImportMemoryWin32HandleInfoNV, Visitor>,
+	&VisitStructureAs<VkExportMemoryWin32HandleInfoNV, Visitor>,
+#endif
+#if defined(VK_NV_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	&VisitStructureAs<VkWin32KeyedMutexAcquireReleaseInfoNV, Visitor>,
+#endif
+#if defined(VK_KHR_XCB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XCB_KHR)
+	&VisitStructureAs<VkXcbSurfaceCreateInfoKHR, Visitor>,
+#endif
+#if defined(VK_KHR_XLIB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XLIB_KHR)
+	&VisitStructureAs<VkXlibSurfaceCreateInfoKHR, Visitor>,
+#endif
+};
+
+//Byte range of a single structure member
+struct StructureMemberRange
+{
+	uint32_t Offset;
+	uint32_t Size;
+};
+
+//Returns the byte ranges of all structure members except pNext, or nullptr if the structure layout is unknown
+inline const StructureMemberRange* GetSTypeMemberRanges(VulkanStructureType, size_t* outRangeCount)
+{
+	*outRangeCount = 0;
+	return nullptr;
+}
+
+//Returns true if the structure is only ever filled by the implementation (returnedonly in vk.xml), e.g. VkPhysicalDeviceProperties2
+inline bool IsSTypeReturnedOnly(VulkanStructureType sType)
+{
+	switch(sType)
+	{
+	default:
+		return false;
+	}
+}
+
+//How to deep-copy the data a pointer member points to
+enum class PointerMemberKind: uint32_t
+{
+	Array,		//(Count + CountAdd) / CountDivisor elements of ElementSize bytes, or a single element if CountSize is 0
+	String,		//Null-terminated string
+	StringArray //Count null-terminated strings
+};
+
+struct StructurePointerLayout;
+
+//Pointer member of a structure, along with the member that holds the number of elements
+struct PointerMemberLayout
+{
+	uint32_t					  Offset;
+	uint32_t					  ElementSize;
+	uint32_t					  CountOffset;
+	uint32_t					  CountSize;
+	uint32_t					  CountAdd;
+	uint32_t					  CountDivisor;
+	PointerMemberKind			  Kind;
+	const StructurePointerLayout* ElementLayout;		  //Null if the elements contain no pointers to follow
+	const StructureMemberRange*	  ElementMemberRanges;	  //Members of the elements without sType, null if the elements are not structures or have sType
+	uint32_t					  ElementMemberRangeCount;
+};
+
+//All pointer members of a structure except pNext: the ones that can be deep-copied and the opaque ones (e.g. pUserData or function pointers)
+struct StructurePointerLayout
+{
+	const PointerMemberLayout* Members;
+	uint32_t				   MemberCount;
+	const uint32_t*			   OpaquePointerOffsets; //Not followed, copied as is. Zeroed when loading serialized data
+	uint32_t				   OpaquePointerCount;
+	bool					   HasPNext;
+};
+
+//Returns the pointer members of the structure with the given sType, or nullptr if the structure has none except pNext
+inline const StructurePointerLayout* GetSTypePointerLayout(VulkanStructureType)
+{
+	return nullptr;
+}
+
+constexpr uint32_t FeatureStructureMaxExtensions = 4;
+
+//Structure that extends VkPhysicalDeviceFeatures2, along with what provides it
+struct FeatureStructureInfo
+{
+	VulkanStructureType SType;
+	uint32_t			Size;
+	uint32_t			CoreVersion;									//0 if the structure is not a part of any core version
+	const char*			ExtensionNames[FeatureStructureMaxExtensions];	//Extensions that provide the structure, the unused ones are null
+	const uint32_t*		FeatureMemberOffsets;							//Offsets of the VkBool32 members, including the ones of the nested structures
+	uint32_t			FeatureMemberCount;
+	VulkanStructureType CoreFeaturesSType;								//VkPhysicalDeviceVulkanNNFeatures of the version the structure is promoted to if it has all of its features, SType otherwise
+	const uint32_t*		CoreFeatureMemberIndices;						//Index of each feature member in FeatureMemberOffsets of CoreFeaturesSType, null if there's no such structure
+};
+
+//Every structure that extends VkPhysicalDeviceFeatures2, VkPhysicalDeviceFeatures2 itself is the first
+inline constexpr FeatureStructureInfo FeatureStructureInfos[] =
+{
+	{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, sizeof(VkPhysicalDeviceFeatures2), VK_MAKE_VERSION(1, 1, 0), {"VK_KHR_get_physical_device_properties2"}, nullptr, 0, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, nullptr},
+};
+
+constexpr uint32_t FeatureStructureCount = (uint32_t)(sizeof(FeatureStructureInfos) / sizeof(FeatureStructureInfos[0]));
+
+//Feature member of the structure from FeatureStructureInfos, by its name in a profile, e.g. "VkPhysicalDeviceFeatures.geometryShader"
+struct FeatureMemberNameEntry
+{
+	const char*			Name;		 //Null for an empty slot
+	VulkanStructureType SType;
+	uint32_t			MemberIndex; //Index in FeatureMemberOffsets of the structure
+};
+
+constexpr uint32_t FeatureMemberNameBucketCount = 1;
+constexpr uint32_t FeatureMemberNameSlotCount   = 1;
+
+inline constexpr uint32_t FeatureMemberNameDisplacements[FeatureMemberNameBucketCount] =
+{
+	0,
+};
+
+inline constexpr FeatureMemberNameEntry FeatureMemberNameSlots[FeatureMemberNameSlotCount] =
+{
+	{},
+};
+
+constexpr uint32_t ExtensionCount   = 0;
+constexpr uint32_t NoExtensionIndex = 0xffffffff;
+
+//Names of all the extensions in vk.xml that are not disabled, sorted, followed by nullptr
+inline constexpr const char* ExtensionNames[ExtensionCount + 1] =
+{
+	nullptr
+};
+
+constexpr uint32_t ExtensionNameBucketCount = 1;
+constexpr uint32_t ExtensionNameSlotCount   = 1;
+
+inline constexpr uint32_t ExtensionNameDisplacements[ExtensionNameBucketCount] =
+{
+	0,
+};
+
+//Extension index of each slot of the perfect hash table, NoExtensionIndex for an empty slot
+inline constexpr uint32_t ExtensionNameSlots[ExtensionNameSlotCount] =
+{
+	NoExtensionIndex,
+};
+
+//Core version and extensions that provide a structure. It can be used if apiVersion >= CoreVersion (when CoreVersion is not 0) or any of the extensions is enabled
+struct StructureRequirement
+{
+	uint32_t CoreVersion;
+	uint32_t FirstProviderExtension; //Index in StructureProviderExtensions
+	uint32_t ProviderExtensionCount;
+};
+
+//Extension indices of the extensions that provide each structure, in ranges pointed to by StructureRequirements
+inline constexpr uint32_t StructureProviderExtensions[] =
+{
+	NoExtensionIndex
+};
+
+//Requirements of each structure indexed by StructureOrdinal, followed by an empty entry so the table is never empty
+inline constexpr StructureRequirement StructureRequirements[StructureOrdinalCount + 1] =
+{
+	{0, 0, 0}, //VkApplicationInfo
+	{0, 0, 0}, //VkDeviceQueueCreateInfo
+	{0, 0, 0}, //VkDeviceCreateInfo
+	{0, 0, 0}, //VkInstanceCreateInfo
+	{0, 0, 0}, //VkMemoryAllocateInfo
+	{0, 0, 0}, //VkMappedMemoryRange
+	{0, 0, 0}, //VkWriteDescriptorSet
+	{0, 0, 0}, //VkCopyDescriptorSet
+	{0, 0, 0}, //VkBufferCreateInfo
+	{0, 0, 0}, //VkBufferViewCreateInfo
+	{0, 0, 0}, //VkMemoryBarrier
+	{0, 0, 0}, //VkBufferMemoryBarrier
+	{0, 0, 0}, //VkImageMemoryBarrier
+	{0, 0, 0}, //VkImageCreateInfo
+	{0, 0, 0}, //VkImageViewCreateInfo
+	{0, 0, 0}, //VkBindSparseInfo
+	{0, 0, 0}, //VkShaderModuleCreateInfo
+	{0, 0, 0}, //VkDescriptorSetLayoutCreateInfo
+	{0, 0, 0}, //VkDescriptorPoolCreateInfo
+	{0, 0, 0}, //VkDescriptorSetAllocateInfo
+	{0, 0, 0}, //VkPipelineShaderStageCreateInfo
+	{0, 0, 0}, //VkComputePipelineCreateInfo
+	{0, 0, 0}, //VkPipelineVertexInputStateCreateInfo
+	{0, 0, 0}, //VkPipelineInputAssemblyStateCreateInfo
+	{0, 0, 0}, //VkPipelineTessellationStateCreateInfo
+	{0, 0, 0}, //VkPipelineViewportStateCreateInfo
+	{0, 0, 0}, //VkPipelineRasterizationStateCreateInfo
+	{0, 0, 0}, //VkPipelineMultisampleStateCreateInfo
+	{0, 0, 0}, //VkPipelineColorBlendStateCreateInfo
+	{0, 0, 0}, //VkPipelineDynamicStateCreateInfo
+	{0, 0, 0}, //VkPipelineDepthStencilStateCreateInfo
+	{0, 0, 0}, //VkGraphicsPipelineCreateInfo
+	{0, 0, 0}, //VkPipelineCacheCreateInfo
+	{0, 0, 0}, //VkPipelineLayoutCreateInfo
+	{0, 0, 0}, //VkSamplerCreateInfo
+	{0, 0, 0}, //VkCommandPoolCreateInfo
+	{0, 0, 0}, //VkCommandBufferAllocateInfo
+	{0, 0, 0}, //VkCommandBufferInheritanceInfo
+	{0, 0, 0}, //VkCommandBufferBeginInfo
+	{0, 0, 0}, //VkRenderPassBeginInfo
+	{0, 0, 0}, //VkRenderPassCreateInfo
+	{0, 0, 0}, //VkEventCreateInfo
+	{0, 0, 0}, //VkFenceCreateInfo
+	{0, 0, 0}, //VkSemaphoreCreateInfo
+	{0, 0, 0}, //VkQueryPoolCreateInfo
+	{0, 0, 0}, //VkFramebufferCreateInfo
+	{0, 0, 0}, //VkSubmitInfo
+	{0, 0, 0}, //VkPhysicalDeviceFeatures2
+	{0, 0, 0}, //VkPhysicalDeviceProperties2
+	{0, 0, 0}, //VkFormatProperties2
+	{0, 0, 0}, //VkImageFormatProperties2
+	{0, 0, 0}, //VkPhysicalDeviceImageFormatInfo2
+	{0, 0, 0}, //VkQueueFamilyProperties2
+	{0, 0, 0}, //VkPhysicalDeviceMemoryProperties2
+	{0, 0, 0}, //VkSparseImageFormatProperties2
+	{0, 0, 0}, //VkPhysicalDeviceSparseImageFormatInfo2
+	{0, 0, 0}, //VkPhysicalDeviceDriverProperties
+	{0, 0, 0}, //VkPhysicalDeviceVariablePointersFeatures
+	{0, 0, 0}, //VkPhysicalDeviceExternalImageFormatInfo
+	{0, 0, 0}, //VkExternalImageFormatProperties
+	{0, 0, 0}, //VkPhysicalDeviceExternalBufferInfo
+	{0, 0, 0}, //VkExternalBufferProperties
+	{0, 0, 0}, //VkPhysicalDeviceIDProperties
+	{0, 0, 0}, //VkExternalMemoryImageCreateInfo
+	{0, 0, 0}, //VkExternalMemoryBufferCreateInfo
+	{0, 0, 0}, //VkExportMemoryAllocateInfo
+	{0, 0, 0}, //VkPhysicalDeviceExternalSemaphoreInfo
+	{0, 0, 0}, //VkExternalSemaphoreProperties
+	{0, 0, 0}, //VkExportSemaphoreCreateInfo
+	{0, 0, 0}, //VkPhysicalDeviceExternalFenceInfo
+	{0, 0, 0}, //VkExternalFenceProperties
+	{0, 0, 0}, //VkExportFenceCreateInfo
+	{0, 0, 0}, //VkPhysicalDeviceMultiviewFeatures
+	{0, 0, 0}, //VkPhysicalDeviceMultiviewProperties
+	{0, 0, 0}, //VkRenderPassMultiviewCreateInfo
+	{0, 0, 0}, //VkPhysicalDeviceGroupProperties
+	{0, 0, 0}, //VkMemoryAllocateFlagsInfo
+	{0, 0, 0}, //VkBindBufferMemoryInfo
+	{0, 0, 0}, //VkBindBufferMemoryDeviceGroupInfo
+	{0, 0, 0}, //VkBindImageMemoryInfo
+	{0, 0, 0}, //VkBindImageMemoryDeviceGroupInfo
+	{0, 0, 0}, //VkDeviceGroupRenderPassBeginInfo
+	{0, 0, 0}, //VkDeviceGroupCommandBufferBeginInfo
+	{0, 0, 0}, //VkDeviceGroupSubmitInfo
+	{0, 0, 0}, //VkDeviceGroupBindSparseInfo
+	{0, 0, 0}, //VkDeviceGroupDeviceCreateInfo
+	{0, 0, 0}, //VkDescriptorUpdateTemplateCreateInfo
+	{0, 0, 0}, //VkRenderPassInputAttachmentAspectCreateInfo
+	{0, 0, 0}, //VkPhysicalDevice16BitStorageFeatures
+	{0, 0, 0}, //VkPhysicalDeviceSubgroupProperties
+	{0, 0, 0}, //VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures
+	{0, 0, 0}, //VkBufferMemoryRequirementsInfo2
+	{0, 0, 0}, //VkImageMemoryRequirementsInfo2
+	{0, 0, 0}, //VkImageSparseMemoryRequirementsInfo2
+	{0, 0, 0}, //VkMemoryRequirements2
+	{0, 0, 0}, //VkSparseImageMemoryRequirements2
+	{0, 0, 0}, //VkPhysicalDevicePointClippingProperties
+	{0, 0, 0}, //VkMemoryDedicatedRequirements
+	{0, 0, 0}, //VkMemoryDedicatedAllocateInfo
+	{0, 0, 0}, //VkImageViewUsageCreateInfo
+	{0, 0, 0}, //VkPipelineTessellationDomainOriginStateCreateInfo
+	{0, 0, 0}, //VkSamplerYcbcrConversionInfo
+	{0, 0, 0}, //VkSamplerYcbcrConversionCreateInfo
+	{0, 0, 0}, //VkBindImagePlaneMemoryInfo
+	{0, 0, 0}, //VkImagePlaneMemoryRequirementsInfo
+	{0, 0, 0}, //VkPhysicalDeviceSamplerYcbcrConversionFeatures
+	{0, 0, 0}, //VkSamplerYcbcrConversionImageFormatProperties
+	{0, 0, 0}, //VkProtectedSubmitInfo
+	{0, 0, 0}, //VkPhysicalDeviceProtectedMemoryFeatures
+	{0, 0, 0}, //VkPhysicalDeviceProtectedMemoryProperties
+	{0, 0, 0}, //VkDeviceQueueInfo2
+	{0, 0, 0}, //VkPhysicalDeviceSamplerFilterMinmaxProperties
+	{0, 0, 0}, //VkSamplerReductionModeCreateInfo
+	{0, 0, 0}, //VkImageFormatListCreateInfo
+	{0, 0, 0}, //VkPhysicalDeviceMaintenance3Properties
+	{0, 0, 0}, //VkDescriptorSetLayoutSupport
+	{0, 0, 0}, //VkPhysicalDeviceShaderDrawParametersFeatures
+	{0, 0, 0}, //VkPhysicalDeviceShaderFloat16Int8Features
+	{0, 0, 0}, //VkPhysicalDeviceFloatControlsProperties
+	{0, 0, 0}, //VkPhysicalDeviceHostQueryResetFeatures
+	{0, 0, 0}, //VkPhysicalDeviceDescriptorIndexingFeatures
+	{0, 0, 0}, //VkPhysicalDeviceDescriptorIndexingProperties
+	{0, 0, 0}, //VkDescriptorSetLayoutBindingFlagsCreateInfo
+	{0, 0, 0}, //VkDescriptorSetVariableDescriptorCountAllocateInfo
+	{0, 0, 0}, //VkDescriptorSetVariableDescriptorCountLayoutSupport
+	{0, 0, 0}, //VkAttachmentDescription2
+	{0, 0, 0}, //VkAttachmentReference2
+	{0, 0, 0}, //VkSubpassDescription2
+	{0, 0, 0}, //VkSubpassDependency2
+	{0, 0, 0}, //VkRenderPassCreateInfo2
+	{0, 0, 0}, //VkSubpassBeginInfo
+	{0, 0, 0}, //VkSubpassEndInfo
+	{0, 0, 0}, //VkPhysicalDeviceTimelineSemaphoreFeatures
+	{0, 0, 0}, //VkPhysicalDeviceTimelineSemaphoreProperties
+	{0, 0, 0}, //VkSemaphoreTypeCreateInfo
+	{0, 0, 0}, //VkTimelineSemaphoreSubmitInfo
+	{0, 0, 0}, //VkSemaphoreWaitInfo
+	{0, 0, 0}, //VkSemaphoreSignalInfo
+	{0, 0, 0}, //VkPhysicalDevice8BitStorageFeatures
+	{0, 0, 0}, //VkPhysicalDeviceVulkanMemoryModelFeatures
+	{0, 0, 0}, //VkPhysicalDeviceShaderAtomicInt64Features
+	{0, 0, 0}, //VkPhysicalDeviceDepthStencilResolveProperties
+	{0, 0, 0}, //VkSubpassDescriptionDepthStencilResolve
+	{0, 0, 0}, //VkImageStencilUsageCreateInfo
+	{0, 0, 0}, //VkPhysicalDeviceScalarBlockLayoutFeatures
+	{0, 0, 0}, //VkPhysicalDeviceUniformBufferStandardLayoutFeatures
+	{0, 0, 0}, //VkPhysicalDeviceBufferDeviceAddressFeatures
+	{0, 0, 0}, //VkBufferDeviceAddressInfo
+	{0, 0, 0}, //VkBufferOpaqueCaptureAddressCreateInfo
+	{0, 0, 0}, //VkPhysicalDeviceImagelessFramebufferFeatures
+	{0, 0, 0}, //VkFramebufferAttachmentsCreateInfo
+	{0, 0, 0}, //VkFramebufferAttachmentImageInfo
+	{0, 0, 0}, //VkRenderPassAttachmentBeginInfo
+	{0, 0, 0}, //VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures
+	{0, 0, 0}, //VkAttachmentReferenceStencilLayout
+	{0, 0, 0}, //VkAttachmentDescriptionStencilLayout
+	{0, 0, 0}, //VkMemoryOpaqueCaptureAddressAllocateInfo
+	{0, 0, 0}, //VkDeviceMemoryOpaqueCaptureAddressInfo
+	{0, 0, 0}, //VkPhysicalDeviceVulkan11Features
+	{0, 0, 0}, //VkPhysicalDeviceVulkan11Properties
+	{0, 0, 0}, //VkPhysicalDeviceVulkan12Features
+	{0, 0, 0}, //VkPhysicalDeviceVulkan12Properties
+#if defined(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceCoherentMemoryFeaturesAMD
+#endif
+#if defined(VK_AMD_DISPLAY_NATIVE_HDR_EXTENSION_NAME)
+	{0, 0, 0}, //VkDisplayNativeHdrSurfaceCapabilitiesAMD
+	{0, 0, 0}, //VkSwapchainDisplayNativeHdrCreateInfoAMD
+#endif
+#if defined(VK_AMD_MEMORY_OVERALLOCATION_BEHAVIOR_EXTENSION_NAME)
+	{0, 0, 0}, //VkDeviceMemoryOverallocationCreateInfoAMD
+#endif
+#if defined(VK_AMD_PIPELINE_COMPILER_CONTROL_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineCompilerControlCreateInfoAMD
+#endif
+#if defined(VK_AMD_RASTERIZATION_ORDER_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineRasterizationStateRasterizationOrderAMD
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderCoreProperties2AMD
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderCorePropertiesAMD
+#endif
+#if defined(VK_AMD_TEXTURE_GATHER_BIAS_LOD_EXTENSION_NAME)
+	{0, 0, 0}, //VkTextureLODGatherFormatPropertiesAMD
+#endif
+#if defined(VK_EXT_4444_FORMATS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevice4444FormatsFeaturesEXT
+#endif
+#if defined(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME)
+	{0, 0, 0}, //VkImageViewASTCDecodeModeEXT
+	{0, 0, 0}, //VkPhysicalDeviceASTCDecodeFeaturesEXT
+#endif
+#if defined(VK_EXT_BLEND_OPERATION_ADVANCED_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT
+	{0, 0, 0}, //VkPipelineColorBlendAdvancedStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_BORDER_COLOR_SWIZZLE_EXTENSION_NAME)
+	{0, 0, 0}, //VkSamplerBorderColorComponentMappingCreateInfoEXT
+	{0, 0, 0}, //VkPhysicalDeviceBorderColorSwizzleFeaturesEXT
+#endif
+#if defined(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceBufferDeviceAddressFeaturesEXT
+	{0, 0, 0}, //VkBufferDeviceAddressCreateInfoEXT
+#endif
+#if defined(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+	{0, 0, 0}, //VkCalibratedTimestampInfoEXT
+#endif
+#if defined(VK_EXT_COLOR_WRITE_ENABLE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceColorWriteEnableFeaturesEXT
+	{0, 0, 0}, //VkPipelineColorWriteCreateInfoEXT
+#endif
+#if defined(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME)
+	{0, 0, 0}, //VkConditionalRenderingBeginInfoEXT
+	{0, 0, 0}, //VkCommandBufferInheritanceConditionalRenderingInfoEXT
+	{0, 0, 0}, //VkPhysicalDeviceConditionalRenderingFeaturesEXT
+#endif
+#if defined(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceConservativeRasterizationPropertiesEXT
+	{0, 0, 0}, //VkPipelineRasterizationConservativeStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME)
+	{0, 0, 0}, //VkSamplerCustomBorderColorCreateInfoEXT
+	{0, 0, 0}, //VkPhysicalDeviceCustomBorderColorPropertiesEXT
+	{0, 0, 0}, //VkPhysicalDeviceCustomBorderColorFeaturesEXT
+#endif
+#if defined(VK_EXT_DEBUG_MARKER_EXTENSION_NAME)
+	{0, 0, 0}, //VkDebugMarkerObjectNameInfoEXT
+	{0, 0, 0}, //VkDebugMarkerObjectTagInfoEXT
+	{0, 0, 0}, //VkDebugMarkerMarkerInfoEXT
+#endif
+#if defined(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+	{0, 0, 0}, //VkDebugReportCallbackCreateInfoEXT
+#endif
+#if defined(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+	{0, 0, 0}, //VkDebugUtilsObjectNameInfoEXT
+	{0, 0, 0}, //VkDebugUtilsObjectTagInfoEXT
+	{0, 0, 0}, //VkDebugUtilsLabelEXT
+	{0, 0, 0}, //VkDebugUtilsMessengerCreateInfoEXT
+	{0, 0, 0}, //VkDebugUtilsMessengerCallbackDataEXT
+#endif
+#if defined(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceDepthClipEnableFeaturesEXT
+	{0, 0, 0}, //VkPipelineRasterizationDepthClipStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceDeviceMemoryReportFeaturesEXT
+	{0, 0, 0}, //VkDeviceDeviceMemoryReportCreateInfoEXT
+	{0, 0, 0}, //VkDeviceMemoryReportCallbackDataEXT
+#endif
+#if defined(VK_EXT_DISCARD_RECTANGLES_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceDiscardRectanglePropertiesEXT
+	{0, 0, 0}, //VkPipelineDiscardRectangleStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_DISPLAY_CONTROL_EXTENSION_NAME)
+	{0, 0, 0}, //VkDisplayPowerInfoEXT
+	{0, 0, 0}, //VkDeviceEventInfoEXT
+	{0, 0, 0}, //VkDisplayEventInfoEXT
+	{0, 0, 0}, //VkSwapchainCounterCreateInfoEXT
+#endif
+#if defined(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)
+	{0, 0, 0}, //VkSurfaceCapabilities2EXT
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceExtendedDynamicState2FeaturesEXT
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceExtendedDynamicStateFeaturesEXT
+#endif
+#if defined(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)
+	{0, 0, 0}, //VkImportMemoryHostPointerInfoEXT
+	{0, 0, 0}, //VkMemoryHostPointerPropertiesEXT
+	{0, 0, 0}, //VkPhysicalDeviceExternalMemoryHostPropertiesEXT
+#endif
+#if defined(VK_EXT_FILTER_CUBIC_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceImageViewImageFormatInfoEXT
+	{0, 0, 0}, //VkFilterCubicImageViewImageFormatPropertiesEXT
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceFragmentDensityMap2FeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceFragmentDensityMap2PropertiesEXT
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceFragmentDensityMapFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceFragmentDensityMapPropertiesEXT
+	{0, 0, 0}, //VkRenderPassFragmentDensityMapCreateInfoEXT
+#endif
+#if defined(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)
+	{0, 0, 0}, //VkDeviceQueueGlobalPriorityCreateInfoEXT
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_QUERY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceGlobalPriorityQueryFeaturesEXT
+	{0, 0, 0}, //VkQueueFamilyGlobalPriorityPropertiesEXT
+#endif
+#if defined(VK_EXT_HDR_METADATA_EXTENSION_NAME)
+	{0, 0, 0}, //VkHdrMetadataEXT
+#endif
+#if defined(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+	{0, 0, 0}, //VkHeadlessSurfaceCreateInfoEXT
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME)
+	{0, 0, 0}, //VkDrmFormatModifierPropertiesListEXT
+	{0, 0, 0}, //VkPhysicalDeviceImageDrmFormatModifierInfoEXT
+	{0, 0, 0}, //VkImageDrmFormatModifierListCreateInfoEXT
+	{0, 0, 0}, //VkImageDrmFormatModifierExplicitCreateInfoEXT
+	{0, 0, 0}, //VkImageDrmFormatModifierPropertiesEXT
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkDrmFormatModifierPropertiesList2EXT
+#endif
+#if defined(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceImageRobustnessFeaturesEXT
+#endif
+#if defined(VK_EXT_INDEX_TYPE_UINT8_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceIndexTypeUint8FeaturesEXT
+#endif
+#if defined(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceInlineUniformBlockFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceInlineUniformBlockPropertiesEXT
+	{0, 0, 0}, //VkWriteDescriptorSetInlineUniformBlockEXT
+	{0, 0, 0}, //VkDescriptorPoolInlineUniformBlockCreateInfoEXT
+#endif
+#if defined(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceLineRasterizationFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceLineRasterizationPropertiesEXT
+	{0, 0, 0}, //VkPipelineRasterizationLineStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceMemoryBudgetPropertiesEXT
+#endif
+#if defined(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceMemoryPriorityFeaturesEXT
+	{0, 0, 0}, //VkMemoryPriorityAllocateInfoEXT
+#endif
+#if defined(VK_EXT_MULTI_DRAW_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceMultiDrawPropertiesEXT
+	{0, 0, 0}, //VkPhysicalDeviceMultiDrawFeaturesEXT
+#endif
+#if defined(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT
+#endif
+#if defined(VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePCIBusInfoPropertiesEXT
+#endif
+#if defined(VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceDrmPropertiesEXT
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineCreationFeedbackCreateInfoEXT
+#endif
+#if defined(VK_EXT_PRIMITIVE_TOPOLOGY_LIST_RESTART_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT
+#endif
+#if defined(VK_EXT_PRIVATE_DATA_EXTENSION_NAME)
+	{0, 0, 0}, //VkDevicePrivateDataCreateInfoEXT
+	{0, 0, 0}, //VkPrivateDataSlotCreateInfoEXT
+	{0, 0, 0}, //VkPhysicalDevicePrivateDataFeaturesEXT
+#endif
+#if defined(VK_EXT_PROVOKING_VERTEX_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceProvokingVertexFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceProvokingVertexPropertiesEXT
+	{0, 0, 0}, //VkPipelineRasterizationProvokingVertexStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_RGBA10X6_FORMATS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT
+#endif
+#if defined(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceRobustness2FeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceRobustness2PropertiesEXT
+#endif
+#if defined(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME)
+	{0, 0, 0}, //VkSampleLocationsInfoEXT
+	{0, 0, 0}, //VkRenderPassSampleLocationsBeginInfoEXT
+	{0, 0, 0}, //VkPipelineSampleLocationsStateCreateInfoEXT
+	{0, 0, 0}, //VkPhysicalDeviceSampleLocationsPropertiesEXT
+	{0, 0, 0}, //VkMultisamplePropertiesEXT
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderAtomicFloatFeaturesEXT
+#endif
+#if defined(VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT
+#endif
+#if defined(VK_EXT_SHADER_IMAGE_ATOMIC_INT64_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT
+#endif
+#if defined(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceSubgroupSizeControlFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceSubgroupSizeControlPropertiesEXT
+	{0, 0, 0}, //VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT
+#endif
+#if defined(VK_EXT_TEXEL_BUFFER_ALIGNMENT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT
+#endif
+#if defined(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT
+#endif
+#if defined(VK_EXT_TOOLING_INFO_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceToolPropertiesEXT
+#endif
+#if defined(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceTransformFeedbackFeaturesEXT
+	{0, 0, 0}, //VkPhysicalDeviceTransformFeedbackPropertiesEXT
+	{0, 0, 0}, //VkPipelineRasterizationStateStreamCreateInfoEXT
+#endif
+#if defined(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)
+	{0, 0, 0}, //VkValidationCacheCreateInfoEXT
+	{0, 0, 0}, //VkShaderModuleValidationCacheCreateInfoEXT
+#endif
+#if defined(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME)
+	{0, 0, 0}, //VkValidationFeaturesEXT
+#endif
+#if defined(VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME)
+	{0, 0, 0}, //VkValidationFlagsEXT
+#endif
+#if defined(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineVertexInputDivisorStateCreateInfoEXT
+	{0, 0, 0}, //VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT
+	{0, 0, 0}, //VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT
+#endif
+#if defined(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT
+	{0, 0, 0}, //VkVertexInputBindingDescription2EXT
+	{0, 0, 0}, //VkVertexInputAttributeDescription2EXT
+#endif
+#if defined(VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT
+#endif
+#if defined(VK_EXT_YCBCR_IMAGE_ARRAYS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceYcbcrImageArraysFeaturesEXT
+#endif
+#if defined(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)
+	{0, 0, 0}, //VkPresentTimesInfoGOOGLE
+#endif
+#if defined(VK_HUAWEI_INVOCATION_MASK_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceInvocationMaskFeaturesHUAWEI
+#endif
+#if defined(VK_HUAWEI_SUBPASS_SHADING_EXTENSION_NAME)
+	{0, 0, 0}, //VkSubpassShadingPipelineCreateInfoHUAWEI
+	{0, 0, 0}, //VkPhysicalDeviceSubpassShadingPropertiesHUAWEI
+	{0, 0, 0}, //VkPhysicalDeviceSubpassShadingFeaturesHUAWEI
+#endif
+#if defined(VK_INTEL_PERFORMANCE_QUERY_EXTENSION_NAME)
+	{0, 0, 0}, //VkInitializePerformanceApiInfoINTEL
+	{0, 0, 0}, //VkQueryPoolPerformanceQueryCreateInfoINTEL
+	{0, 0, 0}, //VkPerformanceMarkerInfoINTEL
+	{0, 0, 0}, //VkPerformanceStreamMarkerInfoINTEL
+	{0, 0, 0}, //VkPerformanceOverrideInfoINTEL
+	{0, 0, 0}, //VkPerformanceConfigurationAcquireInfoINTEL
+#endif
+#if defined(VK_INTEL_SHADER_INTEGER_FUNCTIONS_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL
+#endif
+#if defined(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)
+	{0, 0, 0}, //VkWriteDescriptorSetAccelerationStructureKHR
+	{0, 0, 0}, //VkPhysicalDeviceAccelerationStructureFeaturesKHR
+	{0, 0, 0}, //VkPhysicalDeviceAccelerationStructurePropertiesKHR
+	{0, 0, 0}, //VkAccelerationStructureGeometryTrianglesDataKHR
+	{0, 0, 0}, //VkAccelerationStructureGeometryAabbsDataKHR
+	{0, 0, 0}, //VkAccelerationStructureGeometryInstancesDataKHR
+	{0, 0, 0}, //VkAccelerationStructureGeometryKHR
+	{0, 0, 0}, //VkAccelerationStructureBuildGeometryInfoKHR
+	{0, 0, 0}, //VkAccelerationStructureCreateInfoKHR
+	{0, 0, 0}, //VkAccelerationStructureDeviceAddressInfoKHR
+	{0, 0, 0}, //VkAccelerationStructureVersionInfoKHR
+	{0, 0, 0}, //VkCopyAccelerationStructureInfoKHR
+	{0, 0, 0}, //VkCopyAccelerationStructureToMemoryInfoKHR
+	{0, 0, 0}, //VkCopyMemoryToAccelerationStructureInfoKHR
+	{0, 0, 0}, //VkAccelerationStructureBuildSizesInfoKHR
+#endif
+#if defined(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkBufferCopy2KHR
+	{0, 0, 0}, //VkImageCopy2KHR
+	{0, 0, 0}, //VkImageBlit2KHR
+	{0, 0, 0}, //VkBufferImageCopy2KHR
+	{0, 0, 0}, //VkImageResolve2KHR
+	{0, 0, 0}, //VkCopyBufferInfo2KHR
+	{0, 0, 0}, //VkCopyImageInfo2KHR
+	{0, 0, 0}, //VkBlitImageInfo2KHR
+	{0, 0, 0}, //VkCopyBufferToImageInfo2KHR
+	{0, 0, 0}, //VkCopyImageToBufferInfo2KHR
+	{0, 0, 0}, //VkResolveImageInfo2KHR
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SURFACE_EXTENSION_NAME)
+	{0, 0, 0}, //VkDeviceGroupPresentCapabilitiesKHR
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	{0, 0, 0}, //VkImageSwapchainCreateInfoKHR
+	{0, 0, 0}, //VkBindImageMemorySwapchainInfoKHR
+	{0, 0, 0}, //VkAcquireNextImageInfoKHR
+	{0, 0, 0}, //VkDeviceGroupPresentInfoKHR
+	{0, 0, 0}, //VkDeviceGroupSwapchainCreateInfoKHR
+#endif
+#if defined(VK_KHR_DISPLAY_EXTENSION_NAME)
+	{0, 0, 0}, //VkDisplayModeCreateInfoKHR
+	{0, 0, 0}, //VkDisplaySurfaceCreateInfoKHR
+#endif
+#if defined(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME)
+	{0, 0, 0}, //VkDisplayPresentInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME)
+	{0, 0, 0}, //VkImportFenceFdInfoKHR
+	{0, 0, 0}, //VkFenceGetFdInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)
+	{0, 0, 0}, //VkImportMemoryFdInfoKHR
+	{0, 0, 0}, //VkMemoryFdPropertiesKHR
+	{0, 0, 0}, //VkMemoryGetFdInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME)
+	{0, 0, 0}, //VkImportSemaphoreFdInfoKHR
+	{0, 0, 0}, //VkSemaphoreGetFdInfoKHR
+#endif
+#if defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkFormatProperties3KHR
+#endif
+#if defined(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME)
+	{0, 0, 0}, //VkFragmentShadingRateAttachmentInfoKHR
+	{0, 0, 0}, //VkPipelineFragmentShadingRateStateCreateInfoKHR
+	{0, 0, 0}, //VkPhysicalDeviceFragmentShadingRateFeaturesKHR
+	{0, 0, 0}, //VkPhysicalDeviceFragmentShadingRatePropertiesKHR
+	{0, 0, 0}, //VkPhysicalDeviceFragmentShadingRateKHR
+#endif
+#if defined(VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkDisplayProperties2KHR
+	{0, 0, 0}, //VkDisplayPlaneProperties2KHR
+	{0, 0, 0}, //VkDisplayModeProperties2KHR
+	{0, 0, 0}, //VkDisplayPlaneInfo2KHR
+	{0, 0, 0}, //VkDisplayPlaneCapabilities2KHR
+#endif
+#if defined(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceSurfaceInfo2KHR
+	{0, 0, 0}, //VkSurfaceCapabilities2KHR
+	{0, 0, 0}, //VkSurfaceFormat2KHR
+#endif
+#if defined(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPresentRegionsKHR
+#endif
+#if defined(VK_KHR_MAINTENANCE_4_EXTENSION_NAME)
+	{0, 0, 0}, //VkDeviceBufferMemoryRequirementsKHR
+	{0, 0, 0}, //VkDeviceImageMemoryRequirementsKHR
+	{0, 0, 0}, //VkPhysicalDeviceMaintenance4FeaturesKHR
+	{0, 0, 0}, //VkPhysicalDeviceMaintenance4PropertiesKHR
+#endif
+#if defined(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePerformanceQueryFeaturesKHR
+	{0, 0, 0}, //VkPhysicalDevicePerformanceQueryPropertiesKHR
+	{0, 0, 0}, //VkPerformanceCounterKHR
+	{0, 0, 0}, //VkPerformanceCounterDescriptionKHR
+	{0, 0, 0}, //VkQueryPoolPerformanceCreateInfoKHR
+	{0, 0, 0}, //VkAcquireProfilingLockInfoKHR
+	{0, 0, 0}, //VkPerformanceQuerySubmitInfoKHR
+#endif
+#if defined(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR
+	{0, 0, 0}, //VkPipelineInfoKHR
+	{0, 0, 0}, //VkPipelineExecutablePropertiesKHR
+	{0, 0, 0}, //VkPipelineExecutableInfoKHR
+	{0, 0, 0}, //VkPipelineExecutableStatisticKHR
+	{0, 0, 0}, //VkPipelineExecutableInternalRepresentationKHR
+#endif
+#if defined(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineLibraryCreateInfoKHR
+#endif
+#if defined(VK_KHR_PRESENT_ID_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePresentIdFeaturesKHR
+	{0, 0, 0}, //VkPresentIdKHR
+#endif
+#if defined(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePresentWaitFeaturesKHR
+#endif
+#if defined(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDevicePushDescriptorPropertiesKHR
+#endif
+#if defined(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceRayQueryFeaturesKHR
+#endif
+#if defined(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME)
+	{0, 0, 0}, //VkRayTracingShaderGroupCreateInfoKHR
+	{0, 0, 0}, //VkRayTracingPipelineCreateInfoKHR
+	{0, 0, 0}, //VkPhysicalDeviceRayTracingPipelineFeaturesKHR
+	{0, 0, 0}, //VkPhysicalDeviceRayTracingPipelinePropertiesKHR
+	{0, 0, 0}, //VkRayTracingPipelineInterfaceCreateInfoKHR
+#endif
+#if defined(VK_KHR_SHADER_CLOCK_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderClockFeaturesKHR
+#endif
+#if defined(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR
+	{0, 0, 0}, //VkPhysicalDeviceShaderIntegerDotProductPropertiesKHR
+#endif
+#if defined(VK_KHR_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR
+#endif
+#if defined(VK_KHR_SHADER_TERMINATE_INVOCATION_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR
+#endif
+#if defined(VK_KHR_SHARED_PRESENTABLE_IMAGE_EXTENSION_NAME)
+	{0, 0, 0}, //VkSharedPresentSurfaceCapabilitiesKHR
+#endif
+#if defined(VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME)
+	{0, 0, 0}, //VkSurfaceProtectedCapabilitiesKHR
+#endif
+#if defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	{0, 0, 0}, //VkSwapchainCreateInfoKHR
+	{0, 0, 0}, //VkPresentInfoKHR
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
+	{0, 0, 0}, //VkMemoryBarrier2KHR
+	{0, 0, 0}, //VkImageMemoryBarrier2KHR
+	{0, 0, 0}, //VkBufferMemoryBarrier2KHR
+	{0, 0, 0}, //VkDependencyInfoKHR
+	{0, 0, 0}, //VkSemaphoreSubmitInfoKHR
+	{0, 0, 0}, //VkCommandBufferSubmitInfoKHR
+	{0, 0, 0}, //VkSubmitInfo2KHR
+	{0, 0, 0}, //VkPhysicalDeviceSynchronization2FeaturesKHR
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) && defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	{0, 0, 0}, //VkQueueFamilyCheckpointProperties2NV
+	{0, 0, 0}, //VkCheckpointData2NV
+#endif
+#if defined(VK_KHR_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR
+#endif
+#if defined(VK_KHR_ZERO_INITIALIZE_WORKGROUP_MEMORY_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR
+#endif
+#if defined(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)
+	{0, 0, 0}, //VkCuModuleCreateInfoNVX
+	{0, 0, 0}, //VkCuFunctionCreateInfoNVX
+	{0, 0, 0}, //VkCuLaunchInfoNVX
+#endif
+#if defined(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)
+	{0, 0, 0}, //VkImageViewHandleInfoNVX
+	{0, 0, 0}, //VkImageViewAddressPropertiesNVX
+#endif
+#if defined(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX
+#endif
+#if defined(VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineViewportWScalingStateCreateInfoNV
+#endif
+#if defined(VK_NV_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceComputeShaderDerivativesFeaturesNV
+#endif
+#if defined(VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceCooperativeMatrixFeaturesNV
+	{0, 0, 0}, //VkPhysicalDeviceCooperativeMatrixPropertiesNV
+	{0, 0, 0}, //VkCooperativeMatrixPropertiesNV
+#endif
+#if defined(VK_NV_CORNER_SAMPLED_IMAGE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceCornerSampledImageFeaturesNV
+#endif
+#if defined(VK_NV_COVERAGE_REDUCTION_MODE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceCoverageReductionModeFeaturesNV
+	{0, 0, 0}, //VkPipelineCoverageReductionStateCreateInfoNV
+	{0, 0, 0}, //VkFramebufferMixedSamplesCombinationNV
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME)
+	{0, 0, 0}, //VkDedicatedAllocationImageCreateInfoNV
+	{0, 0, 0}, //VkDedicatedAllocationBufferCreateInfoNV
+	{0, 0, 0}, //VkDedicatedAllocationMemoryAllocateInfoNV
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_IMAGE_ALIASING_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTICS_CONFIG_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceDiagnosticsConfigFeaturesNV
+	{0, 0, 0}, //VkDeviceDiagnosticsConfigCreateInfoNV
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	{0, 0, 0}, //VkQueueFamilyCheckpointPropertiesNV
+	{0, 0, 0}, //VkCheckpointDataNV
+#endif
+#if defined(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV
+	{0, 0, 0}, //VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV
+	{0, 0, 0}, //VkGraphicsShaderGroupCreateInfoNV
+	{0, 0, 0}, //VkGraphicsPipelineShaderGroupsCreateInfoNV
+	{0, 0, 0}, //VkIndirectCommandsLayoutTokenNV
+	{0, 0, 0}, //VkIndirectCommandsLayoutCreateInfoNV
+	{0, 0, 0}, //VkGeneratedCommandsInfoNV
+	{0, 0, 0}, //VkGeneratedCommandsMemoryRequirementsInfoNV
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_EXTENSION_NAME)
+	{0, 0, 0}, //VkExternalMemoryImageCreateInfoNV
+	{0, 0, 0}, //VkExportMemoryAllocateInfoNV
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_RDMA_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceExternalMemoryRDMAFeaturesNV
+	{0, 0, 0}, //VkMemoryGetRemoteAddressInfoNV
+#endif
+#if defined(VK_NV_FRAGMENT_COVERAGE_TO_COLOR_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineCoverageToColorStateCreateInfoNV
+#endif
+#if defined(VK_NV_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV
+#endif
+#if defined(VK_NV_FRAGMENT_SHADING_RATE_ENUMS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV
+	{0, 0, 0}, //VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV
+	{0, 0, 0}, //VkPipelineFragmentShadingRateEnumStateCreateInfoNV
+#endif
+#if defined(VK_NV_FRAMEBUFFER_MIXED_SAMPLES_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineCoverageModulationStateCreateInfoNV
+#endif
+#if defined(VK_NV_INHERITED_VIEWPORT_SCISSOR_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceInheritedViewportScissorFeaturesNV
+	{0, 0, 0}, //VkCommandBufferInheritanceViewportScissorInfoNV
+#endif
+#if defined(VK_NV_MESH_SHADER_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceMeshShaderFeaturesNV
+	{0, 0, 0}, //VkPhysicalDeviceMeshShaderPropertiesNV
+#endif
+#if defined(VK_NV_RAY_TRACING_EXTENSION_NAME)
+	{0, 0, 0}, //VkRayTracingShaderGroupCreateInfoNV
+	{0, 0, 0}, //VkRayTracingPipelineCreateInfoNV
+	{0, 0, 0}, //VkGeometryTrianglesNV
+	{0, 0, 0}, //VkGeometryAABBNV
+	{0, 0, 0}, //VkGeometryNV
+	{0, 0, 0}, //VkAccelerationStructureInfoNV
+	{0, 0, 0}, //VkAccelerationStructureCreateInfoNV
+	{0, 0, 0}, //VkBindAccelerationStructureMemoryInfoNV
+	{0, 0, 0}, //VkWriteDescriptorSetAccelerationStructureNV
+	{0, 0, 0}, //VkAccelerationStructureMemoryRequirementsInfoNV
+	{0, 0, 0}, //VkPhysicalDeviceRayTracingPropertiesNV
+#endif
+#if defined(VK_NV_RAY_TRACING_MOTION_BLUR_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceRayTracingMotionBlurFeaturesNV
+	{0, 0, 0}, //VkAccelerationStructureGeometryMotionTrianglesDataNV
+	{0, 0, 0}, //VkAccelerationStructureMotionInfoNV
+#endif
+#if defined(VK_NV_REPRESENTATIVE_FRAGMENT_TEST_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV
+	{0, 0, 0}, //VkPipelineRepresentativeFragmentTestStateCreateInfoNV
+#endif
+#if defined(VK_NV_SCISSOR_EXCLUSIVE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceExclusiveScissorFeaturesNV
+	{0, 0, 0}, //VkPipelineViewportExclusiveScissorStateCreateInfoNV
+#endif
+#if defined(VK_NV_SHADER_IMAGE_FOOTPRINT_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderImageFootprintFeaturesNV
+#endif
+#if defined(VK_NV_SHADER_SM_BUILTINS_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceShaderSMBuiltinsPropertiesNV
+	{0, 0, 0}, //VkPhysicalDeviceShaderSMBuiltinsFeaturesNV
+#endif
+#if defined(VK_NV_SHADING_RATE_IMAGE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineViewportShadingRateImageStateCreateInfoNV
+	{0, 0, 0}, //VkPhysicalDeviceShadingRateImageFeaturesNV
+	{0, 0, 0}, //VkPhysicalDeviceShadingRateImagePropertiesNV
+	{0, 0, 0}, //VkPipelineViewportCoarseSampleOrderStateCreateInfoNV
+#endif
+#if defined(VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPipelineViewportSwizzleStateCreateInfoNV
+#endif
+#if defined(VK_QCOM_RENDER_PASS_TRANSFORM_EXTENSION_NAME)
+	{0, 0, 0}, //VkRenderPassTransformBeginInfoQCOM
+	{0, 0, 0}, //VkCommandBufferInheritanceRenderPassTransformInfoQCOM
+#endif
+#if defined(VK_QCOM_ROTATED_COPY_COMMANDS_EXTENSION_NAME)
+	{0, 0, 0}, //VkCopyCommandTransformInfoQCOM
+#endif
+#if defined(VK_VALVE_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)
+	{0, 0, 0}, //VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE
+	{0, 0, 0}, //VkMutableDescriptorTypeCreateInfoVALVE
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkVideoDecodeH264ProfileEXT
+	{0, 0, 0}, //VkVideoDecodeH264CapabilitiesEXT
+	{0, 0, 0}, //VkVideoDecodeH264SessionCreateInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH264SessionParametersAddInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH264SessionParametersCreateInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH264PictureInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH264DpbSlotInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH264MvcEXT
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkVideoDecodeH265ProfileEXT
+	{0, 0, 0}, //VkVideoDecodeH265CapabilitiesEXT
+	{0, 0, 0}, //VkVideoDecodeH265SessionCreateInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH265SessionParametersAddInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH265SessionParametersCreateInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH265PictureInfoEXT
+	{0, 0, 0}, //VkVideoDecodeH265DpbSlotInfoEXT
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkVideoEncodeH264CapabilitiesEXT
+	{0, 0, 0}, //VkVideoEncodeH264SessionCreateInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH264SessionParametersAddInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH264SessionParametersCreateInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH264DpbSlotInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH264VclFrameInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH264EmitPictureParametersEXT
+	{0, 0, 0}, //VkVideoEncodeH264ProfileEXT
+	{0, 0, 0}, //VkVideoEncodeH264NaluSliceEXT
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkVideoEncodeH265CapabilitiesEXT
+	{0, 0, 0}, //VkVideoEncodeH265SessionCreateInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH265SessionParametersAddInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH265SessionParametersCreateInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH265VclFrameInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH265EmitPictureParametersEXT
+	{0, 0, 0}, //VkVideoEncodeH265NaluSliceEXT
+	{0, 0, 0}, //VkVideoEncodeH265ProfileEXT
+	{0, 0, 0}, //VkVideoEncodeH265DpbSlotInfoEXT
+	{0, 0, 0}, //VkVideoEncodeH265ReferenceListsEXT
+#endif
+#if defined(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkPhysicalDevicePortabilitySubsetFeaturesKHR
+	{0, 0, 0}, //VkPhysicalDevicePortabilitySubsetPropertiesKHR
+#endif
+#if defined(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkVideoDecodeInfoKHR
+#endif
+#if defined(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkVideoEncodeInfoKHR
+	{0, 0, 0}, //VkVideoEncodeRateControlInfoKHR
+#endif
+#if defined(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{0, 0, 0}, //VkVideoQueueFamilyProperties2KHR
+	{0, 0, 0}, //VkVideoProfilesKHR
+	{0, 0, 0}, //VkPhysicalDeviceVideoFormatInfoKHR
+	{0, 0, 0}, //VkVideoFormatPropertiesKHR
+	{0, 0, 0}, //VkVideoProfileKHR
+	{0, 0, 0}, //VkVideoCapabilitiesKHR
+	{0, 0, 0}, //VkVideoGetMemoryPropertiesKHR
+	{0, 0, 0}, //VkVideoBindMemoryKHR
+	{0, 0, 0}, //VkVideoPictureResourceKHR
+	{0, 0, 0}, //VkVideoReferenceSlotKHR
+	{0, 0, 0}, //VkVideoSessionCreateInfoKHR
+	{0, 0, 0}, //VkVideoSessionParametersCreateInfoKHR
+	{0, 0, 0}, //VkVideoSessionParametersUpdateInfoKHR
+	{0, 0, 0}, //VkVideoBeginCodingInfoKHR
+	{0, 0, 0}, //VkVideoEndCodingInfoKHR
+	{0, 0, 0}, //VkVideoCodingControlInfoKHR
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{0, 0, 0}, //VkImportAndroidHardwareBufferInfoANDROID
+	{0, 0, 0}, //VkAndroidHardwareBufferUsageANDROID
+	{0, 0, 0}, //VkAndroidHardwareBufferPropertiesANDROID
+	{0, 0, 0}, //VkMemoryGetAndroidHardwareBufferInfoANDROID
+	{0, 0, 0}, //VkAndroidHardwareBufferFormatPropertiesANDROID
+	{0, 0, 0}, //VkExternalFormatANDROID
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{0, 0, 0}, //VkAndroidHardwareBufferFormatProperties2ANDROID
+#endif
+#if defined(VK_ANDROID_NATIVE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{0, 0, 0}, //VkNativeBufferANDROID
+	{0, 0, 0}, //VkSwapchainImageCreateInfoANDROID
+	{0, 0, 0}, //VkPhysicalDevicePresentationPropertiesANDROID
+#endif
+#if defined(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{0, 0, 0}, //VkAndroidSurfaceCreateInfoKHR
+#endif
+#if defined(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+	{0, 0, 0}, //VkDirectFBSurfaceCreateInfoEXT
+#endif
+#if defined(VK_FUCHSIA_BUFFER_COLLECTION_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{0, 0, 0}, //VkImportMemoryBufferCollectionFUCHSIA
+	{0, 0, 0}, //VkBufferCollectionImageCreateInfoFUCHSIA
+	{0, 0, 0}, //VkBufferCollectionBufferCreateInfoFUCHSIA
+	{0, 0, 0}, //VkBufferCollectionCreateInfoFUCHSIA
+	{0, 0, 0}, //VkBufferCollectionPropertiesFUCHSIA
+	{0, 0, 0}, //VkBufferConstraintsInfoFUCHSIA
+	{0, 0, 0}, //VkSysmemColorSpaceFUCHSIA
+	{0, 0, 0}, //VkImageFormatConstraintsInfoFUCHSIA
+	{0, 0, 0}, //VkImageConstraintsInfoFUCHSIA
+	{0, 0, 0}, //VkBufferCollectionConstraintsInfoFUCHSIA
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_MEMORY_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{0, 0, 0}, //VkImportMemoryZirconHandleInfoFUCHSIA
+	{0, 0, 0}, //VkMemoryZirconHandlePropertiesFUCHSIA
+	{0, 0, 0}, //VkMemoryGetZirconHandleInfoFUCHSIA
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_SEMAPHORE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{0, 0, 0}, //VkImportSemaphoreZirconHandleInfoFUCHSIA
+	{0, 0, 0}, //VkSemaphoreGetZirconHandleInfoFUCHSIA
+#endif
+#if defined(VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{0, 0, 0}, //VkImagePipeSurfaceCreateInfoFUCHSIA
+#endif
+#if defined(VK_GGP_FRAME_TOKEN_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	{0, 0, 0}, //VkPresentFrameTokenGGP
+#endif
+#if defined(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	{0, 0, 0}, //VkStreamDescriptorSurfaceCreateInfoGGP
+#endif
+#if defined(VK_MVK_IOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_IOS_MVK)
+	{0, 0, 0}, //VkIOSSurfaceCreateInfoMVK
+#endif
+#if defined(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_MACOS_MVK)
+	{0, 0, 0}, //VkMacOSSurfaceCreateInfoMVK
+#endif
+#if defined(VK_EXT_METAL_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_METAL_EXT)
+	{0, 0, 0}, //VkMetalSurfaceCreateInfoEXT
+#endif
+#if defined(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_SCREEN_QNX)
+	{0, 0, 0}, //VkScreenSurfaceCreateInfoQNX
+#endif
+#if defined(VK_NN_VI_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_VI_NN)
+	{0, 0, 0}, //VkViSurfaceCreateInfoNN
+#endif
+#if defined(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WAYLAND_KHR)
+	{0, 0, 0}, //VkWaylandSurfaceCreateInfoKHR
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkSurfaceFullScreenExclusiveInfoEXT
+	{0, 0, 0}, //VkSurfaceCapabilitiesFullScreenExclusiveEXT
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkSurfaceFullScreenExclusiveWin32InfoEXT
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkImportFenceWin32HandleInfoKHR
+	{0, 0, 0}, //VkExportFenceWin32HandleInfoKHR
+	{0, 0, 0}, //VkFenceGetWin32HandleInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkImportMemoryWin32HandleInfoKHR
+	{0, 0, 0}, //VkExportMemoryWin32HandleInfoKHR
+	{0, 0, 0}, //VkMemoryWin32HandlePropertiesKHR
+	{0, 0, 0}, //VkMemoryGetWin32HandleInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkImportSemaphoreWin32HandleInfoKHR
+	{0, 0, 0}, //VkExportSemaphoreWin32HandleInfoKHR
+	{0, 0, 0}, //VkD3D12FenceSubmitInfoKHR
+	{0, 0, 0}, //VkSemaphoreGetWin32HandleInfoKHR
+#endif
+#if defined(VK_KHR_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkWin32KeyedMutexAcquireReleaseInfoKHR
+#endif
+#if defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkWin32SurfaceCreateInfoKHR
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkImportMemoryWin32HandleInfoNV
+	{0, 0, 0}, //VkExportMemoryWin32HandleInfoNV
+#endif
+#if defined(VK_NV_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{0, 0, 0}, //VkWin32KeyedMutexAcquireReleaseInfoNV
+#endif
+#if defined(VK_KHR_XCB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XCB_KHR)
+	{0, 0, 0}, //VkXcbSurfaceCreateInfoKHR
+#endif
+#if defined(VK_KHR_XLIB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XLIB_KHR)
+	{0, 0, 0}, //VkXlibSurfaceCreateInfoKHR
+#endif
+	{0, 0, 0}
+};
+
+//What a structure can be chained to, used by ValidateChain()
+struct StructureChainRule
+{
+	const VulkanStructureType*	ExtendedSTypes;		//sTypes of the structures it can extend, ended with VK_STRUCTURE_TYPE_MAX_ENUM. Null if the rule is unknown
+	bool						AllowDuplicates;	//Can be in a chain more than once
+};
+
+//Chain rules of each structure indexed by StructureOrdinal, followed by an empty entry so the table is never empty
+inline constexpr StructureChainRule StructureChainRules[StructureOrdinalCount + 1] =
+{
+	{nullptr, false}, //VkApplicationInfo
+	{nullptr, false}, //VkDeviceQueueCreateInfo
+	{nullptr, false}, //VkDeviceCreateInfo
+	{nullptr, false}, //VkInstanceCreateInfo
+	{nullptr, false}, //VkMemoryAllocateInfo
+	{nullptr, false}, //VkMappedMemoryRange
+	{nullptr, false}, //VkWriteDescriptorSet
+	{nullptr, false}, //VkCopyDescriptorSet
+	{nullptr, false}, //VkBufferCreateInfo
+	{nullptr, false}, //VkBufferViewCreateInfo
+	{nullptr, false}, //VkMemoryBarrier
+	{nullptr, false}, //VkBufferMemoryBarrier
+	{nullptr, false}, //VkImageMemoryBarrier
+	{nullptr, false}, //VkImageCreateInfo
+	{nullptr, false}, //VkImageViewCreateInfo
+	{nullptr, false}, //VkBindSparseInfo
+	{nullptr, false}, //VkShaderModuleCreateInfo
+	{nullptr, false}, //VkDescriptorSetLayoutCreateInfo
+	{nullptr, false}, //VkDescriptorPoolCreateInfo
+	{nullptr, false}, //VkDescriptorSetAllocateInfo
+	{nullptr, false}, //VkPipelineShaderStageCreateInfo
+	{nullptr, false}, //VkComputePipelineCreateInfo
+	{nullptr, false}, //VkPipelineVertexInputStateCreateInfo
+	{nullptr, false}, //VkPipelineInputAssemblyStateCreateInfo
+	{nullptr, false}, //VkPipelineTessellationStateCreateInfo
+	{nullptr, false}, //VkPipelineViewportStateCreateInfo
+	{nullptr, false}, //VkPipelineRasterizationStateCreateInfo
+	{nullptr, false}, //VkPipelineMultisampleStateCreateInfo
+	{nullptr, false}, //VkPipelineColorBlendStateCreateInfo
+	{nullptr, false}, //VkPipelineDynamicStateCreateInfo
+	{nullptr, false}, //VkPipelineDepthStencilStateCreateInfo
+	{nullptr, false}, //VkGraphicsPipelineCreateInfo
+	{nullptr, false}, //VkPipelineCacheCreateInfo
+	{nullptr, false}, //VkPipelineLayoutCreateInfo
+	{nullptr, false}, //VkSamplerCreateInfo
+	{nullptr, false}, //VkCommandPoolCreateInfo
+	{nullptr, false}, //VkCommandBufferAllocateInfo
+	{nullptr, false}, //VkCommandBufferInheritanceInfo
+	{nullptr, false}, //VkCommandBufferBeginInfo
+	{nullptr, false}, //VkRenderPassBeginInfo
+	{nullptr, false}, //VkRenderPassCreateInfo
+	{nullptr, false}, //VkEventCreateInfo
+	{nullptr, false}, //VkFenceCreateInfo
+	{nullptr, false}, //VkSemaphoreCreateInfo
+	{nullptr, false}, //VkQueryPoolCreateInfo
+	{nullptr, false}, //VkFramebufferCreateInfo
+	{nullptr, false}, //VkSubmitInfo
+	{nullptr, false}, //VkPhysicalDeviceFeatures2
+	{nullptr, false}, //VkPhysicalDeviceProperties2
+	{nullptr, false}, //VkFormatProperties2
+	{nullptr, false}, //VkImageFormatProperties2
+	{nullptr, false}, //VkPhysicalDeviceImageFormatInfo2
+	{nullptr, false}, //VkQueueFamilyProperties2
+	{nullptr, false}, //VkPhysicalDeviceMemoryProperties2
+	{nullptr, false}, //VkSparseImageFormatProperties2
+	{nullptr, false}, //VkPhysicalDeviceSparseImageFormatInfo2
+	{nullptr, false}, //VkPhysicalDeviceDriverProperties
+	{nullptr, false}, //VkPhysicalDeviceVariablePointersFeatures
+	{nullptr, false}, //VkPhysicalDeviceExternalImageFormatInfo
+	{nullptr, false}, //VkExternalImageFormatProperties
+	{nullptr, false}, //VkPhysicalDeviceExternalBufferInfo
+	{nullptr, false}, //VkExternalBufferProperties
+	{nullptr, false}, //VkPhysicalDeviceIDProperties
+	{nullptr, false}, //VkExternalMemoryImageCreateInfo
+	{nullptr, false}, //VkExternalMemoryBufferCreateInfo
+	{nullptr, false}, //VkExportMemoryAllocateInfo
+	{nullptr, false}, //VkPhysicalDeviceExternalSemaphoreInfo
+	{nullptr, false}, //VkExternalSemaphoreProperties
+	{nullptr, false}, //VkExportSemaphoreCreateInfo
+	{nullptr, false}, //VkPhysicalDeviceExternalFenceInfo
+	{nullptr, false}, //VkExternalFenceProperties
+	{nullptr, false}, //VkExportFenceCreateInfo
+	{nullptr, false}, //VkPhysicalDeviceMultiviewFeatures
+	{nullptr, false}, //VkPhysicalDeviceMultiviewProperties
+	{nullptr, false}, //VkRenderPassMultiviewCreateInfo
+	{nullptr, false}, //VkPhysicalDeviceGroupProperties
+	{nullptr, false}, //VkMemoryAllocateFlagsInfo
+	{nullptr, false}, //VkBindBufferMemoryInfo
+	{nullptr, false}, //VkBindBufferMemoryDeviceGroupInfo
+	{nullptr, false}, //VkBindImageMemoryInfo
+	{nullptr, false}, //VkBindImageMemoryDeviceGroupInfo
+	{nullptr, false}, //VkDeviceGroupRenderPassBeginInfo
+	{nullptr, false}, //VkDeviceGroupCommandBufferBeginInfo
+	{nullptr, false}, //VkDeviceGroupSubmitInfo
+	{nullptr, false}, //VkDeviceGroupBindSparseInfo
+	{nullptr, false}, //VkDeviceGroupDeviceCreateInfo
+	{nullptr, false}, //VkDescriptorUpdateTemplateCreateInfo
+	{nullptr, false}, //VkRenderPassInputAttachmentAspectCreateInfo
+	{nullptr, false}, //VkPhysicalDevice16BitStorageFeatures
+	{nullptr, false}, //VkPhysicalDeviceSubgroupProperties
+	{nullptr, false}, //VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures
+	{nullptr, false}, //VkBufferMemoryRequirementsInfo2
+	{nullptr, false}, //VkImageMemoryRequirementsInfo2
+	{nullptr, false}, //VkImageSparseMemoryRequirementsInfo2
+	{nullptr, false}, //VkMemoryRequirements2
+	{nullptr, false}, //VkSparseImageMemoryRequirements2
+	{nullptr, false}, //VkPhysicalDevicePointClippingProperties
+	{nullptr, false}, //VkMemoryDedicatedRequirements
+	{nullptr, false}, //VkMemoryDedicatedAllocateInfo
+	{nullptr, false}, //VkImageViewUsageCreateInfo
+	{nullptr, false}, //VkPipelineTessellationDomainOriginStateCreateInfo
+	{nullptr, false}, //VkSamplerYcbcrConversionInfo
+	{nullptr, false}, //VkSamplerYcbcrConversionCreateInfo
+	{nullptr, false}, //VkBindImagePlaneMemoryInfo
+	{nullptr, false}, //VkImagePlaneMemoryRequirementsInfo
+	{nullptr, false}, //VkPhysicalDeviceSamplerYcbcrConversionFeatures
+	{nullptr, false}, //VkSamplerYcbcrConversionImageFormatProperties
+	{nullptr, false}, //VkProtectedSubmitInfo
+	{nullptr, false}, //VkPhysicalDeviceProtectedMemoryFeatures
+	{nullptr, false}, //VkPhysicalDeviceProtectedMemoryProperties
+	{nullptr, false}, //VkDeviceQueueInfo2
+	{nullptr, false}, //VkPhysicalDeviceSamplerFilterMinmaxProperties
+	{nullptr, false}, //VkSamplerReductionModeCreateInfo
+	{nullptr, false}, //VkImageFormatListCreateInfo
+	{nullptr, false}, //VkPhysicalDeviceMaintenance3Properties
+	{nullptr, false}, //VkDescriptorSetLayoutSupport
+	{nullptr, false}, //VkPhysicalDeviceShaderDrawParametersFeatures
+	{nullptr, false}, //VkPhysicalDeviceShaderFloat16Int8Features
+	{nullptr, false}, //VkPhysicalDeviceFloatControlsProperties
+	{nullptr, false}, //VkPhysicalDeviceHostQueryResetFeatures
+	{nullptr, false}, //VkPhysicalDeviceDescriptorIndexingFeatures
+	{nullptr, false}, //VkPhysicalDeviceDescriptorIndexingProperties
+	{nullptr, false}, //VkDescriptorSetLayoutBindingFlagsCreateInfo
+	{nullptr, false}, //VkDescriptorSetVariableDescriptorCountAllocateInfo
+	{nullptr, false}, //VkDescriptorSetVariableDescriptorCountLayoutSupport
+	{nullptr, false}, //VkAttachmentDescription2
+	{nullptr, false}, //VkAttachmentReference2
+	{nullptr, false}, //VkSubpassDescription2
+	{nullptr, false}, //VkSubpassDependency2
+	{nullptr, false}, //VkRenderPassCreateInfo2
+	{nullptr, false}, //VkSubpassBeginInfo
+	{nullptr, false}, //VkSubpassEndInfo
+	{nullptr, false}, //VkPhysicalDeviceTimelineSemaphoreFeatures
+	{nullptr, false}, //VkPhysicalDeviceTimelineSemaphoreProperties
+	{nullptr, false}, //VkSemaphoreTypeCreateInfo
+	{nullptr, false}, //VkTimelineSemaphoreSubmitInfo
+	{nullptr, false}, //VkSemaphoreWaitInfo
+	{nullptr, false}, //VkSemaphoreSignalInfo
+	{nullptr, false}, //VkPhysicalDevice8BitStorageFeatures
+	{nullptr, false}, //VkPhysicalDeviceVulkanMemoryModelFeatures
+	{nullptr, false}, //VkPhysicalDeviceShaderAtomicInt64Features
+	{nullptr, false}, //VkPhysicalDeviceDepthStencilResolveProperties
+	{nullptr, false}, //VkSubpassDescriptionDepthStencilResolve
+	{nullptr, false}, //VkImageStencilUsageCreateInfo
+	{nullptr, false}, //VkPhysicalDeviceScalarBlockLayoutFeatures
+	{nullptr, false}, //VkPhysicalDeviceUniformBufferStandardLayoutFeatures
+	{nullptr, false}, //VkPhysicalDeviceBufferDeviceAddressFeatures
+	{nullptr, false}, //VkBufferDeviceAddressInfo
+	{nullptr, false}, //VkBufferOpaqueCaptureAddressCreateInfo
+	{nullptr, false}, //VkPhysicalDeviceImagelessFramebufferFeatures
+	{nullptr, false}, //VkFramebufferAttachmentsCreateInfo
+	{nullptr, false}, //VkFramebufferAttachmentImageInfo
+	{nullptr, false}, //VkRenderPassAttachmentBeginInfo
+	{nullptr, false}, //VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures
+	{nullptr, false}, //VkAttachmentReferenceStencilLayout
+	{nullptr, false}, //VkAttachmentDescriptionStencilLayout
+	{nullptr, false}, //VkMemoryOpaqueCaptureAddressAllocateInfo
+	{nullptr, false}, //VkDeviceMemoryOpaqueCaptureAddressInfo
+	{nullptr, false}, //VkPhysicalDeviceVulkan11Features
+	{nullptr, false}, //VkPhysicalDeviceVulkan11Properties
+	{nullptr, false}, //VkPhysicalDeviceVulkan12Features
+	{nullptr, false}, //VkPhysicalDeviceVulkan12Properties
+#if defined(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceCoherentMemoryFeaturesAMD
+#endif
+#if defined(VK_AMD_DISPLAY_NATIVE_HDR_EXTENSION_NAME)
+	{nullptr, false}, //VkDisplayNativeHdrSurfaceCapabilitiesAMD
+	{nullptr, false}, //VkSwapchainDisplayNativeHdrCreateInfoAMD
+#endif
+#if defined(VK_AMD_MEMORY_OVERALLOCATION_BEHAVIOR_EXTENSION_NAME)
+	{nullptr, false}, //VkDeviceMemoryOverallocationCreateInfoAMD
+#endif
+#if defined(VK_AMD_PIPELINE_COMPILER_CONTROL_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineCompilerControlCreateInfoAMD
+#endif
+#if defined(VK_AMD_RASTERIZATION_ORDER_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineRasterizationStateRasterizationOrderAMD
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderCoreProperties2AMD
+#endif
+#if defined(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderCorePropertiesAMD
+#endif
+#if defined(VK_AMD_TEXTURE_GATHER_BIAS_LOD_EXTENSION_NAME)
+	{nullptr, false}, //VkTextureLODGatherFormatPropertiesAMD
+#endif
+#if defined(VK_EXT_4444_FORMATS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevice4444FormatsFeaturesEXT
+#endif
+#if defined(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME)
+	{nullptr, false}, //VkImageViewASTCDecodeModeEXT
+	{nullptr, false}, //VkPhysicalDeviceASTCDecodeFeaturesEXT
+#endif
+#if defined(VK_EXT_BLEND_OPERATION_ADVANCED_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT
+	{nullptr, false}, //VkPipelineColorBlendAdvancedStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_BORDER_COLOR_SWIZZLE_EXTENSION_NAME)
+	{nullptr, false}, //VkSamplerBorderColorComponentMappingCreateInfoEXT
+	{nullptr, false}, //VkPhysicalDeviceBorderColorSwizzleFeaturesEXT
+#endif
+#if defined(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceBufferDeviceAddressFeaturesEXT
+	{nullptr, false}, //VkBufferDeviceAddressCreateInfoEXT
+#endif
+#if defined(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+	{nullptr, false}, //VkCalibratedTimestampInfoEXT
+#endif
+#if defined(VK_EXT_COLOR_WRITE_ENABLE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceColorWriteEnableFeaturesEXT
+	{nullptr, false}, //VkPipelineColorWriteCreateInfoEXT
+#endif
+#if defined(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME)
+	{nullptr, false}, //VkConditionalRenderingBeginInfoEXT
+	{nullptr, false}, //VkCommandBufferInheritanceConditionalRenderingInfoEXT
+	{nullptr, false}, //VkPhysicalDeviceConditionalRenderingFeaturesEXT
+#endif
+#if defined(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceConservativeRasterizationPropertiesEXT
+	{nullptr, false}, //VkPipelineRasterizationConservativeStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME)
+	{nullptr, false}, //VkSamplerCustomBorderColorCreateInfoEXT
+	{nullptr, false}, //VkPhysicalDeviceCustomBorderColorPropertiesEXT
+	{nullptr, false}, //VkPhysicalDeviceCustomBorderColorFeaturesEXT
+#endif
+#if defined(VK_EXT_DEBUG_MARKER_EXTENSION_NAME)
+	{nullptr, false}, //VkDebugMarkerObjectNameInfoEXT
+	{nullptr, false}, //VkDebugMarkerObjectTagInfoEXT
+	{nullptr, false}, //VkDebugMarkerMarkerInfoEXT
+#endif
+#if defined(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+	{nullptr, false}, //VkDebugReportCallbackCreateInfoEXT
+#endif
+#if defined(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+	{nullptr, false}, //VkDebugUtilsObjectNameInfoEXT
+	{nullptr, false}, //VkDebugUtilsObjectTagInfoEXT
+	{nullptr, false}, //VkDebugUtilsLabelEXT
+	{nullptr, false}, //VkDebugUtilsMessengerCreateInfoEXT
+	{nullptr, false}, //VkDebugUtilsMessengerCallbackDataEXT
+#endif
+#if defined(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceDepthClipEnableFeaturesEXT
+	{nullptr, false}, //VkPipelineRasterizationDepthClipStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceDeviceMemoryReportFeaturesEXT
+	{nullptr, false}, //VkDeviceDeviceMemoryReportCreateInfoEXT
+	{nullptr, false}, //VkDeviceMemoryReportCallbackDataEXT
+#endif
+#if defined(VK_EXT_DISCARD_RECTANGLES_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceDiscardRectanglePropertiesEXT
+	{nullptr, false}, //VkPipelineDiscardRectangleStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_DISPLAY_CONTROL_EXTENSION_NAME)
+	{nullptr, false}, //VkDisplayPowerInfoEXT
+	{nullptr, false}, //VkDeviceEventInfoEXT
+	{nullptr, false}, //VkDisplayEventInfoEXT
+	{nullptr, false}, //VkSwapchainCounterCreateInfoEXT
+#endif
+#if defined(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)
+	{nullptr, false}, //VkSurfaceCapabilities2EXT
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceExtendedDynamicState2FeaturesEXT
+#endif
+#if defined(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceExtendedDynamicStateFeaturesEXT
+#endif
+#if defined(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)
+	{nullptr, false}, //VkImportMemoryHostPointerInfoEXT
+	{nullptr, false}, //VkMemoryHostPointerPropertiesEXT
+	{nullptr, false}, //VkPhysicalDeviceExternalMemoryHostPropertiesEXT
+#endif
+#if defined(VK_EXT_FILTER_CUBIC_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceImageViewImageFormatInfoEXT
+	{nullptr, false}, //VkFilterCubicImageViewImageFormatPropertiesEXT
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_2_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceFragmentDensityMap2FeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceFragmentDensityMap2PropertiesEXT
+#endif
+#if defined(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceFragmentDensityMapFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceFragmentDensityMapPropertiesEXT
+	{nullptr, false}, //VkRenderPassFragmentDensityMapCreateInfoEXT
+#endif
+#if defined(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)
+	{nullptr, false}, //VkDeviceQueueGlobalPriorityCreateInfoEXT
+#endif
+#if defined(VK_EXT_GLOBAL_PRIORITY_QUERY_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceGlobalPriorityQueryFeaturesEXT
+	{nullptr, false}, //VkQueueFamilyGlobalPriorityPropertiesEXT
+#endif
+#if defined(VK_EXT_HDR_METADATA_EXTENSION_NAME)
+	{nullptr, false}, //VkHdrMetadataEXT
+#endif
+#if defined(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+	{nullptr, false}, //VkHeadlessSurfaceCreateInfoEXT
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME)
+	{nullptr, false}, //VkDrmFormatModifierPropertiesListEXT
+	{nullptr, false}, //VkPhysicalDeviceImageDrmFormatModifierInfoEXT
+	{nullptr, false}, //VkImageDrmFormatModifierListCreateInfoEXT
+	{nullptr, false}, //VkImageDrmFormatModifierExplicitCreateInfoEXT
+	{nullptr, false}, //VkImageDrmFormatModifierPropertiesEXT
+#endif
+#if defined(VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	{nullptr, false}, //VkDrmFormatModifierPropertiesList2EXT
+#endif
+#if defined(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceImageRobustnessFeaturesEXT
+#endif
+#if defined(VK_EXT_INDEX_TYPE_UINT8_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceIndexTypeUint8FeaturesEXT
+#endif
+#if defined(VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceInlineUniformBlockFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceInlineUniformBlockPropertiesEXT
+	{nullptr, false}, //VkWriteDescriptorSetInlineUniformBlockEXT
+	{nullptr, false}, //VkDescriptorPoolInlineUniformBlockCreateInfoEXT
+#endif
+#if defined(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceLineRasterizationFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceLineRasterizationPropertiesEXT
+	{nullptr, false}, //VkPipelineRasterizationLineStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceMemoryBudgetPropertiesEXT
+#endif
+#if defined(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceMemoryPriorityFeaturesEXT
+	{nullptr, false}, //VkMemoryPriorityAllocateInfoEXT
+#endif
+#if defined(VK_EXT_MULTI_DRAW_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceMultiDrawPropertiesEXT
+	{nullptr, false}, //VkPhysicalDeviceMultiDrawFeaturesEXT
+#endif
+#if defined(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT
+#endif
+#if defined(VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePCIBusInfoPropertiesEXT
+#endif
+#if defined(VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceDrmPropertiesEXT
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT
+#endif
+#if defined(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineCreationFeedbackCreateInfoEXT
+#endif
+#if defined(VK_EXT_PRIMITIVE_TOPOLOGY_LIST_RESTART_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT
+#endif
+#if defined(VK_EXT_PRIVATE_DATA_EXTENSION_NAME)
+	{nullptr, false}, //VkDevicePrivateDataCreateInfoEXT
+	{nullptr, false}, //VkPrivateDataSlotCreateInfoEXT
+	{nullptr, false}, //VkPhysicalDevicePrivateDataFeaturesEXT
+#endif
+#if defined(VK_EXT_PROVOKING_VERTEX_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceProvokingVertexFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceProvokingVertexPropertiesEXT
+	{nullptr, false}, //VkPipelineRasterizationProvokingVertexStateCreateInfoEXT
+#endif
+#if defined(VK_EXT_RGBA10X6_FORMATS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT
+#endif
+#if defined(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceRobustness2FeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceRobustness2PropertiesEXT
+#endif
+#if defined(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME)
+	{nullptr, false}, //VkSampleLocationsInfoEXT
+	{nullptr, false}, //VkRenderPassSampleLocationsBeginInfoEXT
+	{nullptr, false}, //VkPipelineSampleLocationsStateCreateInfoEXT
+	{nullptr, false}, //VkPhysicalDeviceSampleLocationsPropertiesEXT
+	{nullptr, false}, //VkMultisamplePropertiesEXT
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_2_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT
+#endif
+#if defined(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderAtomicFloatFeaturesEXT
+#endif
+#if defined(VK_EXT_SHADER_DEMOTE_TO_HELPER_INVOCATION_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT
+#endif
+#if defined(VK_EXT_SHADER_IMAGE_ATOMIC_INT64_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT
+#endif
+#if defined(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceSubgroupSizeControlFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceSubgroupSizeControlPropertiesEXT
+	{nullptr, false}, //VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT
+#endif
+#if defined(VK_EXT_TEXEL_BUFFER_ALIGNMENT_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT
+#endif
+#if defined(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT
+#endif
+#if defined(VK_EXT_TOOLING_INFO_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceToolPropertiesEXT
+#endif
+#if defined(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceTransformFeedbackFeaturesEXT
+	{nullptr, false}, //VkPhysicalDeviceTransformFeedbackPropertiesEXT
+	{nullptr, false}, //VkPipelineRasterizationStateStreamCreateInfoEXT
+#endif
+#if defined(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)
+	{nullptr, false}, //VkValidationCacheCreateInfoEXT
+	{nullptr, false}, //VkShaderModuleValidationCacheCreateInfoEXT
+#endif
+#if defined(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME)
+	{nullptr, false}, //VkValidationFeaturesEXT
+#endif
+#if defined(VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME)
+	{nullptr, false}, //VkValidationFlagsEXT
+#endif
+#if defined(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineVertexInputDivisorStateCreateInfoEXT
+	{nullptr, false}, //VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT
+	{nullptr, false}, //VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT
+#endif
+#if defined(VK_EXT_VERTEX_INPUT_DYNAMIC_STATE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT
+	{nullptr, false}, //VkVertexInputBindingDescription2EXT
+	{nullptr, false}, //VkVertexInputAttributeDescription2EXT
+#endif
+#if defined(VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT
+#endif
+#if defined(VK_EXT_YCBCR_IMAGE_ARRAYS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceYcbcrImageArraysFeaturesEXT
+#endif
+#if defined(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)
+	{nullptr, false}, //VkPresentTimesInfoGOOGLE
+#endif
+#if defined(VK_HUAWEI_INVOCATION_MASK_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceInvocationMaskFeaturesHUAWEI
+#endif
+#if defined(VK_HUAWEI_SUBPASS_SHADING_EXTENSION_NAME)
+	{nullptr, false}, //VkSubpassShadingPipelineCreateInfoHUAWEI
+	{nullptr, false}, //VkPhysicalDeviceSubpassShadingPropertiesHUAWEI
+	{nullptr, false}, //VkPhysicalDeviceSubpassShadingFeaturesHUAWEI
+#endif
+#if defined(VK_INTEL_PERFORMANCE_QUERY_EXTENSION_NAME)
+	{nullptr, false}, //VkInitializePerformanceApiInfoINTEL
+	{nullptr, false}, //VkQueryPoolPerformanceQueryCreateInfoINTEL
+	{nullptr, false}, //VkPerformanceMarkerInfoINTEL
+	{nullptr, false}, //VkPerformanceStreamMarkerInfoINTEL
+	{nullptr, false}, //VkPerformanceOverrideInfoINTEL
+	{nullptr, false}, //VkPerformanceConfigurationAcquireInfoINTEL
+#endif
+#if defined(VK_INTEL_SHADER_INTEGER_FUNCTIONS_2_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL
+#endif
+#if defined(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)
+	{nullptr, false}, //VkWriteDescriptorSetAccelerationStructureKHR
+	{nullptr, false}, //VkPhysicalDeviceAccelerationStructureFeaturesKHR
+	{nullptr, false}, //VkPhysicalDeviceAccelerationStructurePropertiesKHR
+	{nullptr, false}, //VkAccelerationStructureGeometryTrianglesDataKHR
+	{nullptr, false}, //VkAccelerationStructureGeometryAabbsDataKHR
+	{nullptr, false}, //VkAccelerationStructureGeometryInstancesDataKHR
+	{nullptr, false}, //VkAccelerationStructureGeometryKHR
+	{nullptr, false}, //VkAccelerationStructureBuildGeometryInfoKHR
+	{nullptr, false}, //VkAccelerationStructureCreateInfoKHR
+	{nullptr, false}, //VkAccelerationStructureDeviceAddressInfoKHR
+	{nullptr, false}, //VkAccelerationStructureVersionInfoKHR
+	{nullptr, false}, //VkCopyAccelerationStructureInfoKHR
+	{nullptr, false}, //VkCopyAccelerationStructureToMemoryInfoKHR
+	{nullptr, false}, //VkCopyMemoryToAccelerationStructureInfoKHR
+	{nullptr, false}, //VkAccelerationStructureBuildSizesInfoKHR
+#endif
+#if defined(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME)
+	{nullptr, false}, //VkBufferCopy2KHR
+	{nullptr, false}, //VkImageCopy2KHR
+	{nullptr, false}, //VkImageBlit2KHR
+	{nullptr, false}, //VkBufferImageCopy2KHR
+	{nullptr, false}, //VkImageResolve2KHR
+	{nullptr, false}, //VkCopyBufferInfo2KHR
+	{nullptr, false}, //VkCopyImageInfo2KHR
+	{nullptr, false}, //VkBlitImageInfo2KHR
+	{nullptr, false}, //VkCopyBufferToImageInfo2KHR
+	{nullptr, false}, //VkCopyImageToBufferInfo2KHR
+	{nullptr, false}, //VkResolveImageInfo2KHR
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SURFACE_EXTENSION_NAME)
+	{nullptr, false}, //VkDeviceGroupPresentCapabilitiesKHR
+#endif
+#if defined(VK_KHR_DEVICE_GROUP_EXTENSION_NAME) && defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	{nullptr, false}, //VkImageSwapchainCreateInfoKHR
+	{nullptr, false}, //VkBindImageMemorySwapchainInfoKHR
+	{nullptr, false}, //VkAcquireNextImageInfoKHR
+	{nullptr, false}, //VkDeviceGroupPresentInfoKHR
+	{nullptr, false}, //VkDeviceGroupSwapchainCreateInfoKHR
+#endif
+#if defined(VK_KHR_DISPLAY_EXTENSION_NAME)
+	{nullptr, false}, //VkDisplayModeCreateInfoKHR
+	{nullptr, false}, //VkDisplaySurfaceCreateInfoKHR
+#endif
+#if defined(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME)
+	{nullptr, false}, //VkDisplayPresentInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME)
+	{nullptr, false}, //VkImportFenceFdInfoKHR
+	{nullptr, false}, //VkFenceGetFdInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)
+	{nullptr, false}, //VkImportMemoryFdInfoKHR
+	{nullptr, false}, //VkMemoryFdPropertiesKHR
+	{nullptr, false}, //VkMemoryGetFdInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME)
+	{nullptr, false}, //VkImportSemaphoreFdInfoKHR
+	{nullptr, false}, //VkSemaphoreGetFdInfoKHR
+#endif
+#if defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)
+	{nullptr, false}, //VkFormatProperties3KHR
+#endif
+#if defined(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME)
+	{nullptr, false}, //VkFragmentShadingRateAttachmentInfoKHR
+	{nullptr, false}, //VkPipelineFragmentShadingRateStateCreateInfoKHR
+	{nullptr, false}, //VkPhysicalDeviceFragmentShadingRateFeaturesKHR
+	{nullptr, false}, //VkPhysicalDeviceFragmentShadingRatePropertiesKHR
+	{nullptr, false}, //VkPhysicalDeviceFragmentShadingRateKHR
+#endif
+#if defined(VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME)
+	{nullptr, false}, //VkDisplayProperties2KHR
+	{nullptr, false}, //VkDisplayPlaneProperties2KHR
+	{nullptr, false}, //VkDisplayModeProperties2KHR
+	{nullptr, false}, //VkDisplayPlaneInfo2KHR
+	{nullptr, false}, //VkDisplayPlaneCapabilities2KHR
+#endif
+#if defined(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceSurfaceInfo2KHR
+	{nullptr, false}, //VkSurfaceCapabilities2KHR
+	{nullptr, false}, //VkSurfaceFormat2KHR
+#endif
+#if defined(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)
+	{nullptr, false}, //VkPresentRegionsKHR
+#endif
+#if defined(VK_KHR_MAINTENANCE_4_EXTENSION_NAME)
+	{nullptr, false}, //VkDeviceBufferMemoryRequirementsKHR
+	{nullptr, false}, //VkDeviceImageMemoryRequirementsKHR
+	{nullptr, false}, //VkPhysicalDeviceMaintenance4FeaturesKHR
+	{nullptr, false}, //VkPhysicalDeviceMaintenance4PropertiesKHR
+#endif
+#if defined(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePerformanceQueryFeaturesKHR
+	{nullptr, false}, //VkPhysicalDevicePerformanceQueryPropertiesKHR
+	{nullptr, false}, //VkPerformanceCounterKHR
+	{nullptr, false}, //VkPerformanceCounterDescriptionKHR
+	{nullptr, false}, //VkQueryPoolPerformanceCreateInfoKHR
+	{nullptr, false}, //VkAcquireProfilingLockInfoKHR
+	{nullptr, false}, //VkPerformanceQuerySubmitInfoKHR
+#endif
+#if defined(VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR
+	{nullptr, false}, //VkPipelineInfoKHR
+	{nullptr, false}, //VkPipelineExecutablePropertiesKHR
+	{nullptr, false}, //VkPipelineExecutableInfoKHR
+	{nullptr, false}, //VkPipelineExecutableStatisticKHR
+	{nullptr, false}, //VkPipelineExecutableInternalRepresentationKHR
+#endif
+#if defined(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineLibraryCreateInfoKHR
+#endif
+#if defined(VK_KHR_PRESENT_ID_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePresentIdFeaturesKHR
+	{nullptr, false}, //VkPresentIdKHR
+#endif
+#if defined(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePresentWaitFeaturesKHR
+#endif
+#if defined(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDevicePushDescriptorPropertiesKHR
+#endif
+#if defined(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceRayQueryFeaturesKHR
+#endif
+#if defined(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME)
+	{nullptr, false}, //VkRayTracingShaderGroupCreateInfoKHR
+	{nullptr, false}, //VkRayTracingPipelineCreateInfoKHR
+	{nullptr, false}, //VkPhysicalDeviceRayTracingPipelineFeaturesKHR
+	{nullptr, false}, //VkPhysicalDeviceRayTracingPipelinePropertiesKHR
+	{nullptr, false}, //VkRayTracingPipelineInterfaceCreateInfoKHR
+#endif
+#if defined(VK_KHR_SHADER_CLOCK_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderClockFeaturesKHR
+#endif
+#if defined(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR
+	{nullptr, false}, //VkPhysicalDeviceShaderIntegerDotProductPropertiesKHR
+#endif
+#if defined(VK_KHR_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR
+#endif
+#if defined(VK_KHR_SHADER_TERMINATE_INVOCATION_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR
+#endif
+#if defined(VK_KHR_SHARED_PRESENTABLE_IMAGE_EXTENSION_NAME)
+	{nullptr, false}, //VkSharedPresentSurfaceCapabilitiesKHR
+#endif
+#if defined(VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME)
+	{nullptr, false}, //VkSurfaceProtectedCapabilitiesKHR
+#endif
+#if defined(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+	{nullptr, false}, //VkSwapchainCreateInfoKHR
+	{nullptr, false}, //VkPresentInfoKHR
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
+	{nullptr, false}, //VkMemoryBarrier2KHR
+	{nullptr, false}, //VkImageMemoryBarrier2KHR
+	{nullptr, false}, //VkBufferMemoryBarrier2KHR
+	{nullptr, false}, //VkDependencyInfoKHR
+	{nullptr, false}, //VkSemaphoreSubmitInfoKHR
+	{nullptr, false}, //VkCommandBufferSubmitInfoKHR
+	{nullptr, false}, //VkSubmitInfo2KHR
+	{nullptr, false}, //VkPhysicalDeviceSynchronization2FeaturesKHR
+#endif
+#if defined(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) && defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	{nullptr, false}, //VkQueueFamilyCheckpointProperties2NV
+	{nullptr, false}, //VkCheckpointData2NV
+#endif
+#if defined(VK_KHR_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR
+#endif
+#if defined(VK_KHR_ZERO_INITIALIZE_WORKGROUP_MEMORY_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR
+#endif
+#if defined(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)
+	{nullptr, false}, //VkCuModuleCreateInfoNVX
+	{nullptr, false}, //VkCuFunctionCreateInfoNVX
+	{nullptr, false}, //VkCuLaunchInfoNVX
+#endif
+#if defined(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)
+	{nullptr, false}, //VkImageViewHandleInfoNVX
+	{nullptr, false}, //VkImageViewAddressPropertiesNVX
+#endif
+#if defined(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX
+#endif
+#if defined(VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineViewportWScalingStateCreateInfoNV
+#endif
+#if defined(VK_NV_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceComputeShaderDerivativesFeaturesNV
+#endif
+#if defined(VK_NV_COOPERATIVE_MATRIX_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceCooperativeMatrixFeaturesNV
+	{nullptr, false}, //VkPhysicalDeviceCooperativeMatrixPropertiesNV
+	{nullptr, false}, //VkCooperativeMatrixPropertiesNV
+#endif
+#if defined(VK_NV_CORNER_SAMPLED_IMAGE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceCornerSampledImageFeaturesNV
+#endif
+#if defined(VK_NV_COVERAGE_REDUCTION_MODE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceCoverageReductionModeFeaturesNV
+	{nullptr, false}, //VkPipelineCoverageReductionStateCreateInfoNV
+	{nullptr, false}, //VkFramebufferMixedSamplesCombinationNV
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME)
+	{nullptr, false}, //VkDedicatedAllocationImageCreateInfoNV
+	{nullptr, false}, //VkDedicatedAllocationBufferCreateInfoNV
+	{nullptr, false}, //VkDedicatedAllocationMemoryAllocateInfoNV
+#endif
+#if defined(VK_NV_DEDICATED_ALLOCATION_IMAGE_ALIASING_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTICS_CONFIG_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceDiagnosticsConfigFeaturesNV
+	{nullptr, false}, //VkDeviceDiagnosticsConfigCreateInfoNV
+#endif
+#if defined(VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME)
+	{nullptr, false}, //VkQueueFamilyCheckpointPropertiesNV
+	{nullptr, false}, //VkCheckpointDataNV
+#endif
+#if defined(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV
+	{nullptr, false}, //VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV
+	{nullptr, false}, //VkGraphicsShaderGroupCreateInfoNV
+	{nullptr, false}, //VkGraphicsPipelineShaderGroupsCreateInfoNV
+	{nullptr, false}, //VkIndirectCommandsLayoutTokenNV
+	{nullptr, false}, //VkIndirectCommandsLayoutCreateInfoNV
+	{nullptr, false}, //VkGeneratedCommandsInfoNV
+	{nullptr, false}, //VkGeneratedCommandsMemoryRequirementsInfoNV
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_EXTENSION_NAME)
+	{nullptr, false}, //VkExternalMemoryImageCreateInfoNV
+	{nullptr, false}, //VkExportMemoryAllocateInfoNV
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_RDMA_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceExternalMemoryRDMAFeaturesNV
+	{nullptr, false}, //VkMemoryGetRemoteAddressInfoNV
+#endif
+#if defined(VK_NV_FRAGMENT_COVERAGE_TO_COLOR_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineCoverageToColorStateCreateInfoNV
+#endif
+#if defined(VK_NV_FRAGMENT_SHADER_BARYCENTRIC_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV
+#endif
+#if defined(VK_NV_FRAGMENT_SHADING_RATE_ENUMS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV
+	{nullptr, false}, //VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV
+	{nullptr, false}, //VkPipelineFragmentShadingRateEnumStateCreateInfoNV
+#endif
+#if defined(VK_NV_FRAMEBUFFER_MIXED_SAMPLES_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineCoverageModulationStateCreateInfoNV
+#endif
+#if defined(VK_NV_INHERITED_VIEWPORT_SCISSOR_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceInheritedViewportScissorFeaturesNV
+	{nullptr, false}, //VkCommandBufferInheritanceViewportScissorInfoNV
+#endif
+#if defined(VK_NV_MESH_SHADER_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceMeshShaderFeaturesNV
+	{nullptr, false}, //VkPhysicalDeviceMeshShaderPropertiesNV
+#endif
+#if defined(VK_NV_RAY_TRACING_EXTENSION_NAME)
+	{nullptr, false}, //VkRayTracingShaderGroupCreateInfoNV
+	{nullptr, false}, //VkRayTracingPipelineCreateInfoNV
+	{nullptr, false}, //VkGeometryTrianglesNV
+	{nullptr, false}, //VkGeometryAABBNV
+	{nullptr, false}, //VkGeometryNV
+	{nullptr, false}, //VkAccelerationStructureInfoNV
+	{nullptr, false}, //VkAccelerationStructureCreateInfoNV
+	{nullptr, false}, //VkBindAccelerationStructureMemoryInfoNV
+	{nullptr, false}, //VkWriteDescriptorSetAccelerationStructureNV
+	{nullptr, false}, //VkAccelerationStructureMemoryRequirementsInfoNV
+	{nullptr, false}, //VkPhysicalDeviceRayTracingPropertiesNV
+#endif
+#if defined(VK_NV_RAY_TRACING_MOTION_BLUR_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceRayTracingMotionBlurFeaturesNV
+	{nullptr, false}, //VkAccelerationStructureGeometryMotionTrianglesDataNV
+	{nullptr, false}, //VkAccelerationStructureMotionInfoNV
+#endif
+#if defined(VK_NV_REPRESENTATIVE_FRAGMENT_TEST_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV
+	{nullptr, false}, //VkPipelineRepresentativeFragmentTestStateCreateInfoNV
+#endif
+#if defined(VK_NV_SCISSOR_EXCLUSIVE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceExclusiveScissorFeaturesNV
+	{nullptr, false}, //VkPipelineViewportExclusiveScissorStateCreateInfoNV
+#endif
+#if defined(VK_NV_SHADER_IMAGE_FOOTPRINT_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderImageFootprintFeaturesNV
+#endif
+#if defined(VK_NV_SHADER_SM_BUILTINS_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceShaderSMBuiltinsPropertiesNV
+	{nullptr, false}, //VkPhysicalDeviceShaderSMBuiltinsFeaturesNV
+#endif
+#if defined(VK_NV_SHADING_RATE_IMAGE_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineViewportShadingRateImageStateCreateInfoNV
+	{nullptr, false}, //VkPhysicalDeviceShadingRateImageFeaturesNV
+	{nullptr, false}, //VkPhysicalDeviceShadingRateImagePropertiesNV
+	{nullptr, false}, //VkPipelineViewportCoarseSampleOrderStateCreateInfoNV
+#endif
+#if defined(VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME)
+	{nullptr, false}, //VkPipelineViewportSwizzleStateCreateInfoNV
+#endif
+#if defined(VK_QCOM_RENDER_PASS_TRANSFORM_EXTENSION_NAME)
+	{nullptr, false}, //VkRenderPassTransformBeginInfoQCOM
+	{nullptr, false}, //VkCommandBufferInheritanceRenderPassTransformInfoQCOM
+#endif
+#if defined(VK_QCOM_ROTATED_COPY_COMMANDS_EXTENSION_NAME)
+	{nullptr, false}, //VkCopyCommandTransformInfoQCOM
+#endif
+#if defined(VK_VALVE_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)
+	{nullptr, false}, //VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE
+	{nullptr, false}, //VkMutableDescriptorTypeCreateInfoVALVE
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkVideoDecodeH264ProfileEXT
+	{nullptr, false}, //VkVideoDecodeH264CapabilitiesEXT
+	{nullptr, false}, //VkVideoDecodeH264SessionCreateInfoEXT
+	{nullptr, false}, //VkVideoDecodeH264SessionParametersAddInfoEXT
+	{nullptr, false}, //VkVideoDecodeH264SessionParametersCreateInfoEXT
+	{nullptr, false}, //VkVideoDecodeH264PictureInfoEXT
+	{nullptr, false}, //VkVideoDecodeH264DpbSlotInfoEXT
+	{nullptr, false}, //VkVideoDecodeH264MvcEXT
+#endif
+#if defined(VK_EXT_VIDEO_DECODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkVideoDecodeH265ProfileEXT
+	{nullptr, false}, //VkVideoDecodeH265CapabilitiesEXT
+	{nullptr, false}, //VkVideoDecodeH265SessionCreateInfoEXT
+	{nullptr, false}, //VkVideoDecodeH265SessionParametersAddInfoEXT
+	{nullptr, false}, //VkVideoDecodeH265SessionParametersCreateInfoEXT
+	{nullptr, false}, //VkVideoDecodeH265PictureInfoEXT
+	{nullptr, false}, //VkVideoDecodeH265DpbSlotInfoEXT
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H264_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkVideoEncodeH264CapabilitiesEXT
+	{nullptr, false}, //VkVideoEncodeH264SessionCreateInfoEXT
+	{nullptr, false}, //VkVideoEncodeH264SessionParametersAddInfoEXT
+	{nullptr, false}, //VkVideoEncodeH264SessionParametersCreateInfoEXT
+	{nullptr, false}, //VkVideoEncodeH264DpbSlotInfoEXT
+	{nullptr, false}, //VkVideoEncodeH264VclFrameInfoEXT
+	{nullptr, false}, //VkVideoEncodeH264EmitPictureParametersEXT
+	{nullptr, false}, //VkVideoEncodeH264ProfileEXT
+	{nullptr, false}, //VkVideoEncodeH264NaluSliceEXT
+#endif
+#if defined(VK_EXT_VIDEO_ENCODE_H265_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkVideoEncodeH265CapabilitiesEXT
+	{nullptr, false}, //VkVideoEncodeH265SessionCreateInfoEXT
+	{nullptr, false}, //VkVideoEncodeH265SessionParametersAddInfoEXT
+	{nullptr, false}, //VkVideoEncodeH265SessionParametersCreateInfoEXT
+	{nullptr, false}, //VkVideoEncodeH265VclFrameInfoEXT
+	{nullptr, false}, //VkVideoEncodeH265EmitPictureParametersEXT
+	{nullptr, false}, //VkVideoEncodeH265NaluSliceEXT
+	{nullptr, false}, //VkVideoEncodeH265ProfileEXT
+	{nullptr, false}, //VkVideoEncodeH265DpbSlotInfoEXT
+	{nullptr, false}, //VkVideoEncodeH265ReferenceListsEXT
+#endif
+#if defined(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkPhysicalDevicePortabilitySubsetFeaturesKHR
+	{nullptr, false}, //VkPhysicalDevicePortabilitySubsetPropertiesKHR
+#endif
+#if defined(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkVideoDecodeInfoKHR
+#endif
+#if defined(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkVideoEncodeInfoKHR
+	{nullptr, false}, //VkVideoEncodeRateControlInfoKHR
+#endif
+#if defined(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME) && defined(VK_ENABLE_BETA_EXTENSIONS)
+	{nullptr, false}, //VkVideoQueueFamilyProperties2KHR
+	{nullptr, false}, //VkVideoProfilesKHR
+	{nullptr, false}, //VkPhysicalDeviceVideoFormatInfoKHR
+	{nullptr, false}, //VkVideoFormatPropertiesKHR
+	{nullptr, false}, //VkVideoProfileKHR
+	{nullptr, false}, //VkVideoCapabilitiesKHR
+	{nullptr, false}, //VkVideoGetMemoryPropertiesKHR
+	{nullptr, false}, //VkVideoBindMemoryKHR
+	{nullptr, false}, //VkVideoPictureResourceKHR
+	{nullptr, false}, //VkVideoReferenceSlotKHR
+	{nullptr, false}, //VkVideoSessionCreateInfoKHR
+	{nullptr, false}, //VkVideoSessionParametersCreateInfoKHR
+	{nullptr, false}, //VkVideoSessionParametersUpdateInfoKHR
+	{nullptr, false}, //VkVideoBeginCodingInfoKHR
+	{nullptr, false}, //VkVideoEndCodingInfoKHR
+	{nullptr, false}, //VkVideoCodingControlInfoKHR
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{nullptr, false}, //VkImportAndroidHardwareBufferInfoANDROID
+	{nullptr, false}, //VkAndroidHardwareBufferUsageANDROID
+	{nullptr, false}, //VkAndroidHardwareBufferPropertiesANDROID
+	{nullptr, false}, //VkMemoryGetAndroidHardwareBufferInfoANDROID
+	{nullptr, false}, //VkAndroidHardwareBufferFormatPropertiesANDROID
+	{nullptr, false}, //VkExternalFormatANDROID
+#endif
+#if defined(VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) && defined(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{nullptr, false}, //VkAndroidHardwareBufferFormatProperties2ANDROID
+#endif
+#if defined(VK_ANDROID_NATIVE_BUFFER_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{nullptr, false}, //VkNativeBufferANDROID
+	{nullptr, false}, //VkSwapchainImageCreateInfoANDROID
+	{nullptr, false}, //VkPhysicalDevicePresentationPropertiesANDROID
+#endif
+#if defined(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_ANDROID_KHR)
+	{nullptr, false}, //VkAndroidSurfaceCreateInfoKHR
+#endif
+#if defined(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+	{nullptr, false}, //VkDirectFBSurfaceCreateInfoEXT
+#endif
+#if defined(VK_FUCHSIA_BUFFER_COLLECTION_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{nullptr, false}, //VkImportMemoryBufferCollectionFUCHSIA
+	{nullptr, false}, //VkBufferCollectionImageCreateInfoFUCHSIA
+	{nullptr, false}, //VkBufferCollectionBufferCreateInfoFUCHSIA
+	{nullptr, false}, //VkBufferCollectionCreateInfoFUCHSIA
+	{nullptr, false}, //VkBufferCollectionPropertiesFUCHSIA
+	{nullptr, false}, //VkBufferConstraintsInfoFUCHSIA
+	{nullptr, false}, //VkSysmemColorSpaceFUCHSIA
+	{nullptr, false}, //VkImageFormatConstraintsInfoFUCHSIA
+	{nullptr, false}, //VkImageConstraintsInfoFUCHSIA
+	{nullptr, false}, //VkBufferCollectionConstraintsInfoFUCHSIA
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_MEMORY_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{nullptr, false}, //VkImportMemoryZirconHandleInfoFUCHSIA
+	{nullptr, false}, //VkMemoryZirconHandlePropertiesFUCHSIA
+	{nullptr, false}, //VkMemoryGetZirconHandleInfoFUCHSIA
+#endif
+#if defined(VK_FUCHSIA_EXTERNAL_SEMAPHORE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{nullptr, false}, //VkImportSemaphoreZirconHandleInfoFUCHSIA
+	{nullptr, false}, //VkSemaphoreGetZirconHandleInfoFUCHSIA
+#endif
+#if defined(VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_FUCHSIA)
+	{nullptr, false}, //VkImagePipeSurfaceCreateInfoFUCHSIA
+#endif
+#if defined(VK_GGP_FRAME_TOKEN_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	{nullptr, false}, //VkPresentFrameTokenGGP
+#endif
+#if defined(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_GGP)
+	{nullptr, false}, //VkStreamDescriptorSurfaceCreateInfoGGP
+#endif
+#if defined(VK_MVK_IOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_IOS_MVK)
+	{nullptr, false}, //VkIOSSurfaceCreateInfoMVK
+#endif
+#if defined(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_MACOS_MVK)
+	{nullptr, false}, //VkMacOSSurfaceCreateInfoMVK
+#endif
+#if defined(VK_EXT_METAL_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_METAL_EXT)
+	{nullptr, false}, //VkMetalSurfaceCreateInfoEXT
+#endif
+#if defined(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_SCREEN_QNX)
+	{nullptr, false}, //VkScreenSurfaceCreateInfoQNX
+#endif
+#if defined(VK_NN_VI_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_VI_NN)
+	{nullptr, false}, //VkViSurfaceCreateInfoNN
+#endif
+#if defined(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WAYLAND_KHR)
+	{nullptr, false}, //VkWaylandSurfaceCreateInfoKHR
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkSurfaceFullScreenExclusiveInfoEXT
+	{nullptr, false}, //VkSurfaceCapabilitiesFullScreenExclusiveEXT
+#endif
+#if defined(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME) && defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkSurfaceFullScreenExclusiveWin32InfoEXT
+#endif
+#if defined(VK_KHR_EXTERNAL_FENCE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkImportFenceWin32HandleInfoKHR
+	{nullptr, false}, //VkExportFenceWin32HandleInfoKHR
+	{nullptr, false}, //VkFenceGetWin32HandleInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkImportMemoryWin32HandleInfoKHR
+	{nullptr, false}, //VkExportMemoryWin32HandleInfoKHR
+	{nullptr, false}, //VkMemoryWin32HandlePropertiesKHR
+	{nullptr, false}, //VkMemoryGetWin32HandleInfoKHR
+#endif
+#if defined(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkImportSemaphoreWin32HandleInfoKHR
+	{nullptr, false}, //VkExportSemaphoreWin32HandleInfoKHR
+	{nullptr, false}, //VkD3D12FenceSubmitInfoKHR
+	{nullptr, false}, //VkSemaphoreGetWin32HandleInfoKHR
+#endif
+#if defined(VK_KHR_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkWin32KeyedMutexAcquireReleaseInfoKHR
+#endif
+#if defined(VK_KHR_WIN32_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkWin32SurfaceCreateInfoKHR
+#endif
+#if defined(VK_NV_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkImportMemoryWin32HandleInfoNV
+	{nullptr, false}, //VkExportMemoryWin32HandleInfoNV
+#endif
+#if defined(VK_NV_WIN32_KEYED_MUTEX_EXTENSION_NAME) && defined(VK_USE_PLATFORM_WIN32_KHR)
+	{nullptr, false}, //VkWin32KeyedMutexAcquireReleaseInfoNV
+#endif
+#if defined(VK_KHR_XCB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XCB_KHR)
+	{nullptr, false}, //VkXcbSurfaceCreateInfoKHR
+#endif
+#if defined(VK_KHR_XLIB_SURFACE_EXTENSION_NAME) && defined(VK_USE_PLATFORM_XLIB_KHR)
+	{nullptr, false}, //VkXlibSurfaceCreateInfoKHR
+#endif
+	{nullptr, false}
+};
+
+//==========================================================================================================================
+
+//Base interface for StructureBlob(owning type-erased structure) and GenericStructureView(non-owning type-erased structure)
+class GenericStructBase
+{
+protected:
+	GenericStructBase();
+	GenericStructBase(std::byte* data, size_t dataSize, ptrdiff_t pNextOffset, ptrdiff_t sTypeOffset);
+	~GenericStructBase();
+
+public:
+	template<typename Struct>
+	Struct& GetDataAs();
+
+	std::byte* GetStructureData() const;
+	size_t	 GetStructureSize() const;
+
+	ptrdiff_t GetPNextOffset() const;
+	void*	 GetPNext()	   const;
+
+	ptrdiff_t		   GetSTypeOffset() const;
+	VulkanStructureType GetSType()	   const;
+
+	//Both ignore the value of pNext and the padding
+	uint64_t Hash() const;
+	bool	 operator==(const GenericStructBase& rhs) const;
+	bool	 operator!=(const GenericStructBase& rhs) const;
+
+protected:
+	std::byte* StructureData;
+	size_t	 StructureSize;
+
+	ptrdiff_t PNextPointerOffset;
+	ptrdiff_t STypeOffset;
+};
+
+inline GenericStructBase::GenericStructBase(): StructureData(nullptr), StructureSize(0), PNextPointerOffset(0), STypeOffset(0)
+{
+}
+
+inline GenericStructBase::GenericStructBase(std::byte* data, size_t dataSize, ptrdiff_t pNextOffset, ptrdiff_t sTypeOffset): StructureData(data), StructureSize(dataSize), PNextPointerOffset(pNextOffset), STypeOffset(sTypeOffset)
+{
+}
+
+inline GenericStructBase::~GenericStructBase()
+{
+}
+
+template<typename Struct>
+inline Struct& GenericStructBase::GetDataAs()
+{
+	assert(GetStructureSize() == sizeof(Struct));
+	assert(StructureData != nullptr);
+
+	Struct* structureData = reinterpret_cast<Struct*>(StructureData);
+	return *structureData;
+}
+
+inline std::byte* GenericStructBase::GetStructureData() const
+{
+	assert(GetStructureSize() != 0);
+
+	return StructureData;
+}
+
+inline size_t GenericStructBase::GetStructureSize() const
+{
+	return StructureSize;
+}
+
+inline ptrdiff_t GenericStructBase::GetPNextOffset() const
+{
+	return PNextPointerOffset;
+}
+
+inline void* GenericStructBase::GetPNext() const
+{
+	assert(PNextPointerOffset + sizeof(void*) <= GetStructureSize());
+
+	void* pNext = nullptr;
+	memcpy(&pNext, StructureData + PNextPointerOffset, sizeof(void*));
+
+	return pNext;
+}
+
+inline ptrdiff_t GenericStructBase::GetSTypeOffset() const
+{
+	return STypeOffset;
+}
+
+inline VulkanStructureType GenericStructBase::GetSType() const
+{
+	assert(STypeOffset + sizeof(VulkanStructureType) <= GetStructureSize());
+
+	VulkanStructureType sType;
+	memcpy(&sType, StructureData + STypeOffset, sizeof(VulkanStructureType));
+
+	return sType;
+}
+
+//==========================================================================================================================
+
+//Calls visitor(typedStructure) with the structure cast to the type its sType tells, e.g. Visit(pNextLink, [](auto& typedLink){...})
+//The dispatch is a lookup of the dense structure ordinal and a single indirect call through StructureVisitFunctions
+//Return false if the sType is unknown or the structure is not available in this configuration
+template<typename Visitor>
+bool Visit(void* structure, Visitor&& visitor);
+
+template<typename Visitor>
+bool Visit(const GenericStructBase& structure, Visitor&& visitor);
+
+template<typename Visitor>
+inline bool VisitWithSType(VulkanStructureType sType, void* structure, Visitor& visitor)
+{
+	uint32_t ordinal = GetStructureOrdinal(sType);
+	if(ordinal == NoStructureOrdinal)
+	{
+		return false;
+	}
+
+	StructureVisitFunctions<Visitor>[ordinal](structure, visitor);
+	return true;
+}
+
+template<typename Visitor>
+inline bool Visit(void* structure, Visitor&& visitor)
+{
+	assert(structure != nullptr);
+
+	VulkanStructureType sType;
+	memcpy(&sType, structure, sizeof(VulkanStructureType));
+
+	return VisitWithSType<std::remove_reference_t<Visitor>>(sType, structure, visitor);
+}
+
+template<typename Visitor>
+inline bool Visit(const GenericStructBase& structure, Visitor&& visitor)
+{
+	return VisitWithSType<std::remove_reference_t<Visitor>>(structure.GetSType(), structure.GetStructureData(), visitor);
+}
+
+//==========================================================================================================================
+
+//Non-owning version of a generic structure
+class GenericStruct: public GenericStructBase
+{
+public:
+	template<typename Struct>
+	GenericStruct(Struct& structure);
+
+	//The copy constructor should be template-specialized, because <const GenericStructureView&> can be passed as a <Struct&>
+	template<>
+	GenericStruct(const GenericStruct& right);
+	GenericStruct& operator=(const GenericStruct& right);
+};
+
+template<typename Struct>
+inline GenericStruct::GenericStruct(Struct& structure): GenericStructBase(reinterpret_cast<std::byte*>(&structure), sizeof(Struct), offsetof(Struct, pNext), offsetof(Struct, sType))
+{
+}
+
+template<>
+inline GenericStruct::GenericStruct(const GenericStruct& right): GenericStructBase(right.StructureData, right.StructureSize, right.PNextPointerOffset, right.STypeOffset)
+{
+}
+
+inline GenericStruct& GenericStruct::operator=(const GenericStruct& right)
+{
+	StructureData	  = right.StructureData;
+	StructureSize	  = right.StructureSize;
+	STypeOffset		= right.STypeOffset;
+	PNextPointerOffset = right.PNextPointerOffset;
+
+	return *this;
+}
+
+//Creates a GenericStruct and automatically fills in sType (a side effect which is undesireable in constructors)
+template<typename Struct>
+inline GenericStruct TransmuteTypeToSType(Struct& structure)
+{
+	InitSType(&structure, offsetof(Struct, sType), ValidStructureType<Struct>);
+	return GenericStruct(structure);
+}
+
+//==========================================================================================================================
+
+//Owning version of a generic structure
+class StructureBlob: public GenericStructBase
+{
+public:
+	StructureBlob();
+
+	StructureBlob(const StructureBlob& right);
+	StructureBlob& operator=(const StructureBlob& right);
+
+	template<typename Struct>
+	StructureBlob(const Struct& structure);
+
+	//Serializes the structure alone, see SerializeStructures()
+	std::vector<std::byte> Serialize() const;
+
+	//Loads the head structure serialized with SerializeStructures(). Returns false if the data is not valid or is a deep serialization
+	static bool Deserialize(const void* serializedData, size_t serializedSize, StructureBlob& outBlob);
+
+private:
+	std::vector<std::byte> StructureBlobData;
+};
+
+inline StructureBlob::StructureBlob()
+{
+	PNextPointerOffset = 0;
+	STypeOffset		= 0;
+
+	StructureData = nullptr;
+	StructureSize = 0;
+}
+
+template<typename Struct>
+inline StructureBlob::StructureBlob(const Struct& structure)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "Structure blob contents must be trivially destructible");
+
+	PNextPointerOffset = offsetof(Struct, pNext);
+	STypeOffset		= offsetof(Struct, sType);
+
+	StructureBlobData.resize(sizeof(Struct));
+	memcpy(StructureBlobData.data(), &structure, sizeof(Struct));
+
+	StructureData = StructureBlobData.data();
+	StructureSize = StructureBlobData.size();
+
+	//Init sType and set pNext to null
+	VulkanStructureType structureType = ValidStructureType<Struct>;
+	InitSType(StructureBlobData.data(), STypeOffset, structureType);
+
+	void* nullPNext = nullptr;
+	memcpy(StructureBlobData.data() + PNextPointerOffset, &nullPNext, sizeof(void*));
+}
+
+inline StructureBlob::StructureBlob(const StructureBlob& right)
+{
+	*this = right;
+}
+
+inline StructureBlob& StructureBlob::operator=(const StructureBlob& right)
+{
+	StructureBlobData.assign(right.StructureBlobData.begin(), right.StructureBlobData.end());
+
+	StructureData = StructureBlobData.data();
+	StructureSize = StructureBlobData.size();
+
+	STypeOffset		= right.STypeOffset;
+	PNextPointerOffset = right.PNextPointerOffset;
+
+	//Default-constructed blob has no pNext to zero out
+	if(StructureBlobData.empty())
+	{
+		return *this;
+	}
+
+	assert(PNextPointerOffset + sizeof(void*) <= StructureBlobData.size());
+
+	//Zero out PNext
+	memset(StructureBlobData.data() + PNextPointerOffset, 0, sizeof(void*));
+
+	return *this;
+}
+
+//==========================================================================================================================
+
+inline uint32_t FindLowestSetBit(uint64_t value)
+{
+	assert(value != 0);
+
+	uint32_t index = 0;
+	if((value & 0x00000000FFFFFFFFull) == 0) { value >>= 32; index += 32; }
+	if((value & 0x000000000000FFFFull) == 0) { value >>= 16; index += 16; }
+	if((value & 0x00000000000000FFull) == 0) { value >>= 8;  index += 8;  }
+	if((value & 0x000000000000000Full) == 0) { value >>= 4;  index += 4;  }
+	if((value & 0x0000000000000003ull) == 0) { value >>= 2;  index += 2;  }
+	if((value & 0x0000000000000001ull) == 0) { index += 1; }
+
+	return index;
+}
+
+inline uint32_t FindHighestSetBit(uint64_t value)
+{
+	assert(value != 0);
+
+	uint32_t index = 0;
+	if(value & 0xFFFFFFFF00000000ull) { value >>= 32; index += 32; }
+	if(value & 0x00000000FFFF0000ull) { value >>= 16; index += 16; }
+	if(value & 0x000000000000FF00ull) { value >>= 8;  index += 8;  }
+	if(value & 0x00000000000000F0ull) { value >>= 4;  index += 4;  }
+	if(value & 0x000000000000000Cull) { value >>= 2;  index += 2;  }
+	if(value & 0x0000000000000002ull) { index += 1; }
+
+	return index;
+}
+
+//==========================================================================================================================
+
+//Flat sType -> link indices map. Keeps every occurrence of every structure type, so the chains can hold duplicate structures.
+//The map itself is an open-addressing table, and all indices live in a single shared pool where each sType owns a contiguous run.
+//A run that outgrows its capacity is moved to a free run of twice the capacity, so lookups of any occurrence are O(1).
+//Capacities are powers of two, the runs left behind are kept in a free list per capacity and reused, so the pool doesn't grow in edit loops
+class StructureTypeIndexMap
+{
+public:
+	StructureTypeIndexMap();
+	~StructureTypeIndexMap();
+
+	StructureTypeIndexMap(const StructureTypeIndexMap& rhs)			   = default;
+	StructureTypeIndexMap& operator=(const StructureTypeIndexMap& rhs) = default;
+
+	StructureTypeIndexMap(StructureTypeIndexMap&& rhs)			  = default;
+	StructureTypeIndexMap& operator=(StructureTypeIndexMap&& rhs) = default;
+
+	void Clear();
+
+	void AddIndex(VulkanStructureType sType, size_t index);
+	void RemoveIndex(VulkanStructureType sType, size_t index);
+
+	size_t GetIndex(VulkanStructureType sType, size_t occurrence) const;
+	size_t GetCount(VulkanStructureType sType)                    const;
+
+private:
+	struct TypeEntry
+	{
+		VulkanStructureType SType;
+		uint32_t			RunStart;
+		uint32_t			RunCount;
+		uint32_t			RunCapacity;
+	};
+
+	static constexpr VulkanStructureType EmptySType = static_cast<VulkanStructureType>(0x7FFFFFFF);
+	static constexpr size_t				 NoEntry	= (size_t)(-1);
+
+	size_t HashSType(VulkanStructureType sType) const;
+
+	size_t	   FindEntry(VulkanStructureType sType) const;
+	TypeEntry& FindOrAddEntry(VulkanStructureType sType);
+
+	void Rehash(size_t newTableSize);
+
+	uint32_t AllocateRun(uint32_t runCapacity);
+	void	 FreeRun(uint32_t runStart, uint32_t runCapacity);
+
+private:
+	static constexpr uint32_t RunCapacityClassCount = 32;
+
+	std::vector<TypeEntry> TypeEntries;
+	std::vector<uint32_t>  IndexPool;
+	std::vector<uint32_t>  FreeRunStarts[RunCapacityClassCount]; //Indexed by log2 of the run capacity
+
+	size_t UsedEntryCount;
+};
+
+inline StructureTypeIndexMap::StructureTypeIndexMap(): UsedEntryCount(0)
+{
+}
+
+inline StructureTypeIndexMap::~StructureTypeIndexMap()
+{
+}
+
+inline void StructureTypeIndexMap::Clear()
+{
+	//Keep the allocated memory, it's going to be reused for the same chain anyway
+	for(TypeEntry& entry: TypeEntries)
+	{
+		entry.SType = EmptySType;
+	}
+
+	IndexPool.clear();
+	for(std::vector<uint32_t>& freeRunStarts: FreeRunStarts)
+	{
+		freeRunStarts.clear();
+	}
+
+	UsedEntryCount = 0;
+}
+
+inline void StructureTypeIndexMap::AddIndex(VulkanStructureType sType, size_t index)
+{
+	TypeEntry& entry = FindOrAddEntry(sType);
+	if(entry.RunCount == entry.RunCapacity)
+	{
+		//Relocate the run to a bigger one, the old run goes to the free list
+		uint32_t newRunCapacity = entry.RunCapacity * 2;
+		uint32_t newRunStart    = AllocateRun(newRunCapacity);
+
+		memcpy(IndexPool.data() + newRunStart, IndexPool.data() + entry.RunStart, entry.RunCount * sizeof(uint32_t));
+		FreeRun(entry.RunStart, entry.RunCapacity);
+
+		entry.RunStart    = newRunStart;
+		entry.RunCapacity = newRunCapacity;
+	}
+
+	IndexPool[entry.RunStart + entry.RunCount] = (uint32_t)index;
+	entry.RunCount++;
+}
+
+inline void StructureTypeIndexMap::RemoveIndex(VulkanStructureType sType, size_t index)
+{
+	size_t entrySlot = FindEntry(sType);
+	assert(entrySlot != NoEntry);
+
+	//Keep the order of the remaining occurrences, so it's O(occurrences of the sType), which is 1 for almost every chain
+	//The entry itself and its run stay in the table even if the run becomes empty, the same sType is likely to be added again
+	TypeEntry& entry = TypeEntries[entrySlot];
+	for(uint32_t i = 0; i < entry.RunCount; i++)
+	{
+		if(IndexPool[entry.RunStart + i] == (uint32_t)index)
+		{
+			memmove(IndexPool.data() + entry.RunStart + i, IndexPool.data() + entry.RunStart + i + 1, (entry.RunCount - i - 1) * sizeof(uint32_t));
+			entry.RunCount--;
+			return;
+		}
+	}
+
+	assert(false); //The index was never added
+}
+
+inline size_t StructureTypeIndexMap::GetIndex(VulkanStructureType sType, size_t occurrence) const
+{
+	size_t entrySlot = FindEntry(sType);
+	assert(entrySlot != NoEntry);
+
+	const TypeEntry& entry = TypeEntries[entrySlot];
+	assert(occurrence < entry.RunCount);
+
+	return IndexPool[entry.RunStart + occurrence];
+}
+
+inline size_t StructureTypeIndexMap::GetCount(VulkanStructureType sType) const
+{
+	size_t entrySlot = FindEntry(sType);
+	if(entrySlot == NoEntry)
+	{
+		return 0;
+	}
+
+	return TypeEntries[entrySlot].RunCount;
+}
+
+inline size_t StructureTypeIndexMap::HashSType(VulkanStructureType sType) const
+{
+	//Extension sTypes differ mostly in the middle digits, Fibonacci hashing spreads them well enough
+	uint64_t hash = (uint64_t)(uint32_t)sType * 0x9E3779B97F4A7C15ull;
+	return (size_t)(hash >> 32) & (TypeEntries.size() - 1);
+}
+
+inline size_t StructureTypeIndexMap::FindEntry(VulkanStructureType sType) const
+{
+	if(TypeEntries.size() == 0)
+	{
+		return NoEntry;
+	}
+
+	size_t tableMask = TypeEntries.size() - 1;
+	for(size_t slot = HashSType(sType); ; slot = (slot + 1) & tableMask)
+	{
+		const TypeEntry& entry = TypeEntries[slot];
+		if(entry.SType == sType)
+		{
+			return slot;
+		}
+		else if(entry.SType == EmptySType)
+		{
+			return NoEntry;
+		}
+	}
+}
+
+inline StructureTypeIndexMap::TypeEntry& StructureTypeIndexMap::FindOrAddEntry(VulkanStructureType sType)
+{
+	assert(sType != EmptySType);
+
+	//Keep the load factor at most 1/2
+	if((UsedEntryCount + 1) * 2 > TypeEntries.size())
+	{
+		Rehash(TypeEntries.size() == 0 ? 16 : TypeEntries.size() * 2);
+	}
+
+	size_t tableMask = TypeEntries.size() - 1;
+	for(size_t slot = HashSType(sType); ; slot = (slot + 1) & tableMask)
+	{
+		TypeEntry& entry = TypeEntries[slot];
+		if(entry.SType == sType)
+		{
+			return entry;
+		}
+		else if(entry.SType == EmptySType)
+		{
+			entry.SType       = sType;
+			entry.RunStart    = AllocateRun(1);
+			entry.RunCount    = 0;
+			entry.RunCapacity = 1;
+
+			UsedEntryCount++;
+
+			return entry;
+		}
+	}
+}
+
+inline void StructureTypeIndexMap::Rehash(size_t newTableSize)
+{
+	std::vector<TypeEntry> oldEntries = std::move(TypeEntries);
+
+	TypeEntries.assign(newTableSize, TypeEntry{EmptySType, 0, 0, 0});
+
+	size_t tableMask = TypeEntries.size() - 1;
+	for(const TypeEntry& oldEntry: oldEntries)
+	{
+		if(oldEntry.SType == EmptySType)
+		{
+			continue;
+		}
+
+		size_t slot = HashSType(oldEntry.SType);
+		while(TypeEntries[slot].SType != EmptySType)
+		{
+			slot = (slot + 1) & tableMask;
+		}
+
+		TypeEntries[slot] = oldEntry;
+	}
+}
+
+inline uint32_t StructureTypeIndexMap::AllocateRun(uint32_t runCapacity)
+{
+	std::vector<uint32_t>& freeRunStarts = FreeRunStarts[FindLowestSetBit(runCapacity)];
+	if(!freeRunStarts.empty())
+	{
+		uint32_t runStart = freeRunStarts.back();
+		freeRunStarts.pop_back();
+		return runStart;
+	}
+
+	uint32_t runStart = (uint32_t)IndexPool.size();
+	IndexPool.resize(IndexPool.size() + runCapacity);
+	return runStart;
+}
+
+inline void StructureTypeIndexMap::FreeRun(uint32_t runStart, uint32_t runCapacity)
+{
+	FreeRunStarts[FindLowestSetBit(runCapacity)].push_back(runStart);
+}
+
+//==========================================================================================================================
+
+//Alignment of every structure stored in owning chains, enough for any Vulkan structure
+constexpr size_t ChainLinkDataAlignment = alignof(uint64_t) > alignof(void*) ? alignof(uint64_t) : alignof(void*);
+
+//Raw access to sType and pNext of any Vulkan structure, for walking the chains of unknown structures
+inline VulkanStructureType GetChainLinkSType(const void* structure)
+{
+	VulkanStructureType sType;
+	memcpy(&sType, (const std::byte*)structure + offsetof(VkBaseInStructure, sType), sizeof(VulkanStructureType));
+
+	return sType;
+}
+
+inline const void* GetChainLinkPNext(const void* structure)
+{
+	const void* pNext = nullptr;
+	memcpy(&pNext, (const std::byte*)structure + offsetof(VkBaseInStructure, pNext), sizeof(void*));
+
+	return pNext;
+}
+
+inline void SetChainLinkPNext(void* structure, const void* pNext)
+{
+	memcpy((std::byte*)structure + offsetof(VkBaseOutStructure, pNext), &pNext, sizeof(void*));
+}
+
+//==========================================================================================================================
+
+//Final mixing step of the hash, so every input bit affects every output bit
+constexpr uint64_t MixHash(uint64_t hash)
+{
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDull;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ull;
+	hash ^= hash >> 33;
+
+	return hash;
+}
+
+constexpr uint64_t NameHashBasis = 0xCBF29CE484222325ull;
+constexpr uint64_t NameHashPrime = 0x100000001B3ull;
+
+//FNV-1a, same as the generator uses for the perfect hash tables of names. Can be continued, e.g. with the structure name hashed once for all its members
+constexpr uint64_t HashName(uint64_t nameHash, const char* name, size_t nameLength)
+{
+	for(size_t i = 0; i < nameLength; i++)
+	{
+		nameHash = (nameHash ^ (uint8_t)name[i]) * NameHashPrime;
+	}
+
+	return nameHash;
+}
+
+//Hashes 32 bytes per iteration in 4 independent lanes, so the main loop can be vectorized
+//Returns the number of bytes hashed, the rest is the tail shorter than an iteration
+inline size_t HashBytesLanes(const std::byte* data, size_t dataSize, uint64_t* lanes)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	size_t offset = 0;
+	for(; offset + 4 * sizeof(uint64_t) <= dataSize; offset += 4 * sizeof(uint64_t))
+	{
+		for(size_t i = 0; i < 4; i++)
+		{
+			uint64_t word;
+			memcpy(&word, data + offset + i * sizeof(uint64_t), sizeof(uint64_t));
+
+			lanes[i] = (lanes[i] ^ word) * multiplier;
+			lanes[i] = lanes[i] ^ (lanes[i] >> 29);
+		}
+	}
+
+	return offset;
+}
+
+//Folds the lanes and the tail into the final hash. The tail is zero-padded to the whole word
+inline uint64_t HashBytesFold(const uint64_t* lanes, const std::byte* tailData, size_t tailSize, uint64_t hash)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	for(size_t i = 0; i < 4; i++)
+	{
+		hash = (hash ^ MixHash(lanes[i])) * multiplier;
+	}
+
+	for(size_t offset = 0; offset < tailSize; offset += sizeof(uint64_t))
+	{
+		uint64_t word = 0;
+		memcpy(&word, tailData + offset, tailSize - offset < sizeof(uint64_t) ? tailSize - offset : sizeof(uint64_t));
+
+		hash = (hash ^ word) * multiplier;
+		hash = hash ^ (hash >> 29);
+	}
+
+	return MixHash(hash);
+}
+
+inline uint64_t HashBytes(const std::byte* data, size_t dataSize, uint64_t seed = 0)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	uint64_t lanes[4] = {seed, seed + multiplier, seed ^ multiplier, seed - multiplier};
+	size_t	 laneDataSize = HashBytesLanes(data, dataSize, lanes);
+
+	return HashBytesFold(lanes, data + laneDataSize, dataSize - laneDataSize, dataSize);
+}
+
+//128-bit hash, for the keys that are compared by the hash alone. Both halves are folded from the same lanes in different order
+inline void HashBytes128(const std::byte* data, size_t dataSize, uint64_t* outHash)
+{
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+	uint64_t lanes[4] = {0, multiplier, multiplier, 0 - multiplier};
+	size_t	 laneDataSize = HashBytesLanes(data, dataSize, lanes);
+
+	uint64_t reversedLanes[4] = {lanes[3], lanes[2], lanes[1], lanes[0]};
+
+	outHash[0] = HashBytesFold(lanes,		  data + laneDataSize, dataSize - laneDataSize, dataSize);
+	outHash[1] = HashBytesFold(reversedLanes, data + laneDataSize, dataSize - laneDataSize, ~(uint64_t)dataSize);
+}
+
+//Copies only the given members of the structure, everything between them is zeroed out
+inline void CopyStructureMemberRanges(std::byte* maskedData, const std::byte* structureData, size_t structureSize, const StructureMemberRange* memberRanges, size_t rangeCount)
+{
+	memset(maskedData, 0, structureSize);
+	for(size_t i = 0; i < rangeCount; i++)
+	{
+		memcpy(maskedData + memberRanges[i].Offset, structureData + memberRanges[i].Offset, memberRanges[i].Size);
+	}
+}
+
+//Copies the structure with pNext and padding zeroed out. Padding is known from the generated member ranges
+//For the structures with unknown layout only pNext is zeroed out
+inline void CopyMaskedStructure(std::byte* maskedData, const std::byte* structureData, size_t structureSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset)
+{
+	VulkanStructureType sType;
+	memcpy(&sType, structureData + sTypeOffset, sizeof(VulkanStructureType));
+
+	size_t						rangeCount   = 0;
+	const StructureMemberRange* memberRanges = GetSTypeMemberRanges(sType, &rangeCount);
+	if(memberRanges != nullptr && GetSTypeStructureSize(sType) == structureSize)
+	{
+		CopyStructureMemberRanges(maskedData, structureData, structureSize, memberRanges, rangeCount);
+	}
+	else
+	{
+		memcpy(maskedData, structureData, structureSize);
+		memset(maskedData + pNextOffset, 0, sizeof(void*));
+	}
+}
+
+//Copy of the structure with pNext and padding zeroed out, for hashing and comparison
+class MaskedStructure
+{
+public:
+	MaskedStructure(const std::byte* structureData, size_t structureSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset);
+	~MaskedStructure();
+
+	const std::byte* GetData() const;
+	size_t			 GetSize() const;
+
+public:
+	MaskedStructure(const MaskedStructure& rhs)			   = delete;
+	MaskedStructure& operator=(const MaskedStructure& rhs) = delete;
+
+private:
+	//Most structures fit into the stack buffer
+	std::byte			   StackData[1024];
+	std::vector<std::byte> HeapData;
+
+	std::byte* Data;
+	size_t	   Size;
+};
+
+inline MaskedStructure::MaskedStructure(const std::byte* structureData, size_t structureSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset): Data(StackData), Size(structureSize)
+{
+	if(Size == 0)
+	{
+		return;
+	}
+
+	if(Size > sizeof(StackData))
+	{
+		HeapData.resize(Size);
+		Data = HeapData.data();
+	}
+
+	CopyMaskedStructure(Data, structureData, Size, sTypeOffset, pNextOffset);
+}
+
+inline MaskedStructure::~MaskedStructure()
+{
+}
+
+inline const std::byte* MaskedStructure::GetData() const
+{
+	return Data;
+}
+
+inline size_t MaskedStructure::GetSize() const
+{
+	return Size;
+}
+
+inline uint64_t GenericStructBase::Hash() const
+{
+	MaskedStructure maskedStructure(StructureData, StructureSize, STypeOffset, PNextPointerOffset);
+	return HashBytes(maskedStructure.GetData(), maskedStructure.GetSize());
+}
+
+inline bool GenericStructBase::operator==(const GenericStructBase& rhs) const
+{
+	if(StructureSize != rhs.StructureSize)
+	{
+		return false;
+	}
+
+	if(StructureSize == 0)
+	{
+		return true;
+	}
+
+	if(GetSType() != rhs.GetSType())
+	{
+		return false;
+	}
+
+	MaskedStructure lhsMaskedStructure(StructureData,	  StructureSize,	 STypeOffset,	  PNextPointerOffset);
+	MaskedStructure rhsMaskedStructure(rhs.StructureData, rhs.StructureSize, rhs.STypeOffset, rhs.PNextPointerOffset);
+
+	return memcmp(lhsMaskedStructure.GetData(), rhsMaskedStructure.GetData(), StructureSize) == 0;
+}
+
+inline bool GenericStructBase::operator!=(const GenericStructBase& rhs) const
+{
+	return !(*this == rhs);
+}
+
+//The contents of the links with unknown sType can't be read, such links are only equal to themselves
+inline uint64_t HashChainLink(const void* link)
+{
+	VulkanStructureType sType	= GetChainLinkSType(link);
+	size_t				linkSize = GetSTypeStructureSize(sType);
+	if(linkSize == 0)
+	{
+		return MixHash((uint64_t)sType);
+	}
+
+	MaskedStructure maskedLink((const std::byte*)link, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+	return HashBytes(maskedLink.GetData(), maskedLink.GetSize());
+}
+
+inline bool CompareChainLinks(const void* lhsLink, const void* rhsLink)
+{
+	VulkanStructureType sType = GetChainLinkSType(lhsLink);
+	if(sType != GetChainLinkSType(rhsLink))
+	{
+		return false;
+	}
+
+	size_t linkSize = GetSTypeStructureSize(sType);
+	if(linkSize == 0)
+	{
+		return lhsLink == rhsLink;
+	}
+
+	MaskedStructure lhsMaskedLink((const std::byte*)lhsLink, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+	MaskedStructure rhsMaskedLink((const std::byte*)rhsLink, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+
+	return memcmp(lhsMaskedLink.GetData(), rhsMaskedLink.GetData(), linkSize) == 0;
+}
+
+//Both go through the whole pNext chain. The order of the links after the head doesn't matter
+//With skipUnknownLinks the links with unknown sType are left out, so a chain compares equal to its linearized copy
+inline uint64_t HashChain(const void* head, bool skipUnknownLinks = false)
+{
+	//The sum doesn't depend on the link order
+	uint64_t linksHash = 0;
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(skipUnknownLinks && GetSTypeStructureSize(GetChainLinkSType(link)) == 0)
+		{
+			continue;
+		}
+
+		linksHash += HashChainLink(link);
+	}
+
+	return MixHash(HashChainLink(head) ^ MixHash(linksHash));
+}
+
+inline bool CompareChains(const void* lhsHead, const void* rhsHead, bool skipUnknownLinks = false)
+{
+	if(!CompareChainLinks(lhsHead, rhsHead))
+	{
+		return false;
+	}
+
+	std::vector<const void*> unmatchedRhsLinks;
+	for(const void* link = GetChainLinkPNext(rhsHead); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(!skipUnknownLinks || GetSTypeStructureSize(GetChainLinkSType(link)) != 0)
+		{
+			unmatchedRhsLinks.push_back(link);
+		}
+	}
+
+	//Every link has to match a different link of rhs, in any order
+	for(const void* link = GetChainLinkPNext(lhsHead); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(skipUnknownLinks && GetSTypeStructureSize(GetChainLinkSType(link)) == 0)
+		{
+			continue;
+		}
+
+		size_t matchIndex = 0;
+		while(matchIndex < unmatchedRhsLinks.size() && !CompareChainLinks(link, unmatchedRhsLinks[matchIndex]))
+		{
+			matchIndex++;
+		}
+
+		if(matchIndex == unmatchedRhsLinks.size())
+		{
+			return false;
+		}
+
+		unmatchedRhsLinks[matchIndex] = unmatchedRhsLinks.back();
+		unmatchedRhsLinks.pop_back();
+	}
+
+	return unmatchedRhsLinks.empty();
+}
+
+//==========================================================================================================================
+
+//Pointers to the structures of a chain, in a separate allocation that moves together with the chain
+//LinkHandles point to the allocation, so they survive both the growth of the chain storage and moving the chain. A moved-from table is empty
+class LinkDataPointerTable
+{
+public:
+	LinkDataPointerTable();
+	~LinkDataPointerTable();
+
+	//A copy gets its own allocation, the handles keep pointing to the original chain
+	LinkDataPointerTable(const LinkDataPointerTable& rhs);
+	LinkDataPointerTable& operator=(const LinkDataPointerTable& rhs);
+
+	//Has to be noexcept, otherwise std::vector copies the chains when it grows instead of moving them
+	LinkDataPointerTable(LinkDataPointerTable&& rhs) noexcept;
+	LinkDataPointerTable& operator=(LinkDataPointerTable&& rhs) noexcept;
+
+	std::byte*&		  operator[](size_t index);
+	std::byte* const& operator[](size_t index) const;
+
+	std::byte* back() const;
+	size_t	   size() const;
+
+	void push_back(std::byte* linkData);
+	void resize(size_t linkCount);
+	void reserve(size_t linkCount);
+
+	const std::vector<std::byte*>* GetPointers() const;
+
+private:
+	std::vector<std::byte*>& GetOrAllocatePointers();
+
+private:
+	std::unique_ptr<std::vector<std::byte*>> Pointers; //Allocated on the first use
+};
+
+inline LinkDataPointerTable::LinkDataPointerTable()
+{
+}
+
+inline LinkDataPointerTable::~LinkDataPointerTable()
+{
+}
+
+inline LinkDataPointerTable::LinkDataPointerTable(const LinkDataPointerTable& rhs)
+{
+	*this = rhs;
+}
+
+inline LinkDataPointerTable& LinkDataPointerTable::operator=(const LinkDataPointerTable& rhs)
+{
+	if(this == &rhs)
+	{
+		return *this;
+	}
+
+	if(rhs.Pointers == nullptr)
+	{
+		Pointers.reset();
+	}
+	else
+	{
+		GetOrAllocatePointers() = *rhs.Pointers;
+	}
+
+	return *this;
+}
+
+inline LinkDataPointerTable::LinkDataPointerTable(LinkDataPointerTable&& rhs) noexcept: Pointers(std::move(rhs.Pointers))
+{
+}
+
+inline LinkDataPointerTable& LinkDataPointerTable::operator=(LinkDataPointerTable&& rhs) noexcept
+{
+	Pointers = std::move(rhs.Pointers);
+	return *this;
+}
+
+inline std::byte*& LinkDataPointerTable::operator[](size_t index)
+{
+	assert(index < size());
+
+	return (*Pointers)[index];
+}
+
+inline std::byte* const& LinkDataPointerTable::operator[](size_t index) const
+{
+	assert(index < size());
+
+	return (*Pointers)[index];
+}
+
+inline std::byte* LinkDataPointerTable::back() const
+{
+	assert(size() > 0);
+
+	return Pointers->back();
+}
+
+inline size_t LinkDataPointerTable::size() const
+{
+	return (Pointers == nullptr) ? 0 : Pointers->size();
+}
+
+inline void LinkDataPointerTable::push_back(std::byte* linkData)
+{
+	GetOrAllocatePointers().push_back(linkData);
+}
+
+inline void LinkDataPointerTable::resize(size_t linkCount)
+{
+	GetOrAllocatePointers().resize(linkCount);
+}
+
+inline void LinkDataPointerTable::reserve(size_t linkCount)
+{
+	GetOrAllocatePointers().reserve(linkCount);
+}
+
+inline const std::vector<std::byte*>* LinkDataPointerTable::GetPointers() const
+{
+	assert(Pointers != nullptr);
+
+	return Pointers.get();
+}
+
+inline std::vector<std::byte*>& LinkDataPointerTable::GetOrAllocatePointers()
+{
+	if(Pointers == nullptr)
+	{
+		Pointers = std::make_unique<std::vector<std::byte*>>();
+	}
+
+	return *Pointers;
+}
+
+//Stable reference to a chain link. Stays valid when the chain storage grows and when the chain is moved, until the link is removed or the chain is cleared or destroyed
+template<typename Struct>
+class LinkHandle
+{
+public:
+	LinkHandle();
+	LinkHandle(const std::vector<std::byte*>* linkDataPointers, size_t linkIndex);
+
+	Struct& operator*()  const;
+	Struct* operator->() const;
+	Struct* Get()		 const;
+
+	size_t GetLinkIndex() const;
+
+private:
+	const std::vector<std::byte*>* LinkDataPointers;
+	size_t						   LinkIndex;
+};
+
+template<typename Struct>
+inline LinkHandle<Struct>::LinkHandle(): LinkDataPointers(nullptr), LinkIndex(0)
+{
+}
+
+template<typename Struct>
+inline LinkHandle<Struct>::LinkHandle(const std::vector<std::byte*>* linkDataPointers, size_t linkIndex): LinkDataPointers(linkDataPointers), LinkIndex(linkIndex)
+{
+}
+
+template<typename Struct>
+inline Struct& LinkHandle<Struct>::operator*() const
+{
+	return *Get();
+}
+
+template<typename Struct>
+inline Struct* LinkHandle<Struct>::operator->() const
+{
+	return Get();
+}
+
+template<typename Struct>
+inline Struct* LinkHandle<Struct>::Get() const
+{
+	assert(LinkDataPointers != nullptr);
+	assert(LinkIndex < LinkDataPointers->size());
+
+	return reinterpret_cast<Struct*>((*LinkDataPointers)[LinkIndex]);
+}
+
+template<typename Struct>
+inline size_t LinkHandle<Struct>::GetLinkIndex() const
+{
+	return LinkIndex;
+}
+
+//==========================================================================================================================
+
+//Base class for a generic structure chain, hiding chain link type info and the head type
+class GenericStructureChainBase
+{
+protected:
+	GenericStructureChainBase();
+	~GenericStructureChainBase();
+
+	GenericStructureChainBase(GenericStructureChainBase&& rhs)			  = default;
+	GenericStructureChainBase& operator=(GenericStructureChainBase&& rhs) = default;
+
+	//Only the owning chains can be copied, they relocate the pointers themselves
+	GenericStructureChainBase(const GenericStructureChainBase& rhs)			   = default;
+	GenericStructureChainBase& operator=(const GenericStructureChainBase& rhs) = default;
+
+public:
+	std::byte*			GetChainHeadData()  const;
+	VulkanStructureType GetChainHeadSType() const;
+
+	template<typename HeadType>
+	HeadType& GetChainHeadAs();
+
+	//Returns the occurrence-th structure of the type Struct in the chain, in order of adding
+	template<typename Struct>
+	Struct& GetChainLinkDataAs(size_t occurrence = 0);
+
+	template<typename Struct>
+	size_t CountOf() const;
+
+	//Same as GetChainLinkDataAs, but the result stays valid after adding more structures to the chain
+	template<typename Struct>
+	LinkHandle<Struct> GetChainLinkHandle(size_t occurrence = 0) const;
+
+	//Both go through the whole pNext chain. The order of the links after the head doesn't matter, the values of pNext and the padding are ignored
+	uint64_t Hash() const;
+	bool	 operator==(const GenericStructureChainBase& rhs) const;
+	bool	 operator!=(const GenericStructureChainBase& rhs) const;
+
+	//Serializes the whole pNext chain, see SerializeStructures()
+	std::vector<std::byte> Serialize(bool deep = false) const;
+
+protected:
+	VulkanStructureType GetLinkSType(size_t linkIndex) const;
+
+	void* GetLinkPNext(size_t linkIndex) const;
+	void  SetLinkPNext(size_t linkIndex, const void* pNext);
+
+protected:
+	LinkDataPointerTable   StructureDataPointers;
+	std::vector<ptrdiff_t> PNextPointerOffsets;
+	std::vector<ptrdiff_t> STypeOffsets;
+
+	StructureTypeIndexMap StructureDataIndices;
+};
+
+inline GenericStructureChainBase::GenericStructureChainBase()
+{
+}
+
+inline GenericStructureChainBase::~GenericStructureChainBase()
+{
+}
+
+inline std::byte* GenericStructureChainBase::GetChainHeadData() const
+{
+	assert(StructureDataPointers.size() > 0);
+	assert(StructureDataPointers[0] != nullptr);
+
+	return StructureDataPointers[0];
+}
+
+inline VulkanStructureType GenericStructureChainBase::GetChainHeadSType() const
+{
+	assert(StructureDataPointers.size() > 0);
+
+	return GetLinkSType(0);
+}
+
+template<typename HeadType>
+inline HeadType& GenericStructureChainBase::GetChainHeadAs()
+{
+	assert(GetChainHeadSType() == ValidStructureType<HeadType>);
+
+	HeadType* head = reinterpret_cast<HeadType*>(GetChainHeadData());
+	return *head;
+}
+
+template<typename Struct>
+inline Struct& GenericStructureChainBase::GetChainLinkDataAs(size_t occurrence)
+{
+	Struct* structPtr = reinterpret_cast<Struct*>(StructureDataPointers[StructureDataIndices.GetIndex(ValidStructureType<Struct>, occurrence)]);
+	return *structPtr;
+}
+
+template<typename Struct>
+inline size_t GenericStructureChainBase::CountOf() const
+{
+	return StructureDataIndices.GetCount(ValidStructureType<Struct>);
+}
+
+template<typename Struct>
+inline LinkHandle<Struct> GenericStructureChainBase::GetChainLinkHandle(size_t occurrence) const
+{
+	return LinkHandle<Struct>(StructureDataPointers.GetPointers(), StructureDataIndices.GetIndex(ValidStructureType<Struct>, occurrence));
+}
+
+inline uint64_t GenericStructureChainBase::Hash() const
+{
+	return HashChain(GetChainHeadData());
+}
+
+inline bool GenericStructureChainBase::operator==(const GenericStructureChainBase& rhs) const
+{
+	return CompareChains(GetChainHeadData(), rhs.GetChainHeadData());
+}
+
+inline bool GenericStructureChainBase::operator!=(const GenericStructureChainBase& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline VulkanStructureType GenericStructureChainBase::GetLinkSType(size_t linkIndex) const
+{
+	VulkanStructureType sType;
+	memcpy(&sType, StructureDataPointers[linkIndex] + STypeOffsets[linkIndex], sizeof(VulkanStructureType));
+
+	return sType;
+}
+
+inline void* GenericStructureChainBase::GetLinkPNext(size_t linkIndex) const
+{
+	void* pNext = nullptr;
+	memcpy(&pNext, StructureDataPointers[linkIndex] + PNextPointerOffsets[linkIndex], sizeof(void*));
+
+	return pNext;
+}
+
+inline void GenericStructureChainBase::SetLinkPNext(size_t linkIndex, const void* pNext)
+{
+	memcpy(StructureDataPointers[linkIndex] + PNextPointerOffsets[linkIndex], &pNext, sizeof(void*));
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, non-owning version with the head type erased. The head is referenced, not copied
+//Every appended link keeps its slot until Clear(). Links can be disabled and re-enabled through a bitmask, which only relinks the neighbours
+class AnyGenericStructureChain: public GenericStructureChainBase
+{
+public:
+	AnyGenericStructureChain(GenericStructBase& head);
+	~AnyGenericStructureChain();
+	
+	//Clears everything EXCEPT head
+	void Clear();
+
+	//Both return the index of the appended link. The link is enabled after appending
+	template<typename Struct>
+	size_t AppendToChain(Struct& next);
+
+	size_t AppendToChainGeneric(GenericStructBase& nextBlobData);
+
+	//Disabled links are skipped by the pNext pointers, but still can be accessed with GetChainLinkDataAs. Head is always enabled
+	void SetLinkEnabled(size_t linkIndex, bool enabled);
+	bool IsLinkEnabled(size_t linkIndex) const;
+
+	template<typename Struct>
+	void SetStructureEnabled(bool enabled, size_t occurrence = 0);
+
+	//Enable mask for links [64 * wordIndex, 64 * wordIndex + 63]. Only the links with the changed bits get relinked
+	void	 SetLinkEnableMask(uint64_t enableMask, size_t wordIndex = 0);
+	uint64_t GetLinkEnableMask(size_t wordIndex = 0) const;
+
+public:
+	AnyGenericStructureChain(const AnyGenericStructureChain& rhs) = delete;
+	AnyGenericStructureChain& operator=(const AnyGenericStructureChain& rhs) = delete;
+
+protected:
+	AnyGenericStructureChain();
+
+	void InitChainHead(std::byte* headData, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType);
+
+private:
+	size_t AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType);
+
+	void EnableLink(size_t linkIndex);
+	void DisableLink(size_t linkIndex);
+
+	size_t FindPrevEnabledLink(size_t linkIndex) const;
+
+private:
+	std::vector<uint64_t> LinkEnableMask;
+};
+
+inline AnyGenericStructureChain::AnyGenericStructureChain()
+{
+}
+
+inline AnyGenericStructureChain::AnyGenericStructureChain(GenericStructBase& head)
+{
+	InitChainHead(head.GetStructureData(), head.GetSTypeOffset(), head.GetPNextOffset(), head.GetSType());
+}
+
+inline AnyGenericStructureChain::~AnyGenericStructureChain()
+{
+}
+
+inline void AnyGenericStructureChain::Clear()
+{
+	//Just reset the pointers, head is always the first one
+	StructureDataPointers.resize(1);
+	STypeOffsets.resize(1);
+	PNextPointerOffsets.resize(1);
+
+	SetLinkPNext(0, nullptr);
+
+	LinkEnableMask.assign(1, 1);
+
+	StructureDataIndices.Clear();
+	StructureDataIndices.AddIndex(GetLinkSType(0), 0);
+}
+
+template<typename Struct>
+inline size_t AnyGenericStructureChain::AppendToChain(Struct& next)
+{
+	return AppendDataToChain(&next, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+}
+
+inline size_t AnyGenericStructureChain::AppendToChainGeneric(GenericStructBase& nextBlobData)
+{
+	return AppendDataToChain(nextBlobData.GetStructureData(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+}
+
+inline void AnyGenericStructureChain::SetLinkEnabled(size_t linkIndex, bool enabled)
+{
+	assert(linkIndex < StructureDataPointers.size());
+
+	if(IsLinkEnabled(linkIndex) == enabled)
+	{
+		return;
+	}
+
+	if(enabled)
+	{
+		EnableLink(linkIndex);
+	}
+	else
+	{
+		DisableLink(linkIndex);
+	}
+}
+
+inline bool AnyGenericStructureChain::IsLinkEnabled(size_t linkIndex) const
+{
+	return (LinkEnableMask[linkIndex / 64] >> (linkIndex % 64)) & 1;
+}
+
+template<typename Struct>
+inline void AnyGenericStructureChain::SetStructureEnabled(bool enabled, size_t occurrence)
+{
+	SetLinkEnabled(StructureDataIndices.GetIndex(ValidStructureType<Struct>, occurrence), enabled);
+}
+
+inline void AnyGenericStructureChain::SetLinkEnableMask(uint64_t enableMask, size_t wordIndex)
+{
+	assert(wordIndex < LinkEnableMask.size());
+
+	//Bits for the links that don't exist yet are ignored
+	size_t linkCountInWord = StructureDataPointers.size() - wordIndex * 64;
+	if(linkCountInWord < 64)
+	{
+		enableMask &= (1ull << linkCountInWord) - 1;
+	}
+
+	//Head is always enabled
+	if(wordIndex == 0)
+	{
+		enableMask |= 1;
+	}
+
+	uint64_t changedMask = LinkEnableMask[wordIndex] ^ enableMask;
+	while(changedMask != 0)
+	{
+		size_t bitIndex  = FindLowestSetBit(changedMask);
+		size_t linkIndex = wordIndex * 64 + bitIndex;
+
+		if((enableMask >> bitIndex) & 1)
+		{
+			EnableLink(linkIndex);
+		}
+		else
+		{
+			DisableLink(linkIndex);
+		}
+
+		changedMask &= changedMask - 1;
+	}
+}
+
+inline uint64_t AnyGenericStructureChain::GetLinkEnableMask(size_t wordIndex) const
+{
+	assert(wordIndex < LinkEnableMask.size());
+
+	return LinkEnableMask[wordIndex];
+}
+
+inline void AnyGenericStructureChain::InitChainHead(std::byte* headData, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType)
+{
+	//Head is always the first pointer
+	StructureDataPointers.push_back(headData);
+	STypeOffsets.push_back(sTypeOffset);
+	PNextPointerOffsets.push_back(pNextOffset);
+
+	SetLinkPNext(0, nullptr);
+
+	LinkEnableMask.push_back(1);
+
+	StructureDataIndices.AddIndex(sType, 0);
+}
+
+inline size_t AnyGenericStructureChain::AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType)
+{
+	size_t linkIndex = StructureDataPointers.size();
+
+	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(dataPtr));
+	STypeOffsets.push_back(sTypeOffset);
+	PNextPointerOffsets.push_back(pNextOffset);
+
+	if(linkIndex % 64 == 0)
+	{
+		LinkEnableMask.push_back(0);
+	}
+
+	LinkEnableMask[linkIndex / 64] |= (1ull << (linkIndex % 64));
+
+	std::byte* currLastStructPtr = StructureDataPointers.back();
+	InitSType(dataPtr, sTypeOffset, sType);						  //Set sType of the current struct
+	SetLinkPNext(FindPrevEnabledLink(linkIndex), currLastStructPtr); //Set pNext pointer of the previous enabled struct
+
+	StructureDataIndices.AddIndex(sType, linkIndex);
+	return linkIndex;
+}
+
+inline void AnyGenericStructureChain::EnableLink(size_t linkIndex)
+{
+	size_t prevLinkIndex = FindPrevEnabledLink(linkIndex);
+
+	//The previous enabled link points either to the next enabled link or to the end of the chain
+	SetLinkPNext(linkIndex, GetLinkPNext(prevLinkIndex));
+	SetLinkPNext(prevLinkIndex, StructureDataPointers[linkIndex]);
+
+	LinkEnableMask[linkIndex / 64] |= (1ull << (linkIndex % 64));
+}
+
+inline void AnyGenericStructureChain::DisableLink(size_t linkIndex)
+{
+	assert(linkIndex != 0); //Head cannot be disabled
+
+	size_t prevLinkIndex = FindPrevEnabledLink(linkIndex);
+	SetLinkPNext(prevLinkIndex, GetLinkPNext(linkIndex));
+
+	LinkEnableMask[linkIndex / 64] &= ~(1ull << (linkIndex % 64));
+}
+
+inline size_t AnyGenericStructureChain::FindPrevEnabledLink(size_t linkIndex) const
+{
+	//Head is always enabled, so the loop always ends
+	size_t   wordIndex = linkIndex / 64;
+	uint64_t wordMask  = LinkEnableMask[wordIndex] & ((1ull << (linkIndex % 64)) - 1);
+	while(wordMask == 0)
+	{
+		wordIndex--;
+		wordMask = LinkEnableMask[wordIndex];
+	}
+
+	return wordIndex * 64 + FindHighestSetBit(wordMask);
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, non-owning version. Stores a copy of the head
+template<typename HeadType>
+class GenericStructureChain: public AnyGenericStructureChain
+{
+public:
+	GenericStructureChain();
+	GenericStructureChain(HeadType& head);
+	~GenericStructureChain();
+
+	HeadType& GetChainHead();
+
+public:
+	GenericStructureChain(const GenericStructureChain& rhs) = delete;
+	GenericStructureChain& operator=(const GenericStructureChain& rhs) = delete;
+
+protected:
+	HeadType HeadData;
+};
+
+template<typename HeadType>
+inline GenericStructureChain<HeadType>::GenericStructureChain()
+{
+	//Init HeadData's sType, pNext is initialized in InitChainHead()
+	InitSType(&HeadData, offsetof(HeadType, sType), ValidStructureType<HeadType>);
+	InitChainHead(reinterpret_cast<std::byte*>(&HeadData), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline GenericStructureChain<HeadType>::GenericStructureChain(HeadType& head)
+{
+	HeadData = head;
+
+	InitSType(&HeadData, offsetof(HeadType, sType), ValidStructureType<HeadType>);
+	InitChainHead(reinterpret_cast<std::byte*>(&HeadData), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline GenericStructureChain<HeadType>::~GenericStructureChain()
+{
+}
+
+template<typename HeadType>
+inline HeadType& GenericStructureChain<HeadType>::GetChainHead()
+{
+	return HeadData;
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, owning version with the head type erased. Can be copied and moved, so chains with different heads can be stored together
+//All links live in a single blob that grows geometrically. The chain order is tracked apart from the storage order,
+//so links can be inserted and removed by patching only the neighbouring pNext pointers. Storage of removed links gets reused
+class ExtensionBitset;
+
+class AnyStructureChainBlob: public GenericStructureChainBase
+{
+public:
+	//Creates an empty chain without a head. Only useful as a placeholder to move another chain into
+	AnyStructureChainBlob();
+	explicit AnyStructureChainBlob(const GenericStructBase& head);
+	~AnyStructureChainBlob();
+
+	//Copying is a single blob copy plus relocation of the link pointers
+	AnyStructureChainBlob(const AnyStructureChainBlob& rhs);
+	AnyStructureChainBlob& operator=(const AnyStructureChainBlob& rhs);
+
+	//Moving keeps all structure pointers and LinkHandles valid, since the blob memory and the link table stay the same
+	AnyStructureChainBlob(AnyStructureChainBlob&& rhs)			  = default;
+	AnyStructureChainBlob& operator=(AnyStructureChainBlob&& rhs) = default;
+	   
+	//Clears everything EXCEPT head
+	void Clear();
+
+	template<typename Struct>
+	void AppendToChain(const Struct& next);
+
+	void AppendToChainGeneric(const GenericStructBase& nextBlobData);
+
+	//Inserts the structure right after the anchorOccurrence-th structure of the type AnchorStruct
+	template<typename AnchorStruct, typename Struct>
+	void InsertAfter(const Struct& next, size_t anchorOccurrence = 0);
+
+	template<typename AnchorStruct>
+	void InsertAfterGeneric(const GenericStructBase& nextBlobData, size_t anchorOccurrence = 0);
+
+	//Unlinks the occurrence-th structure of the type Struct. Its storage is reused by the next added structure that fits
+	template<typename Struct>
+	void Remove(size_t occurrence = 0);
+
+	//Overwrites the first structure of the type Struct in place, keeping its position in the chain. Appends the structure if there's none
+	template<typename Struct>
+	void Upsert(const Struct& value);
+
+	//Constructs the structure directly in the blob with Struct{args...} and appends it to the chain
+	template<typename Struct, typename... Args>
+	LinkHandle<Struct> Emplace(Args&&... args);
+
+	//Copies the whole chain into a single exact-size blob, in the pNext order. Links with unknown sType are skipped, the head has to be known
+	static AnyStructureChainBlob Linearize(const void* head);
+	static AnyStructureChainBlob Linearize(const GenericStructureChainBase& chain);
+
+	//Loads the chain serialized with SerializeStructures(), straight from the serialized records in a single exact-size blob
+	//Returns false if the data is not valid or is a deep serialization, since a chain can't own the data its pointer members point to
+	static bool Deserialize(const void* serializedData, size_t serializedSize, AnyStructureChainBlob& outChain);
+
+protected:
+	friend size_t FilterByEnabled(AnyStructureChainBlob& chain, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+
+	void LinearizeChain(const void* head);
+
+	void InitChainHead(const std::byte* headData, size_t headSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType);
+
+	size_t AllocateLink(size_t dataSize);
+	size_t AddLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+	void   InitEmplacedLink(size_t linkIndex, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+	void   RemoveLink(VulkanStructureType sType, size_t occurrence);
+	void   RemoveLinkAt(size_t linkIndex);
+	void   UpsertLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+
+	void LinkAfter(size_t prevLinkIndex, size_t linkIndex, const void* linkPNext);
+	void GrowBlob(size_t requiredSize);
+	void RelocateLinks(const std::byte* oldBlobData);
+
+protected:
+	static constexpr size_t NoLink = (size_t)(-1);
+
+	std::vector<std::byte> StructureChainBlobData;
+
+	std::vector<size_t> LinkDataCapacities;
+	std::vector<size_t> PrevLinkIndices;
+	std::vector<size_t> NextLinkIndices;
+	std::vector<size_t> FreeLinkIndices;
+
+	size_t LastLinkIndex;
+};
+
+inline AnyStructureChainBlob::AnyStructureChainBlob(): LastLinkIndex(NoLink)
+{
+}
+
+inline AnyStructureChainBlob::AnyStructureChainBlob(const GenericStructBase& head): LastLinkIndex(NoLink)
+{
+	InitChainHead(head.GetStructureData(), head.GetStructureSize(), head.GetSTypeOffset(), head.GetPNextOffset(), head.GetSType());
+}
+
+inline AnyStructureChainBlob::AnyStructureChainBlob(const AnyStructureChainBlob& rhs): GenericStructureChainBase(rhs), StructureChainBlobData(rhs.StructureChainBlobData), LinkDataCapacities(rhs.LinkDataCapacities), PrevLinkIndices(rhs.PrevLinkIndices), NextLinkIndices(rhs.NextLinkIndices), FreeLinkIndices(rhs.FreeLinkIndices), LastLinkIndex(rhs.LastLinkIndex)
+{
+	RelocateLinks(rhs.StructureChainBlobData.data());
+}
+
+inline AnyStructureChainBlob::~AnyStructureChainBlob()
+{
+}
+
+inline AnyStructureChainBlob& AnyStructureChainBlob::operator=(const AnyStructureChainBlob& rhs)
+{
+	if(this == &rhs)
+	{
+		return *this;
+	}
+
+	GenericStructureChainBase::operator=(rhs);
+
+	StructureChainBlobData = rhs.StructureChainBlobData;
+
+	LinkDataCapacities = rhs.LinkDataCapacities;
+	PrevLinkIndices	   = rhs.PrevLinkIndices;
+	NextLinkIndices	   = rhs.NextLinkIndices;
+	FreeLinkIndices	   = rhs.FreeLinkIndices;
+
+	LastLinkIndex = rhs.LastLinkIndex;
+
+	RelocateLinks(rhs.StructureChainBlobData.data());
+	return *this;
+}
+
+inline void AnyStructureChainBlob::Clear()
+{
+	assert(StructureDataPointers.size() > 0);
+
+	//The head is always the first in the blob, so it's enough to just drop everything after it
+	StructureChainBlobData.resize(LinkDataCapacities[0]);
+
+	StructureDataPointers.resize(1);
+	STypeOffsets.resize(1);
+	PNextPointerOffsets.resize(1);
+
+	LinkDataCapacities.resize(1);
+	PrevLinkIndices.resize(1);
+	NextLinkIndices.resize(1);
+	FreeLinkIndices.clear();
+
+	NextLinkIndices[0] = NoLink;
+	LastLinkIndex	   = 0;
+
+	SetLinkPNext(0, nullptr);
+
+	StructureDataIndices.Clear();
+	StructureDataIndices.AddIndex(GetLinkSType(0), 0);
+}
+
+template<typename Struct>
+inline void AnyStructureChainBlob::AppendToChain(const Struct& next)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	size_t linkIndex = AddLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	LinkAfter(LastLinkIndex, linkIndex, next.pNext);
+}
+
+inline void AnyStructureChainBlob::AppendToChainGeneric(const GenericStructBase& nextBlobData)
+{
+	const void* nextPNext = nextBlobData.GetPNext();
+
+	size_t linkIndex = AddLinkData(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+	LinkAfter(LastLinkIndex, linkIndex, nextPNext);
+}
+
+template<typename AnchorStruct, typename Struct>
+inline void AnyStructureChainBlob::InsertAfter(const Struct& next, size_t anchorOccurrence)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	size_t anchorLinkIndex = StructureDataIndices.GetIndex(ValidStructureType<AnchorStruct>, anchorOccurrence);
+
+	size_t linkIndex = AddLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	LinkAfter(anchorLinkIndex, linkIndex, next.pNext);
+}
+
+template<typename AnchorStruct>
+inline void AnyStructureChainBlob::InsertAfterGeneric(const GenericStructBase& nextBlobData, size_t anchorOccurrence)
+{
+	size_t anchorLinkIndex = StructureDataIndices.GetIndex(ValidStructureType<AnchorStruct>, anchorOccurrence);
+
+	const void* nextPNext = nextBlobData.GetPNext();
+
+	size_t linkIndex = AddLinkData(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+	LinkAfter(anchorLinkIndex, linkIndex, nextPNext);
+}
+
+template<typename Struct>
+inline void AnyStructureChainBlob::Remove(size_t occurrence)
+{
+	RemoveLink(ValidStructureType<Struct>, occurrence);
+}
+
+template<typename Struct>
+inline void AnyStructureChainBlob::Upsert(const Struct& value)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	UpsertLinkData((const std::byte*)(&value), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+}
+
+template<typename Struct, typename... Args>
+inline LinkHandle<Struct> AnyStructureChainBlob::Emplace(Args&&... args)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
+
+	size_t linkIndex = AllocateLink(sizeof(Struct));
+	new(StructureDataPointers[linkIndex]) Struct{std::forward<Args>(args)...};
+
+	InitEmplacedLink(linkIndex, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	return LinkHandle<Struct>(StructureDataPointers.GetPointers(), linkIndex);
+}
+
+inline AnyStructureChainBlob AnyStructureChainBlob::Linearize(const void* head)
+{
+	AnyStructureChainBlob linearizedChain;
+	linearizedChain.LinearizeChain(head);
+
+	return linearizedChain;
+}
+
+inline AnyStructureChainBlob AnyStructureChainBlob::Linearize(const GenericStructureChainBase& chain)
+{
+	return Linearize(chain.GetChainHeadData());
+}
+
+inline void AnyStructureChainBlob::LinearizeChain(const void* head)
+{
+	assert(head != nullptr);
+	assert(StructureDataPointers.size() == 0);
+
+	VulkanStructureType headSType = GetChainLinkSType(head);
+	size_t				headSize  = GetSTypeStructureSize(headSType);
+	assert(headSize != 0);
+
+	//Measure the chain first, so everything is allocated only once
+	size_t blobSize  = headSize;
+	size_t linkCount = 1;
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize != 0)
+		{
+			blobSize = ((blobSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1)) + linkSize;
+			linkCount++;
+		}
+	}
+
+	StructureChainBlobData.reserve(blobSize);
+
+	StructureDataPointers.reserve(linkCount);
+	STypeOffsets.reserve(linkCount);
+	PNextPointerOffsets.reserve(linkCount);
+	LinkDataCapacities.reserve(linkCount);
+	PrevLinkIndices.reserve(linkCount);
+	NextLinkIndices.reserve(linkCount);
+
+	InitChainHead((const std::byte*)head, headSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), headSType);
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		VulkanStructureType linkSType = GetChainLinkSType(link);
+		size_t				linkSize  = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		size_t linkIndex = AddLinkData((const std::byte*)link, linkSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), linkSType);
+		LinkAfter(LastLinkIndex, linkIndex, nullptr);
+	}
+}
+
+inline void AnyStructureChainBlob::InitChainHead(const std::byte* headData, size_t headSize, ptrdiff_t sTypeOffset, ptrdiff_t pNextOffset, VulkanStructureType sType)
+{
+	//Store head in the blob
+	StructureChainBlobData.resize(headSize);
+	memcpy(StructureChainBlobData.data(), headData, headSize);
+
+	StructureDataPointers.push_back(StructureChainBlobData.data());
+	STypeOffsets.push_back(sTypeOffset);
+	PNextPointerOffsets.push_back(pNextOffset);
+
+	LinkDataCapacities.push_back(headSize);
+	PrevLinkIndices.push_back(NoLink);
+	NextLinkIndices.push_back(NoLink);
+
+	LastLinkIndex = 0;
+
+	InitSType(StructureDataPointers.back(), sTypeOffset, sType);
+	SetLinkPNext(0, nullptr);
+
+	StructureDataIndices.AddIndex(sType, 0);
+}
+
+inline size_t AnyStructureChainBlob::AllocateLink(size_t dataSize)
+{
+	//Most recently removed links are the most likely to be re-added, so in an edit loop the first one checked fits
+	for(size_t i = FreeLinkIndices.size(); i > 0; i--)
+	{
+		size_t freeLinkIndex = FreeLinkIndices[i - 1];
+		if(LinkDataCapacities[freeLinkIndex] >= dataSize)
+		{
+			//The order of the free links doesn't matter, swap-and-pop
+			FreeLinkIndices[i - 1] = FreeLinkIndices.back();
+			FreeLinkIndices.pop_back();
+			return freeLinkIndex;
+		}
+	}
+
+	size_t linkDataOffset = (StructureChainBlobData.size() + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+	GrowBlob(linkDataOffset + dataSize);
+
+	StructureDataPointers.push_back(StructureChainBlobData.data() + linkDataOffset);
+	STypeOffsets.push_back(0);
+	PNextPointerOffsets.push_back(0);
+
+	LinkDataCapacities.push_back(dataSize);
+	PrevLinkIndices.push_back(NoLink);
+	NextLinkIndices.push_back(NoLink);
+
+	return StructureDataPointers.size() - 1;
+}
+
+inline size_t AnyStructureChainBlob::AddLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	//The data can be a part of this very blob, which can get reallocated
+	const std::byte* blobBegin = StructureChainBlobData.data();
+	const std::byte* blobEnd   = StructureChainBlobData.data() + StructureChainBlobData.size();
+
+	ptrdiff_t dataOffsetInBlob = -1;
+	if(data >= blobBegin && data < blobEnd)
+	{
+		dataOffsetInBlob = data - blobBegin;
+	}
+
+	size_t linkIndex = AllocateLink(dataSize);
+	if(dataOffsetInBlob >= 0)
+	{
+		data = StructureChainBlobData.data() + dataOffsetInBlob;
+	}
+
+	memmove(StructureDataPointers[linkIndex], data, dataSize);
+
+	STypeOffsets[linkIndex]		   = dataSTypeOffset;
+	PNextPointerOffsets[linkIndex] = dataPNextOffset;
+
+	InitSType(StructureDataPointers[linkIndex], dataSTypeOffset, sType);
+
+	StructureDataIndices.AddIndex(sType, linkIndex);
+	return linkIndex;
+}
+
+inline void AnyStructureChainBlob::InitEmplacedLink(size_t linkIndex, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	STypeOffsets[linkIndex]		   = dataSTypeOffset;
+	PNextPointerOffsets[linkIndex] = dataPNextOffset;
+
+	InitSType(StructureDataPointers[linkIndex], dataSTypeOffset, sType);
+
+	StructureDataIndices.AddIndex(sType, linkIndex);
+	LinkAfter(LastLinkIndex, linkIndex, GetLinkPNext(linkIndex));
+}
+
+inline void AnyStructureChainBlob::RemoveLink(VulkanStructureType sType, size_t occurrence)
+{
+	RemoveLinkAt(StructureDataIndices.GetIndex(sType, occurrence));
+}
+
+inline void AnyStructureChainBlob::RemoveLinkAt(size_t linkIndex)
+{
+	assert(linkIndex != 0); //Head cannot be removed
+
+	VulkanStructureType sType = GetLinkSType(linkIndex);
+
+	size_t prevLinkIndex = PrevLinkIndices[linkIndex];
+	size_t nextLinkIndex = NextLinkIndices[linkIndex];
+
+	//The removed structure's pNext is either the next link or whatever the user specified for the last structure
+	SetLinkPNext(prevLinkIndex, GetLinkPNext(linkIndex));
+
+	NextLinkIndices[prevLinkIndex] = nextLinkIndex;
+	if(nextLinkIndex != NoLink)
+	{
+		PrevLinkIndices[nextLinkIndex] = prevLinkIndex;
+	}
+	else
+	{
+		LastLinkIndex = prevLinkIndex;
+	}
+
+	PrevLinkIndices[linkIndex] = NoLink;
+	NextLinkIndices[linkIndex] = NoLink;
+
+	StructureDataIndices.RemoveIndex(sType, linkIndex);
+	FreeLinkIndices.push_back(linkIndex);
+}
+
+inline void AnyStructureChainBlob::UpsertLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	if(StructureDataIndices.GetCount(sType) == 0)
+	{
+		const void* dataPNext = nullptr;
+		memcpy(&dataPNext, data + dataPNextOffset, sizeof(void*));
+
+		size_t linkIndex = AddLinkData(data, dataSize, dataSTypeOffset, dataPNextOffset, sType);
+		LinkAfter(LastLinkIndex, linkIndex, dataPNext);
+		return;
+	}
+
+	size_t linkIndex = StructureDataIndices.GetIndex(sType, 0);
+	assert(LinkDataCapacities[linkIndex] >= dataSize);
+
+	void* linkPNext = GetLinkPNext(linkIndex);
+	memmove(StructureDataPointers[linkIndex], data, dataSize);
+
+	InitSType(StructureDataPointers[linkIndex], dataSTypeOffset, sType);
+	SetLinkPNext(linkIndex, linkPNext);
+}
+
+inline void AnyStructureChainBlob::LinkAfter(size_t prevLinkIndex, size_t linkIndex, const void* linkPNext)
+{
+	size_t nextLinkIndex = NextLinkIndices[prevLinkIndex];
+
+	PrevLinkIndices[linkIndex]	   = prevLinkIndex;
+	NextLinkIndices[linkIndex]	   = nextLinkIndex;
+	NextLinkIndices[prevLinkIndex] = linkIndex;
+
+	if(nextLinkIndex != NoLink)
+	{
+		PrevLinkIndices[nextLinkIndex] = linkIndex;
+		SetLinkPNext(linkIndex, StructureDataPointers[nextLinkIndex]);
+	}
+	else
+	{
+		//The last pNext can point to whatever the user specified
+		SetLinkPNext(linkIndex, linkPNext);
+		LastLinkIndex = linkIndex;
+	}
+
+	SetLinkPNext(prevLinkIndex, StructureDataPointers[linkIndex]);
+}
+
+inline void AnyStructureChainBlob::GrowBlob(size_t requiredSize)
+{
+	if(requiredSize > StructureChainBlobData.capacity())
+	{
+		size_t doubledCapacity = StructureChainBlobData.capacity() * 2;
+
+		//Moved-from vector is guaranteed to be empty
+		std::vector<std::byte> oldStructureChainData = std::move(StructureChainBlobData);
+
+		StructureChainBlobData.reserve(requiredSize > doubledCapacity ? requiredSize : doubledCapacity);
+		StructureChainBlobData.resize(oldStructureChainData.size());
+
+		memcpy(StructureChainBlobData.data(), oldStructureChainData.data(), oldStructureChainData.size());
+		RelocateLinks(oldStructureChainData.data());
+	}
+
+	//Never reallocates after the check above
+	StructureChainBlobData.resize(requiredSize);
+}
+
+inline void AnyStructureChainBlob::RelocateLinks(const std::byte* oldBlobData)
+{
+	//Link pointers serve as the relocation table: each one is an offset from the blob start. Rebase all of them, including the free ones
+	std::byte* newBlobData = StructureChainBlobData.data();
+	for(size_t i = 0; i < StructureDataPointers.size(); i++)
+	{
+		StructureDataPointers[i] = newBlobData + (StructureDataPointers[i] - oldBlobData);
+	}
+
+	//Point pNext of every linked structure to the relocated next one. pNext of the last structure is left as is, it can point to whatever the user specified
+	for(size_t linkIndex = 0; linkIndex < NextLinkIndices.size(); linkIndex++)
+	{
+		if(NextLinkIndices[linkIndex] != NoLink)
+		{
+			SetLinkPNext(linkIndex, StructureDataPointers[NextLinkIndices[linkIndex]]);
+		}
+	}
+}
+
+//==========================================================================================================================
+
+//Generic structure chain, owning version
+template<typename HeadType> 
+class StructureChainBlob: public AnyStructureChainBlob
+{
+public:
+	StructureChainBlob();
+	StructureChainBlob(const HeadType& head);
+	~StructureChainBlob();
+
+	StructureChainBlob(const StructureChainBlob& rhs)			 = default;
+	StructureChainBlob& operator=(const StructureChainBlob& rhs) = default;
+
+	StructureChainBlob(StructureChainBlob&& rhs)			= default;
+	StructureChainBlob& operator=(StructureChainBlob&& rhs) = default;
+
+	HeadType& GetChainHead();
+
+	//Same as AnyStructureChainBlob::Linearize, the head has to be of the type HeadType
+	static StructureChainBlob Linearize(const void* head);
+	static StructureChainBlob Linearize(const GenericStructureChainBase& chain);
+
+	//Same as AnyStructureChainBlob::Deserialize, also returns false if the head is not of the type HeadType
+	static bool Deserialize(const void* serializedData, size_t serializedSize, StructureChainBlob& outChain);
+
+private:
+	explicit StructureChainBlob(AnyStructureChainBlob&& linearizedChain);
+};
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::StructureChainBlob()
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+
+	HeadType head = HeadType();
+	InitChainHead((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::StructureChainBlob(const HeadType& head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+
+	InitChainHead((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::StructureChainBlob(AnyStructureChainBlob&& linearizedChain): AnyStructureChainBlob(std::move(linearizedChain))
+{
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType>::~StructureChainBlob()
+{
+}
+
+template<typename HeadType>
+inline HeadType& StructureChainBlob<HeadType>::GetChainHead()
+{
+	return GetChainHeadAs<HeadType>();
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType> StructureChainBlob<HeadType>::Linearize(const void* head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+	assert(GetChainLinkSType(head) == ValidStructureType<HeadType>);
+
+	return StructureChainBlob(AnyStructureChainBlob::Linearize(head));
+}
+
+template<typename HeadType>
+inline StructureChainBlob<HeadType> StructureChainBlob<HeadType>::Linearize(const GenericStructureChainBase& chain)
+{
+	return Linearize(chain.GetChainHeadData());
+}
+
+//==========================================================================================================================
+
+//Thread-safe table of unique chains. Equal chains (see CompareChains) are stored only once, as shared immutable blobs
+//The table is split into shards with separate reader-writer locks, so the threads rarely wait for each other
+class ChainInternTable
+{
+public:
+	ChainInternTable();
+	~ChainInternTable();
+
+	//Returns the shared copy of the chain. Equal chains always give the same pointer, which can serve as the identity of the chain contents
+	//The links with unknown sType are not copied, so they are ignored when looking for an equal chain too
+	std::shared_ptr<const AnyStructureChainBlob> Intern(const void* head);
+	std::shared_ptr<const AnyStructureChainBlob> Intern(const GenericStructureChainBase& chain);
+
+	//Removes the chains that are not referenced outside the table. Returns the number of the removed chains
+	size_t Purge();
+
+	size_t GetChainCount() const;
+
+public:
+	ChainInternTable(const ChainInternTable& rhs)			 = delete;
+	ChainInternTable& operator=(const ChainInternTable& rhs) = delete;
+
+private:
+	using ChainMap = std::unordered_multimap<uint64_t, std::shared_ptr<const AnyStructureChainBlob>>;
+
+	struct Shard
+	{
+		mutable std::shared_mutex Mutex;
+
+		ChainMap Chains;
+	};
+
+	std::shared_ptr<const AnyStructureChainBlob> FindChain(const Shard& shard, const void* head, uint64_t chainHash) const;
+
+private:
+	static constexpr size_t ShardCount = 16;
+
+	Shard Shards[ShardCount];
+};
+
+inline ChainInternTable::ChainInternTable()
+{
+}
+
+inline ChainInternTable::~ChainInternTable()
+{
+}
+
+inline std::shared_ptr<const AnyStructureChainBlob> ChainInternTable::Intern(const void* head)
+{
+	uint64_t chainHash = HashChain(head, true);
+
+	//The lower bits are used by the shard hash map
+	Shard& shard = Shards[(chainHash >> 32) % ShardCount];
+
+	{
+		std::shared_lock<std::shared_mutex> readLock(shard.Mutex);
+
+		std::shared_ptr<const AnyStructureChainBlob> existingChain = FindChain(shard, head, chainHash);
+		if(existingChain != nullptr)
+		{
+			return existingChain;
+		}
+	}
+
+	//Copy the chain outside of the lock
+	std::shared_ptr<const AnyStructureChainBlob> newChain = std::make_shared<const AnyStructureChainBlob>(AnyStructureChainBlob::Linearize(head));
+
+	std::unique_lock<std::shared_mutex> writeLock(shard.Mutex);
+
+	//Another thread could have added the same chain in the meantime
+	std::shared_ptr<const AnyStructureChainBlob> existingChain = FindChain(shard, head, chainHash);
+	if(existingChain != nullptr)
+	{
+		return existingChain;
+	}
+
+	shard.Chains.emplace(chainHash, newChain);
+	return newChain;
+}
+
+inline std::shared_ptr<const AnyStructureChainBlob> ChainInternTable::Intern(const GenericStructureChainBase& chain)
+{
+	return Intern(chain.GetChainHeadData());
+}
+
+inline size_t ChainInternTable::Purge()
+{
+	size_t removedCount = 0;
+	for(size_t i = 0; i < ShardCount; i++)
+	{
+		std::unique_lock<std::shared_mutex> writeLock(Shards[i].Mutex);
+
+		//The references can only be added under the lock, so use_count() can be trusted here
+		ChainMap::iterator chainIt = Shards[i].Chains.begin();
+		while(chainIt != Shards[i].Chains.end())
+		{
+			if(chainIt->second.use_count() == 1)
+			{
+				chainIt = Shards[i].Chains.erase(chainIt);
+				removedCount++;
+			}
+			else
+			{
+				++chainIt;
+			}
+		}
+	}
+
+	return removedCount;
+}
+
+inline size_t ChainInternTable::GetChainCount() const
+{
+	size_t chainCount = 0;
+	for(size_t i = 0; i < ShardCount; i++)
+	{
+		std::shared_lock<std::shared_mutex> readLock(Shards[i].Mutex);
+		chainCount += Shards[i].Chains.size();
+	}
+
+	return chainCount;
+}
+
+inline std::shared_ptr<const AnyStructureChainBlob> ChainInternTable::FindChain(const Shard& shard, const void* head, uint64_t chainHash) const
+{
+	std::pair<ChainMap::const_iterator, ChainMap::const_iterator> chainRange = shard.Chains.equal_range(chainHash);
+	for(ChainMap::const_iterator chainIt = chainRange.first; chainIt != chainRange.second; ++chainIt)
+	{
+		if(CompareChains(chainIt->second->GetChainHeadData(), head, true))
+		{
+			return chainIt->second;
+		}
+	}
+
+	return nullptr;
+}
+
+//==========================================================================================================================
+
+//Immutable structure chain, tightly packed into a single exact-size blob. Made by StructureChainBuilder::Bake()
+//Has no mutable state at all, so it can be shared across threads without locks. The last pNext is always null
+class BakedStructureChain
+{
+public:
+	//Creates an empty chain without a head. Only useful as a placeholder to move another chain into
+	BakedStructureChain();
+	~BakedStructureChain();
+
+	BakedStructureChain(BakedStructureChain&& rhs)			  = default;
+	BakedStructureChain& operator=(BakedStructureChain&& rhs) = default;
+
+	const void*			GetChainHeadData()  const;
+	VulkanStructureType GetChainHeadSType() const;
+	size_t				GetChainDataSize()  const;
+
+	template<typename HeadType>
+	const HeadType& GetChainHeadAs() const;
+
+	//Both walk the chain, since the baked chain has no index map
+	template<typename Struct>
+	const Struct& GetChainLinkDataAs(size_t occurrence = 0) const;
+
+	template<typename Struct>
+	size_t CountOf() const;
+
+public:
+	BakedStructureChain(const BakedStructureChain& rhs)			   = delete;
+	BakedStructureChain& operator=(const BakedStructureChain& rhs) = delete;
+
+private:
+	template<typename HeadType>
+	friend class StructureChainBuilder;
+
+	BakedStructureChain(std::vector<std::byte>&& chainData);
+
+private:
+	std::vector<std::byte> ChainData;
+};
+
+//Append-only structure chain builder. Appending only copies the structure, all pNext pointers are set at once in Bake()
+template<typename HeadType>
+class StructureChainBuilder
+{
+public:
+	StructureChainBuilder();
+	StructureChainBuilder(const HeadType& head);
+	~StructureChainBuilder();
+
+	//The reference is invalidated by appending
+	HeadType& GetChainHead();
+
+	//Clears everything EXCEPT head
+	void Clear();
+
+	template<typename Struct>
+	void AppendToChain(const Struct& next);
+
+	void AppendToChainGeneric(const GenericStructBase& nextBlobData);
+
+	BakedStructureChain Bake() const;
+
+private:
+	void AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+
+private:
+	std::vector<std::byte> ChainData;
+	std::vector<size_t>	   LinkOffsets;
+	std::vector<ptrdiff_t> PNextPointerOffsets;
+};
+
+inline BakedStructureChain::BakedStructureChain()
+{
+}
+
+inline BakedStructureChain::BakedStructureChain(std::vector<std::byte>&& chainData): ChainData(std::move(chainData))
+{
+}
+
+inline BakedStructureChain::~BakedStructureChain()
+{
+}
+
+inline const void* BakedStructureChain::GetChainHeadData() const
+{
+	assert(ChainData.size() > 0);
+
+	return ChainData.data();
+}
+
+inline VulkanStructureType BakedStructureChain::GetChainHeadSType() const
+{
+	return GetChainLinkSType(GetChainHeadData());
+}
+
+inline size_t BakedStructureChain::GetChainDataSize() const
+{
+	return ChainData.size();
+}
+
+template<typename HeadType>
+inline const HeadType& BakedStructureChain::GetChainHeadAs() const
+{
+	assert(GetChainHeadSType() == ValidStructureType<HeadType>);
+
+	const HeadType* head = reinterpret_cast<const HeadType*>(GetChainHeadData());
+	return *head;
+}
+
+template<typename Struct>
+inline const Struct& BakedStructureChain::GetChainLinkDataAs(size_t occurrence) const
+{
+	const void* link = GetChainHeadData();
+	while(link != nullptr)
+	{
+		if(GetChainLinkSType(link) == ValidStructureType<Struct> && occurrence-- == 0)
+		{
+			break;
+		}
+
+		link = GetChainLinkPNext(link);
+	}
+
+	assert(link != nullptr);
+
+	const Struct* structPtr = reinterpret_cast<const Struct*>(link);
+	return *structPtr;
+}
+
+template<typename Struct>
+inline size_t BakedStructureChain::CountOf() const
+{
+	size_t count = 0;
+	for(const void* link = GetChainHeadData(); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(GetChainLinkSType(link) == ValidStructureType<Struct>)
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
+
+template<typename HeadType>
+inline StructureChainBuilder<HeadType>::StructureChainBuilder()
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain builder must be trivially destructible");
+
+	HeadType head = HeadType();
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBuilder<HeadType>::StructureChainBuilder(const HeadType& head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain builder must be trivially destructible");
+
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline StructureChainBuilder<HeadType>::~StructureChainBuilder()
+{
+}
+
+template<typename HeadType>
+inline HeadType& StructureChainBuilder<HeadType>::GetChainHead()
+{
+	HeadType* head = reinterpret_cast<HeadType*>(ChainData.data());
+	return *head;
+}
+
+template<typename HeadType>
+inline void StructureChainBuilder<HeadType>::Clear()
+{
+	//Head is always the first one
+	ChainData.resize(sizeof(HeadType));
+	LinkOffsets.resize(1);
+	PNextPointerOffsets.resize(1);
+}
+
+template<typename HeadType>
+template<typename Struct>
+inline void StructureChainBuilder<HeadType>::AppendToChain(const Struct& next)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain builder must be trivially destructible");
+
+	AppendLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+}
+
+template<typename HeadType>
+inline void StructureChainBuilder<HeadType>::AppendToChainGeneric(const GenericStructBase& nextBlobData)
+{
+	AppendLinkData(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+}
+
+template<typename HeadType>
+inline BakedStructureChain StructureChainBuilder<HeadType>::Bake() const
+{
+	//The builder data is already packed, only the pNext pointers are missing
+	std::vector<std::byte> bakedData(ChainData.begin(), ChainData.end());
+	for(size_t i = 0; i < LinkOffsets.size(); i++)
+	{
+		const void* pNext = nullptr;
+		if(i + 1 < LinkOffsets.size())
+		{
+			pNext = bakedData.data() + LinkOffsets[i + 1];
+		}
+
+		memcpy(bakedData.data() + LinkOffsets[i] + PNextPointerOffsets[i], &pNext, sizeof(void*));
+	}
+
+	return BakedStructureChain(std::move(bakedData));
+}
+
+template<typename HeadType>
+inline void StructureChainBuilder<HeadType>::AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	size_t linkDataOffset = (ChainData.size() + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+	ChainData.resize(linkDataOffset + dataSize);
+	memcpy(ChainData.data() + linkDataOffset, data, dataSize);
+
+	InitSType(ChainData.data() + linkDataOffset, dataSTypeOffset, sType);
+
+	LinkOffsets.push_back(linkDataOffset);
+	PNextPointerOffsets.push_back(dataPNextOffset);
+}
+
+//==========================================================================================================================
+
+//Typed location of a structure inside the instances of a chain template
+template<typename Struct>
+class ChainSlot
+{
+public:
+	ChainSlot();
+	ChainSlot(size_t dataOffset);
+	~ChainSlot();
+
+	size_t GetDataOffset() const;
+
+private:
+	size_t DataOffset;
+};
+
+//Chain template instance, living in the caller-provided memory. Doesn't own anything
+template<typename HeadType>
+class ChainInstance
+{
+public:
+	ChainInstance(std::byte* instanceData);
+	~ChainInstance();
+
+	HeadType& GetChainHead();
+
+	template<typename Struct>
+	Struct& GetSlotData(ChainSlot<Struct> slot);
+
+private:
+	std::byte* InstanceData;
+};
+
+//Structure chain that is made once and instantiated many times into caller-provided memory
+//Instantiation is a single memcpy plus the precomputed pNext relocation. The structures that change are accessed through slots
+template<typename HeadType>
+class ChainTemplate
+{
+public:
+	ChainTemplate();
+	ChainTemplate(const HeadType& head);
+	~ChainTemplate();
+
+	ChainSlot<HeadType> GetHeadSlot() const;
+
+	template<typename Struct>
+	ChainSlot<Struct> AppendToChain(const Struct& next);
+
+	//The memory for each instance has to be at least this big and aligned to ChainLinkDataAlignment
+	size_t GetInstanceSize() const;
+
+	ChainInstance<HeadType> Instantiate(void* instanceMemory) const;
+
+private:
+	size_t AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+
+private:
+	std::vector<std::byte> TemplateData;
+	std::vector<size_t>	   LinkOffsets;
+	std::vector<size_t>	   PNextFieldOffsets;
+};
+
+template<typename Struct>
+inline ChainSlot<Struct>::ChainSlot(): DataOffset(0)
+{
+}
+
+template<typename Struct>
+inline ChainSlot<Struct>::ChainSlot(size_t dataOffset): DataOffset(dataOffset)
+{
+}
+
+template<typename Struct>
+inline ChainSlot<Struct>::~ChainSlot()
+{
+}
+
+template<typename Struct>
+inline size_t ChainSlot<Struct>::GetDataOffset() const
+{
+	return DataOffset;
+}
+
+template<typename HeadType>
+inline ChainInstance<HeadType>::ChainInstance(std::byte* instanceData): InstanceData(instanceData)
+{
+}
+
+template<typename HeadType>
+inline ChainInstance<HeadType>::~ChainInstance()
+{
+}
+
+template<typename HeadType>
+inline HeadType& ChainInstance<HeadType>::GetChainHead()
+{
+	HeadType* head = reinterpret_cast<HeadType*>(InstanceData);
+	return *head;
+}
+
+template<typename HeadType>
+template<typename Struct>
+inline Struct& ChainInstance<HeadType>::GetSlotData(ChainSlot<Struct> slot)
+{
+	Struct* structPtr = reinterpret_cast<Struct*>(InstanceData + slot.GetDataOffset());
+	return *structPtr;
+}
+
+template<typename HeadType>
+inline ChainTemplate<HeadType>::ChainTemplate()
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the chain template must be trivially destructible");
+
+	HeadType head = HeadType();
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline ChainTemplate<HeadType>::ChainTemplate(const HeadType& head)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the chain template must be trivially destructible");
+
+	AppendLinkData((const std::byte*)(&head), sizeof(HeadType), offsetof(HeadType, sType), offsetof(HeadType, pNext), ValidStructureType<HeadType>);
+}
+
+template<typename HeadType>
+inline ChainTemplate<HeadType>::~ChainTemplate()
+{
+}
+
+template<typename HeadType>
+inline ChainSlot<HeadType> ChainTemplate<HeadType>::GetHeadSlot() const
+{
+	return ChainSlot<HeadType>(0);
+}
+
+template<typename HeadType>
+template<typename Struct>
+inline ChainSlot<Struct> ChainTemplate<HeadType>::AppendToChain(const Struct& next)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the chain template must be trivially destructible");
+
+	size_t linkDataOffset = AppendLinkData((const std::byte*)(&next), sizeof(Struct), offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	return ChainSlot<Struct>(linkDataOffset);
+}
+
+template<typename HeadType>
+inline size_t ChainTemplate<HeadType>::GetInstanceSize() const
+{
+	return TemplateData.size();
+}
+
+template<typename HeadType>
+inline ChainInstance<HeadType> ChainTemplate<HeadType>::Instantiate(void* instanceMemory) const
+{
+	assert(((uintptr_t)instanceMemory & (ChainLinkDataAlignment - 1)) == 0);
+
+	std::byte* instanceData = reinterpret_cast<std::byte*>(instanceMemory);
+	memcpy(instanceData, TemplateData.data(), TemplateData.size());
+
+	//All pNext pointers in the template are null, only the pointers between the links need to be set
+	for(size_t i = 1; i < LinkOffsets.size(); i++)
+	{
+		std::byte* linkData = instanceData + LinkOffsets[i];
+		memcpy(instanceData + PNextFieldOffsets[i - 1], &linkData, sizeof(void*));
+	}
+
+	return ChainInstance<HeadType>(instanceData);
+}
+
+template<typename HeadType>
+inline size_t ChainTemplate<HeadType>::AppendLinkData(const std::byte* data, size_t dataSize, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
+{
+	size_t linkDataOffset = (TemplateData.size() + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+	TemplateData.resize(linkDataOffset + dataSize);
+	memcpy(TemplateData.data() + linkDataOffset, data, dataSize);
+
+	const void* pNext = nullptr;
+	memcpy(TemplateData.data() + linkDataOffset + dataPNextOffset, &pNext, sizeof(void*));
+
+	InitSType(TemplateData.data() + linkDataOffset, dataSTypeOffset, sType);
+
+	LinkOffsets.push_back(linkDataOffset);
+	PNextFieldOffsets.push_back(linkDataOffset + dataPNextOffset);
+
+	return linkDataOffset;
+}
+
+//==========================================================================================================================
+
+//Number of elements the pointer member points to, read from the count member of the structure
+inline size_t GetPointerMemberElementCount(const std::byte* structureData, const PointerMemberLayout& pointerMember)
+{
+	uint64_t count = 1;
+	if(pointerMember.CountSize == sizeof(uint32_t))
+	{
+		uint32_t count32 = 0;
+		memcpy(&count32, structureData + pointerMember.CountOffset, sizeof(uint32_t));
+
+		count = count32;
+	}
+	else if(pointerMember.CountSize == sizeof(uint64_t))
+	{
+		memcpy(&count, structureData + pointerMember.CountOffset, sizeof(uint64_t));
+	}
+	else
+	{
+		return 1;
+	}
+
+	return (size_t)((count + pointerMember.CountAdd) / pointerMember.CountDivisor);
+}
+
+//Deep copy of a structure together with its pNext chain and all the data its pointer members point to, in a single exact-size blob
+//Pointer members are followed using the generated GetSTypePointerLayout table, the opaque ones (e.g. pUserData) are copied as is
+//Doesn't reference any outside memory, so it can be built on one thread and consumed on another
+class StructureTreeBlob
+{
+public:
+	//Creates an empty tree without a head. Only useful as a placeholder to copy or move another tree into
+	StructureTreeBlob();
+	explicit StructureTreeBlob(const void* head);
+	~StructureTreeBlob();
+
+	//Copying is a single blob copy plus relocation of the tree pointers, so all pointers of the copy point into the copy
+	StructureTreeBlob(const StructureTreeBlob& rhs);
+	StructureTreeBlob& operator=(const StructureTreeBlob& rhs);
+
+	//Moving keeps the blob in place, so all pointers stay valid
+	StructureTreeBlob(StructureTreeBlob&& rhs)			  = default;
+	StructureTreeBlob& operator=(StructureTreeBlob&& rhs) = default;
+
+	const void*			GetTreeHeadData()  const;
+	VulkanStructureType GetTreeHeadSType() const;
+	size_t				GetTreeDataSize()  const;
+
+	template<typename HeadType>
+	const HeadType& GetTreeHeadAs() const;
+
+	//Serializes the whole tree, see SerializeStructures()
+	std::vector<std::byte> Serialize() const;
+
+	//Loads the tree serialized with SerializeStructures(), deep or not. The data is copied once and the pointers are relocated in a single pass
+	//Returns false if the data is not a valid serialized tree
+	static bool Deserialize(const void* serializedData, size_t serializedSize, StructureTreeBlob& outTree);
+
+private:
+	void CopyTree(const void* head);
+	void RelocateTree(const std::byte* oldTreeData);
+
+	//Every copy function runs twice: first with null treeBase to only measure the tree, then to copy it into the allocated blob
+	static std::byte* AllocateTreeData(std::byte* treeBase, size_t& treeSize, size_t dataSize, size_t dataAlignment);
+
+	std::byte* CopyTreeArray(std::byte* treeBase, size_t& treeSize, const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool copyPNext);
+	std::byte* CopyTreeChain(std::byte* treeBase, size_t& treeSize, const void* chainLink);
+	std::byte* CopyTreePointer(std::byte* treeBase, size_t& treeSize, const std::byte* structureData, const PointerMemberLayout& pointerMember);
+	std::byte* CopyTreeString(std::byte* treeBase, size_t& treeSize, const char* string);
+
+	//Writes the pointer into the copied tree and remembers its place for relocation. Does nothing when only measuring
+	void WriteTreePointer(std::byte* treeBase, std::byte* pointerPlace, const void* pointer);
+
+private:
+	std::vector<std::byte> TreeData;
+	std::vector<size_t>	   TreePointerOffsets; //Offsets of all non-null pointers inside TreeData that point into TreeData
+};
+
+inline StructureTreeBlob::StructureTreeBlob()
+{
+}
+
+inline StructureTreeBlob::StructureTreeBlob(const void* head)
+{
+	CopyTree(head);
+}
+
+inline StructureTreeBlob::~StructureTreeBlob()
+{
+}
+
+inline StructureTreeBlob::StructureTreeBlob(const StructureTreeBlob& rhs)
+{
+	*this = rhs;
+}
+
+inline StructureTreeBlob& StructureTreeBlob::operator=(const StructureTreeBlob& rhs)
+{
+	if(this == &rhs)
+	{
+		return *this;
+	}
+
+	TreeData		   = rhs.TreeData;
+	TreePointerOffsets = rhs.TreePointerOffsets;
+
+	RelocateTree(rhs.TreeData.data());
+	return *this;
+}
+
+inline const void* StructureTreeBlob::GetTreeHeadData() const
+{
+	assert(TreeData.size() > 0);
+
+	return TreeData.data();
+}
+
+inline VulkanStructureType StructureTreeBlob::GetTreeHeadSType() const
+{
+	return GetChainLinkSType(GetTreeHeadData());
+}
+
+inline size_t StructureTreeBlob::GetTreeDataSize() const
+{
+	return TreeData.size();
+}
+
+template<typename HeadType>
+inline const HeadType& StructureTreeBlob::GetTreeHeadAs() const
+{
+	assert(GetTreeHeadSType() == ValidStructureType<HeadType>);
+
+	const HeadType* head = reinterpret_cast<const HeadType*>(GetTreeHeadData());
+	return *head;
+}
+
+inline void StructureTreeBlob::CopyTree(const void* head)
+{
+	VulkanStructureType headSType = GetChainLinkSType(head);
+
+	size_t headSize = GetSTypeStructureSize(headSType);
+	assert(headSize != 0);
+
+	const std::byte*			  headData	 = (const std::byte*)head;
+	const StructurePointerLayout* headLayout = GetSTypePointerLayout(headSType);
+
+	size_t treeSize = 0;
+	CopyTreeArray(nullptr, treeSize, headData, headSize, 1, headLayout, true);
+
+	TreeData.clear();
+	TreeData.resize(treeSize);
+	TreePointerOffsets.clear();
+
+	size_t copiedSize = 0;
+	CopyTreeArray(TreeData.data(), copiedSize, headData, headSize, 1, headLayout, true);
+
+	assert(copiedSize == treeSize);
+}
+
+inline void StructureTreeBlob::RelocateTree(const std::byte* oldTreeData)
+{
+	std::byte* newTreeData = TreeData.data();
+	for(size_t pointerOffset: TreePointerOffsets)
+	{
+		const std::byte* pointer = nullptr;
+		memcpy(&pointer, newTreeData + pointerOffset, sizeof(void*));
+
+		pointer = newTreeData + (pointer - oldTreeData);
+		memcpy(newTreeData + pointerOffset, &pointer, sizeof(void*));
+	}
+}
+
+inline std::byte* StructureTreeBlob::AllocateTreeData(std::byte* treeBase, size_t& treeSize, size_t dataSize, size_t dataAlignment)
+{
+	size_t dataOffset = (treeSize + dataAlignment - 1) & ~(dataAlignment - 1);
+	treeSize = dataOffset + dataSize;
+
+	if(treeBase == nullptr)
+	{
+		return nullptr;
+	}
+
+	return treeBase + dataOffset;
+}
+
+inline std::byte* StructureTreeBlob::CopyTreeArray(std::byte* treeBase, size_t& treeSize, const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool copyPNext)
+{
+	std::byte* arrayCopy = AllocateTreeData(treeBase, treeSize, elementSize * elementCount, ChainLinkDataAlignment);
+	if(arrayCopy != nullptr)
+	{
+		memcpy(arrayCopy, arrayData, elementSize * elementCount);
+	}
+
+	for(size_t i = 0; i < elementCount; i++)
+	{
+		const std::byte* elementData = arrayData + i * elementSize;
+		std::byte*		 elementCopy = (arrayCopy != nullptr) ? (arrayCopy + i * elementSize) : nullptr;
+
+		if(elementLayout != nullptr)
+		{
+			for(uint32_t j = 0; j < elementLayout->MemberCount; j++)
+			{
+				const PointerMemberLayout& pointerMember = elementLayout->Members[j];
+
+				std::byte* pointerCopy = CopyTreePointer(treeBase, treeSize, elementData, pointerMember);
+				if(elementCopy != nullptr)
+				{
+					WriteTreePointer(treeBase, elementCopy + pointerMember.Offset, pointerCopy);
+				}
+			}
+		}
+
+		if(copyPNext)
+		{
+			std::byte* chainCopy = CopyTreeChain(treeBase, treeSize, GetChainLinkPNext(elementData));
+			if(elementCopy != nullptr)
+			{
+				WriteTreePointer(treeBase, elementCopy + offsetof(VkBaseInStructure, pNext), chainCopy);
+			}
+		}
+	}
+
+	return arrayCopy;
+}
+
+inline std::byte* StructureTreeBlob::CopyTreeChain(std::byte* treeBase, size_t& treeSize, const void* chainLink)
+{
+	std::byte* firstLinkCopy = nullptr;
+	std::byte* prevLinkCopy  = nullptr;
+
+	//Links with unknown sType are skipped, same as in AnyStructureChainBlob::Linearize()
+	for(const void* link = chainLink; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		VulkanStructureType linkSType = GetChainLinkSType(link);
+
+		size_t linkSize = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		std::byte* linkCopy = CopyTreeArray(treeBase, treeSize, (const std::byte*)link, linkSize, 1, GetSTypePointerLayout(linkSType), false);
+		if(linkCopy != nullptr)
+		{
+			if(prevLinkCopy != nullptr)
+			{
+				WriteTreePointer(treeBase, prevLinkCopy + offsetof(VkBaseInStructure, pNext), linkCopy);
+			}
+			else
+			{
+				firstLinkCopy = linkCopy;
+			}
+
+			const void* pNext = nullptr;
+			memcpy(linkCopy + offsetof(VkBaseInStructure, pNext), &pNext, sizeof(void*));
+		}
+
+		prevLinkCopy = linkCopy;
+	}
+
+	return firstLinkCopy;
+}
+
+inline std::byte* StructureTreeBlob::CopyTreePointer(std::byte* treeBase, size_t& treeSize, const std::byte* structureData, const PointerMemberLayout& pointerMember)
+{
+	const std::byte* pointerData = nullptr;
+	memcpy(&pointerData, structureData + pointerMember.Offset, sizeof(void*));
+
+	if(pointerData == nullptr)
+	{
+		return nullptr;
+	}
+
+	//The pointer is ignored by Vulkan if the count is 0, it's not copied
+	size_t elementCount = GetPointerMemberElementCount(structureData, pointerMember);
+	if(elementCount == 0)
+	{
+		return nullptr;
+	}
+
+	switch(pointerMember.Kind)
+	{
+	case PointerMemberKind::Array:
+	{
+		bool copyElementPNext = pointerMember.ElementLayout != nullptr && pointerMember.ElementLayout->HasPNext;
+		return CopyTreeArray(treeBase, treeSize, pointerData, pointerMember.ElementSize, elementCount, pointerMember.ElementLayout, copyElementPNext);
+	}
+	case PointerMemberKind::String:
+	{
+		return CopyTreeString(treeBase, treeSize, (const char*)pointerData);
+	}
+	case PointerMemberKind::StringArray:
+	{
+		std::byte* stringArrayCopy = AllocateTreeData(treeBase, treeSize, elementCount * sizeof(const char*), alignof(const char*));
+		for(size_t i = 0; i < elementCount; i++)
+		{
+			const char* string = nullptr;
+			memcpy(&string, pointerData + i * sizeof(const char*), sizeof(const char*));
+
+			std::byte* stringCopy = (string != nullptr) ? CopyTreeString(treeBase, treeSize, string) : nullptr;
+			if(stringArrayCopy != nullptr)
+			{
+				WriteTreePointer(treeBase, stringArrayCopy + i * sizeof(const char*), stringCopy);
+			}
+		}
+
+		return stringArrayCopy;
+	}
+	default:
+		return nullptr;
+	}
+}
+
+inline std::byte* StructureTreeBlob::CopyTreeString(std::byte* treeBase, size_t& treeSize, const char* string)
+{
+	size_t stringSize = strlen(string) + 1;
+
+	std::byte* stringCopy = AllocateTreeData(treeBase, treeSize, stringSize, alignof(char));
+	if(stringCopy != nullptr)
+	{
+		memcpy(stringCopy, string, stringSize);
+	}
+
+	return stringCopy;
+}
+
+inline void StructureTreeBlob::WriteTreePointer(std::byte* treeBase, std::byte* pointerPlace, const void* pointer)
+{
+	memcpy(pointerPlace, &pointer, sizeof(void*));
+	if(pointer != nullptr)
+	{
+		TreePointerOffsets.push_back(pointerPlace - treeBase);
+	}
+}
+
+//==========================================================================================================================
+
+//Canonical key of a structure tree: the structure, its pNext chain and all the data its pointer members point to
+//Trees that only differ in pointer values, padding or the order of pNext links get the same key
+struct StructureTreeKey
+{
+	uint64_t			   Hash[2];
+	std::vector<std::byte> KeyData; //Canonical serialized tree, only kept on request. Keys without it are compared by the 128-bit hash alone
+
+	bool operator==(const StructureTreeKey& rhs) const;
+	bool operator!=(const StructureTreeKey& rhs) const;
+};
+
+//Makes StructureTreeKey for structure trees, e.g. VkGraphicsPipelineCreateInfo for pipeline deduplication
+//The scratch memory is kept between the calls, so making a key doesn't allocate once the builder is warmed up. Not thread-safe, use one builder per thread
+class StructureTreeKeyBuilder
+{
+public:
+	StructureTreeKeyBuilder();
+	~StructureTreeKeyBuilder();
+
+	StructureTreeKey MakeKey(const void* head, bool keepKeyData = false);
+
+private:
+	//Returns the offset of the appended data. The key buffer only grows, so appending doesn't allocate once it's big enough
+	size_t AllocateKeyData(size_t dataSize);
+	void   AppendKeyData(const void* data, size_t dataSize);
+
+	//The pNext chains of chain links themselves are walked by AppendChain(), not appended recursively
+	void AppendStructureArray(const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, const StructureMemberRange* elementMemberRanges, size_t elementMemberRangeCount, bool hasPNext, bool appendChain);
+	void AppendChain(const void* chainLink);
+	void AppendPointer(const std::byte* structureData, const PointerMemberLayout& pointerMember);
+	void AppendString(const char* string);
+
+private:
+	std::vector<std::byte> KeyData;
+	size_t				   KeyDataSize;
+
+	//Serialized pNext links are sorted to make the key independent of the link order
+	std::vector<std::pair<size_t, size_t>> LinkSpans;
+	std::vector<std::byte>				   SortedLinkData;
+};
+
+inline bool StructureTreeKey::operator==(const StructureTreeKey& rhs) const
+{
+	if(Hash[0] != rhs.Hash[0] || Hash[1] != rhs.Hash[1])
+	{
+		return false;
+	}
+
+	if(KeyData.size() == 0 || rhs.KeyData.size() == 0)
+	{
+		return true;
+	}
+
+	return KeyData == rhs.KeyData;
+}
+
+inline bool StructureTreeKey::operator!=(const StructureTreeKey& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline StructureTreeKeyBuilder::StructureTreeKeyBuilder(): KeyDataSize(0)
+{
+}
+
+inline StructureTreeKeyBuilder::~StructureTreeKeyBuilder()
+{
+}
+
+inline StructureTreeKey StructureTreeKeyBuilder::MakeKey(const void* head, bool keepKeyData)
+{
+	KeyDataSize = 0;
+
+	//Same as a chain link with unknown sType, the head is only equal to itself
+	VulkanStructureType headSType = GetChainLinkSType(head);
+	size_t				headSize  = GetSTypeStructureSize(headSType);
+	if(headSize == 0)
+	{
+		AppendKeyData(&headSType, sizeof(VulkanStructureType));
+		AppendKeyData(&head, sizeof(void*));
+	}
+	else
+	{
+		AppendStructureArray((const std::byte*)head, headSize, 1, GetSTypePointerLayout(headSType), nullptr, 0, true, true);
+	}
+
+	StructureTreeKey key;
+	HashBytes128(KeyData.data(), KeyDataSize, key.Hash);
+
+	if(keepKeyData)
+	{
+		key.KeyData.assign(KeyData.begin(), KeyData.begin() + KeyDataSize);
+	}
+
+	return key;
+}
+
+inline size_t StructureTreeKeyBuilder::AllocateKeyData(size_t dataSize)
+{
+	size_t keyDataOffset = KeyDataSize;
+
+	KeyDataSize += dataSize;
+	if(KeyDataSize > KeyData.size())
+	{
+		KeyData.resize(KeyDataSize > 2 * KeyData.size() ? KeyDataSize : 2 * KeyData.size());
+	}
+
+	return keyDataOffset;
+}
+
+inline void StructureTreeKeyBuilder::AppendKeyData(const void* data, size_t dataSize)
+{
+	size_t keyDataOffset = AllocateKeyData(dataSize);
+	memcpy(KeyData.data() + keyDataOffset, data, dataSize);
+}
+
+inline void StructureTreeKeyBuilder::AppendStructureArray(const std::byte* arrayData, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, const StructureMemberRange* elementMemberRanges, size_t elementMemberRangeCount, bool hasPNext, bool appendChain)
+{
+	for(size_t i = 0; i < elementCount; i++)
+	{
+		const std::byte* elementData = arrayData + i * elementSize;
+
+		//Pointer values are replaced by the data they point to, appended right after the structure
+		size_t	   elementKeyOffset = AllocateKeyData(elementSize);
+		std::byte* elementKeyData = KeyData.data() + elementKeyOffset;
+		if(hasPNext)
+		{
+			CopyMaskedStructure(elementKeyData, elementData, elementSize, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext));
+		}
+		else if(elementMemberRanges != nullptr)
+		{
+			CopyStructureMemberRanges(elementKeyData, elementData, elementSize, elementMemberRanges, elementMemberRangeCount);
+		}
+		else
+		{
+			memcpy(elementKeyData, elementData, elementSize);
+		}
+
+		if(elementLayout != nullptr)
+		{
+			for(uint32_t j = 0; j < elementLayout->MemberCount; j++)
+			{
+				memset(elementKeyData + elementLayout->Members[j].Offset, 0, sizeof(void*));
+			}
+
+			for(uint32_t j = 0; j < elementLayout->MemberCount; j++)
+			{
+				AppendPointer(elementData, elementLayout->Members[j]);
+			}
+		}
+
+		if(appendChain)
+		{
+			AppendChain(GetChainLinkPNext(elementData));
+		}
+	}
+}
+
+inline void StructureTreeKeyBuilder::AppendChain(const void* chainLink)
+{
+	size_t linkSpanBase = LinkSpans.size();
+
+	//The link count goes first, it's written after the chain is walked
+	uint64_t linkCount		 = 0;
+	size_t	 linkCountOffset = AllocateKeyData(sizeof(uint64_t));
+
+	size_t chainOffset = KeyDataSize;
+
+	for(const void* link = chainLink; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkKeyOffset = KeyDataSize;
+
+		//The contents of the links with unknown sType can't be read, such links are only equal to themselves
+		VulkanStructureType linkSType = GetChainLinkSType(link);
+		size_t				linkSize  = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			AppendKeyData(&linkSType, sizeof(VulkanStructureType));
+			AppendKeyData(&link, sizeof(void*));
+		}
+		else
+		{
+			AppendStructureArray((const std::byte*)link, linkSize, 1, GetSTypePointerLayout(linkSType), nullptr, 0, true, false);
+		}
+
+		LinkSpans.push_back(std::make_pair(linkKeyOffset, KeyDataSize - linkKeyOffset));
+	}
+
+	linkCount = LinkSpans.size() - linkSpanBase;
+	memcpy(KeyData.data() + linkCountOffset, &linkCount, sizeof(uint64_t));
+
+	if(linkCount > 1)
+	{
+		const std::byte* keyData = KeyData.data();
+		std::sort(LinkSpans.begin() + linkSpanBase, LinkSpans.end(), [keyData](const std::pair<size_t, size_t>& lhs, const std::pair<size_t, size_t>& rhs)
+		{
+			if(lhs.second != rhs.second)
+			{
+				return lhs.second < rhs.second;
+			}
+
+			return memcmp(keyData + lhs.first, keyData + rhs.first, lhs.second) < 0;
+		});
+
+		SortedLinkData.clear();
+		for(size_t i = linkSpanBase; i < LinkSpans.size(); i++)
+		{
+			SortedLinkData.insert(SortedLinkData.end(), KeyData.begin() + LinkSpans[i].first, KeyData.begin() + LinkSpans[i].first + LinkSpans[i].second);
+		}
+
+		memcpy(KeyData.data() + chainOffset, SortedLinkData.data(), SortedLinkData.size());
+	}
+
+	LinkSpans.resize(linkSpanBase);
+}
+
+inline void StructureTreeKeyBuilder::AppendPointer(const std::byte* structureData, const PointerMemberLayout& pointerMember)
+{
+	const std::byte* pointerData = nullptr;
+	memcpy(&pointerData, structureData + pointerMember.Offset, sizeof(void*));
+
+	//Null pointers and empty arrays are the same for Vulkan
+	uint64_t elementCount = (pointerData != nullptr) ? GetPointerMemberElementCount(structureData, pointerMember) : 0;
+	AppendKeyData(&elementCount, sizeof(uint64_t));
+
+	if(elementCount == 0)
+	{
+		return;
+	}
+
+	switch(pointerMember.Kind)
+	{
+	case PointerMemberKind::Array:
+	{
+		bool hasElementPNext = pointerMember.ElementLayout != nullptr && pointerMember.ElementLayout->HasPNext;
+		AppendStructureArray(pointerData, pointerMember.ElementSize, (size_t)elementCount, pointerMember.ElementLayout, pointerMember.ElementMemberRanges, pointerMember.ElementMemberRangeCount, hasElementPNext, hasElementPNext);
+		break;
+	}
+	case PointerMemberKind::String:
+	{
+		AppendString((const char*)pointerData);
+		break;
+	}
+	case PointerMemberKind::StringArray:
+	{
+		for(size_t i = 0; i < elementCount; i++)
+		{
+			const char* string = nullptr;
+			memcpy(&string, pointerData + i * sizeof(const char*), sizeof(const char*));
+
+			AppendString(string != nullptr ? string : "");
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+inline void StructureTreeKeyBuilder::AppendString(const char* string)
+{
+	uint64_t stringSize = strlen(string);
+
+	AppendKeyData(&stringSize, sizeof(uint64_t));
+	AppendKeyData(string, (size_t)stringSize);
+}
+
+//==========================================================================================================================
+
+//Flat binary form of a structure chain, optionally with all the data its pointer members point to (deep serialization)
+//The layout is: SerializedStructuresHeader, RecordCount records of the chain structures in the pNext order with the head first,
+//DataSize bytes of the structure data (padded to 8 bytes), RelocationCount uint64_t offsets of the pointers inside the structure data
+//Every relocated pointer is stored as the offset of its target in the structure data plus 1, null pointers are left as 0 and not relocated
+//Pointers that are not relocated (opaque ones like pUserData, or everything except pNext for non-deep serialization) are stored as is and zeroed when loading
+//The format depends on the pointer size and the byte order, the data made on a platform with different ones is rejected
+
+constexpr uint32_t SerializedStructuresMagic   = 0x53534756; //"VGSS"
+constexpr uint16_t SerializedStructuresVersion = 1;
+
+constexpr uint8_t SerializedStructuresDeepFlag		= 0x01;
+constexpr uint8_t SerializedStructuresRelocatedFlag = 0x02; //Set by LoadSerializedStructures(), the pointers are absolute
+
+struct SerializedStructuresHeader
+{
+	uint32_t Magic;
+	uint16_t Version;
+	uint8_t	 PointerSize;
+	uint8_t	 Flags;
+	uint32_t RecordCount;
+	uint32_t Reserved;
+	uint64_t DataSize;
+	uint64_t RelocationCount;
+};
+
+struct SerializedStructureRecord
+{
+	VulkanStructureType SType;
+	uint32_t			Size;
+	uint64_t			Offset; //From the start of the structure data, the head is always at 0
+};
+
+static_assert(sizeof(SerializedStructuresHeader) % ChainLinkDataAlignment == 0, "Structure data must stay aligned after the serialized header");
+static_assert(sizeof(SerializedStructureRecord)	 % ChainLinkDataAlignment == 0, "Structure data must stay aligned after the serialized records");
+
+//Serializes the pNext chain of head. With deep = true also serializes all the data its pointer members point to, same as StructureTreeBlob copies it
+//Links with unknown sType are skipped, the head has to be known
+std::vector<std::byte> SerializeStructures(const void* head, bool deep);
+
+//Zero-copy loading: relocates the pointers of the serialized data in place in a single pass, and returns the head structure right inside the data
+//Meant for memory-mapped files. Map the file copy-on-write (MAP_PRIVATE with PROT_WRITE, or FILE_MAP_COPY on Windows), so only the pages with pointers get copied
+//The data has to be aligned to ChainLinkDataAlignment and can only be loaded once. Returns null if the data is not valid
+const void* LoadSerializedStructures(void* serializedData, size_t serializedSize);
+
+inline size_t GetSerializedDataOffset(const SerializedStructuresHeader& header)
+{
+	return sizeof(SerializedStructuresHeader) + (size_t)header.RecordCount * sizeof(SerializedStructureRecord);
+}
+
+inline size_t GetSerializedRelocationsOffset(const SerializedStructuresHeader& header)
+{
+	return GetSerializedDataOffset(header) + (size_t)((header.DataSize + ChainLinkDataAlignment - 1) & ~(uint64_t)(ChainLinkDataAlignment - 1));
+}
+
+inline SerializedStructureRecord GetSerializedRecord(const std::byte* serializedData, size_t recordIndex)
+{
+	SerializedStructureRecord record;
+	memcpy(&record, serializedData + sizeof(SerializedStructuresHeader) + recordIndex * sizeof(SerializedStructureRecord), sizeof(SerializedStructureRecord));
+
+	return record;
+}
+
+//Checks everything but the pointers, which are checked by SerializedPointerValidator
+inline bool ReadSerializedHeader(const std::byte* serializedData, size_t serializedSize, SerializedStructuresHeader& outHeader)
+{
+	if(serializedData == nullptr || serializedSize < sizeof(SerializedStructuresHeader))
+	{
+		return false;
+	}
+
+	memcpy(&outHeader, serializedData, sizeof(SerializedStructuresHeader));
+	if(outHeader.Magic != SerializedStructuresMagic || outHeader.Version != SerializedStructuresVersion || outHeader.PointerSize != sizeof(void*) || outHeader.RecordCount == 0)
+	{
+		return false;
+	}
+
+	//All sizes are checked against the remaining size first, so nothing can overflow
+	size_t remainingSize = serializedSize - sizeof(SerializedStructuresHeader);
+	if(outHeader.RecordCount > remainingSize / sizeof(SerializedStructureRecord))
+	{
+		return false;
+	}
+
+	remainingSize -= (size_t)outHeader.RecordCount * sizeof(SerializedStructureRecord);
+	if(outHeader.DataSize > remainingSize)
+	{
+		return false;
+	}
+
+	size_t paddedDataSize = GetSerializedRelocationsOffset(outHeader) - GetSerializedDataOffset(outHeader);
+	if(paddedDataSize > remainingSize)
+	{
+		return false;
+	}
+
+	remainingSize -= paddedDataSize;
+	if(outHeader.RelocationCount > remainingSize / sizeof(uint64_t))
+	{
+		return false;
+	}
+
+	for(size_t i = 0; i < outHeader.RecordCount; i++)
+	{
+		SerializedStructureRecord record = GetSerializedRecord(serializedData, i);
+
+		size_t structureSize = GetSTypeStructureSize(record.SType);
+		if(structureSize == 0 || record.Size != structureSize || structureSize > outHeader.DataSize || record.Offset > outHeader.DataSize - structureSize)
+		{
+			return false;
+		}
+
+		if(record.Offset % ChainLinkDataAlignment != 0 || (i == 0 && record.Offset != 0))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//The read-only pass of the loading: walks the serialized structures from the records the same way StructureTreeBlob copies them, and checks every pointer before anything is written
+//Every relocation has to be a pointer the walk reaches, every relocated pNext of the records has to point to the next record, and every pointer without a relocation has to be null
+//The pointers the walk doesn't follow (opaque ones, or everything except pNext for non-deep data) are collected to be zeroed
+class SerializedPointerValidator
+{
+public:
+	SerializedPointerValidator(const std::byte* structureData, size_t dataSize, bool deep);
+	~SerializedPointerValidator();
+
+	//Fills outRelocatedOffsets with the offsets of the pointers to relocate and outClearedOffsets with the offsets of the pointers to zero
+	bool Validate(const std::byte* serializedData, const SerializedStructuresHeader& header, std::vector<size_t>& outRelocatedOffsets, std::vector<size_t>& outClearedOffsets);
+
+private:
+	bool ReadRelocations(const std::byte* relocationData, size_t relocationCount);
+
+	//Reads the pointer as stored: the target offset plus 1, or 0 for null. Every relocated pointer can be taken only once, so the walk can't loop
+	bool TakePointer(size_t pointerOffset, size_t& outStoredTarget);
+	bool ClearPointer(size_t pointerOffset);
+
+	bool ValidateArray(size_t arrayOffset, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool validatePNext);
+	bool ValidateStructure(size_t structureOffset, const StructurePointerLayout* layout);
+	bool ValidateChain(size_t pNextOffset);
+	bool ValidatePointer(size_t structureOffset, const PointerMemberLayout& pointerMember);
+	bool ValidateString(size_t stringOffset);
+
+private:
+	const std::byte* StructureData;
+	size_t			 DataSize;
+	bool			 Deep;
+
+	std::vector<size_t>	 RelocatedOffsets; //In the order of the relocations, so the loaded data serializes the same way
+	std::vector<size_t>	 SortedRelocatedOffsets;
+	std::vector<uint8_t> TakenRelocations;
+	size_t				 TakenRelocationCount;
+
+	std::vector<size_t> ClearedOffsets;
+};
+
+inline SerializedPointerValidator::SerializedPointerValidator(const std::byte* structureData, size_t dataSize, bool deep): StructureData(structureData), DataSize(dataSize), Deep(deep), TakenRelocationCount(0)
+{
+}
+
+inline SerializedPointerValidator::~SerializedPointerValidator()
+{
+}
+
+inline bool SerializedPointerValidator::Validate(const std::byte* serializedData, const SerializedStructuresHeader& header, std::vector<size_t>& outRelocatedOffsets, std::vector<size_t>& outClearedOffsets)
+{
+	if(!ReadRelocations(serializedData + GetSerializedRelocationsOffset(header), (size_t)header.RelocationCount))
+	{
+		return false;
+	}
+
+	for(size_t i = 0; i < header.RecordCount; i++)
+	{
+		SerializedStructureRecord record = GetSerializedRecord(serializedData, i);
+
+		VulkanStructureType structureSType;
+		memcpy(&structureSType, StructureData + record.Offset + offsetof(VkBaseInStructure, sType), sizeof(VulkanStructureType));
+
+		if(structureSType != record.SType || !ValidateStructure((size_t)record.Offset, GetSTypePointerLayout(record.SType)))
+		{
+			return false;
+		}
+
+		size_t storedPNext = 0;
+		if(!TakePointer((size_t)record.Offset + offsetof(VkBaseInStructure, pNext), storedPNext))
+		{
+			return false;
+		}
+
+		size_t expectedPNext = (i + 1 < header.RecordCount) ? (size_t)GetSerializedRecord(serializedData, i + 1).Offset + 1 : 0;
+		if(storedPNext != expectedPNext)
+		{
+			return false;
+		}
+	}
+
+	//A relocation the walk doesn't reach would write to the data that's not a pointer
+	if(TakenRelocationCount != RelocatedOffsets.size())
+	{
+		return false;
+	}
+
+	outRelocatedOffsets.swap(RelocatedOffsets);
+	outClearedOffsets.swap(ClearedOffsets);
+	return true;
+}
+
+inline bool SerializedPointerValidator::ReadRelocations(const std::byte* relocationData, size_t relocationCount)
+{
+	RelocatedOffsets.resize(relocationCount);
+	for(size_t i = 0; i < relocationCount; i++)
+	{
+		uint64_t pointerOffset = 0;
+		memcpy(&pointerOffset, relocationData + i * sizeof(uint64_t), sizeof(uint64_t));
+
+		if(DataSize < sizeof(void*) || pointerOffset > DataSize - sizeof(void*) || pointerOffset % alignof(void*) != 0)
+		{
+			return false;
+		}
+
+		uintptr_t storedTarget = 0;
+		memcpy(&storedTarget, StructureData + pointerOffset, sizeof(void*));
+
+		if(storedTarget == 0 || storedTarget > DataSize)
+		{
+			return false;
+		}
+
+		RelocatedOffsets[i] = (size_t)pointerOffset;
+	}
+
+	SortedRelocatedOffsets = RelocatedOffsets;
+	std::sort(SortedRelocatedOffsets.begin(), SortedRelocatedOffsets.end());
+
+	if(std::adjacent_find(SortedRelocatedOffsets.begin(), SortedRelocatedOffsets.end()) != SortedRelocatedOffsets.end())
+	{
+		return false;
+	}
+
+	TakenRelocations.assign(relocationCount, 0);
+	return true;
+}
+
+inline bool SerializedPointerValidator::TakePointer(size_t pointerOffset, size_t& outStoredTarget)
+{
+	uintptr_t storedTarget = 0;
+	memcpy(&storedTarget, StructureData + pointerOffset, sizeof(void*));
+
+	outStoredTarget = (size_t)storedTarget;
+	if(storedTarget == 0)
+	{
+		return true;
+	}
+
+	std::vector<size_t>::const_iterator relocationIt = std::lower_bound(SortedRelocatedOffsets.cbegin(), SortedRelocatedOffsets.cend(), pointerOffset);
+	if(relocationIt == SortedRelocatedOffsets.cend() || *relocationIt != pointerOffset)
+	{
+		return false;
+	}
+
+	size_t relocationIndex = relocationIt - SortedRelocatedOffsets.cbegin();
+	if(TakenRelocations[relocationIndex] != 0)
+	{
+		return false;
+	}
+
+	TakenRelocations[relocationIndex] = 1;
+	TakenRelocationCount++;
+	return true;
+}
+
+inline bool SerializedPointerValidator::ClearPointer(size_t pointerOffset)
+{
+	if(std::binary_search(SortedRelocatedOffsets.begin(), SortedRelocatedOffsets.end(), pointerOffset))
+	{
+		return false;
+	}
+
+	ClearedOffsets.push_back(pointerOffset);
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidateArray(size_t arrayOffset, size_t elementSize, size_t elementCount, const StructurePointerLayout* elementLayout, bool validatePNext)
+{
+	for(size_t i = 0; i < elementCount; i++)
+	{
+		size_t elementOffset = arrayOffset + i * elementSize;
+		if(!ValidateStructure(elementOffset, elementLayout))
+		{
+			return false;
+		}
+
+		if(validatePNext && !ValidateChain(elementOffset + offsetof(VkBaseInStructure, pNext)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidateStructure(size_t structureOffset, const StructurePointerLayout* layout)
+{
+	if(layout == nullptr)
+	{
+		return true;
+	}
+
+	for(uint32_t i = 0; i < layout->MemberCount; i++)
+	{
+		const PointerMemberLayout& pointerMember = layout->Members[i];
+
+		bool pointerValid = Deep ? ValidatePointer(structureOffset, pointerMember) : ClearPointer(structureOffset + pointerMember.Offset);
+		if(!pointerValid)
+		{
+			return false;
+		}
+	}
+
+	for(uint32_t i = 0; i < layout->OpaquePointerCount; i++)
+	{
+		if(!ClearPointer(structureOffset + layout->OpaquePointerOffsets[i]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidateChain(size_t pNextOffset)
+{
+	size_t storedLink = 0;
+	if(!TakePointer(pNextOffset, storedLink))
+	{
+		return false;
+	}
+
+	while(storedLink != 0)
+	{
+		size_t linkOffset = storedLink - 1;
+		if(linkOffset % ChainLinkDataAlignment != 0 || DataSize - linkOffset < sizeof(VkBaseInStructure))
+		{
+			return false;
+		}
+
+		VulkanStructureType linkSType;
+		memcpy(&linkSType, StructureData + linkOffset + offsetof(VkBaseInStructure, sType), sizeof(VulkanStructureType));
+
+		size_t linkSize = GetSTypeStructureSize(linkSType);
+		if(linkSize == 0 || linkSize > DataSize - linkOffset || !ValidateStructure(linkOffset, GetSTypePointerLayout(linkSType)))
+		{
+			return false;
+		}
+
+		if(!TakePointer(linkOffset + offsetof(VkBaseInStructure, pNext), storedLink))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool SerializedPointerValidator::ValidatePointer(size_t structureOffset, const PointerMemberLayout& pointerMember)
+{
+	size_t storedTarget = 0;
+	if(!TakePointer(structureOffset + pointerMember.Offset, storedTarget))
+	{
+		return false;
+	}
+
+	if(storedTarget == 0)
+	{
+		return true;
+	}
+
+	//Pointers with the count of 0 are never serialized
+	size_t elementCount = GetPointerMemberElementCount(StructureData + structureOffset, pointerMember);
+	if(elementCount == 0)
+	{
+		return false;
+	}
+
+	size_t targetOffset = storedTarget - 1;
+	switch(pointerMember.Kind)
+	{
+	case PointerMemberKind::Array:
+	{
+		if(targetOffset % ChainLinkDataAlignment != 0 || elementCount > (DataSize - targetOffset) / pointerMember.ElementSize)
+		{
+			return false;
+		}
+
+		bool validateElementPNext = pointerMember.ElementLayout != nullptr && pointerMember.ElementLayout->HasPNext;
+		return ValidateArray(targetOffset, pointerMember.ElementSize, elementCount, pointerMember.ElementLayout, validateElementPNext);
+	}
+	case PointerMemberKind::String:
+	{
+		return ValidateString(targetOffset);
+	}
+	case PointerMemberKind::StringArray:
+	{
+		if(targetOffset % alignof(const char*) != 0 || elementCount > (DataSize - targetOffset) / sizeof(const char*))
+		{
+			return false;
+		}
+
+		for(size_t i = 0; i < elementCount; i++)
+		{
+			size_t storedString = 0;
+			if(!TakePointer(targetOffset + i * sizeof(const char*), storedString))
+			{
+				return false;
+			}
+
+			if(storedString != 0 && !ValidateString(storedString - 1))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+inline bool SerializedPointerValidator::ValidateString(size_t stringOffset)
+{
+	return memchr(StructureData + stringOffset, 0, DataSize - stringOffset) != nullptr;
+}
+
+//The write pass of the loading, can't fail once SerializedPointerValidator has checked the data
+inline void RelocateSerializedPointers(std::byte* structureData, const std::vector<size_t>& relocatedOffsets, const std::vector<size_t>& clearedOffsets)
+{
+	for(size_t pointerOffset: relocatedOffsets)
+	{
+		uintptr_t storedTarget = 0;
+		memcpy(&storedTarget, structureData + pointerOffset, sizeof(void*));
+
+		const std::byte* pointer = structureData + (storedTarget - 1);
+		memcpy(structureData + pointerOffset, &pointer, sizeof(void*));
+	}
+
+	for(size_t pointerOffset: clearedOffsets)
+	{
+		memset(structureData + pointerOffset, 0, sizeof(void*));
+	}
+}
+
+//Serializes the structures of structureData, which has the head at the start and all pointers listed in pointerOffsets pointing inside it
+inline std::vector<std::byte> WriteSerializedStructures(const std::byte* structureData, size_t dataSize, const std::vector<size_t>& pointerOffsets, uint8_t flags)
+{
+	SerializedStructuresHeader header;
+	header.Magic		   = SerializedStructuresMagic;
+	header.Version		   = SerializedStructuresVersion;
+	header.PointerSize	   = sizeof(void*);
+	header.Flags		   = flags;
+	header.RecordCount	   = 0;
+	header.Reserved		   = 0;
+	header.DataSize		   = dataSize;
+	header.RelocationCount = pointerOffsets.size();
+
+	for(const void* link = structureData; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		header.RecordCount++;
+	}
+
+	size_t dataOffset		 = GetSerializedDataOffset(header);
+	size_t relocationsOffset = GetSerializedRelocationsOffset(header);
+
+	std::vector<std::byte> serializedData(relocationsOffset + pointerOffsets.size() * sizeof(uint64_t));
+	memcpy(serializedData.data(), &header, sizeof(SerializedStructuresHeader));
+
+	size_t recordIndex = 0;
+	for(const void* link = structureData; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		SerializedStructureRecord record;
+		record.SType  = GetChainLinkSType(link);
+		record.Size	  = (uint32_t)GetSTypeStructureSize(record.SType);
+		record.Offset = (const std::byte*)link - structureData;
+
+		memcpy(serializedData.data() + sizeof(SerializedStructuresHeader) + recordIndex * sizeof(SerializedStructureRecord), &record, sizeof(SerializedStructureRecord));
+		recordIndex++;
+	}
+
+	memcpy(serializedData.data() + dataOffset, structureData, dataSize);
+	for(size_t i = 0; i < pointerOffsets.size(); i++)
+	{
+		const std::byte* pointer = nullptr;
+		memcpy(&pointer, structureData + pointerOffsets[i], sizeof(void*));
+
+		assert(pointer >= structureData && pointer < structureData + dataSize);
+
+		uintptr_t targetOffset  = (uintptr_t)(pointer - structureData) + 1;
+		uint64_t  pointerOffset = pointerOffsets[i];
+
+		memcpy(serializedData.data() + dataOffset + pointerOffsets[i], &targetOffset, sizeof(void*));
+		memcpy(serializedData.data() + relocationsOffset + i * sizeof(uint64_t), &pointerOffset, sizeof(uint64_t));
+	}
+
+	return serializedData;
+}
+
+inline std::vector<std::byte> SerializeStructures(const void* head, bool deep)
+{
+	if(deep)
+	{
+		StructureTreeBlob structureTree(head);
+		return structureTree.Serialize();
+	}
+
+	VulkanStructureType headSType = GetChainLinkSType(head);
+	size_t				headSize  = GetSTypeStructureSize(headSType);
+	assert(headSize != 0);
+
+	//Measure the chain first, same as AnyStructureChainBlob::Linearize()
+	size_t dataSize  = headSize;
+	size_t linkCount = 1;
+	for(const void* link = GetChainLinkPNext(head); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize != 0)
+		{
+			dataSize = ((dataSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1)) + linkSize;
+			linkCount++;
+		}
+	}
+
+	std::vector<std::byte> structureData(dataSize);
+	std::vector<size_t>	   pointerOffsets;
+	pointerOffsets.reserve(linkCount - 1);
+
+	std::byte* prevLinkData = nullptr;
+	size_t	   linkOffset	= 0;
+	for(const void* link = head; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		std::byte* linkData = structureData.data() + linkOffset;
+		memcpy(linkData, link, linkSize);
+
+		const void* pNext = nullptr;
+		memcpy(linkData + offsetof(VkBaseInStructure, pNext), &pNext, sizeof(void*));
+
+		if(prevLinkData != nullptr)
+		{
+			memcpy(prevLinkData + offsetof(VkBaseInStructure, pNext), &linkData, sizeof(void*));
+			pointerOffsets.push_back((prevLinkData - structureData.data()) + offsetof(VkBaseInStructure, pNext));
+		}
+
+		prevLinkData = linkData;
+		linkOffset	 = ((linkOffset + linkSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1));
+	}
+
+	return WriteSerializedStructures(structureData.data(), structureData.size(), pointerOffsets, 0);
+}
+
+inline const void* LoadSerializedStructures(void* serializedData, size_t serializedSize)
+{
+	assert(((uintptr_t)serializedData & (ChainLinkDataAlignment - 1)) == 0);
+
+	std::byte* serializedBytes = (std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & SerializedStructuresRelocatedFlag) != 0)
+	{
+		return nullptr;
+	}
+
+	//Nothing is written until the whole data is checked, so the data that's not valid is left as is
+	std::byte* structureData = serializedBytes + GetSerializedDataOffset(header);
+
+	std::vector<size_t> relocatedOffsets;
+	std::vector<size_t> clearedOffsets;
+
+	SerializedPointerValidator pointerValidator(structureData, (size_t)header.DataSize, (header.Flags & SerializedStructuresDeepFlag) != 0);
+	if(!pointerValidator.Validate(serializedBytes, header, relocatedOffsets, clearedOffsets))
+	{
+		return nullptr;
+	}
+
+	RelocateSerializedPointers(structureData, relocatedOffsets, clearedOffsets);
+
+	header.Flags |= SerializedStructuresRelocatedFlag;
+	memcpy(serializedBytes, &header, sizeof(SerializedStructuresHeader));
+
+	return structureData;
+}
+
+inline std::vector<std::byte> StructureBlob::Serialize() const
+{
+	return SerializeStructures(StructureData, false);
+}
+
+inline bool StructureBlob::Deserialize(const void* serializedData, size_t serializedSize, StructureBlob& outBlob)
+{
+	const std::byte* serializedBytes = (const std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & (SerializedStructuresDeepFlag | SerializedStructuresRelocatedFlag)) != 0)
+	{
+		return false;
+	}
+
+	SerializedStructureRecord headRecord = GetSerializedRecord(serializedBytes, 0);
+	const std::byte*		  headData	 = serializedBytes + GetSerializedDataOffset(header) + headRecord.Offset;
+
+	outBlob.StructureBlobData.assign(headData, headData + headRecord.Size);
+
+	outBlob.PNextPointerOffset = offsetof(VkBaseInStructure, pNext);
+	outBlob.STypeOffset		   = offsetof(VkBaseInStructure, sType);
+
+	outBlob.StructureData = outBlob.StructureBlobData.data();
+	outBlob.StructureSize = outBlob.StructureBlobData.size();
+
+	memset(outBlob.StructureBlobData.data() + outBlob.PNextPointerOffset, 0, sizeof(void*));
+	return true;
+}
+
+inline std::vector<std::byte> GenericStructureChainBase::Serialize(bool deep) const
+{
+	return SerializeStructures(GetChainHeadData(), deep);
+}
+
+inline bool AnyStructureChainBlob::Deserialize(const void* serializedData, size_t serializedSize, AnyStructureChainBlob& outChain)
+{
+	const std::byte* serializedBytes = (const std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & (SerializedStructuresDeepFlag | SerializedStructuresRelocatedFlag)) != 0)
+	{
+		return false;
+	}
+
+	//The records are already in the chain order and aligned, so the chain data is copied as is and only the pNext pointers are set
+	const std::byte* structureData = serializedBytes + GetSerializedDataOffset(header);
+
+	AnyStructureChainBlob chain;
+	chain.StructureChainBlobData.reserve((size_t)header.DataSize);
+
+	chain.StructureDataPointers.reserve(header.RecordCount);
+	chain.STypeOffsets.reserve(header.RecordCount);
+	chain.PNextPointerOffsets.reserve(header.RecordCount);
+	chain.LinkDataCapacities.reserve(header.RecordCount);
+	chain.PrevLinkIndices.reserve(header.RecordCount);
+	chain.NextLinkIndices.reserve(header.RecordCount);
+
+	SerializedStructureRecord headRecord = GetSerializedRecord(serializedBytes, 0);
+	chain.InitChainHead(structureData + headRecord.Offset, headRecord.Size, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), headRecord.SType);
+
+	for(size_t i = 1; i < header.RecordCount; i++)
+	{
+		SerializedStructureRecord record = GetSerializedRecord(serializedBytes, i);
+
+		size_t linkIndex = chain.AddLinkData(structureData + record.Offset, record.Size, offsetof(VkBaseInStructure, sType), offsetof(VkBaseInStructure, pNext), record.SType);
+		chain.LinkAfter(chain.LastLinkIndex, linkIndex, nullptr);
+	}
+
+	outChain = std::move(chain);
+	return true;
+}
+
+template<typename HeadType>
+inline bool StructureChainBlob<HeadType>::Deserialize(const void* serializedData, size_t serializedSize, StructureChainBlob& outChain)
+{
+	AnyStructureChainBlob chain;
+	if(!AnyStructureChainBlob::Deserialize(serializedData, serializedSize, chain) || chain.GetChainHeadSType() != ValidStructureType<HeadType>)
+	{
+		return false;
+	}
+
+	outChain = StructureChainBlob(std::move(chain));
+	return true;
+}
+
+inline std::vector<std::byte> StructureTreeBlob::Serialize() const
+{
+	return WriteSerializedStructures(TreeData.data(), TreeData.size(), TreePointerOffsets, SerializedStructuresDeepFlag);
+}
+
+inline bool StructureTreeBlob::Deserialize(const void* serializedData, size_t serializedSize, StructureTreeBlob& outTree)
+{
+	const std::byte* serializedBytes = (const std::byte*)serializedData;
+
+	SerializedStructuresHeader header;
+	if(!ReadSerializedHeader(serializedBytes, serializedSize, header) || (header.Flags & SerializedStructuresRelocatedFlag) != 0)
+	{
+		return false;
+	}
+
+	//The tree data is the structure data as is, the relocations become the tree pointers
+	const std::byte* structureData = serializedBytes + GetSerializedDataOffset(header);
+
+	StructureTreeBlob   structureTree;
+	std::vector<size_t> clearedOffsets;
+
+	SerializedPointerValidator pointerValidator(structureData, (size_t)header.DataSize, (header.Flags & SerializedStructuresDeepFlag) != 0);
+	if(!pointerValidator.Validate(serializedBytes, header, structureTree.TreePointerOffsets, clearedOffsets))
+	{
+		return false;
+	}
+
+	structureTree.TreeData.assign(structureData, structureData + header.DataSize);
+	RelocateSerializedPointers(structureTree.TreeData.data(), structureTree.TreePointerOffsets, clearedOffsets);
+
+	outTree = std::move(structureTree);
+	return true;
+}
+
 //==========================================================================================================================
 
-//Base interface for StructureBlob(owning type-erased structure) and GenericStructureView(non-owning type-erased structure)
-class GenericStructBase
+//Identifies the chains queried from one physical device: the same device with the same driver fills the same set of structures the same way
+struct DeviceChainCacheKey
+{
+	uint8_t	 DeviceUUID[VK_UUID_SIZE];
+	uint32_t DriverVersion;
+	uint32_t Reserved;
+	uint64_t STypeSetHash; //Doesn't depend on the order of the structures in the chain
+
+	bool operator==(const DeviceChainCacheKey& rhs) const;
+	bool operator!=(const DeviceChainCacheKey& rhs) const;
+};
+
+//deviceUUID is VkPhysicalDeviceIDProperties::deviceUUID (VK_UUID_SIZE bytes), driverVersion is VkPhysicalDeviceProperties::driverVersion
+//The sType set is taken from the chain that is going to be queried, the contents of its structures don't matter
+DeviceChainCacheKey MakeDeviceChainCacheKey(const uint8_t* deviceUUID, uint32_t driverVersion, const void* chainHead);
+
+constexpr uint32_t DeviceChainCacheMagic   = 0x44534756; //"VGSD"
+constexpr uint32_t DeviceChainCacheVersion = 1;
+
+//Cache data layout: DeviceChainCacheHeader, EntryCount entries, the chains serialized with SerializeStructures() at the entry offsets
+struct DeviceChainCacheHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint64_t EntryCount;
+};
+
+struct DeviceChainCacheEntry
+{
+	DeviceChainCacheKey Key;
+	uint64_t			Offset;
+	uint64_t			Size;
+};
+
+//Cache of the filled physical device chains (e.g. VkPhysicalDeviceFeatures2 and VkPhysicalDeviceProperties2 with everything chained to them), meant to be kept in a file
+//With a warm cache the chains are neither queried nor copied: they are loaded right in the memory-mapped cache data on the first lookup
+//Lookups go through all entries, which is fine for a few devices with a few chains each. Not thread-safe
+class DeviceChainCache
+{
+public:
+	DeviceChainCache();
+	~DeviceChainCache();
+
+	//The found chains point into the cache, so it can't be copied
+	DeviceChainCache(const DeviceChainCache& rhs)			 = delete;
+	DeviceChainCache& operator=(const DeviceChainCache& rhs) = delete;
+
+	DeviceChainCache(DeviceChainCache&& rhs)			= default;
+	DeviceChainCache& operator=(DeviceChainCache&& rhs) = default;
+
+	//Uses the data saved with Save(), e.g. a file mapped copy-on-write. The data has to be aligned to ChainLinkDataAlignment and outlive the cache
+	//The cache has to be empty. Returns false if the data is not a valid cache, e.g. made on a platform with a different pointer size
+	bool Open(void* cacheData, size_t cacheSize);
+
+	//Returns the head of the cached chain, or null if there's none. The returned chain is only valid while the cache and its data are
+	const void* FindChain(const DeviceChainCacheKey& key);
+
+	template<typename HeadType>
+	const HeadType* FindChainAs(const DeviceChainCacheKey& key);
+
+	//Stores the filled chain, replacing the one with the same key. Same as SerializeStructures(), only pNext of all pointer members is followed
+	void StoreChain(const DeviceChainCacheKey& key, const void* chainHead);
+
+	//Writes all the chains, both opened and stored, into the data for a new cache file. The chains found broken by the lookups are dropped
+	std::vector<std::byte> Save() const;
+
+private:
+	struct CacheEntry
+	{
+		DeviceChainCacheKey	  Key;
+		std::byte*			  SerializedData;
+		size_t				  SerializedSize;
+		const void*			  LoadedHead; //Null until the first lookup, the serialized data is relocated in place by it
+		bool				  Broken;	  //Set by the first lookup if the serialized data is not valid, the entry is never loaded again and not saved
+		std::vector<uint64_t> StoredData; //Aligned storage for the stored chains, SerializedData points into it
+	};
+
+	size_t FindEntry(const DeviceChainCacheKey& key) const;
+
+private:
+	static constexpr size_t NoEntry = (size_t)(-1);
+
+	std::vector<CacheEntry> CacheEntries;
+};
+
+inline bool DeviceChainCacheKey::operator==(const DeviceChainCacheKey& rhs) const
+{
+	return memcmp(DeviceUUID, rhs.DeviceUUID, VK_UUID_SIZE) == 0 && DriverVersion == rhs.DriverVersion && STypeSetHash == rhs.STypeSetHash;
+}
+
+inline bool DeviceChainCacheKey::operator!=(const DeviceChainCacheKey& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline DeviceChainCacheKey MakeDeviceChainCacheKey(const uint8_t* deviceUUID, uint32_t driverVersion, const void* chainHead)
+{
+	DeviceChainCacheKey key;
+	memcpy(key.DeviceUUID, deviceUUID, VK_UUID_SIZE);
+
+	key.DriverVersion = driverVersion;
+	key.Reserved	  = 0;
+
+	//Same as HashChain(), the sum doesn't depend on the link order. Links with unknown sType are not stored, so they don't count either
+	uint64_t linksHash = 0;
+	for(const void* link = GetChainLinkPNext(chainHead); link != nullptr; link = GetChainLinkPNext(link))
+	{
+		if(GetSTypeStructureSize(GetChainLinkSType(link)) != 0)
+		{
+			linksHash += MixHash((uint64_t)GetChainLinkSType(link));
+		}
+	}
+
+	key.STypeSetHash = MixHash(MixHash((uint64_t)GetChainLinkSType(chainHead)) ^ MixHash(linksHash));
+	return key;
+}
+
+inline DeviceChainCache::DeviceChainCache()
+{
+}
+
+inline DeviceChainCache::~DeviceChainCache()
+{
+}
+
+inline bool DeviceChainCache::Open(void* cacheData, size_t cacheSize)
+{
+	assert(CacheEntries.empty());
+	assert(((uintptr_t)cacheData & (ChainLinkDataAlignment - 1)) == 0);
+
+	std::byte* cacheBytes = (std::byte*)cacheData;
+	if(cacheBytes == nullptr || cacheSize < sizeof(DeviceChainCacheHeader))
+	{
+		return false;
+	}
+
+	DeviceChainCacheHeader header;
+	memcpy(&header, cacheBytes, sizeof(DeviceChainCacheHeader));
+
+	if(header.Magic != DeviceChainCacheMagic || header.Version != DeviceChainCacheVersion || header.EntryCount > (cacheSize - sizeof(DeviceChainCacheHeader)) / sizeof(DeviceChainCacheEntry))
+	{
+		return false;
+	}
+
+	//The chains themselves are only checked when loaded
+	std::vector<CacheEntry> cacheEntries((size_t)header.EntryCount);
+	for(size_t i = 0; i < cacheEntries.size(); i++)
+	{
+		DeviceChainCacheEntry entry;
+		memcpy(&entry, cacheBytes + sizeof(DeviceChainCacheHeader) + i * sizeof(DeviceChainCacheEntry), sizeof(DeviceChainCacheEntry));
+
+		if(entry.Offset > cacheSize || entry.Size > cacheSize - entry.Offset || entry.Offset % ChainLinkDataAlignment != 0)
+		{
+			return false;
+		}
+
+		cacheEntries[i].Key			   = entry.Key;
+		cacheEntries[i].SerializedData = cacheBytes + entry.Offset;
+		cacheEntries[i].SerializedSize = (size_t)entry.Size;
+		cacheEntries[i].LoadedHead	   = nullptr;
+		cacheEntries[i].Broken		   = false;
+	}
+
+	CacheEntries = std::move(cacheEntries);
+	return true;
+}
+
+inline const void* DeviceChainCache::FindChain(const DeviceChainCacheKey& key)
+{
+	size_t entryIndex = FindEntry(key);
+	if(entryIndex == NoEntry)
+	{
+		return nullptr;
+	}
+
+	//The data is checked once. Broken data is left untouched and stays not found
+	CacheEntry& entry = CacheEntries[entryIndex];
+	if(entry.LoadedHead == nullptr && !entry.Broken)
+	{
+		entry.LoadedHead = LoadSerializedStructures(entry.SerializedData, entry.SerializedSize);
+		entry.Broken	 = (entry.LoadedHead == nullptr);
+	}
+
+	return entry.LoadedHead;
+}
+
+template<typename HeadType>
+inline const HeadType* DeviceChainCache::FindChainAs(const DeviceChainCacheKey& key)
+{
+	const void* chainHead = FindChain(key);
+	if(chainHead == nullptr || GetChainLinkSType(chainHead) != ValidStructureType<HeadType>)
+	{
+		return nullptr;
+	}
+
+	return reinterpret_cast<const HeadType*>(chainHead);
+}
+
+inline void DeviceChainCache::StoreChain(const DeviceChainCacheKey& key, const void* chainHead)
+{
+	assert(key.STypeSetHash == MakeDeviceChainCacheKey(key.DeviceUUID, key.DriverVersion, chainHead).STypeSetHash);
+
+	size_t entryIndex = FindEntry(key);
+	if(entryIndex == NoEntry)
+	{
+		CacheEntries.emplace_back();
+		entryIndex = CacheEntries.size() - 1;
+	}
+
+	std::vector<std::byte> serializedChain = SerializeStructures(chainHead, false);
+
+	CacheEntry& entry = CacheEntries[entryIndex];
+	entry.StoredData.resize((serializedChain.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	memcpy(entry.StoredData.data(), serializedChain.data(), serializedChain.size());
+
+	entry.Key			 = key;
+	entry.SerializedData = (std::byte*)entry.StoredData.data();
+	entry.SerializedSize = serializedChain.size();
+	entry.LoadedHead	 = nullptr;
+	entry.Broken		 = false;
+}
+
+inline std::vector<std::byte> DeviceChainCache::Save() const
+{
+	//The loaded chains are relocated in place, so they are serialized again. The broken ones are dropped
+	std::vector<size_t>					savedEntryIndices;
+	std::vector<std::vector<std::byte>> reserializedChains(CacheEntries.size());
+	for(size_t i = 0; i < CacheEntries.size(); i++)
+	{
+		if(CacheEntries[i].Broken)
+		{
+			continue;
+		}
+
+		if(CacheEntries[i].LoadedHead != nullptr)
+		{
+			reserializedChains[i] = SerializeStructures(CacheEntries[i].LoadedHead, false);
+		}
+
+		savedEntryIndices.push_back(i);
+	}
+
+	DeviceChainCacheHeader header;
+	header.Magic	  = DeviceChainCacheMagic;
+	header.Version	  = DeviceChainCacheVersion;
+	header.EntryCount = savedEntryIndices.size();
+
+	size_t cacheSize = sizeof(DeviceChainCacheHeader) + savedEntryIndices.size() * sizeof(DeviceChainCacheEntry);
+
+	std::vector<DeviceChainCacheEntry> entries(savedEntryIndices.size());
+	for(size_t i = 0; i < savedEntryIndices.size(); i++)
+	{
+		const CacheEntry& cacheEntry = CacheEntries[savedEntryIndices[i]];
+
+		size_t chainSize = (cacheEntry.LoadedHead != nullptr) ? reserializedChains[savedEntryIndices[i]].size() : cacheEntry.SerializedSize;
+
+		entries[i].Key	  = cacheEntry.Key;
+		entries[i].Offset = (cacheSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+		entries[i].Size	  = chainSize;
+
+		cacheSize = (size_t)entries[i].Offset + chainSize;
+	}
+
+	std::vector<std::byte> cacheData(cacheSize);
+	memcpy(cacheData.data(), &header, sizeof(DeviceChainCacheHeader));
+
+	for(size_t i = 0; i < savedEntryIndices.size(); i++)
+	{
+		const CacheEntry& cacheEntry = CacheEntries[savedEntryIndices[i]];
+
+		memcpy(cacheData.data() + sizeof(DeviceChainCacheHeader) + i * sizeof(DeviceChainCacheEntry), &entries[i], sizeof(DeviceChainCacheEntry));
+
+		const std::byte* chainData = (cacheEntry.LoadedHead != nullptr) ? reserializedChains[savedEntryIndices[i]].data() : cacheEntry.SerializedData;
+		memcpy(cacheData.data() + entries[i].Offset, chainData, (size_t)entries[i].Size);
+	}
+
+	return cacheData;
+}
+
+inline size_t DeviceChainCache::FindEntry(const DeviceChainCacheKey& key) const
+{
+	for(size_t i = 0; i < CacheEntries.size(); i++)
+	{
+		if(CacheEntries[i].Key == key)
+		{
+			return i;
+		}
+	}
+
+	return NoEntry;
+}
+
+//=================================================================================================================================================================
+
+constexpr uint32_t NoFeatureStructure = (uint32_t)(-1);
+
+//Index of the structure in FeatureStructureInfos, or NoFeatureStructure if it doesn't extend VkPhysicalDeviceFeatures2
+constexpr uint32_t GetFeatureStructureOrdinal(VulkanStructureType sType)
+{
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(FeatureStructureInfos[i].SType == sType)
+		{
+			return i;
+		}
+	}
+
+	return NoFeatureStructure;
+}
+
+class FeatureBitset;
+
+//VkPhysicalDeviceFeatures2 chain of every feature structure supported by the API version and the enabled extensions, made with BuildFullFeatureChain()
+//All the structures are zeroed and linked in a single exact-size allocation, in order of FeatureStructureInfos
+//Lookup of a structure is a single array read, its index is known at compile time
+class FullFeatureChain
+{
+public:
+	FullFeatureChain();
+	~FullFeatureChain();
+
+	//A copy is a single blob copy plus relinking
+	FullFeatureChain(const FullFeatureChain& rhs);
+	FullFeatureChain& operator=(const FullFeatureChain& rhs);
+
+	FullFeatureChain(FullFeatureChain&& rhs)			= default;
+	FullFeatureChain& operator=(FullFeatureChain&& rhs) = default;
+
+	template<typename HeadType>
+	HeadType& GetChainHeadAs();
+
+	//The structure has to be in the chain, check it with Contains<Struct>()
+	template<typename Struct>
+	Struct& GetChainLinkDataAs();
+
+	template<typename Struct>
+	bool Contains() const;
+
+	//Number of the structures in the chain, including the head
+	uint32_t GetLinkCount() const;
+
+private:
+	friend FullFeatureChain BuildFullFeatureChain(uint32_t apiVersion, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames);
+	friend FullFeatureChain BuildFeatureChain(const FeatureBitset& features);
+
+	//Lays out the included structures (indexed same as FeatureStructureInfos) in a single zeroed allocation and links them
+	void AllocateChain(const bool* includedStructures);
+	void LinkChain();
+
+private:
+	static constexpr uint32_t NoLink = (uint32_t)(-1);
+
+	std::vector<std::byte> ChainData;
+	uint32_t			   LinkOffsets[FeatureStructureCount]; //Offset of each structure from FeatureStructureInfos in ChainData, or NoLink
+};
+
+//Makes the chain of all feature structures of apiVersion (e.g. VK_API_VERSION_1_2) and the enabled device extensions, to pass to vkGetPhysicalDeviceFeatures2
+//The structures that are not a part of this header (e.g. disabled with the extension defines) are never included
+FullFeatureChain BuildFullFeatureChain(uint32_t apiVersion, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames);
+
+inline FullFeatureChain::FullFeatureChain()
+{
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		LinkOffsets[i] = NoLink;
+	}
+}
+
+inline FullFeatureChain::~FullFeatureChain()
+{
+}
+
+inline FullFeatureChain::FullFeatureChain(const FullFeatureChain& rhs)
+{
+	*this = rhs;
+}
+
+inline FullFeatureChain& FullFeatureChain::operator=(const FullFeatureChain& rhs)
+{
+	ChainData = rhs.ChainData;
+	memcpy(LinkOffsets, rhs.LinkOffsets, sizeof(LinkOffsets));
+
+	LinkChain();
+	return *this;
+}
+
+template<typename HeadType>
+inline HeadType& FullFeatureChain::GetChainHeadAs()
+{
+	static_assert(ValidStructureType<HeadType> == FeatureStructureInfos[0].SType, "The head of the full feature chain is VkPhysicalDeviceFeatures2");
+	assert(!ChainData.empty());
+
+	HeadType* head = reinterpret_cast<HeadType*>(ChainData.data());
+	return *head;
+}
+
+template<typename Struct>
+inline Struct& FullFeatureChain::GetChainLinkDataAs()
+{
+	constexpr uint32_t featureOrdinal = GetFeatureStructureOrdinal(ValidStructureType<Struct>);
+	assert(Contains<Struct>());
+
+	Struct* link = reinterpret_cast<Struct*>(ChainData.data() + LinkOffsets[featureOrdinal]);
+	return *link;
+}
+
+template<typename Struct>
+inline bool FullFeatureChain::Contains() const
+{
+	constexpr uint32_t featureOrdinal = GetFeatureStructureOrdinal(ValidStructureType<Struct>);
+	return featureOrdinal != NoFeatureStructure && LinkOffsets[featureOrdinal] != NoLink;
+}
+
+inline uint32_t FullFeatureChain::GetLinkCount() const
+{
+	uint32_t linkCount = 0;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(LinkOffsets[i] != NoLink)
+		{
+			linkCount++;
+		}
+	}
+
+	return linkCount;
+}
+
+inline void FullFeatureChain::AllocateChain(const bool* includedStructures)
+{
+	//The head is always included
+	size_t chainSize = 0;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		LinkOffsets[i] = NoLink;
+		if(i == 0 || includedStructures[i])
+		{
+			chainSize = (chainSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+			LinkOffsets[i] = (uint32_t)chainSize;
+			chainSize += FeatureStructureInfos[i].Size;
+		}
+	}
+
+	ChainData.assign(chainSize, std::byte(0));
+	LinkChain();
+}
+
+inline void FullFeatureChain::LinkChain()
+{
+	void* prevLink = nullptr;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(LinkOffsets[i] == NoLink)
+		{
+			continue;
+		}
+
+		std::byte* link = ChainData.data() + LinkOffsets[i];
+		memcpy(link + offsetof(VkBaseOutStructure, sType), &FeatureStructureInfos[i].SType, sizeof(VulkanStructureType));
+
+		if(prevLink != nullptr)
+		{
+			memcpy((std::byte*)prevLink + offsetof(VkBaseOutStructure, pNext), &link, sizeof(void*));
+		}
+
+		prevLink = link;
+	}
+
+	if(prevLink != nullptr)
+	{
+		void* chainEnd = nullptr;
+		memcpy((std::byte*)prevLink + offsetof(VkBaseOutStructure, pNext), &chainEnd, sizeof(void*));
+	}
+}
+
+inline bool ExtensionNameLess(const char* lhs, const char* rhs)
+{
+	return strcmp(lhs, rhs) < 0;
+}
+
+inline FullFeatureChain BuildFullFeatureChain(uint32_t apiVersion, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames)
+{
+	std::vector<const char*> sortedExtensionNames(enabledExtensionNames, enabledExtensionNames + enabledExtensionCount);
+	std::sort(sortedExtensionNames.begin(), sortedExtensionNames.end(), ExtensionNameLess);
+
+	bool includedStructures[FeatureStructureCount];
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		const FeatureStructureInfo& featureInfo = FeatureStructureInfos[i];
+
+		bool isSupported = (featureInfo.CoreVersion != 0 && apiVersion >= featureInfo.CoreVersion);
+		for(uint32_t j = 0; j < FeatureStructureMaxExtensions && !isSupported && featureInfo.ExtensionNames[j] != nullptr; j++)
+		{
+			isSupported = std::binary_search(sortedExtensionNames.begin(), sortedExtensionNames.end(), featureInfo.ExtensionNames[j], ExtensionNameLess);
+		}
+
+		includedStructures[i] = isSupported;
+	}
+
+	FullFeatureChain fullFeatureChain;
+	fullFeatureChain.AllocateChain(includedStructures);
+
+	return fullFeatureChain;
+}
+
+//=================================================================================================================================================================
+
+//Feature bits of each structure from FeatureStructureInfos start at FirstBits[ordinal] and go in order of FeatureMemberOffsets, FirstBits[FeatureStructureCount] is the total count
+struct FeatureStructureBitRanges
+{
+	uint32_t FirstBits[FeatureStructureCount + 1];
+};
+
+constexpr FeatureStructureBitRanges MakeFeatureStructureBitRanges()
+{
+	FeatureStructureBitRanges bitRanges = {};
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		bitRanges.FirstBits[i + 1] = bitRanges.FirstBits[i] + FeatureStructureInfos[i].FeatureMemberCount;
+	}
+
+	return bitRanges;
+}
+
+inline constexpr FeatureStructureBitRanges FeatureBitRanges = MakeFeatureStructureBitRanges();
+
+constexpr uint32_t FeatureBitCount = FeatureBitRanges.FirstBits[FeatureStructureCount];
+constexpr uint32_t NoFeatureBit	   = (uint32_t)(-1);
+
+//Members of VkPhysicalDeviceVulkanNNFeatures are the same features as the members of the structures promoted to that version, so they share the bits:
+//e.g. the bit of VkPhysicalDeviceVulkan11Features::multiview is the bit of VkPhysicalDeviceMultiviewFeatures::multiview
+struct FeatureStructureAliases
+{
+	uint32_t CanonicalBits[FeatureBitCount + 1];		 //The bit each feature bit shares, the bit itself if it's not aliased. One more, so the array is never empty
+	uint32_t CoreFeatureOrdinals[FeatureStructureCount]; //Ordinal of VkPhysicalDeviceVulkanNNFeatures that has all the features of the structure, or NoFeatureStructure
+};
+
+constexpr FeatureStructureAliases MakeFeatureStructureAliases()
+{
+	FeatureStructureAliases aliases = {};
+	for(uint32_t i = 0; i < FeatureBitCount; i++)
+	{
+		aliases.CanonicalBits[i] = i;
+	}
+
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		const FeatureStructureInfo& featureInfo = FeatureStructureInfos[i];
+
+		uint32_t coreFeatureOrdinal = (featureInfo.CoreFeaturesSType != featureInfo.SType) ? GetFeatureStructureOrdinal(featureInfo.CoreFeaturesSType) : NoFeatureStructure;
+		aliases.CoreFeatureOrdinals[i] = coreFeatureOrdinal;
+
+		if(coreFeatureOrdinal == NoFeatureStructure)
+		{
+			continue;
+		}
+
+		for(uint32_t j = 0; j < featureInfo.FeatureMemberCount; j++)
+		{
+			aliases.CanonicalBits[FeatureBitRanges.FirstBits[coreFeatureOrdinal] + featureInfo.CoreFeatureMemberIndices[j]] = FeatureBitRanges.FirstBits[i] + j;
+		}
+	}
+
+	return aliases;
+}
+
+inline constexpr FeatureStructureAliases FeatureAliases = MakeFeatureStructureAliases();
+
+//The bitset is made of 256-bit blocks, so the operations over it vectorize without a scalar tail. There's always at least one block
+constexpr uint32_t FeatureBitsetWordCount = (FeatureBitCount == 0) ? 4 : ((FeatureBitCount + 255) / 256) * 4;
+
+//Feature bit of the VkBool32 member at memberOffset of the feature structure, e.g. GetFeatureBit(ValidStructureType<VkPhysicalDeviceVulkan11Features>, offsetof(VkPhysicalDeviceVulkan11Features, multiview))
+//The aliased members get the same bit. Returns NoFeatureBit if there's no such member
+constexpr uint32_t GetFeatureBit(VulkanStructureType sType, uint32_t memberOffset)
+{
+	uint32_t featureOrdinal = GetFeatureStructureOrdinal(sType);
+	if(featureOrdinal == NoFeatureStructure)
+	{
+		return NoFeatureBit;
+	}
+
+	const FeatureStructureInfo& featureInfo = FeatureStructureInfos[featureOrdinal];
+	for(uint32_t i = 0; i < featureInfo.FeatureMemberCount; i++)
+	{
+		if(featureInfo.FeatureMemberOffsets[i] == memberOffset)
+		{
+			return FeatureAliases.CanonicalBits[FeatureBitRanges.FirstBits[featureOrdinal] + i];
+		}
+	}
+
+	return NoFeatureBit;
+}
+
+//Set of the VkBool32 members of all feature structures, one bit per feature, e.g. the features a device supports or the ones an application requires
+//The aliased members share the bit, any of their bits can be passed to Test() and Set()
+//The set operations are plain loops over a fixed number of aligned 64-bit words without early exits, which compilers turn into SIMD code
+class alignas(32) FeatureBitset
+{
+public:
+	FeatureBitset();
+	~FeatureBitset();
+
+	bool Test(uint32_t featureBit) const;
+	void Set(uint32_t featureBit, bool value = true);
+
+	//Number of the set bits
+	uint32_t Count() const;
+	bool	 IsEmpty() const;
+
+	FeatureBitset Intersect(const FeatureBitset& rhs) const;
+
+	//The features of this set that are missing from rhs
+	FeatureBitset Diff(const FeatureBitset& rhs) const;
+
+	bool IsSubsetOf(const FeatureBitset& rhs) const;
+
+	bool operator==(const FeatureBitset& rhs) const;
+	bool operator!=(const FeatureBitset& rhs) const;
+
+private:
+	uint64_t Words[FeatureBitsetWordCount];
+};
+
+//Makes the bitset of the VK_TRUE members of all feature structures in the chain, e.g. the one filled by vkGetPhysicalDeviceFeatures2. Other structures are skipped
+FeatureBitset MakeFeatureBitset(const void* chainHead);
+
+//Makes the VkPhysicalDeviceFeatures2 chain of the structures that have at least one of the features, with these features set to VK_TRUE, e.g. for VkDeviceCreateInfo::pNext
+//Each feature is set in only one structure: VkPhysicalDeviceVulkanNNFeatures is never chained along with the structures promoted to its version
+FullFeatureChain BuildFeatureChain(const FeatureBitset& features);
+
+//Tests the required features against each of the profiles (e.g. stored supported features of thousands of devices), outSupported gets profileCount results
+//Returns the number of the profiles that have all the required features
+size_t EvaluateFeatureProfiles(const FeatureBitset& requiredFeatures, const FeatureBitset* profiles, size_t profileCount, bool* outSupported);
+
+inline FeatureBitset::FeatureBitset()
+{
+	memset(Words, 0, sizeof(Words));
+}
+
+inline FeatureBitset::~FeatureBitset()
+{
+}
+
+inline bool FeatureBitset::Test(uint32_t featureBit) const
+{
+	assert(featureBit < FeatureBitCount);
+
+	featureBit = FeatureAliases.CanonicalBits[featureBit];
+	return (Words[featureBit / 64] >> (featureBit % 64)) & 1;
+}
+
+inline void FeatureBitset::Set(uint32_t featureBit, bool value)
+{
+	assert(featureBit < FeatureBitCount);
+
+	featureBit = FeatureAliases.CanonicalBits[featureBit];
+
+	uint64_t featureMask = 1ull << (featureBit % 64);
+	Words[featureBit / 64] = value ? (Words[featureBit / 64] | featureMask) : (Words[featureBit / 64] & ~featureMask);
+}
+
+inline uint32_t FeatureBitset::Count() const
+{
+	uint32_t setBitCount = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		for(uint64_t word = Words[i]; word != 0; word &= word - 1)
+		{
+			setBitCount++;
+		}
+	}
+
+	return setBitCount;
+}
+
+inline bool FeatureBitset::IsEmpty() const
+{
+	uint64_t setBits = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		setBits |= Words[i];
+	}
+
+	return setBits == 0;
+}
+
+inline FeatureBitset FeatureBitset::Intersect(const FeatureBitset& rhs) const
+{
+	FeatureBitset intersection;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		intersection.Words[i] = Words[i] & rhs.Words[i];
+	}
+
+	return intersection;
+}
+
+inline FeatureBitset FeatureBitset::Diff(const FeatureBitset& rhs) const
+{
+	FeatureBitset difference;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		difference.Words[i] = Words[i] & ~rhs.Words[i];
+	}
+
+	return difference;
+}
+
+inline bool FeatureBitset::IsSubsetOf(const FeatureBitset& rhs) const
+{
+	uint64_t missingBits = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		missingBits |= Words[i] & ~rhs.Words[i];
+	}
+
+	return missingBits == 0;
+}
+
+inline bool FeatureBitset::operator==(const FeatureBitset& rhs) const
+{
+	uint64_t differentBits = 0;
+	for(uint32_t i = 0; i < FeatureBitsetWordCount; i++)
+	{
+		differentBits |= Words[i] ^ rhs.Words[i];
+	}
+
+	return differentBits == 0;
+}
+
+inline bool FeatureBitset::operator!=(const FeatureBitset& rhs) const
+{
+	return !(*this == rhs);
+}
+
+inline FeatureBitset MakeFeatureBitset(const void* chainHead)
+{
+	FeatureBitset features;
+	for(const void* link = chainHead; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		uint32_t featureOrdinal = GetFeatureStructureOrdinal(GetChainLinkSType(link));
+		if(featureOrdinal == NoFeatureStructure)
+		{
+			continue;
+		}
+
+		const FeatureStructureInfo& featureInfo = FeatureStructureInfos[featureOrdinal];
+		for(uint32_t i = 0; i < featureInfo.FeatureMemberCount; i++)
+		{
+			VkBool32 featureValue = VK_FALSE;
+			memcpy(&featureValue, (const std::byte*)link + featureInfo.FeatureMemberOffsets[i], sizeof(VkBool32));
+
+			if(featureValue != VK_FALSE)
+			{
+				features.Set(FeatureBitRanges.FirstBits[featureOrdinal] + i);
+			}
+		}
+	}
+
+	return features;
+}
+
+inline FullFeatureChain BuildFeatureChain(const FeatureBitset& features)
+{
+	//The aliased features only include the promoted structures, so the chain works on the devices of the older versions too
+	bool includedStructures[FeatureStructureCount];
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		includedStructures[i] = false;
+		for(uint32_t featureBit = FeatureBitRanges.FirstBits[i]; featureBit < FeatureBitRanges.FirstBits[i + 1] && !includedStructures[i]; featureBit++)
+		{
+			includedStructures[i] = FeatureAliases.CanonicalBits[featureBit] == featureBit && features.Test(featureBit);
+		}
+	}
+
+	//VkPhysicalDeviceVulkanNNFeatures can't be chained along with the structures promoted to its version (VUID-VkDeviceCreateInfo-pNext-02829 and 02830),
+	//so if it's included for its own features, it takes their features instead
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		uint32_t coreFeatureOrdinal = FeatureAliases.CoreFeatureOrdinals[i];
+		if(coreFeatureOrdinal != NoFeatureStructure && includedStructures[coreFeatureOrdinal])
+		{
+			includedStructures[i] = false;
+		}
+	}
+
+	FullFeatureChain featureChain;
+	featureChain.AllocateChain(includedStructures);
+
+	VkBool32 enabledValue = VK_TRUE;
+	for(uint32_t i = 0; i < FeatureStructureCount; i++)
+	{
+		if(featureChain.LinkOffsets[i] == FullFeatureChain::NoLink)
+		{
+			continue;
+		}
+
+		std::byte* link = featureChain.ChainData.data() + featureChain.LinkOffsets[i];
+		for(uint32_t j = 0; j < FeatureStructureInfos[i].FeatureMemberCount; j++)
+		{
+			if(features.Test(FeatureBitRanges.FirstBits[i] + j))
+			{
+				memcpy(link + FeatureStructureInfos[i].FeatureMemberOffsets[j], &enabledValue, sizeof(VkBool32));
+			}
+		}
+	}
+
+	return featureChain;
+}
+
+inline size_t EvaluateFeatureProfiles(const FeatureBitset& requiredFeatures, const FeatureBitset* profiles, size_t profileCount, bool* outSupported)
+{
+	size_t supportedCount = 0;
+	for(size_t i = 0; i < profileCount; i++)
+	{
+		outSupported[i] = requiredFeatures.IsSubsetOf(profiles[i]);
+		supportedCount += outSupported[i] ? 1 : 0;
+	}
+
+	return supportedCount;
+}
+
+//=================================================================================================================================================================
+
+//Member of a structure in a query chain, see QueryChainArray::Diff()
+struct QueryChainMember
+{
+	uint32_t			LinkIndex; //0 for the head
+	VulkanStructureType SType;
+	uint32_t			Offset;
+	uint32_t			Size;
+};
+
+//N chains of the same shape in a single allocation, e.g. VkPhysicalDeviceProperties2 chains for vkGetPhysicalDeviceProperties2 of every physical device
+//The returnedonly structures (see IsSTypeReturnedOnly) are zeroed, the other ones are copied from the template chain
+//A copy is a single blob copy plus re-arming
+template<typename HeadType>
+class QueryChainArray
+{
+public:
+	QueryChainArray();
+
+	//Makes chainCount chains of the same structures as the chain of templateHead, links with unknown sType are skipped
+	QueryChainArray(const HeadType& templateHead, size_t chainCount);
+	~QueryChainArray();
+
+	QueryChainArray(const QueryChainArray& rhs);
+	QueryChainArray& operator=(const QueryChainArray& rhs);
+
+	QueryChainArray(QueryChainArray&& rhs)			  = default;
+	QueryChainArray& operator=(QueryChainArray&& rhs) = default;
+
+	size_t GetChainCount() const;
+
+	HeadType& GetChainHead(size_t chainIndex);
+
+	//Returns the first structure of the type Struct in the chain
+	template<typename Struct>
+	Struct& GetChainLinkDataAs(size_t chainIndex);
+
+	//Restores sType and pNext of all structures of all chains before the next query, the rest of the data is kept
+	void Rearm();
+
+	//Members that are not the same in all chains, compared by the ranges of the GetSTypeMemberRanges table
+	//Structures with unknown layout are compared as a whole, past pNext
+	std::vector<QueryChainMember> Diff() const;
+
+	//Members that differ between the two chains
+	std::vector<QueryChainMember> Diff(size_t lhsChainIndex, size_t rhsChainIndex) const;
+
+private:
+	std::byte*		 GetChainData(size_t chainIndex);
+	const std::byte* GetChainData(size_t chainIndex) const;
+
+	bool CompareMember(const QueryChainMember& member, size_t lhsChainIndex, size_t rhsChainIndex) const;
+
+private:
+	std::vector<std::byte>			 ChainData;
+	std::vector<VulkanStructureType> LinkSTypes;
+	std::vector<size_t>				 LinkOffsets; //Offsets in each chain
+	std::vector<QueryChainMember>	 ChainMembers;
+
+	size_t ChainStride;
+	size_t ChainCount;
+};
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::QueryChainArray(): ChainStride(0), ChainCount(0)
+{
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::QueryChainArray(const HeadType& templateHead, size_t chainCount): ChainStride(0), ChainCount(chainCount)
+{
+	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the query chain array must be trivially destructible");
+
+	std::vector<const void*> templateLinks;
+
+	size_t chainSize = 0;
+	for(const void* link = &templateHead; link != nullptr; link = GetChainLinkPNext(link))
+	{
+		VulkanStructureType linkSType = (link == &templateHead) ? ValidStructureType<HeadType> : GetChainLinkSType(link);
+		size_t				linkSize  = (link == &templateHead) ? sizeof(HeadType) : GetSTypeStructureSize(linkSType);
+		if(linkSize == 0)
+		{
+			continue;
+		}
+
+		chainSize = (chainSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+
+		LinkSTypes.push_back(linkSType);
+		LinkOffsets.push_back(chainSize);
+		templateLinks.push_back(link);
+
+		chainSize += linkSize;
+	}
+
+	ChainStride = (chainSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+	ChainData.resize(ChainStride * ChainCount);
+
+	for(size_t i = 0; i < LinkSTypes.size(); i++)
+	{
+		size_t linkSize = (i == 0) ? sizeof(HeadType) : GetSTypeStructureSize(LinkSTypes[i]);
+
+		size_t						rangeCount   = 0;
+		const StructureMemberRange* memberRanges = GetSTypeMemberRanges(LinkSTypes[i], &rangeCount);
+		if(memberRanges != nullptr && GetSTypeStructureSize(LinkSTypes[i]) == linkSize)
+		{
+			for(size_t j = 0; j < rangeCount; j++)
+			{
+				if(memberRanges[j].Offset != offsetof(VkBaseOutStructure, sType))
+				{
+					ChainMembers.push_back(QueryChainMember{(uint32_t)i, LinkSTypes[i], memberRanges[j].Offset, memberRanges[j].Size});
+				}
+			}
+		}
+		else if(linkSize > sizeof(VkBaseOutStructure))
+		{
+			ChainMembers.push_back(QueryChainMember{(uint32_t)i, LinkSTypes[i], (uint32_t)sizeof(VkBaseOutStructure), (uint32_t)(linkSize - sizeof(VkBaseOutStructure))});
+		}
+
+		if(ChainCount != 0 && !IsSTypeReturnedOnly(LinkSTypes[i]))
+		{
+			memcpy(GetChainData(0) + LinkOffsets[i], templateLinks[i], linkSize);
+		}
+	}
+
+	for(size_t chainIndex = 1; chainIndex < ChainCount; chainIndex++)
+	{
+		memcpy(GetChainData(chainIndex), GetChainData(0), ChainStride);
+	}
+
+	Rearm();
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::~QueryChainArray()
+{
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>::QueryChainArray(const QueryChainArray& rhs)
+{
+	*this = rhs;
+}
+
+template<typename HeadType>
+inline QueryChainArray<HeadType>& QueryChainArray<HeadType>::operator=(const QueryChainArray& rhs)
+{
+	ChainData	 = rhs.ChainData;
+	LinkSTypes	 = rhs.LinkSTypes;
+	LinkOffsets	 = rhs.LinkOffsets;
+	ChainMembers = rhs.ChainMembers;
+	ChainStride	 = rhs.ChainStride;
+	ChainCount	 = rhs.ChainCount;
+
+	Rearm();
+	return *this;
+}
+
+template<typename HeadType>
+inline size_t QueryChainArray<HeadType>::GetChainCount() const
+{
+	return ChainCount;
+}
+
+template<typename HeadType>
+inline HeadType& QueryChainArray<HeadType>::GetChainHead(size_t chainIndex)
 {
-protected:
-	GenericStructBase();
-	GenericStructBase(std::byte* data, size_t dataSize, ptrdiff_t pNextOffset, ptrdiff_t sTypeOffset);
-	~GenericStructBase();
+	assert(chainIndex < ChainCount);
 
-public:
-	template<typename Struct>
-	Struct& GetDataAs();
+	HeadType* head = reinterpret_cast<HeadType*>(GetChainData(chainIndex));
+	return *head;
+}
 
-	std::byte* GetStructureData() const;
-	size_t	 GetStructureSize() const;
+template<typename HeadType>
+template<typename Struct>
+inline Struct& QueryChainArray<HeadType>::GetChainLinkDataAs(size_t chainIndex)
+{
+	assert(chainIndex < ChainCount);
 
-	ptrdiff_t GetPNextOffset() const;
-	void*	 GetPNext()	   const;
+	size_t linkIndex = 0;
+	while(linkIndex < LinkSTypes.size() && LinkSTypes[linkIndex] != ValidStructureType<Struct>)
+	{
+		linkIndex++;
+	}
 
-	ptrdiff_t		   GetSTypeOffset() const;
-	VulkanStructureType GetSType()	   const;
+	assert(linkIndex < LinkSTypes.size());
 
-protected:
-	std::byte* StructureData;
-	size_t	 StructureSize;
+	Struct* structPtr = reinterpret_cast<Struct*>(GetChainData(chainIndex) + LinkOffsets[linkIndex]);
+	return *structPtr;
+}
 
-	ptrdiff_t PNextPointerOffset;
-	ptrdiff_t STypeOffset;
-};
+template<typename HeadType>
+inline void QueryChainArray<HeadType>::Rearm()
+{
+	for(size_t chainIndex = 0; chainIndex < ChainCount; chainIndex++)
+	{
+		std::byte* chainData = GetChainData(chainIndex);
+		for(size_t i = 0; i < LinkSTypes.size(); i++)
+		{
+			void* pNext = (i + 1 < LinkSTypes.size()) ? chainData + LinkOffsets[i + 1] : nullptr;
+
+			memcpy(chainData + LinkOffsets[i] + offsetof(VkBaseOutStructure, sType), &LinkSTypes[i], sizeof(VulkanStructureType));
+			memcpy(chainData + LinkOffsets[i] + offsetof(VkBaseOutStructure, pNext), &pNext, sizeof(void*));
+		}
+	}
+}
 
-inline GenericStructBase::GenericStructBase(): StructureData(nullptr), StructureSize(0), PNextPointerOffset(0), STypeOffset(0)
+template<typename HeadType>
+inline std::vector<QueryChainMember> QueryChainArray<HeadType>::Diff() const
 {
+	std::vector<QueryChainMember> differentMembers;
+	for(const QueryChainMember& member: ChainMembers)
+	{
+		for(size_t chainIndex = 1; chainIndex < ChainCount; chainIndex++)
+		{
+			if(!CompareMember(member, 0, chainIndex))
+			{
+				differentMembers.push_back(member);
+				break;
+			}
+		}
+	}
+
+	return differentMembers;
 }
 
-inline GenericStructBase::GenericStructBase(std::byte* data, size_t dataSize, ptrdiff_t pNextOffset, ptrdiff_t sTypeOffset): StructureData(data), StructureSize(dataSize), PNextPointerOffset(pNextOffset), STypeOffset(sTypeOffset)
+template<typename HeadType>
+inline std::vector<QueryChainMember> QueryChainArray<HeadType>::Diff(size_t lhsChainIndex, size_t rhsChainIndex) const
 {
+	assert(lhsChainIndex < ChainCount);
+	assert(rhsChainIndex < ChainCount);
+
+	std::vector<QueryChainMember> differentMembers;
+	for(const QueryChainMember& member: ChainMembers)
+	{
+		if(!CompareMember(member, lhsChainIndex, rhsChainIndex))
+		{
+			differentMembers.push_back(member);
+		}
+	}
+
+	return differentMembers;
 }
 
-inline GenericStructBase::~GenericStructBase()
+template<typename HeadType>
+inline std::byte* QueryChainArray<HeadType>::GetChainData(size_t chainIndex)
 {
+	return ChainData.data() + chainIndex * ChainStride;
 }
 
-template<typename Struct>
-inline Struct& GenericStructBase::GetDataAs()
+template<typename HeadType>
+inline const std::byte* QueryChainArray<HeadType>::GetChainData(size_t chainIndex) const
 {
-	assert(GetStructureSize() == sizeof(Struct));
-	assert(StructureData != nullptr);
+	return ChainData.data() + chainIndex * ChainStride;
+}
 
-	Struct* structureData = reinterpret_cast<Struct*>(StructureData);
-	return *structureData;
+template<typename HeadType>
+inline bool QueryChainArray<HeadType>::CompareMember(const QueryChainMember& member, size_t lhsChainIndex, size_t rhsChainIndex) const
+{
+	size_t memberOffset = LinkOffsets[member.LinkIndex] + member.Offset;
+	return memcmp(GetChainData(lhsChainIndex) + memberOffset, GetChainData(rhsChainIndex) + memberOffset, member.Size) == 0;
 }
 
-inline std::byte* GenericStructBase::GetStructureData() const
+//=================================================================================================================================================================
+
+//Finds the feature member by the hash of "structureName.memberName" with a single probe of the perfect hash table. Returns null if there's no such member
+inline const FeatureMemberNameEntry* FindFeatureMemberName(uint64_t nameHash, const char* structureName, size_t structureNameLength, const char* memberName, size_t memberNameLength)
 {
-	assert(GetStructureSize() != 0);
+	uint32_t nameDisplacement = FeatureMemberNameDisplacements[(nameHash >> 32) % FeatureMemberNameBucketCount];
 
-	return StructureData;
+	const FeatureMemberNameEntry& nameEntry = FeatureMemberNameSlots[MixHash(nameHash ^ nameDisplacement) % FeatureMemberNameSlotCount];
+	if(nameEntry.Name == nullptr)
+	{
+		return nullptr;
+	}
+
+	//The slot can be taken by another name, which is only found out by comparing
+	const char* entryName = nameEntry.Name;
+	if(strncmp(entryName, structureName, structureNameLength) != 0 || entryName[structureNameLength] != '.')
+	{
+		return nullptr;
+	}
+
+	entryName += structureNameLength + 1;
+	if(strncmp(entryName, memberName, memberNameLength) != 0 || entryName[memberNameLength] != '\0')
+	{
+		return nullptr;
+	}
+
+	return &nameEntry;
 }
 
-inline size_t GenericStructBase::GetStructureSize() const
+//Feature bit of the member by the structure and member names as written in the profiles, e.g. ("VkPhysicalDeviceFeatures", "geometryShader")
+//Returns NoFeatureBit if there's no such member
+inline uint32_t FindFeatureBit(const char* structureName, const char* memberName)
 {
-	return StructureSize;
+	size_t structureNameLength = strlen(structureName);
+	size_t memberNameLength	   = strlen(memberName);
+
+	uint64_t nameHash = HashName(NameHashBasis, structureName, structureNameLength);
+	nameHash		  = HashName(nameHash, ".", 1);
+	nameHash		  = HashName(nameHash, memberName, memberNameLength);
+
+	const FeatureMemberNameEntry* nameEntry = FindFeatureMemberName(nameHash, structureName, structureNameLength, memberName, memberNameLength);
+	if(nameEntry == nullptr)
+	{
+		return NoFeatureBit;
+	}
+
+	return FeatureAliases.CanonicalBits[FeatureBitRanges.FirstBits[GetFeatureStructureOrdinal(nameEntry->SType)] + nameEntry->MemberIndex];
 }
 
-inline ptrdiff_t GenericStructBase::GetPNextOffset() const
+//Single-pass reader of the "features" sections of a profile in the JSON format of Vulkan Profiles:
+//{"capabilities": {"baseline": {"features": {"VkPhysicalDeviceFeatures": {"geometryShader": true}, "VkPhysicalDeviceVulkan11Features": {"multiview": true}}}}}
+//Nothing is copied or allocated, the names are looked up right in the data. The rest of the document is only checked to be well-formed
+class FeatureProfileReader
+{
+public:
+	//If capabilityName is not null, only the "features" sections inside its value are read
+	FeatureProfileReader(const char* profileData, size_t profileSize, const char* capabilityName);
+	~FeatureProfileReader();
+
+	//Adds the features set to true. Returns false if the data is not well-formed JSON
+	bool Read(FeatureBitset& features);
+
+	//Number of the members set to true that are not known to this header (e.g. of a newer or a disabled extension)
+	uint32_t GetUnknownFeatureCount() const;
+
+private:
+	bool ReadValue(bool insideCapability, uint32_t depth);
+	bool ReadFeatures(uint32_t depth);
+	bool ReadFeatureStructure(const char* structureName, size_t structureNameLength, uint32_t depth);
+
+	bool ReadString(const char** outString, size_t* outStringLength);
+	bool ReadLiteral(const char* literal);
+	void SkipWhitespace();
+
+	bool MatchesCapabilityName(const char* key, size_t keyLength) const;
+
+private:
+	static constexpr uint32_t MaxDepth = 64;
+
+	const char* Cursor;
+	const char* DataEnd;
+	const char* CapabilityName;
+
+	FeatureBitset* Features;
+	uint32_t	   UnknownFeatureCount;
+
+	//Members of the same structure go in a row, so the structure ordinal is looked up once for all of them
+	VulkanStructureType LastSType;
+	uint32_t			LastFeatureOrdinal;
+};
+
+//Reads the features from the profile data, e.g. a memory-mapped profile file. outFeatures gets the features set to true in all read sections
+bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, FeatureBitset& outFeatures, uint32_t* outUnknownFeatureCount = nullptr);
+
+//Same, but makes the chain of the structures with the features set to true. The chain data is allocated once
+template<typename HeadType>
+bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, StructureChainBlob<HeadType>& outFeatureChain, uint32_t* outUnknownFeatureCount = nullptr);
+
+inline FeatureProfileReader::FeatureProfileReader(const char* profileData, size_t profileSize, const char* capabilityName): Cursor(profileData), DataEnd(profileData + profileSize), CapabilityName(capabilityName), Features(nullptr), UnknownFeatureCount(0), LastSType(FeatureStructureInfos[0].SType), LastFeatureOrdinal(0)
 {
-	return PNextPointerOffset;
 }
 
-inline void* GenericStructBase::GetPNext() const
+inline FeatureProfileReader::~FeatureProfileReader()
 {
-	assert(PNextPointerOffset + sizeof(void*) <= GetStructureSize());
+}
 
-	void* pNext = nullptr;
-	memcpy(&pNext, StructureData + PNextPointerOffset, sizeof(void*));
+inline bool FeatureProfileReader::Read(FeatureBitset& features)
+{
+	Features = &features;
 
-	return pNext;
+	if(!ReadValue(CapabilityName == nullptr, 0))
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+	return Cursor == DataEnd;
 }
 
-inline ptrdiff_t GenericStructBase::GetSTypeOffset() const
+inline uint32_t FeatureProfileReader::GetUnknownFeatureCount() const
 {
-	return STypeOffset;
+	return UnknownFeatureCount;
 }
 
-inline VulkanStructureType GenericStructBase::GetSType() const
+inline bool FeatureProfileReader::ReadValue(bool insideCapability, uint32_t depth)
 {
-	assert(STypeOffset + sizeof(VulkanStructureType) <= GetStructureSize());
+	SkipWhitespace();
+	if(Cursor == DataEnd || depth == MaxDepth)
+	{
+		return false;
+	}
 
-	VulkanStructureType sType;
-	memcpy(&sType, StructureData + STypeOffset, sizeof(VulkanStructureType));
+	if(*Cursor == '{')
+	{
+		Cursor++;
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == '}')
+		{
+			Cursor++;
+			return true;
+		}
+
+		while(true)
+		{
+			const char* key		  = nullptr;
+			size_t		keyLength = 0;
+
+			SkipWhitespace();
+			if(!ReadString(&key, &keyLength))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if(Cursor == DataEnd || *Cursor != ':')
+			{
+				return false;
+			}
+
+			Cursor++;
+
+			bool valueRead = false;
+			if(insideCapability && keyLength == 8 && memcmp(key, "features", 8) == 0)
+			{
+				valueRead = ReadFeatures(depth + 1);
+			}
+			else
+			{
+				valueRead = ReadValue(insideCapability || MatchesCapabilityName(key, keyLength), depth + 1);
+			}
+
+			if(!valueRead)
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if(Cursor != DataEnd && *Cursor == ',')
+			{
+				Cursor++;
+				continue;
+			}
+
+			if(Cursor != DataEnd && *Cursor == '}')
+			{
+				Cursor++;
+				return true;
+			}
+
+			return false;
+		}
+	}
+	else if(*Cursor == '[')
+	{
+		Cursor++;
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == ']')
+		{
+			Cursor++;
+			return true;
+		}
+
+		while(true)
+		{
+			if(!ReadValue(insideCapability, depth + 1))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if(Cursor != DataEnd && *Cursor == ',')
+			{
+				Cursor++;
+				continue;
+			}
+
+			if(Cursor != DataEnd && *Cursor == ']')
+			{
+				Cursor++;
+				return true;
+			}
+
+			return false;
+		}
+	}
+	else if(*Cursor == '"')
+	{
+		const char* value		= nullptr;
+		size_t		valueLength = 0;
+		return ReadString(&value, &valueLength);
+	}
+	else if(*Cursor == 't')
+	{
+		return ReadLiteral("true");
+	}
+	else if(*Cursor == 'f')
+	{
+		return ReadLiteral("false");
+	}
+	else if(*Cursor == 'n')
+	{
+		return ReadLiteral("null");
+	}
+	else
+	{
+		//Numbers are only skipped, so they are checked loosely
+		const char* numberStart = Cursor;
+		while(Cursor != DataEnd && ((*Cursor >= '0' && *Cursor <= '9') || *Cursor == '-' || *Cursor == '+' || *Cursor == '.' || *Cursor == 'e' || *Cursor == 'E'))
+		{
+			Cursor++;
+		}
+
+		return Cursor != numberStart;
+	}
+}
 
-	return sType;
+inline bool FeatureProfileReader::ReadFeatures(uint32_t depth)
+{
+	SkipWhitespace();
+	if(Cursor == DataEnd || *Cursor != '{')
+	{
+		return ReadValue(true, depth);
+	}
+
+	Cursor++;
+
+	SkipWhitespace();
+	if(Cursor != DataEnd && *Cursor == '}')
+	{
+		Cursor++;
+		return true;
+	}
+
+	while(true)
+	{
+		const char* structureName		= nullptr;
+		size_t		structureNameLength = 0;
+
+		SkipWhitespace();
+		if(!ReadString(&structureName, &structureNameLength))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor == DataEnd || *Cursor != ':')
+		{
+			return false;
+		}
+
+		Cursor++;
+		if(!ReadFeatureStructure(structureName, structureNameLength, depth + 1))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == ',')
+		{
+			Cursor++;
+			continue;
+		}
+
+		if(Cursor != DataEnd && *Cursor == '}')
+		{
+			Cursor++;
+			return true;
+		}
+
+		return false;
+	}
 }
 
-//==========================================================================================================================
+inline bool FeatureProfileReader::ReadFeatureStructure(const char* structureName, size_t structureNameLength, uint32_t depth)
+{
+	SkipWhitespace();
+	if(Cursor == DataEnd || *Cursor != '{')
+	{
+		return ReadValue(true, depth);
+	}
 
-//Non-owning version of a generic structure
-class GenericStruct: public GenericStructBase
+	Cursor++;
+
+	SkipWhitespace();
+	if(Cursor != DataEnd && *Cursor == '}')
+	{
+		Cursor++;
+		return true;
+	}
+
+	uint64_t structureNameHash = HashName(NameHashBasis, structureName, structureNameLength);
+	structureNameHash		   = HashName(structureNameHash, ".", 1);
+
+	while(true)
+	{
+		const char* memberName		 = nullptr;
+		size_t		memberNameLength = 0;
+
+		SkipWhitespace();
+		if(!ReadString(&memberName, &memberNameLength))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor == DataEnd || *Cursor != ':')
+		{
+			return false;
+		}
+
+		Cursor++;
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == 't')
+		{
+			if(!ReadLiteral("true"))
+			{
+				return false;
+			}
+
+			uint64_t					  nameHash  = HashName(structureNameHash, memberName, memberNameLength);
+			const FeatureMemberNameEntry* nameEntry = FindFeatureMemberName(nameHash, structureName, structureNameLength, memberName, memberNameLength);
+			if(nameEntry != nullptr)
+			{
+				if(nameEntry->SType != LastSType)
+				{
+					LastSType		   = nameEntry->SType;
+					LastFeatureOrdinal = GetFeatureStructureOrdinal(nameEntry->SType);
+				}
+
+				Features->Set(FeatureBitRanges.FirstBits[LastFeatureOrdinal] + nameEntry->MemberIndex);
+			}
+			else
+			{
+				UnknownFeatureCount++;
+			}
+		}
+		else if(!ReadValue(true, depth + 1))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if(Cursor != DataEnd && *Cursor == ',')
+		{
+			Cursor++;
+			continue;
+		}
+
+		if(Cursor != DataEnd && *Cursor == '}')
+		{
+			Cursor++;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+inline bool FeatureProfileReader::ReadString(const char** outString, size_t* outStringLength)
 {
-public:
-	template<typename Struct>
-	GenericStruct(Struct& structure);
+	if(Cursor == DataEnd || *Cursor != '"')
+	{
+		return false;
+	}
 
-	//The copy constructor should be template-specialized, because <const GenericStructureView&> can be passed as a <Struct&>
-	template<>
-	GenericStruct(const GenericStruct& right);
-	GenericStruct& operator=(const GenericStruct& right);
-};
+	Cursor++;
 
-template<typename Struct>
-inline GenericStruct::GenericStruct(Struct& structure): GenericStructBase(reinterpret_cast<std::byte*>(&structure), sizeof(Struct), offsetof(Struct, pNext), offsetof(Struct, sType))
+	//Escaped names are returned as is, they don't match any structure or member name anyway
+	const char* stringStart = Cursor;
+	while(Cursor != DataEnd && *Cursor != '"')
+	{
+		if(*Cursor == '\\' && DataEnd - Cursor > 1)
+		{
+			Cursor++;
+		}
+
+		Cursor++;
+	}
+
+	if(Cursor == DataEnd)
+	{
+		return false;
+	}
+
+	*outString		 = stringStart;
+	*outStringLength = Cursor - stringStart;
+
+	Cursor++;
+	return true;
+}
+
+inline bool FeatureProfileReader::ReadLiteral(const char* literal)
 {
+	size_t literalLength = strlen(literal);
+	if((size_t)(DataEnd - Cursor) < literalLength || memcmp(Cursor, literal, literalLength) != 0)
+	{
+		return false;
+	}
+
+	Cursor += literalLength;
+	return true;
 }
 
-template<>
-inline GenericStruct::GenericStruct(const GenericStruct& right): GenericStructBase(right.StructureData, right.StructureSize, right.PNextPointerOffset, right.STypeOffset)
+inline void FeatureProfileReader::SkipWhitespace()
 {
+	while(Cursor != DataEnd && (*Cursor == ' ' || *Cursor == '\t' || *Cursor == '\n' || *Cursor == '\r'))
+	{
+		Cursor++;
+	}
 }
 
-inline GenericStruct& GenericStruct::operator=(const GenericStruct& right)
+inline bool FeatureProfileReader::MatchesCapabilityName(const char* key, size_t keyLength) const
 {
-	StructureData	  = right.StructureData;
-	StructureSize	  = right.StructureSize;
-	STypeOffset		= right.STypeOffset;
-	PNextPointerOffset = right.PNextPointerOffset;
+	return CapabilityName != nullptr && strncmp(CapabilityName, key, keyLength) == 0 && CapabilityName[keyLength] == '\0';
+}
 
-	return *this;
+inline bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, FeatureBitset& outFeatures, uint32_t* outUnknownFeatureCount)
+{
+	outFeatures = FeatureBitset();
+
+	FeatureProfileReader profileReader((const char*)profileData, profileSize, capabilityName);
+	if(!profileReader.Read(outFeatures))
+	{
+		return false;
+	}
+
+	if(outUnknownFeatureCount != nullptr)
+	{
+		*outUnknownFeatureCount = profileReader.GetUnknownFeatureCount();
+	}
+
+	return true;
 }
 
-//Creates a GenericStruct and automatically fills in sType (a side effect which is undesireable in constructors)
-template<typename Struct>
-inline GenericStruct TransmuteTypeToSType(Struct& structure)
+template<typename HeadType>
+inline bool LoadFeatureProfile(const void* profileData, size_t profileSize, const char* capabilityName, StructureChainBlob<HeadType>& outFeatureChain, uint32_t* outUnknownFeatureCount)
 {
-	InitSType(&structure, offsetof(Struct, sType), ValidStructureType<Struct>);
-	return GenericStruct(structure);
+	static_assert(ValidStructureType<HeadType> == FeatureStructureInfos[0].SType, "Feature profiles are loaded into VkPhysicalDeviceFeatures2 chains");
+
+	FeatureBitset profileFeatures;
+	if(!LoadFeatureProfile(profileData, profileSize, capabilityName, profileFeatures, outUnknownFeatureCount))
+	{
+		return false;
+	}
+
+	FullFeatureChain profileFeatureChain = BuildFeatureChain(profileFeatures);
+	outFeatureChain = StructureChainBlob<HeadType>::Linearize(&profileFeatureChain.GetChainHeadAs<HeadType>());
+
+	return true;
 }
 
-//==========================================================================================================================
+//=================================================================================================================================================================
 
-//Owning version of a generic structure
-class StructureBlob: public GenericStructBase
+constexpr bool ExtensionNamesEqual(const char* lhs, const char* rhs)
 {
-public:
-	StructureBlob();
+	size_t i = 0;
+	while(lhs[i] != '\0' && lhs[i] == rhs[i])
+	{
+		i++;
+	}
 
-	StructureBlob(const StructureBlob& right);
-	StructureBlob& operator=(const StructureBlob& right);
+	return lhs[i] == rhs[i];
+}
 
-	template<typename Struct>
-	StructureBlob(const Struct& structure);
+//Dense index of the extension with the given name (e.g. VK_EXT_DEBUG_REPORT_EXTENSION_NAME) in ExtensionNames, or NoExtensionIndex if the extension is unknown
+//Hashes the name once and does a single probe of the perfect hash table. Can be used in constant expressions
+constexpr uint32_t GetExtensionIndex(const char* extensionName)
+{
+	size_t nameLength = 0;
+	while(extensionName[nameLength] != '\0')
+	{
+		nameLength++;
+	}
 
-private:
-	std::vector<std::byte> StructureBlobData;
-};
+	uint64_t nameHash		  = HashName(NameHashBasis, extensionName, nameLength);
+	uint32_t nameDisplacement = ExtensionNameDisplacements[(nameHash >> 32) % ExtensionNameBucketCount];
 
-inline StructureBlob::StructureBlob()
-{
-	PNextPointerOffset = 0;
-	STypeOffset		= 0;
+	//The slot can be taken by another name, which is only found out by comparing
+	uint32_t extensionIndex = ExtensionNameSlots[MixHash(nameHash ^ nameDisplacement) % ExtensionNameSlotCount];
+	if(extensionIndex == NoExtensionIndex || !ExtensionNamesEqual(ExtensionNames[extensionIndex], extensionName))
+	{
+		return NoExtensionIndex;
+	}
 
-	StructureData = nullptr;
-	StructureSize = 0;
+	return extensionIndex;
 }
 
-template<typename Struct>
-inline StructureBlob::StructureBlob(const Struct& structure)
+//Structure to add to a chain for each extension, e.g. VkDebugReportCallbackCreateInfoEXT for VK_EXT_debug_report
+//Stores one blob per extension index, so neither setting nor looking up a structure allocates a node or hashes a name more than once
+class ExtensionStructureTable
 {
-	static_assert(std::is_trivially_destructible<Struct>::value, "Structure blob contents must be trivially destructible");
+public:
+	ExtensionStructureTable();
+	~ExtensionStructureTable();
 
-	PNextPointerOffset = offsetof(Struct, pNext);
-	STypeOffset		= offsetof(Struct, sType);
+	//Returns false if the extension is unknown to this header
+	bool SetStructure(const char* extensionName, const StructureBlob& structure);
+	void SetStructure(uint32_t extensionIndex, const StructureBlob& structure);
 
-	StructureBlobData.resize(sizeof(Struct));
-	memcpy(StructureBlobData.data(), &structure, sizeof(Struct));
+	void RemoveStructure(uint32_t extensionIndex);
+
+	//Returns null if there's no structure for the extension
+	const StructureBlob* GetStructure(const char* extensionName) const;
+	const StructureBlob* GetStructure(uint32_t extensionIndex)   const;
+
+	//Appends the structures of the enabled extensions to the chain, in the order of the names. Extensions without a structure are skipped
+	void AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames) const;
+	void AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const uint32_t* enabledExtensionIndices)  const;
+
+private:
+	std::vector<StructureBlob> Structures; //ExtensionCount blobs, empty ones for the extensions without a structure
+};
+
+inline ExtensionStructureTable::ExtensionStructureTable(): Structures(ExtensionCount)
+{
+}
 
-	StructureData = StructureBlobData.data();
-	StructureSize = StructureBlobData.size();
+inline ExtensionStructureTable::~ExtensionStructureTable()
+{
+}
 
-	//Init sType and set pNext to null
-	VulkanStructureType structureType = ValidStructureType<Struct>;
-	InitSType(StructureBlobData.data(), STypeOffset, structureType);
+inline bool ExtensionStructureTable::SetStructure(const char* extensionName, const StructureBlob& structure)
+{
+	uint32_t extensionIndex = GetExtensionIndex(extensionName);
+	if(extensionIndex == NoExtensionIndex)
+	{
+		return false;
+	}
 
-	void* nullPNext = nullptr;
-	memcpy(StructureBlobData.data() + PNextPointerOffset, &nullPNext, sizeof(void*));
+	SetStructure(extensionIndex, structure);
+	return true;
 }
 
-inline StructureBlob::StructureBlob(const StructureBlob& right)
+inline void ExtensionStructureTable::SetStructure(uint32_t extensionIndex, const StructureBlob& structure)
 {
-	*this = right;
+	assert(extensionIndex < ExtensionCount);
+
+	Structures[extensionIndex] = structure;
 }
 
-inline StructureBlob& StructureBlob::operator=(const StructureBlob& right)
+inline void ExtensionStructureTable::RemoveStructure(uint32_t extensionIndex)
 {
-	StructureBlobData.assign(right.StructureBlobData.begin(), right.StructureBlobData.end());
+	assert(extensionIndex < ExtensionCount);
 
-	StructureData = StructureBlobData.data();
-	StructureSize = StructureBlobData.size();
+	Structures[extensionIndex] = StructureBlob();
+}
 
-	STypeOffset		= right.STypeOffset;
-	PNextPointerOffset = right.PNextPointerOffset;
+inline const StructureBlob* ExtensionStructureTable::GetStructure(const char* extensionName) const
+{
+	uint32_t extensionIndex = GetExtensionIndex(extensionName);
+	if(extensionIndex == NoExtensionIndex)
+	{
+		return nullptr;
+	}
 
-	assert(PNextPointerOffset + sizeof(void*) <= StructureBlobData.size());
+	return GetStructure(extensionIndex);
+}
 
-	//Zero out PNext
-	memset(StructureBlobData.data() + PNextPointerOffset, 0, sizeof(void*));
+inline const StructureBlob* ExtensionStructureTable::GetStructure(uint32_t extensionIndex) const
+{
+	assert(extensionIndex < ExtensionCount);
 
-	return *this;
+	const StructureBlob& structure = Structures[extensionIndex];
+	if(structure.GetStructureSize() == 0)
+	{
+		return nullptr;
+	}
+
+	return &structure;
 }
 
-//==========================================================================================================================
+inline void ExtensionStructureTable::AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const char* const* enabledExtensionNames) const
+{
+	for(uint32_t i = 0; i < enabledExtensionCount; i++)
+	{
+		const StructureBlob* structure = GetStructure(enabledExtensionNames[i]);
+		if(structure != nullptr)
+		{
+			chain.AppendToChainGeneric(*structure);
+		}
+	}
+}
 
-//Base class for a generic structure chain, hiding chain link type info
-template<typename HeadType>
-class GenericStructureChainBase
+inline void ExtensionStructureTable::AppendToChain(AnyStructureChainBlob& chain, uint32_t enabledExtensionCount, const uint32_t* enabledExtensionIndices) const
 {
-protected:
-	GenericStructureChainBase();
-	~GenericStructureChainBase();
+	for(uint32_t i = 0; i < enabledExtensionCount; i++)
+	{
+		const StructureBlob* structure = GetStructure(enabledExtensionIndices[i]);
+		if(structure != nullptr)
+		{
+			chain.AppendToChainGeneric(*structure);
+		}
+	}
+}
 
-public:
-	HeadType& GetChainHead();
+//=================================================================================================================================================================
 
-	template<typename Struct>
-	Struct& GetChainLinkDataAs();
+constexpr uint32_t ExtensionBitsetWordCount = (ExtensionCount == 0) ? 1 : (ExtensionCount + 63) / 64;
 
+//Set of the enabled extensions, one bit per extension index
+class ExtensionBitset
+{
 public:
-	GenericStructureChainBase(const GenericStructureChainBase& rhs) = delete;
-	GenericStructureChainBase& operator=(const GenericStructureChainBase& rhs) = delete;
+	ExtensionBitset();
+	ExtensionBitset(uint32_t enabledExtensionCount, const char* const* enabledExtensionNames);
+	~ExtensionBitset();
 
-protected:
-	std::vector<std::byte*> StructureDataPointers;
-	std::vector<ptrdiff_t>  PNextPointerOffsets;
-	std::vector<ptrdiff_t>  STypeOffsets;
+	bool Test(uint32_t extensionIndex) const;
+	void Set(uint32_t extensionIndex, bool value = true);
 
-	std::unordered_map<VulkanStructureType, size_t> StructureDataIndices;
+	//Returns false if the extension is unknown to this header
+	bool Set(const char* extensionName, bool value = true);
+
+private:
+	uint64_t Words[ExtensionBitsetWordCount];
 };
 
-template<typename HeadType>
-inline GenericStructureChainBase<HeadType>::GenericStructureChainBase()
+//Returns true if the structure can be used with apiVersion (e.g. VK_API_VERSION_1_1) and the enabled extensions
+//Structures of unknown sType and the ones that have no known core version or extension to provide them are always supported
+bool IsStructureSupported(VulkanStructureType sType, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+
+//Unlinks all the structures not supported by apiVersion and the enabled extensions from the chain in a single pass, without copying or reallocating anything
+//The head is always kept. Returns the number of the unlinked structures
+size_t FilterByEnabled(void* chainHead, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+size_t FilterByEnabled(AnyStructureChainBlob& chain, uint32_t apiVersion, const ExtensionBitset& enabledExtensions);
+
+inline ExtensionBitset::ExtensionBitset()
 {
+	memset(Words, 0, sizeof(Words));
 }
 
-template<typename HeadType>
-inline GenericStructureChainBase<HeadType>::~GenericStructureChainBase()
+inline ExtensionBitset::ExtensionBitset(uint32_t enabledExtensionCount, const char* const* enabledExtensionNames)
 {
+	memset(Words, 0, sizeof(Words));
+
+	for(uint32_t i = 0; i < enabledExtensionCount; i++)
+	{
+		Set(enabledExtensionNames[i]);
+	}
 }
 
-template<typename HeadType>
-inline HeadType& GenericStructureChainBase<HeadType>::GetChainHead()
+inline ExtensionBitset::~ExtensionBitset()
 {
-	assert(StructureDataPointers.size() > 0);
-	assert(StructureDataPointers[0] != nullptr);
-
-	HeadType* head = reinterpret_cast<HeadType*>(StructureDataPointers[0]);
-	return *head;
 }
 
-template<typename HeadType>
-template<typename Struct>
-inline Struct& GenericStructureChainBase<HeadType>::GetChainLinkDataAs()
+inline bool ExtensionBitset::Test(uint32_t extensionIndex) const
 {
-	Struct* structPtr = reinterpret_cast<Struct*>(StructureDataPointers[StructureDataIndices.at(ValidStructureType<Struct>)]);
-	return *structPtr;
+	assert(extensionIndex < ExtensionCount);
+
+	return (Words[extensionIndex / 64] >> (extensionIndex % 64)) & 1;
 }
 
-//==========================================================================================================================
+inline void ExtensionBitset::Set(uint32_t extensionIndex, bool value)
+{
+	assert(extensionIndex < ExtensionCount);
 
-//Generic structure chain, non-owning version
-template<typename HeadType>
-class GenericStructureChain: public GenericStructureChainBase<HeadType>
+	uint64_t extensionMask = 1ull << (extensionIndex % 64);
+	Words[extensionIndex / 64] = value ? (Words[extensionIndex / 64] | extensionMask) : (Words[extensionIndex / 64] & ~extensionMask);
+}
+
+inline bool ExtensionBitset::Set(const char* extensionName, bool value)
 {
-	using GenericStructureChainBase<HeadType>::StructureDataPointers;
-	using GenericStructureChainBase<HeadType>::STypeOffsets;
-	using GenericStructureChainBase<HeadType>::PNextPointerOffsets;
-	using GenericStructureChainBase<HeadType>::StructureDataIndices;
+	uint32_t extensionIndex = GetExtensionIndex(extensionName);
+	if(extensionIndex == NoExtensionIndex)
+	{
+		return false;
+	}
 
-public:
-	GenericStructureChain();
-	GenericStructureChain(HeadType& head);
-	~GenericStructureChain();
-	
-	//Clears everything EXCEPT head
-	void Clear();
+	Set(extensionIndex, value);
+	return true;
+}
 
-	template<typename Struct>
-	void AppendToChain(Struct& next);
+inline bool IsStructureSupported(VulkanStructureType sType, uint32_t apiVersion, const ExtensionBitset& enabledExtensions)
+{
+	uint32_t ordinal = GetStructureOrdinal(sType);
+	if(ordinal == NoStructureOrdinal)
+	{
+		return true;
+	}
 
-	void AppendToChainGeneric(GenericStructBase& nextBlobData);
+	const StructureRequirement& requirement = StructureRequirements[ordinal];
+	if(requirement.CoreVersion == 0 && requirement.ProviderExtensionCount == 0)
+	{
+		return true;
+	}
 
-public:
-	GenericStructureChain(const GenericStructureChain& rhs) = delete;
-	GenericStructureChain& operator=(const GenericStructureChain& rhs) = delete;
+	if(requirement.CoreVersion != 0 && apiVersion >= requirement.CoreVersion)
+	{
+		return true;
+	}
 
-private:
-	void AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType);
+	for(uint32_t i = 0; i < requirement.ProviderExtensionCount; i++)
+	{
+		if(enabledExtensions.Test(StructureProviderExtensions[requirement.FirstProviderExtension + i]))
+		{
+			return true;
+		}
+	}
 
-protected:
-	HeadType HeadData;
-};
+	return false;
+}
 
-template<typename HeadType>
-inline GenericStructureChain<HeadType>::GenericStructureChain()
+inline size_t FilterByEnabled(void* chainHead, uint32_t apiVersion, const ExtensionBitset& enabledExtensions)
 {
-	//Init HeadData's sType and pNext
-	InitSType(&HeadData, offsetof(HeadData, sType), ValidStructureType<HeadType>);
-	HeadData.pNext = nullptr;
+	size_t removedCount = 0;
 
-	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(&HeadData));
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	//Only the pNext of the last kept structure is ever written, the unlinked structures are left as they are
+	void*		prevLink = chainHead;
+	const void* link	 = GetChainLinkPNext(chainHead);
+	while(link != nullptr)
+	{
+		const void* nextLink = GetChainLinkPNext(link);
+		if(IsStructureSupported(GetChainLinkSType(link), apiVersion, enabledExtensions))
+		{
+			prevLink = (void*)link;
+		}
+		else
+		{
+			SetChainLinkPNext(prevLink, nextLink);
+			removedCount++;
+		}
+
+		link = nextLink;
+	}
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+	return removedCount;
 }
 
-template<typename HeadType>
-inline GenericStructureChain<HeadType>::GenericStructureChain(HeadType& head)
+inline size_t FilterByEnabled(AnyStructureChainBlob& chain, uint32_t apiVersion, const ExtensionBitset& enabledExtensions)
 {
-	HeadData = head;
-
-	InitSType(&HeadData, offsetof(HeadData, sType), ValidStructureType<HeadType>);
-	HeadData.pNext = nullptr;
+	size_t removedCount = 0;
+	if(chain.NextLinkIndices.empty())
+	{
+		return removedCount;
+	}
 
-	//Head is always the first pointer
-	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(&HeadData));
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	//The storage of the unlinked structures is kept for reuse, same as with Remove()
+	size_t linkIndex = chain.NextLinkIndices[0];
+	while(linkIndex != AnyStructureChainBlob::NoLink)
+	{
+		size_t nextLinkIndex = chain.NextLinkIndices[linkIndex];
+		if(!IsStructureSupported(chain.GetLinkSType(linkIndex), apiVersion, enabledExtensions))
+		{
+			chain.RemoveLinkAt(linkIndex);
+			removedCount++;
+		}
+
+		linkIndex = nextLinkIndex;
+	}
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+	return removedCount;
 }
 
-template<typename HeadType>
-inline GenericStructureChain<HeadType>::~GenericStructureChain()
+//=================================================================================================================================================================
+
+enum class ChainIssueKind: uint32_t
 {
-}
+	Cycle,			  //pNext of the link points back to the chain
+	Duplicate,		  //The structure is already in the chain and can't be there more than once
+	InvalidExtension, //The structure can't extend the head of the chain
+	UnknownStructure  //The sType is unknown to this header, the structure is not checked
+};
 
-template<typename HeadType>
-inline void GenericStructureChain<HeadType>::Clear()
+struct ChainIssue
 {
-	//Just reset the pointers
-	StructureDataPointers.clear();
-	PNextPointerOffsets.clear();
+	ChainIssueKind		Kind;
+	uint32_t			LinkIndex; //Position in the chain, the head is 0
+	VulkanStructureType SType;
+};
 
-	StructureDataIndices.clear();
+constexpr uint32_t MaxReportedChainIssues = 8;
 
-	HeadData.pNext = nullptr;
+//IssueCount counts all the found issues, only the first MaxReportedChainIssues of them are stored
+struct ChainValidationReport
+{
+	uint32_t   IssueCount;
+	ChainIssue Issues[MaxReportedChainIssues];
+};
 
-	StructureDataPointers.push_back(&HeadData);
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+//Checks the pNext chain for a cycle, for the repeated structures that don't allow duplicates and for the structures that can't extend the head, same as the validation layers do
+//Doesn't allocate and takes a single pass over a chain without a cycle. Structures of unknown sType are reported but not checked, structures with unknown chain rule are only checked for a cycle
+ChainValidationReport ValidateChain(const void* chainHead);
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
-}
+//One bit per StructureOrdinal
+constexpr uint32_t StructureOrdinalWordCount = StructureOrdinalCount / 64 + 1;
 
-template<typename HeadType>
-template<typename Struct>
-inline void GenericStructureChain<HeadType>::AppendToChain(Struct& next)
+inline void AddChainIssue(ChainValidationReport& report, ChainIssueKind kind, uint32_t linkIndex, VulkanStructureType sType)
 {
-	AppendDataToChain(&next, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	if(report.IssueCount < MaxReportedChainIssues)
+	{
+		report.Issues[report.IssueCount] = {kind, linkIndex, sType};
+	}
+
+	report.IssueCount++;
 }
 
-template<typename HeadType>
-inline void GenericStructureChain<HeadType>::AppendToChainGeneric(GenericStructBase& nextBlobData)
+//A structure with unknown rule is assumed to extend anything
+inline bool CanExtendStructure(const StructureChainRule& chainRule, VulkanStructureType sType)
 {
-	AppendDataToChain(nextBlobData.GetStructureData(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
+	if(chainRule.ExtendedSTypes == nullptr)
+	{
+		return true;
+	}
+
+	for(const VulkanStructureType* extendedSType = chainRule.ExtendedSTypes; *extendedSType != (VulkanStructureType)VK_STRUCTURE_TYPE_MAX_ENUM; extendedSType++)
+	{
+		if(*extendedSType == sType)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
-template<typename HeadType>
-inline void GenericStructureChain<HeadType>::AppendDataToChain(void* dataPtr, size_t sTypeOffset, size_t pNextOffset, VulkanStructureType sType)
+//Checks the first linkLimit links of the chain, the head included. Returns the length of the cycle the chain ends with, or 0 if there's no cycle
+//The cycle is found with Brent's algorithm: the tortoise jumps to the hare after every power of two steps, and they meet only if the chain loops
+inline uint32_t ValidateChainLinks(const void* chainHead, uint32_t linkLimit, ChainValidationReport& outReport)
 {
-	std::byte* prevLastStruct  = StructureDataPointers.back();
-	ptrdiff_t  prevPNextOffset = PNextPointerOffsets.back();
+	outReport.IssueCount = 0;
 
-	StructureDataPointers.push_back(reinterpret_cast<std::byte*>(dataPtr));
-	STypeOffsets.push_back(sTypeOffset);
-	PNextPointerOffsets.push_back(pNextOffset);
+	VulkanStructureType headSType	= GetChainLinkSType(chainHead);
+	uint32_t			headOrdinal = GetStructureOrdinal(headSType);
 
-	std::byte* currLastStructPtr = StructureDataPointers.back();
-	InitSType(dataPtr, sTypeOffset, sType);										   //Set sType of the current struct
-	memcpy(prevLastStruct + prevPNextOffset, &currLastStructPtr, sizeof(std::byte*)); //Set pNext pointer of the previous struct
+	uint64_t foundStructures[StructureOrdinalWordCount];
+	memset(foundStructures, 0, sizeof(foundStructures));
 
-	StructureDataIndices[sType] = StructureDataPointers.size() - 1;
-}
+	if(headOrdinal != NoStructureOrdinal)
+	{
+		foundStructures[headOrdinal / 64] |= 1ull << (headOrdinal % 64);
+	}
 
-//==========================================================================================================================
+	uint32_t	power		= 1;
+	uint32_t	cycleLength = 1;
+	const void* tortoise	= chainHead;
 
-//Generic structure chain, owning version
-template<typename HeadType> 
-class StructureChainBlob: public GenericStructureChainBase<HeadType>
+	const void* link = GetChainLinkPNext(chainHead);
+	for(uint32_t linkIndex = 1; linkIndex < linkLimit && link != nullptr; linkIndex++)
+	{
+		if(link == tortoise)
+		{
+			return cycleLength;
+		}
+
+		VulkanStructureType sType	= GetChainLinkSType(link);
+		uint32_t			ordinal = GetStructureOrdinal(sType);
+		if(ordinal == NoStructureOrdinal)
+		{
+			AddChainIssue(outReport, ChainIssueKind::UnknownStructure, linkIndex, sType);
+		}
+		else if(StructureChainRules[ordinal].ExtendedSTypes != nullptr) //Structures with unknown rule can't be checked
+		{
+			const StructureChainRule& chainRule = StructureChainRules[ordinal];
+
+			uint64_t ordinalMask = 1ull << (ordinal % 64);
+			if((foundStructures[ordinal / 64] & ordinalMask) != 0 && !chainRule.AllowDuplicates)
+			{
+				AddChainIssue(outReport, ChainIssueKind::Duplicate, linkIndex, sType);
+			}
+
+			foundStructures[ordinal / 64] |= ordinalMask;
+
+			if(headOrdinal != NoStructureOrdinal && !CanExtendStructure(chainRule, headSType))
+			{
+				AddChainIssue(outReport, ChainIssueKind::InvalidExtension, linkIndex, sType);
+			}
+		}
+
+		if(cycleLength == power)
+		{
+			tortoise	= link;
+			power	   *= 2;
+			cycleLength = 0;
+		}
+
+		link = GetChainLinkPNext(link);
+		cycleLength++;
+	}
+
+	return 0;
+}
+
+inline ChainValidationReport ValidateChain(const void* chainHead)
 {
-	using GenericStructureChainBase<HeadType>::StructureDataPointers;
-	using GenericStructureChainBase<HeadType>::STypeOffsets;
-	using GenericStructureChainBase<HeadType>::PNextPointerOffsets;
-	using GenericStructureChainBase<HeadType>::StructureDataIndices;
+	ChainValidationReport report;
 
-public:
-	StructureChainBlob();
-	StructureChainBlob(const HeadType& head);
-	~StructureChainBlob();
-	   
-	//Clears everything EXCEPT head
-	void Clear();
+	uint32_t cycleLength = ValidateChainLinks(chainHead, (uint32_t)(-1), report);
+	if(cycleLength == 0)
+	{
+		return report;
+	}
 
-	template<typename Struct>
-	void AppendToChain(const Struct& next);
+	//The hare walked the cycle more than once, so the links are checked again up to the end of the first lap. The cycle starts where two pointers cycleLength apart meet
+	const void* tortoise = chainHead;
+	const void* hare	 = chainHead;
+	for(uint32_t i = 0; i < cycleLength; i++)
+	{
+		hare = GetChainLinkPNext(hare);
+	}
 
-	void AppendToChainGeneric(const GenericStructBase& nextBlobData);
+	uint32_t cycleStart = 0;
+	while(tortoise != hare)
+	{
+		tortoise = GetChainLinkPNext(tortoise);
+		hare	 = GetChainLinkPNext(hare);
+		cycleStart++;
+	}
 
-public:
-	StructureChainBlob(const StructureChainBlob& rhs)			= delete;
-	StructureChainBlob& operator=(const StructureChainBlob& rhs) = delete;
+	uint32_t uniqueLinkCount = cycleStart + cycleLength;
+	ValidateChainLinks(chainHead, uniqueLinkCount, report);
 
-private:
-	void AppendDataToBlob(const std::byte* data, size_t dataSize, const void* dataPNext, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType);
+	const void* lastLink = chainHead;
+	for(uint32_t i = 1; i < uniqueLinkCount; i++)
+	{
+		lastLink = GetChainLinkPNext(lastLink);
+	}
 
-private:
-	std::vector<std::byte> StructureChainBlobData;
-};
+	AddChainIssue(report, ChainIssueKind::Cycle, uniqueLinkCount - 1, GetChainLinkSType(lastLink));
+	return report;
+}
 
-template<typename HeadType>
-inline StructureChainBlob<HeadType>::StructureChainBlob()
+//=================================================================================================================================================================
+
+constexpr size_t PNextEditorInlineSize = 512;
+
+//Edits a const pNext chain without modifying it, e.g. in a layer that adds or removes a structure before calling down the chain
+//Only the structures in front of the edits are copied, shallowly: pointer members keep pointing to the original data, and the rest of the chain is shared with the original
+//The copies are stored inside the editor, the heap is only used for the ones that don't fit in PNextEditorInlineSize bytes
+class PNextEditor
 {
-	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+public:
+	explicit PNextEditor(const void* chainHead);
+	~PNextEditor();
 
-	//Store head in the blob
-	StructureChainBlobData.resize(sizeof(HeadType));
+	//The copies point to each other and into the editor itself
+	PNextEditor(const PNextEditor& rhs)			   = delete;
+	PNextEditor& operator=(const PNextEditor& rhs) = delete;
 
-	HeadType head;
-	InitSType(&head, offsetof(HeadType, sType), ValidStructureType<HeadType>);
-	head.pNext = nullptr;
+	//The edited chain, which is the original one until the first edit
+	const void* GetChainHead() const;
 
-	memcpy(StructureChainBlobData.data(), &head, sizeof(HeadType));
+	template<typename HeadType>
+	const HeadType& GetChainHeadAs() const;
 
-	StructureDataPointers.push_back(StructureChainBlobData.data());
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	//Copies the structure into the editor and links it right after the head. The head has to be known to this header
+	template<typename Struct>
+	Struct& Insert(const Struct& value);
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
-}
+	//Unlinks the occurrence-th structure of the type Struct
+	//Returns false if there's no such structure, or if there's a structure of unknown sType in front of it that can't be copied
+	template<typename Struct>
+	bool Remove(size_t occurrence = 0);
 
-template<typename HeadType>
-inline StructureChainBlob<HeadType>::StructureChainBlob(const HeadType& head)
-{
-	static_assert(std::is_trivially_destructible<HeadType>::value, "All members of the structure chain blob must be trivially destructible");
+	bool RemoveGeneric(VulkanStructureType sType, size_t occurrence = 0);
 
-	//Store head in the blob
-	StructureChainBlobData.resize(sizeof(HeadType));
+	//Number of the structures at the front of the edited chain that are owned by the editor, the head included
+	uint32_t GetWritableLinkCount() const;
 
-	memcpy(StructureChainBlobData.data(), &head, sizeof(HeadType));
+private:
+	void* AllocateLinkData(size_t dataSize);
 
-	StructureDataPointers.push_back(StructureChainBlobData.data());
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	//Copies the structures of the original chain up to linkIndex, so their pNext can be changed. Returns the structure at linkIndex, or null if some structure can't be copied
+	void* MakeLinkWritable(uint32_t linkIndex);
+
+private:
+	alignas(ChainLinkDataAlignment) std::byte InlineData[PNextEditorInlineSize];
+	size_t									  InlineDataSize;
 
-	VulkanStructureType headSType = ValidStructureType<HeadType>;
-	void*			   headPNext = nullptr;
+	std::vector<std::vector<std::byte>> OverflowData; //One allocation per structure, so the copies never move
 
-	InitSType(StructureDataPointers.back(), STypeOffsets.back(), headSType);
-	memcpy(StructureDataPointers.back() + PNextPointerOffsets.back(), &headPNext, sizeof(void*));
+	const void* ChainHead;
+	void*		LastWritableLink;
+	uint32_t	WritableLinkCount;
+};
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+inline PNextEditor::PNextEditor(const void* chainHead): InlineDataSize(0), ChainHead(chainHead), LastWritableLink(nullptr), WritableLinkCount(0)
+{
+	assert(chainHead != nullptr);
 }
 
-template<typename HeadType>
-inline StructureChainBlob<HeadType>::~StructureChainBlob()
+inline PNextEditor::~PNextEditor()
 {
 }
 
+inline const void* PNextEditor::GetChainHead() const
+{
+	return ChainHead;
+}
+
 template<typename HeadType>
-inline void StructureChainBlob<HeadType>::Clear()
+inline const HeadType& PNextEditor::GetChainHeadAs() const
 {
-	//Save the head
-	HeadType& headData = GenericStructureChainBase<HeadType>::GetChainHead();
-	std::vector<std::byte> oldHead(sizeof(HeadType));
-	memcpy(oldHead.data(), &headData, sizeof(HeadType));
+	assert(GetChainLinkSType(ChainHead) == ValidStructureType<HeadType>);
 
-	//Clear everything
-	StructureChainBlobData.clear();
+	return *(const HeadType*)ChainHead;
+}
 
-	StructureDataPointers.clear();
-	STypeOffsets.clear();
-	PNextPointerOffsets.clear();
+template<typename Struct>
+inline Struct& PNextEditor::Insert(const Struct& value)
+{
+	static_assert(std::is_trivially_destructible<Struct>::value, "Structures inserted with PNextEditor must be trivially destructible");
 
-	StructureDataIndices.clear();
+	void* head = MakeLinkWritable(0);
+	assert(head != nullptr); //Unknown head
 
-	//Reinit 
-	StructureChainBlobData.resize(sizeof(HeadType));
+	Struct* link = new(AllocateLinkData(sizeof(Struct))) Struct(value);
+	InitSType(link, offsetof(Struct, sType), ValidStructureType<Struct>);
 
-	memcpy(StructureChainBlobData.data(), oldHead.data(), sizeof(HeadType));
+	SetChainLinkPNext(link, GetChainLinkPNext(head));
+	SetChainLinkPNext(head, link);
 
-	StructureDataPointers.push_back(StructureChainBlobData.data());
-	STypeOffsets.push_back(offsetof(HeadType, sType));
-	PNextPointerOffsets.push_back(offsetof(HeadType, pNext));
+	if(WritableLinkCount == 1)
+	{
+		LastWritableLink = link;
+	}
 
-	StructureDataIndices[ValidStructureType<HeadType>] = 0;
+	WritableLinkCount++;
+	return *link;
 }
 
-template<typename HeadType>
 template<typename Struct>
-inline void StructureChainBlob<HeadType>::AppendToChain(const Struct& next)
+inline bool PNextEditor::Remove(size_t occurrence)
 {
-	static_assert(std::is_trivially_destructible<Struct>::value, "All members of the structure chain blob must be trivially destructible");
-
-	AppendDataToBlob((const std::byte*)(&next), sizeof(Struct), next.pNext, offsetof(Struct, sType), offsetof(Struct, pNext), ValidStructureType<Struct>);
+	return RemoveGeneric(ValidStructureType<Struct>, occurrence);
 }
 
-template<typename HeadType>
-inline void StructureChainBlob<HeadType>::AppendToChainGeneric(const GenericStructBase& nextBlobData)
+inline bool PNextEditor::RemoveGeneric(VulkanStructureType sType, size_t occurrence)
 {
-	AppendDataToBlob(nextBlobData.GetStructureData(), nextBlobData.GetStructureSize(), nextBlobData.GetPNext(), nextBlobData.GetSTypeOffset(), nextBlobData.GetPNextOffset(), nextBlobData.GetSType());
-}
+	uint32_t	linkIndex = 1;
+	const void* link	  = GetChainLinkPNext(ChainHead);
+	while(link != nullptr)
+	{
+		if(GetChainLinkSType(link) == sType)
+		{
+			if(occurrence == 0)
+			{
+				break;
+			}
+
+			occurrence--;
+		}
+
+		link = GetChainLinkPNext(link);
+		linkIndex++;
+	}
 
-template<typename HeadType>
-inline void StructureChainBlob<HeadType>::AppendDataToBlob(const std::byte* data, size_t dataSize, const void* dataPNext, ptrdiff_t dataSTypeOffset, ptrdiff_t dataPNextOffset, VulkanStructureType sType)
-{
-	size_t prevDataSize   = StructureChainBlobData.size();
-	size_t nextDataOffset = prevDataSize;
+	if(link == nullptr)
+	{
+		return false;
+	}
 
-	//Copy all current structures to the new chain, and append new structure
-	std::vector<std::byte> newStructureChainData(prevDataSize + dataSize);
-	memcpy(newStructureChainData.data(),				StructureChainBlobData.data(), prevDataSize);
-	memcpy(newStructureChainData.data() + prevDataSize, data,						  dataSize);
+	void* prevLink = MakeLinkWritable(linkIndex - 1);
+	if(prevLink == nullptr)
+	{
+		return false;
+	}
 
-	//Initialize sType
-	InitSType(newStructureChainData.data() + prevDataSize, dataSTypeOffset, sType);
+	//The removed structure itself is never copied, the original one may be shared with the rest of the chain
+	SetChainLinkPNext(prevLink, GetChainLinkPNext(link));
 
-	//Rebuild StructureDataPointers
-	std::vector<ptrdiff_t> structureDataOffsets(StructureDataPointers.size());
-	for(size_t i = 0; i < StructureDataPointers.size(); i++)
+	if(linkIndex < WritableLinkCount)
 	{
-		structureDataOffsets[i] = (StructureDataPointers[i] - &StructureChainBlobData[0]);
+		if(linkIndex == WritableLinkCount - 1)
+		{
+			LastWritableLink = prevLink;
+		}
+
+		WritableLinkCount--;
 	}
 
-	StructureDataPointers.clear();
-	for(size_t i = 0; i < structureDataOffsets.size(); i++)
+	return true;
+}
+
+inline uint32_t PNextEditor::GetWritableLinkCount() const
+{
+	return WritableLinkCount;
+}
+
+inline void* PNextEditor::AllocateLinkData(size_t dataSize)
+{
+	size_t alignedSize = (dataSize + ChainLinkDataAlignment - 1) & ~(ChainLinkDataAlignment - 1);
+	if(InlineDataSize + alignedSize <= PNextEditorInlineSize)
 	{
-		StructureDataPointers.push_back(newStructureChainData.data() + structureDataOffsets[i]);
+		void* linkData = InlineData + InlineDataSize;
+		InlineDataSize += alignedSize;
+
+		return linkData;
 	}
 
-	StructureDataPointers.push_back(newStructureChainData.data() + nextDataOffset);
-	STypeOffsets.push_back(dataSTypeOffset);
-	PNextPointerOffsets.push_back(dataPNextOffset);
+	OverflowData.emplace_back(alignedSize);
+	return OverflowData.back().data();
+}
 
-	//Invalidate pNext pointers
-	for(size_t i = 0; i < PNextPointerOffsets.size() - 1; i++)
+inline void* PNextEditor::MakeLinkWritable(uint32_t linkIndex)
+{
+	if(WritableLinkCount == 0)
 	{
-		void** currPPNext = (void**)(StructureDataPointers[i] + PNextPointerOffsets[i]);
-		memcpy(currPPNext, &StructureDataPointers[i + 1], sizeof(void*));
+		size_t headSize = GetSTypeStructureSize(GetChainLinkSType(ChainHead));
+		if(headSize == 0)
+		{
+			return nullptr;
+		}
+
+		void* head = AllocateLinkData(headSize);
+		memcpy(head, ChainHead, headSize);
+
+		ChainHead		  = head;
+		LastWritableLink  = head;
+		WritableLinkCount = 1;
 	}
 
-	//Invalidate the last pNext pointer with the provided one
-	std::byte* pLastStruct = StructureDataPointers.back();
-	memcpy(pLastStruct + dataPNextOffset, &dataPNext, sizeof(void*));
+	while(WritableLinkCount <= linkIndex)
+	{
+		const void* link = GetChainLinkPNext(LastWritableLink);
+		assert(link != nullptr);
 
-	//Only use move semantics, because copy semantics will make pNext pointers invalid once again
-	StructureChainBlobData = std::move(newStructureChainData);
+		size_t linkSize = GetSTypeStructureSize(GetChainLinkSType(link));
+		if(linkSize == 0)
+		{
+			return nullptr;
+		}
 
-	//Make sure all pNext point to inside of StructureChainBlobData. The last pointer can point to whatever the user specified
-	for(size_t i = 0; i < PNextPointerOffsets.size() - 1; i++)
-	{
-		void* pNextPointer = nullptr;
-		memcpy(&pNextPointer, StructureDataPointers[i] + PNextPointerOffsets[i], sizeof(void*)); //Init the pointer data
+		void* linkCopy = AllocateLinkData(linkSize);
+		memcpy(linkCopy, link, linkSize);
 
-		assert(pNextPointer >= &StructureChainBlobData[0] && pNextPointer < (&StructureChainBlobData[0] + StructureChainBlobData.size())); //Move semantics should never break pNext pointers, they should always point to inside the blob
+		SetChainLinkPNext(LastWritableLink, linkCopy);
+
+		LastWritableLink = linkCopy;
+		WritableLinkCount++;
+	}
+
+	//The writable links are at the front, so this is a walk over the copies only
+	void* writableLink = (void*)ChainHead;
+	for(uint32_t i = 0; i < linkIndex; i++)
+	{
+		writableLink = (void*)GetChainLinkPNext(writableLink);
 	}
 
-	StructureDataIndices[sType] = StructureDataPointers.size() - 1;
+	return writableLink;
 }
 
 }
 
+namespace std
+{
+	template<>
+	struct hash<vgs::StructureTreeKey>
+	{
+		size_t operator()(const vgs::StructureTreeKey& structureTreeKey) const
+		{
+			return (size_t)structureTreeKey.Hash[0];
+		}
+	};
+
+	template<>
+	struct hash<vgs::StructureBlob>
+	{
+		size_t operator()(const vgs::StructureBlob& structureBlob) const
+		{
+			return (size_t)structureBlob.Hash();
+		}
+	};
+
+	template<>
+	struct hash<vgs::AnyStructureChainBlob>
+	{
+		size_t operator()(const vgs::AnyStructureChainBlob& structureChainBlob) const
+		{
+			return (size_t)structureChainBlob.Hash();
+		}
+	};
+
+	template<typename HeadType>
+	struct hash<vgs::StructureChainBlob<HeadType>>
+	{
+		size_t operator()(const vgs::StructureChainBlob<HeadType>& structureChainBlob) const
+		{
+			return (size_t)structureChainBlob.Hash();
+		}
+	};
+}
+
 #endif
@@ -0,0 +1,132 @@
+/********************************************************************************
+MIT License
+
+Copyright (c) 2020 Sixshaman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+********************************************************************************/
+
+#ifndef VULKAN_GENERIC_STRUCTURES_REFLECTION_H
+#define VULKAN_GENERIC_STRUCTURES_REFLECTION_H
+
+//Member tables of all structures from vk.xml. Opt-in, since they are much larger than the rest of the library
+#include "VulkanGenericStructures.h"
+
+namespace vgs
+{
+
+//What a member holds, for array and pointer members what each element holds
+enum class MemberScalarKind: uint32_t
+{
+	Void,
+	Bool32,
+	Char,
+	Int8,
+	Uint8,
+	Int16,
+	Uint16,
+	Int32,
+	Uint32,
+	Int64,
+	Uint64,
+	Size,
+	Float,
+	Double,
+	Enum,
+	Flags,
+	Flags64,
+	Handle,
+	FunctionPointer,
+	Struct,			//See ElementReflection
+	Union,
+	Other			//Platform types, e.g. HWND or ANativeWindow
+};
+
+constexpr uint32_t NoMemberIndex = 0xffffffff;
+
+struct StructureReflection;
+
+struct StructureMemberInfo
+{
+	const char*				   Name;
+	uint32_t				   Offset;
+	uint32_t				   Size;
+	MemberScalarKind		   ScalarKind;
+	uint32_t				   PointerDepth;
+	uint32_t				   ArrayLength;		  //Number of elements of a fixed-size array member, 0 for the other members
+	const char*				   Len;				  //len (or altlen) attribute of vk.xml, e.g. "enabledExtensionCount,null-terminated", null if none
+	uint32_t				   LenMemberIndex;	  //Index of the member that holds the number of elements, NoMemberIndex if none
+	const StructureReflection* ElementReflection; //Members of the structure the member holds or points to, null if none or unknown
+};
+
+struct StructureReflection
+{
+	const char*				   Name;			  //Null for the structures with unknown layout
+	VulkanStructureType		   SType;
+	uint32_t				   Size;
+	const StructureMemberInfo* Members;
+	uint32_t				   MemberCount;
+};
+
+//Member table of a structure type, e.g. StructureReflectionOf<VkApplicationInfo>.Members
+template<typename VkStruct>
+inline constexpr StructureReflection StructureReflectionOf = {nullptr, VK_STRUCTURE_TYPE_MAX_ENUM, 0, nullptr, 0};
+
+//Returns the member table of the structure with the given sType, or nullptr if the sType or the structure layout is unknown
+inline const StructureReflection* GetSTypeReflection(VulkanStructureType sType)
+{
+	return nullptr;
+}
+
+//Index of the member with the given name, or NoMemberIndex. Can be used in constant expressions
+constexpr uint32_t FindStructureMemberIndex(const StructureReflection& reflection, const char* memberName)
+{
+	for(uint32_t memberIndex = 0; memberIndex < reflection.MemberCount; memberIndex++)
+	{
+		const char* reflectedName = reflection.Members[memberIndex].Name;
+
+		uint32_t charIndex = 0;
+		while(reflectedName[charIndex] != '\0' && reflectedName[charIndex] == memberName[charIndex])
+		{
+			charIndex++;
+		}
+
+		if(reflectedName[charIndex] == memberName[charIndex])
+		{
+			return memberIndex;
+		}
+	}
+
+	return NoMemberIndex;
+}
+
+//Member with the given name, or nullptr
+inline const StructureMemberInfo* FindStructureMember(const StructureReflection& reflection, const char* memberName)
+{
+	uint32_t memberIndex = FindStructureMemberIndex(reflection, memberName);
+	if(memberIndex == NoMemberIndex)
+	{
+		return nullptr;
+	}
+
+	return &reflection.Members[memberIndex];
+}
+}
+
+#endif
@@ -0,0 +1,386 @@
+#include "GenericStructureBenchmarksH.hpp"
+#include <vulkan/vulkan.h>
+#include <vector>
+#include <unordered_set>
+#include <chrono>
+#include <cstdio>
+
+#define vgs vgs_h
+#include "..\..\..\Include\VulkanGenericStructures.h"
+
+//Number of chains built per "frame"
+static constexpr uint32_t BenchmarkChainCount = 50000;
+
+template<typename Func>
+static double MeasureNanosecondsPerChain(Func func)
+{
+	std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+	func();
+	std::chrono::high_resolution_clock::time_point endTime = std::chrono::high_resolution_clock::now();
+
+	return std::chrono::duration<double, std::nano>(endTime - startTime).count() / BenchmarkChainCount;
+}
+
+//Graphics pipeline with all state, every pointer points inside the structure itself
+struct SyntheticPipeline
+{
+	uint32_t							   SpecializationData[4];
+	VkSpecializationMapEntry			   SpecializationMapEntries[4];
+	VkSpecializationInfo				   SpecializationInfo;
+	VkPipelineShaderStageCreateInfo		   ShaderStages[2];
+	VkVertexInputBindingDescription		   VertexBindings[2];
+	VkVertexInputAttributeDescription	   VertexAttributes[4];
+	VkPipelineVertexInputStateCreateInfo   VertexInputState;
+	VkPipelineInputAssemblyStateCreateInfo InputAssemblyState;
+	VkViewport							   Viewport;
+	VkRect2D							   Scissor;
+	VkPipelineViewportStateCreateInfo	   ViewportState;
+	VkPipelineRasterizationStateCreateInfo RasterizationState;
+	VkSampleMask						   SampleMask;
+	VkPipelineMultisampleStateCreateInfo   MultisampleState;
+	VkPipelineDepthStencilStateCreateInfo  DepthStencilState;
+	VkPipelineColorBlendAttachmentState	   ColorBlendAttachments[2];
+	VkPipelineColorBlendStateCreateInfo	   ColorBlendState;
+	VkDynamicState						   DynamicStates[2];
+	VkPipelineDynamicStateCreateInfo	   DynamicState;
+	VkGraphicsPipelineCreateInfo		   GraphicsPipelineInfo;
+};
+
+//Pipelines with the same variant are equal
+static void InitSyntheticPipeline(SyntheticPipeline& pipeline, uint32_t variant)
+{
+	memset(&pipeline, 0, sizeof(SyntheticPipeline));
+
+	for(uint32_t i = 0; i < 4; i++)
+	{
+		pipeline.SpecializationData[i]					 = variant * 4 + i;
+		pipeline.SpecializationMapEntries[i].constantID = i;
+		pipeline.SpecializationMapEntries[i].offset	 = i * sizeof(uint32_t);
+		pipeline.SpecializationMapEntries[i].size		 = sizeof(uint32_t);
+
+		pipeline.VertexAttributes[i].location = i;
+		pipeline.VertexAttributes[i].binding  = i & 1;
+		pipeline.VertexAttributes[i].offset	  = (i >> 1) * 16;
+	}
+
+	pipeline.SpecializationInfo.mapEntryCount = 4;
+	pipeline.SpecializationInfo.pMapEntries	  = pipeline.SpecializationMapEntries;
+	pipeline.SpecializationInfo.dataSize	  = sizeof(pipeline.SpecializationData);
+	pipeline.SpecializationInfo.pData		  = pipeline.SpecializationData;
+
+	for(uint32_t i = 0; i < 2; i++)
+	{
+		pipeline.ShaderStages[i].sType				 = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		pipeline.ShaderStages[i].stage				 = (i == 0) ? VK_SHADER_STAGE_VERTEX_BIT : VK_SHADER_STAGE_FRAGMENT_BIT;
+		pipeline.ShaderStages[i].pName				 = "main";
+		pipeline.ShaderStages[i].pSpecializationInfo = &pipeline.SpecializationInfo;
+
+		pipeline.VertexBindings[i].binding = i;
+		pipeline.VertexBindings[i].stride  = 32;
+
+		pipeline.ColorBlendAttachments[i].blendEnable	 = (variant >> i) & 1;
+		pipeline.ColorBlendAttachments[i].colorWriteMask = 0xF;
+	}
+
+	pipeline.VertexInputState.sType							  = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	pipeline.VertexInputState.vertexBindingDescriptionCount	  = 2;
+	pipeline.VertexInputState.pVertexBindingDescriptions	  = pipeline.VertexBindings;
+	pipeline.VertexInputState.vertexAttributeDescriptionCount = 4;
+	pipeline.VertexInputState.pVertexAttributeDescriptions	  = pipeline.VertexAttributes;
+
+	pipeline.InputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+
+	pipeline.Viewport.width		= 1920.0f;
+	pipeline.Viewport.height	= 1080.0f;
+	pipeline.Viewport.maxDepth	= 1.0f;
+	pipeline.Scissor.extent		= {1920, 1080};
+
+	pipeline.ViewportState.sType		 = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	pipeline.ViewportState.viewportCount = 1;
+	pipeline.ViewportState.pViewports	 = &pipeline.Viewport;
+	pipeline.ViewportState.scissorCount	 = 1;
+	pipeline.ViewportState.pScissors	 = &pipeline.Scissor;
+
+	pipeline.RasterizationState.sType	  = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	pipeline.RasterizationState.cullMode  = (variant >> 2) & 3;
+	pipeline.RasterizationState.lineWidth = 1.0f;
+
+	pipeline.SampleMask = 0xFFFFFFFF;
+
+	pipeline.MultisampleState.sType				   = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	pipeline.MultisampleState.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+	pipeline.MultisampleState.pSampleMask		   = &pipeline.SampleMask;
+
+	pipeline.DepthStencilState.sType			= VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+	pipeline.DepthStencilState.depthTestEnable	= VK_TRUE;
+	pipeline.DepthStencilState.depthWriteEnable = (variant >> 4) & 1;
+
+	pipeline.ColorBlendState.sType			 = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	pipeline.ColorBlendState.attachmentCount = 2;
+	pipeline.ColorBlendState.pAttachments	 = pipeline.ColorBlendAttachments;
+
+	pipeline.DynamicStates[0] = VK_DYNAMIC_STATE_VIEWPORT;
+	pipeline.DynamicStates[1] = VK_DYNAMIC_STATE_SCISSOR;
+
+	pipeline.DynamicState.sType				= VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	pipeline.DynamicState.dynamicStateCount = 2;
+	pipeline.DynamicState.pDynamicStates	= pipeline.DynamicStates;
+
+	pipeline.GraphicsPipelineInfo.sType				  = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	pipeline.GraphicsPipelineInfo.stageCount		  = 2;
+	pipeline.GraphicsPipelineInfo.pStages			  = pipeline.ShaderStages;
+	pipeline.GraphicsPipelineInfo.pVertexInputState	  = &pipeline.VertexInputState;
+	pipeline.GraphicsPipelineInfo.pInputAssemblyState = &pipeline.InputAssemblyState;
+	pipeline.GraphicsPipelineInfo.pViewportState	  = &pipeline.ViewportState;
+	pipeline.GraphicsPipelineInfo.pRasterizationState = &pipeline.RasterizationState;
+	pipeline.GraphicsPipelineInfo.pMultisampleState	  = &pipeline.MultisampleState;
+	pipeline.GraphicsPipelineInfo.pDepthStencilState  = &pipeline.DepthStencilState;
+	pipeline.GraphicsPipelineInfo.pColorBlendState	  = &pipeline.ColorBlendState;
+	pipeline.GraphicsPipelineInfo.pDynamicState		  = &pipeline.DynamicState;
+}
+
+GenericStructureBenchmarksH::GenericStructureBenchmarksH()
+{
+}
+
+GenericStructureBenchmarksH::~GenericStructureBenchmarksH()
+{
+}
+
+void GenericStructureBenchmarksH::DoBenchmarks()
+{
+	BenchmarkChainTemplate();
+	BenchmarkStructureTreeKey();
+	BenchmarkFilterByEnabled();
+	BenchmarkValidateChain();
+	BenchmarkPNextEditor();
+}
+
+void GenericStructureBenchmarksH::BenchmarkChainTemplate()
+{
+	VkPhysicalDeviceVulkan11Features vulkan11Features = {};
+	vulkan11Features.multiview = true;
+
+	VkPhysicalDeviceImagelessFramebufferFeatures imagelessFramebufferFeatures = {};
+	imagelessFramebufferFeatures.imagelessFramebuffer = true;
+
+	VkPhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures = {};
+
+	volatile uint32_t checksum = 0;
+
+	//Rebuilding the chain every time
+	double blobTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			meshShaderFeatures.taskShader = i & 1;
+
+			vgs::StructureChainBlob<VkPhysicalDeviceFeatures2> physicalDeviceFeatures2Chain;
+			physicalDeviceFeatures2Chain.AppendToChain(vulkan11Features);
+			physicalDeviceFeatures2Chain.AppendToChain(imagelessFramebufferFeatures);
+			physicalDeviceFeatures2Chain.AppendToChain(meshShaderFeatures);
+
+			checksum = checksum + physicalDeviceFeatures2Chain.GetChainLinkDataAs<VkPhysicalDeviceMeshShaderFeaturesNV>().taskShader;
+		}
+	});
+
+	//Instantiating the template into one big preallocated buffer
+	vgs::ChainTemplate<VkPhysicalDeviceFeatures2> physicalDeviceFeatures2Template;
+	physicalDeviceFeatures2Template.AppendToChain(vulkan11Features);
+	physicalDeviceFeatures2Template.AppendToChain(imagelessFramebufferFeatures);
+
+	vgs::ChainSlot<VkPhysicalDeviceMeshShaderFeaturesNV> meshShaderFeaturesSlot = physicalDeviceFeatures2Template.AppendToChain(meshShaderFeatures);
+
+	size_t instanceStride = (physicalDeviceFeatures2Template.GetInstanceSize() + vgs::ChainLinkDataAlignment - 1) & ~(vgs::ChainLinkDataAlignment - 1);
+	std::vector<uint64_t> instanceMemory(BenchmarkChainCount * instanceStride / sizeof(uint64_t));
+
+	double templateTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::ChainInstance<VkPhysicalDeviceFeatures2> instance = physicalDeviceFeatures2Template.Instantiate((std::byte*)instanceMemory.data() + i * instanceStride);
+			instance.GetSlotData(meshShaderFeaturesSlot).taskShader = i & 1;
+
+			checksum = checksum + instance.GetSlotData(meshShaderFeaturesSlot).taskShader;
+		}
+	});
+
+	printf("Chain of 4 structures, %u chains:\n", BenchmarkChainCount);
+	printf("\tStructureChainBlob rebuild: %.1f ns per chain\n", blobTime);
+	printf("\tChainTemplate instantiate:  %.1f ns per chain\n", templateTime);
+}
+
+void GenericStructureBenchmarksH::BenchmarkStructureTreeKey()
+{
+	//Every pipeline request is a separate copy of one of the variants, as if built from scratch by the renderer
+	const uint32_t pipelineVariantCount = 32;
+
+	std::vector<SyntheticPipeline> pipelineRequests(BenchmarkChainCount);
+	for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+	{
+		InitSyntheticPipeline(pipelineRequests[i], (i * 7) % pipelineVariantCount);
+	}
+
+	vgs::StructureTreeKeyBuilder keyBuilder;
+
+	volatile uint64_t checksum = 0;
+
+	double compactKeyTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::StructureTreeKey pipelineKey = keyBuilder.MakeKey(&pipelineRequests[i].GraphicsPipelineInfo);
+			checksum = checksum + pipelineKey.Hash[0];
+		}
+	});
+
+	double fullKeyTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::StructureTreeKey pipelineKey = keyBuilder.MakeKey(&pipelineRequests[i].GraphicsPipelineInfo, true);
+			checksum = checksum + pipelineKey.KeyData.size();
+		}
+	});
+
+	std::unordered_set<vgs::StructureTreeKey> uniquePipelineKeys;
+	double dedupeTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			uniquePipelineKeys.insert(keyBuilder.MakeKey(&pipelineRequests[i].GraphicsPipelineInfo));
+		}
+	});
+
+	//Deep copy of every request, for comparison
+	double treeCopyTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::StructureTreeBlob pipelineTree(&pipelineRequests[i].GraphicsPipelineInfo);
+			checksum = checksum + pipelineTree.GetTreeDataSize();
+		}
+	});
+
+	printf("Graphics pipeline with full state, %u requests of %u variants:\n", BenchmarkChainCount, pipelineVariantCount);
+	printf("\tStructureTreeKey (hash only):    %.1f ns per pipeline\n", compactKeyTime);
+	printf("\tStructureTreeKey (with data):    %.1f ns per pipeline\n", fullKeyTime);
+	printf("\tKey + unordered_set dedupe:      %.1f ns per pipeline, %zu unique pipelines\n", dedupeTime, uniquePipelineKeys.size());
+	printf("\tStructureTreeBlob deep copy:     %.1f ns per pipeline\n", treeCopyTime);
+}
+
+void GenericStructureBenchmarksH::BenchmarkFilterByEnabled()
+{
+	//Every feature structure of the header, filtered down to Vulkan 1.1 and every other extension
+	std::vector<const char*> allExtensionNames(vgs::ExtensionNames, vgs::ExtensionNames + vgs::ExtensionCount);
+	vgs::FullFeatureChain fullFeatureChain = vgs::BuildFullFeatureChain(VK_API_VERSION_1_2, (uint32_t)allExtensionNames.size(), allExtensionNames.data());
+
+	vgs::ExtensionBitset enabledExtensions;
+	for(uint32_t extensionIndex = 0; extensionIndex < vgs::ExtensionCount; extensionIndex += 2)
+	{
+		enabledExtensions.Set(extensionIndex);
+	}
+
+	vgs::StructureChainBlob<VkPhysicalDeviceFeatures2> featureChainBlob = vgs::StructureChainBlob<VkPhysicalDeviceFeatures2>::Linearize(&fullFeatureChain.GetChainHeadAs<VkPhysicalDeviceFeatures2>());
+
+	volatile size_t checksum = 0;
+
+	//Copying alone, for comparison
+	double copyTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::FullFeatureChain featureChain = fullFeatureChain;
+			checksum = checksum + featureChain.GetLinkCount();
+		}
+	});
+
+	size_t removedCount = 0;
+	double rawFilterTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::FullFeatureChain featureChain = fullFeatureChain;
+			removedCount = vgs::FilterByEnabled(&featureChain.GetChainHeadAs<VkPhysicalDeviceFeatures2>(), VK_API_VERSION_1_1, enabledExtensions);
+			checksum = checksum + removedCount;
+		}
+	});
+
+	double blobFilterTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::StructureChainBlob<VkPhysicalDeviceFeatures2> featureChain = featureChainBlob;
+			checksum = checksum + vgs::FilterByEnabled(featureChain, VK_API_VERSION_1_1, enabledExtensions);
+		}
+	});
+
+	printf("Full feature chain of %u structures, %zu filtered out, %u chains:\n", fullFeatureChain.GetLinkCount(), removedCount, BenchmarkChainCount);
+	printf("\tFullFeatureChain copy:                       %.1f ns per chain\n", copyTime);
+	printf("\tFullFeatureChain copy + FilterByEnabled:     %.1f ns per chain\n", rawFilterTime);
+	printf("\tStructureChainBlob copy + FilterByEnabled:   %.1f ns per chain\n", blobFilterTime);
+}
+
+void GenericStructureBenchmarksH::BenchmarkValidateChain()
+{
+	std::vector<const char*> allExtensionNames(vgs::ExtensionNames, vgs::ExtensionNames + vgs::ExtensionCount);
+	vgs::FullFeatureChain fullFeatureChain = vgs::BuildFullFeatureChain(VK_API_VERSION_1_2, (uint32_t)allExtensionNames.size(), allExtensionNames.data());
+
+	const VkPhysicalDeviceFeatures2& physicalDeviceFeatures2 = fullFeatureChain.GetChainHeadAs<VkPhysicalDeviceFeatures2>();
+
+	volatile uint32_t checksum = 0;
+
+	double validateTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::ChainValidationReport report = vgs::ValidateChain(&physicalDeviceFeatures2);
+			checksum = checksum + report.IssueCount;
+		}
+	});
+
+	printf("Full feature chain of %u structures, %u chains:\n", fullFeatureChain.GetLinkCount(), BenchmarkChainCount);
+	printf("\tValidateChain: %.1f ns per chain, %.1f ns per link\n", validateTime, validateTime / fullFeatureChain.GetLinkCount());
+}
+
+void GenericStructureBenchmarksH::BenchmarkPNextEditor()
+{
+	//A layer intercepting vkCreateDevice and removing the second structure of the application's feature chain
+	std::vector<const char*> allExtensionNames(vgs::ExtensionNames, vgs::ExtensionNames + vgs::ExtensionCount);
+	vgs::FullFeatureChain fullFeatureChain = vgs::BuildFullFeatureChain(VK_API_VERSION_1_2, (uint32_t)allExtensionNames.size(), allExtensionNames.data());
+
+	const VkPhysicalDeviceFeatures2& physicalDeviceFeatures2 = fullFeatureChain.GetChainHeadAs<VkPhysicalDeviceFeatures2>();
+
+	const VkBaseInStructure* firstLink = (const VkBaseInStructure*)physicalDeviceFeatures2.pNext;
+	if(firstLink == nullptr || firstLink->pNext == nullptr)
+	{
+		return;
+	}
+
+	VkStructureType removedSType = firstLink->pNext->sType;
+
+	volatile size_t checksum = 0;
+
+	double editorTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::PNextEditor chainEditor(&physicalDeviceFeatures2);
+			checksum = checksum + chainEditor.RemoveGeneric(removedSType);
+		}
+	});
+
+	//Copying the whole chain, for comparison
+	double linearizeTime = MeasureNanosecondsPerChain([&]()
+	{
+		for(uint32_t i = 0; i < BenchmarkChainCount; i++)
+		{
+			vgs::StructureChainBlob<VkPhysicalDeviceFeatures2> chainCopy = vgs::StructureChainBlob<VkPhysicalDeviceFeatures2>::Linearize(&physicalDeviceFeatures2);
+			checksum = checksum + chainCopy.GetChainHead().sType;
+		}
+	});
+
+	printf("Removing the second structure of a feature chain of %u structures, %u chains:\n", fullFeatureChain.GetLinkCount(), BenchmarkChainCount);
+	printf("\tPNextEditor remove:         %.1f ns per chain\n", editorTime);
+	printf("\tLinearize whole chain copy: %.1f ns per chain\n", linearizeTime);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+class GenericStructureBenchmarksH
+{
+public:
+	GenericStructureBenchmarksH();
+	~GenericStructureBenchmarksH();
+
+public:
+	void DoBenchmarks();
+
+private:
+	void BenchmarkChainTemplate();
+	void BenchmarkStructureTreeKey();
+	void BenchmarkFilterByEnabled();
+	void BenchmarkValidateChain();
+	void BenchmarkPNextEditor();
+};
\ No newline at end of file
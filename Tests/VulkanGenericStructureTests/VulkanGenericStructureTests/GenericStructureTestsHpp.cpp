@@ -1,9 +1,12 @@
 #include "GenericStructureTestsHpp.hpp"
 #include <vulkan/vulkan.hpp>
 #include <vector>
+#include <unordered_set>
+#include <thread>
 
 #define vgs vgs_hpp
 #include "..\..\..\Include\VulkanGenericStructures.hpp"
+#include "..\..\..\Include\VulkanGenericStructuresReflection.hpp"
 
 GenericStructureTestsHpp::GenericStructureTestsHpp()
 {
@@ -19,6 +22,31 @@ void GenericStructureTestsHpp::DoTests()
 	TestStructureBlob();
 	TestGenericStructureChain();
 	TestStructureChainBlob();
+	TestStructureChainDuplicates();
+	TestStructureChainBlobEditing();
+	TestGenericStructureChainEnableMask();
+	TestStructureChainBlobEmplace();
+	TestAnyStructureChainBlob();
+	TestStructureChainBlobLinearize();
+	TestStructureChainBlobCopy();
+	TestStructureChainBuilder();
+	TestChainTemplate();
+	TestStructureHashing();
+	TestChainInternTable();
+	TestStructureTreeBlob();
+	TestStructureTreeKey();
+	TestSerializeStructures();
+	TestDeviceChainCache();
+	TestFullFeatureChain();
+	TestFeatureBitset();
+	TestQueryChainArray();
+	TestFeatureProfile();
+	TestStructureReflection();
+	TestStructureVisit();
+	TestExtensionStructureTable();
+	TestFilterByEnabled();
+	TestValidateChain();
+	TestPNextEditor();
 }
 
 void GenericStructureTestsHpp::TestGenericStructure()
@@ -333,4 +361,1969 @@ void GenericStructureTestsHpp::TestStructureChainBlob()
 	assert(testMeshShaderFeatures.meshShader);
 	assert(testMeshShaderFeatures.taskShader);
 	assert(testDeviceGeneratedCommandsFeatures.deviceGeneratedCommands);
+}
+
+void GenericStructureTestsHpp::TestStructureChainDuplicates()
+{
+	//Duplicate structures should all be kept in the chain
+	vk::WriteDescriptorSetInlineUniformBlockEXT inlineUniformBlockWrite1;
+	vk::WriteDescriptorSetInlineUniformBlockEXT inlineUniformBlockWrite2;
+	vk::WriteDescriptorSetInlineUniformBlockEXT inlineUniformBlockWrite3;
+
+	inlineUniformBlockWrite1.dataSize = 4;
+	inlineUniformBlockWrite2.dataSize = 8;
+	inlineUniformBlockWrite3.dataSize = 16;
+
+	inlineUniformBlockWrite1.pNext = nullptr;
+	inlineUniformBlockWrite2.pNext = nullptr;
+	inlineUniformBlockWrite3.pNext = nullptr;
+
+	vgs::GenericStructureChain<vk::WriteDescriptorSet> writeDescriptorSetChain;
+	writeDescriptorSetChain.AppendToChain(inlineUniformBlockWrite1);
+	writeDescriptorSetChain.AppendToChain(inlineUniformBlockWrite2);
+	writeDescriptorSetChain.AppendToChain(inlineUniformBlockWrite3);
+
+	assert(writeDescriptorSetChain.CountOf<vk::WriteDescriptorSet>()                      == 1);
+	assert(writeDescriptorSetChain.CountOf<vk::WriteDescriptorSetInlineUniformBlockEXT>() == 3);
+	assert(writeDescriptorSetChain.CountOf<vk::PhysicalDeviceFeatures2>()                 == 0);
+
+	assert(&writeDescriptorSetChain.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>()  == &inlineUniformBlockWrite1);
+	assert(&writeDescriptorSetChain.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(1) == &inlineUniformBlockWrite2);
+	assert(&writeDescriptorSetChain.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(2) == &inlineUniformBlockWrite3);
+
+	assert(writeDescriptorSetChain.GetChainHead().pNext == &inlineUniformBlockWrite1);
+	assert(inlineUniformBlockWrite1.pNext               == &inlineUniformBlockWrite2);
+	assert(inlineUniformBlockWrite2.pNext               == &inlineUniformBlockWrite3);
+	assert(inlineUniformBlockWrite3.pNext               == nullptr);
+
+	//Same for the owning chain
+	inlineUniformBlockWrite1.pNext = nullptr;
+	inlineUniformBlockWrite2.pNext = nullptr;
+
+	vgs::StructureChainBlob<vk::WriteDescriptorSet> writeDescriptorSetChainBlob;
+	writeDescriptorSetChainBlob.AppendToChain(inlineUniformBlockWrite3);
+	writeDescriptorSetChainBlob.AppendToChain(inlineUniformBlockWrite1);
+	writeDescriptorSetChainBlob.AppendToChain(inlineUniformBlockWrite2);
+
+	vk::WriteDescriptorSetInlineUniformBlockEXT& testInlineUniformBlockWrite1 = writeDescriptorSetChainBlob.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(0);
+	vk::WriteDescriptorSetInlineUniformBlockEXT& testInlineUniformBlockWrite2 = writeDescriptorSetChainBlob.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(1);
+	vk::WriteDescriptorSetInlineUniformBlockEXT& testInlineUniformBlockWrite3 = writeDescriptorSetChainBlob.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(2);
+
+	assert(writeDescriptorSetChainBlob.CountOf<vk::WriteDescriptorSetInlineUniformBlockEXT>() == 3);
+
+	assert(testInlineUniformBlockWrite1.dataSize == 16);
+	assert(testInlineUniformBlockWrite2.dataSize == 4);
+	assert(testInlineUniformBlockWrite3.dataSize == 8);
+
+	assert(writeDescriptorSetChainBlob.GetChainHead().pNext == &testInlineUniformBlockWrite1);
+	assert(testInlineUniformBlockWrite1.pNext               == &testInlineUniformBlockWrite2);
+	assert(testInlineUniformBlockWrite2.pNext               == &testInlineUniformBlockWrite3);
+	assert(testInlineUniformBlockWrite3.pNext               == nullptr);
+
+	//The removed link should be reused in place, the remaining occurrences keep their order
+	writeDescriptorSetChainBlob.Remove<vk::WriteDescriptorSetInlineUniformBlockEXT>(0);
+	writeDescriptorSetChainBlob.AppendToChain(inlineUniformBlockWrite3);
+
+	assert(writeDescriptorSetChainBlob.CountOf<vk::WriteDescriptorSetInlineUniformBlockEXT>() == 3);
+	assert(&writeDescriptorSetChainBlob.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(0) == &testInlineUniformBlockWrite2);
+	assert(&writeDescriptorSetChainBlob.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(1) == &testInlineUniformBlockWrite3);
+	assert(&writeDescriptorSetChainBlob.GetChainLinkDataAs<vk::WriteDescriptorSetInlineUniformBlockEXT>(2) == &testInlineUniformBlockWrite1);
+	assert(testInlineUniformBlockWrite1.dataSize == 16);
+	assert(testInlineUniformBlockWrite3.pNext    == &testInlineUniformBlockWrite1);
+}
+
+void GenericStructureTestsHpp::TestStructureChainBlobEditing()
+{
+	vk::PhysicalDeviceVulkan11Features             vulkan11Features;
+	vk::PhysicalDeviceImagelessFramebufferFeatures imagelessFramebufferFeatures;
+	vk::PhysicalDeviceVulkanMemoryModelFeatures    vulkanMemoryModelFeatures;
+	vk::PhysicalDeviceMeshShaderFeaturesNV         meshShaderFeatures;
+
+	vulkan11Features.pNext             = nullptr;
+	imagelessFramebufferFeatures.pNext = nullptr;
+	vulkanMemoryModelFeatures.pNext    = nullptr;
+	meshShaderFeatures.pNext           = nullptr;
+
+	vulkan11Features.multiview = true;
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain;
+	physicalDeviceFeatures2Chain.AppendToChain(vulkan11Features);
+	physicalDeviceFeatures2Chain.AppendToChain(imagelessFramebufferFeatures);
+	physicalDeviceFeatures2Chain.AppendToChain(vulkanMemoryModelFeatures);
+
+	vk::PhysicalDeviceVulkan11Features&             testVulkan11Features             = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>();
+	vk::PhysicalDeviceImagelessFramebufferFeatures& testImagelessFramebufferFeatures = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+	vk::PhysicalDeviceVulkanMemoryModelFeatures&    testVulkanMemoryModelFeatures    = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkanMemoryModelFeatures>();
+
+	//Removal should only relink the neighbours
+	physicalDeviceFeatures2Chain.Remove<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+	assert(physicalDeviceFeatures2Chain.CountOf<vk::PhysicalDeviceImagelessFramebufferFeatures>() == 0);
+	assert(physicalDeviceFeatures2Chain.GetChainHead().pNext == &testVulkan11Features);
+	assert(testVulkan11Features.pNext                        == &testVulkanMemoryModelFeatures);
+	assert(testVulkanMemoryModelFeatures.pNext               == nullptr);
+
+	//Insertion should reuse the storage of the removed structure of the same size
+	physicalDeviceFeatures2Chain.InsertAfter<vk::PhysicalDeviceVulkan11Features>(meshShaderFeatures);
+
+	vk::PhysicalDeviceMeshShaderFeaturesNV& testMeshShaderFeatures = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+	assert(reinterpret_cast<std::byte*>(&testMeshShaderFeatures) == reinterpret_cast<std::byte*>(&testImagelessFramebufferFeatures));
+	assert(testMeshShaderFeatures.sType                          == vk::StructureType::ePhysicalDeviceMeshShaderFeaturesNV);
+	assert(testVulkan11Features.pNext                            == &testMeshShaderFeatures);
+	assert(testMeshShaderFeatures.pNext                          == &testVulkanMemoryModelFeatures);
+
+	//Upsert should replace the contents in place and keep the chain intact
+	vulkan11Features.multiview = false;
+	physicalDeviceFeatures2Chain.Upsert(vulkan11Features);
+
+	assert(&physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>() == &testVulkan11Features);
+	assert(testVulkan11Features.multiview == false);
+	assert(testVulkan11Features.pNext     == &testMeshShaderFeatures);
+
+	//Upsert of a new structure should append it
+	physicalDeviceFeatures2Chain.Upsert(imagelessFramebufferFeatures);
+	assert(physicalDeviceFeatures2Chain.CountOf<vk::PhysicalDeviceImagelessFramebufferFeatures>() == 1);
+
+	vk::PhysicalDeviceImagelessFramebufferFeatures& testImagelessFramebufferFeatures2 = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+
+	vk::PhysicalDeviceVulkan11Features&          testVulkan11Features2          = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>();
+	vk::PhysicalDeviceMeshShaderFeaturesNV&      testMeshShaderFeatures2        = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+	vk::PhysicalDeviceVulkanMemoryModelFeatures& testVulkanMemoryModelFeatures2 = physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkanMemoryModelFeatures>();
+
+	assert(physicalDeviceFeatures2Chain.GetChainHead().pNext == &testVulkan11Features2);
+	assert(testVulkan11Features2.pNext                       == &testMeshShaderFeatures2);
+	assert(testMeshShaderFeatures2.pNext                     == &testVulkanMemoryModelFeatures2);
+	assert(testVulkanMemoryModelFeatures2.pNext              == &testImagelessFramebufferFeatures2);
+	assert(testImagelessFramebufferFeatures2.pNext           == nullptr);
+
+	//Removing the last structure should make the previous one last
+	physicalDeviceFeatures2Chain.Remove<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+	assert(testVulkanMemoryModelFeatures2.pNext == nullptr);
+
+	physicalDeviceFeatures2Chain.AppendToChain(imagelessFramebufferFeatures);
+	assert(testVulkanMemoryModelFeatures2.pNext == &physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>());
+
+	//Clear should leave only the head
+	physicalDeviceFeatures2Chain.Clear();
+	assert(physicalDeviceFeatures2Chain.GetChainHead().pNext == nullptr);
+	assert(physicalDeviceFeatures2Chain.CountOf<vk::PhysicalDeviceVulkan11Features>() == 0);
+}
+
+void GenericStructureTestsHpp::TestGenericStructureChainEnableMask()
+{
+	vk::PhysicalDeviceVulkan11Features             vulkan11Features;
+	vk::PhysicalDeviceImagelessFramebufferFeatures imagelessFramebufferFeatures;
+	vk::PhysicalDeviceVulkanMemoryModelFeatures    vulkanMemoryModelFeatures;
+	vk::PhysicalDeviceMeshShaderFeaturesNV         meshShaderFeatures;
+
+	meshShaderFeatures.pNext = nullptr;
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain;
+	size_t vulkan11FeaturesIndex             = physicalDeviceFeatures2Chain.AppendToChain(vulkan11Features);
+	size_t imagelessFramebufferFeaturesIndex = physicalDeviceFeatures2Chain.AppendToChain(imagelessFramebufferFeatures);
+	size_t vulkanMemoryModelFeaturesIndex    = physicalDeviceFeatures2Chain.AppendToChain(vulkanMemoryModelFeatures);
+	size_t meshShaderFeaturesIndex           = physicalDeviceFeatures2Chain.AppendToChain(meshShaderFeatures);
+
+	assert(vulkan11FeaturesIndex             == 1);
+	assert(imagelessFramebufferFeaturesIndex == 2);
+	assert(vulkanMemoryModelFeaturesIndex    == 3);
+	assert(meshShaderFeaturesIndex           == 4);
+	assert(physicalDeviceFeatures2Chain.GetLinkEnableMask() == 0x1F);
+
+	auto& physicalDeviceFeatures2 = physicalDeviceFeatures2Chain.GetChainHead();
+
+	//Disabling a link should skip it
+	physicalDeviceFeatures2Chain.SetLinkEnabled(imagelessFramebufferFeaturesIndex, false);
+	assert(!physicalDeviceFeatures2Chain.IsLinkEnabled(imagelessFramebufferFeaturesIndex));
+	assert(vulkan11Features.pNext == &vulkanMemoryModelFeatures);
+
+	//Disabled links should still be accessible
+	assert(&physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>() == &imagelessFramebufferFeatures);
+
+	//Disabling the last link should end the chain at the previous enabled one
+	physicalDeviceFeatures2Chain.SetStructureEnabled<vk::PhysicalDeviceMeshShaderFeaturesNV>(false);
+	assert(vulkanMemoryModelFeatures.pNext == nullptr);
+
+	//Re-enabling should put the links back to their places
+	physicalDeviceFeatures2Chain.SetLinkEnabled(imagelessFramebufferFeaturesIndex, true);
+	assert(vulkan11Features.pNext             == &imagelessFramebufferFeatures);
+	assert(imagelessFramebufferFeatures.pNext == &vulkanMemoryModelFeatures);
+
+	//Bulk mask update, head should stay enabled
+	physicalDeviceFeatures2Chain.SetLinkEnableMask(0x14);
+	assert(physicalDeviceFeatures2Chain.GetLinkEnableMask() == 0x15);
+	assert(physicalDeviceFeatures2.pNext      == &imagelessFramebufferFeatures);
+	assert(imagelessFramebufferFeatures.pNext == &meshShaderFeatures);
+	assert(meshShaderFeatures.pNext           == nullptr);
+
+	physicalDeviceFeatures2Chain.SetLinkEnableMask(0x01);
+	assert(physicalDeviceFeatures2.pNext == nullptr);
+
+	physicalDeviceFeatures2Chain.SetLinkEnableMask(0x1F);
+	assert(physicalDeviceFeatures2.pNext      == &vulkan11Features);
+	assert(vulkan11Features.pNext             == &imagelessFramebufferFeatures);
+	assert(imagelessFramebufferFeatures.pNext == &vulkanMemoryModelFeatures);
+	assert(vulkanMemoryModelFeatures.pNext    == &meshShaderFeatures);
+	assert(meshShaderFeatures.pNext           == nullptr);
+
+	//Appending after a disabled link should link to the last enabled one
+	vk::PhysicalDeviceDeviceGeneratedCommandsFeaturesNV deviceGeneratedCommandsFeatures;
+	deviceGeneratedCommandsFeatures.pNext = nullptr;
+
+	physicalDeviceFeatures2Chain.SetLinkEnabled(meshShaderFeaturesIndex, false);
+	physicalDeviceFeatures2Chain.AppendToChain(deviceGeneratedCommandsFeatures);
+	assert(vulkanMemoryModelFeatures.pNext       == &deviceGeneratedCommandsFeatures);
+	assert(deviceGeneratedCommandsFeatures.pNext == nullptr);
+
+	physicalDeviceFeatures2Chain.SetLinkEnabled(meshShaderFeaturesIndex, true);
+	assert(vulkanMemoryModelFeatures.pNext == &meshShaderFeatures);
+	assert(meshShaderFeatures.pNext        == &deviceGeneratedCommandsFeatures);
+}
+
+void GenericStructureTestsHpp::TestStructureChainBlobEmplace()
+{
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain;
+
+	//Emplaced structures should be value-initialized, with sType and pNext set up by the chain
+	vgs::LinkHandle<vk::PhysicalDeviceVulkan11Features> vulkan11Features = physicalDeviceFeatures2Chain.Emplace<vk::PhysicalDeviceVulkan11Features>();
+	assert(vulkan11Features->sType     == vk::StructureType::ePhysicalDeviceVulkan11Features);
+	assert(vulkan11Features->pNext     == nullptr);
+	assert(vulkan11Features->multiview == false);
+
+	vulkan11Features->multiview = true;
+
+	//Constructor arguments should be passed through
+	vgs::LinkHandle<vk::PhysicalDeviceMeshShaderFeaturesNV> meshShaderFeatures = physicalDeviceFeatures2Chain.Emplace<vk::PhysicalDeviceMeshShaderFeaturesNV>(VK_TRUE, VK_FALSE);
+	assert(meshShaderFeatures->sType      == vk::StructureType::ePhysicalDeviceMeshShaderFeaturesNV);
+	assert(meshShaderFeatures->taskShader == VK_TRUE);
+	assert(meshShaderFeatures->meshShader == VK_FALSE);
+
+	//Handles should survive the blob growth
+	vk::PhysicalDeviceVulkanMemoryModelFeatures vulkanMemoryModelFeatures;
+	vulkanMemoryModelFeatures.pNext = nullptr;
+
+	for(int i = 0; i < 64; i++)
+	{
+		physicalDeviceFeatures2Chain.AppendToChain(vulkanMemoryModelFeatures);
+	}
+
+	assert(vulkan11Features->multiview);
+	assert(meshShaderFeatures->taskShader);
+
+	assert(physicalDeviceFeatures2Chain.GetChainHead().pNext == vulkan11Features.Get());
+	assert(vulkan11Features->pNext                           == meshShaderFeatures.Get());
+	assert(meshShaderFeatures->pNext                         == &physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkanMemoryModelFeatures>(0));
+
+	//Handles to already existing links
+	vgs::LinkHandle<vk::PhysicalDeviceVulkanMemoryModelFeatures> lastVulkanMemoryModelFeatures = physicalDeviceFeatures2Chain.GetChainLinkHandle<vk::PhysicalDeviceVulkanMemoryModelFeatures>(63);
+	assert(lastVulkanMemoryModelFeatures->pNext == nullptr);
+
+	physicalDeviceFeatures2Chain.Emplace<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+	assert(lastVulkanMemoryModelFeatures->pNext == &physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>());
+
+	//Handles survive moving the chain, e.g. when a vector of chains grows
+	std::vector<vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>> movedChains;
+	movedChains.push_back(std::move(physicalDeviceFeatures2Chain));
+	for(uint32_t i = 0; i < 16; i++)
+	{
+		movedChains.emplace_back();
+	}
+
+	vulkan11Features->multiview = VK_TRUE;
+	assert(movedChains[0].GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>().multiview == VK_TRUE);
+	assert(lastVulkanMemoryModelFeatures.Get() == &movedChains[0].GetChainLinkDataAs<vk::PhysicalDeviceVulkanMemoryModelFeatures>(63));
+}
+
+void GenericStructureTestsHpp::TestAnyStructureChainBlob()
+{
+	std::vector<vgs::AnyStructureChainBlob> chains;
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain;
+	physicalDeviceFeatures2Chain.Emplace<vk::PhysicalDeviceVulkan11Features>().Get()->multiview = true;
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceProperties2> physicalDeviceProperties2Chain;
+	physicalDeviceProperties2Chain.Emplace<vk::PhysicalDeviceIDProperties>();
+	physicalDeviceProperties2Chain.Emplace<vk::PhysicalDeviceDriverProperties>();
+
+	void* featuresHead   = &physicalDeviceFeatures2Chain.GetChainHead();
+	void* propertiesHead = &physicalDeviceProperties2Chain.GetChainHead();
+
+	//Chains with different heads should be stored together, moving shouldn't invalidate the pNext pointers
+	chains.push_back(std::move(physicalDeviceFeatures2Chain));
+	chains.push_back(std::move(physicalDeviceProperties2Chain));
+
+	assert(chains[0].GetChainHeadSType() == vk::StructureType::ePhysicalDeviceFeatures2);
+	assert(chains[1].GetChainHeadSType() == vk::StructureType::ePhysicalDeviceProperties2);
+
+	assert(chains[0].GetChainHeadData() == featuresHead);
+	assert(chains[1].GetChainHeadData() == propertiesHead);
+
+	vk::PhysicalDeviceFeatures2&   physicalDeviceFeatures2   = chains[0].GetChainHeadAs<vk::PhysicalDeviceFeatures2>();
+	vk::PhysicalDeviceProperties2& physicalDeviceProperties2 = chains[1].GetChainHeadAs<vk::PhysicalDeviceProperties2>();
+
+	assert(physicalDeviceFeatures2.pNext == &chains[0].GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>());
+	assert(chains[0].GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>().multiview);
+
+	assert(physicalDeviceProperties2.pNext                                        == &chains[1].GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>());
+	assert(chains[1].GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>().pNext     == &chains[1].GetChainLinkDataAs<vk::PhysicalDeviceDriverProperties>());
+	assert(chains[1].GetChainLinkDataAs<vk::PhysicalDeviceDriverProperties>().pNext == nullptr);
+
+	//Type-erased chains should be editable the same way as the typed ones
+	chains[1].Remove<vk::PhysicalDeviceIDProperties>();
+	assert(physicalDeviceProperties2.pNext == &chains[1].GetChainLinkDataAs<vk::PhysicalDeviceDriverProperties>());
+
+	//Type-erased chains can also be created from a generic structure
+	vk::PhysicalDeviceFeatures2 physicalDeviceFeatures2Head = {};
+	physicalDeviceFeatures2Head.features.robustBufferAccess = true;
+
+	vgs::GenericStruct genericHead = vgs::TransmuteTypeToSType(physicalDeviceFeatures2Head);
+	chains.emplace_back(genericHead);
+
+	assert(chains[2].GetChainHeadSType() == vk::StructureType::ePhysicalDeviceFeatures2);
+	assert(chains[2].GetChainHeadAs<vk::PhysicalDeviceFeatures2>().features.robustBufferAccess);
+	assert(chains[2].GetChainHeadAs<vk::PhysicalDeviceFeatures2>().pNext == nullptr);
+
+	chains[2].AppendToChain(chains[0].GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>());
+	assert(chains[2].GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>().multiview);
+}
+
+void GenericStructureTestsHpp::TestStructureChainBlobLinearize()
+{
+	//Links scattered across the stack and the heap
+	vk::PhysicalDeviceFeatures2 physicalDeviceFeatures2 = {};
+
+	vk::PhysicalDeviceVulkan11Features* vulkan11Features = new vk::PhysicalDeviceVulkan11Features();
+	vulkan11Features->multiview = true;
+
+	vk::PhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures = {};
+	meshShaderFeatures.taskShader = true;
+
+	physicalDeviceFeatures2.pNext = vulkan11Features;
+	vulkan11Features->pNext       = &meshShaderFeatures;
+	meshShaderFeatures.pNext      = nullptr;
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> linearizedChain = vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>::Linearize(&physicalDeviceFeatures2);
+
+	//The source should be safe to destroy
+	delete vulkan11Features;
+	meshShaderFeatures.taskShader = false;
+
+	assert(linearizedChain.CountOf<vk::PhysicalDeviceVulkan11Features>()     == 1);
+	assert(linearizedChain.CountOf<vk::PhysicalDeviceMeshShaderFeaturesNV>() == 1);
+
+	vk::PhysicalDeviceVulkan11Features&     linearizedVulkan11Features   = linearizedChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>();
+	vk::PhysicalDeviceMeshShaderFeaturesNV& linearizedMeshShaderFeatures = linearizedChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+
+	//Walk order should be kept, all structures should be contiguous
+	assert(linearizedChain.GetChainHead().pNext == &linearizedVulkan11Features);
+	assert(linearizedVulkan11Features.pNext     == &linearizedMeshShaderFeatures);
+	assert(linearizedMeshShaderFeatures.pNext   == nullptr);
+
+	assert(linearizedVulkan11Features.multiview);
+	assert(linearizedMeshShaderFeatures.taskShader);
+
+	assert((std::byte*)(&linearizedVulkan11Features)   >= (std::byte*)(&linearizedChain.GetChainHead()) + sizeof(vk::PhysicalDeviceFeatures2));
+	assert((std::byte*)(&linearizedMeshShaderFeatures) <  (std::byte*)(&linearizedVulkan11Features)     + sizeof(vk::PhysicalDeviceVulkan11Features) + sizeof(void*));
+
+	//Non-owning chains should turn into owning ones, disabled links are skipped
+	vk::PhysicalDeviceImagelessFramebufferFeatures imagelessFramebufferFeatures;
+	imagelessFramebufferFeatures.imagelessFramebuffer = true;
+
+	vk::PhysicalDeviceVulkanMemoryModelFeatures vulkanMemoryModelFeatures;
+	vulkanMemoryModelFeatures.pNext = nullptr;
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> physicalDeviceFeaturesChain;
+	physicalDeviceFeaturesChain.AppendToChain(imagelessFramebufferFeatures);
+	physicalDeviceFeaturesChain.AppendToChain(vulkanMemoryModelFeatures);
+	physicalDeviceFeaturesChain.SetStructureEnabled<vk::PhysicalDeviceVulkanMemoryModelFeatures>(false);
+
+	vgs::AnyStructureChainBlob ownedChain = vgs::AnyStructureChainBlob::Linearize(physicalDeviceFeaturesChain);
+	assert(ownedChain.GetChainHeadSType() == vk::StructureType::ePhysicalDeviceFeatures2);
+
+	assert(ownedChain.CountOf<vk::PhysicalDeviceImagelessFramebufferFeatures>() == 1);
+	assert(ownedChain.CountOf<vk::PhysicalDeviceVulkanMemoryModelFeatures>()    == 0);
+
+	assert(ownedChain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>().imagelessFramebuffer);
+	assert(&ownedChain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>() != &imagelessFramebufferFeatures);
+	assert(ownedChain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>().pNext == nullptr);
+}
+
+void GenericStructureTestsHpp::TestStructureChainBlobCopy()
+{
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain;
+	physicalDeviceFeatures2Chain.Emplace<vk::PhysicalDeviceVulkan11Features>().Get()->multiview = true;
+	physicalDeviceFeatures2Chain.Emplace<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+	physicalDeviceFeatures2Chain.Emplace<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+	physicalDeviceFeatures2Chain.Remove<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+
+	//The copy should only point to its own structures
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> copiedChain = physicalDeviceFeatures2Chain;
+
+	vk::PhysicalDeviceVulkan11Features&     copiedVulkan11Features   = copiedChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>();
+	vk::PhysicalDeviceMeshShaderFeaturesNV& copiedMeshShaderFeatures = copiedChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+
+	assert(&copiedVulkan11Features != &physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>());
+
+	assert(copiedChain.GetChainHead().pNext == &copiedVulkan11Features);
+	assert(copiedVulkan11Features.pNext     == &copiedMeshShaderFeatures);
+	assert(copiedMeshShaderFeatures.pNext   == nullptr);
+	assert(copiedVulkan11Features.multiview);
+
+	//Modifying the original shouldn't touch the copy
+	physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>().multiview = false;
+	physicalDeviceFeatures2Chain.Remove<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+
+	assert(copiedVulkan11Features.multiview);
+	assert(copiedChain.CountOf<vk::PhysicalDeviceMeshShaderFeaturesNV>() == 1);
+
+	//Free slots should be copied too
+	copiedChain.Emplace<vk::PhysicalDeviceImagelessFramebufferFeatures>();
+	assert(copiedMeshShaderFeatures.pNext == &copiedChain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>());
+
+	//Copy assignment, chains as values in containers
+	std::vector<vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>> chains(3);
+	chains[0] = copiedChain;
+	chains[1] = chains[0];
+	chains[2] = physicalDeviceFeatures2Chain;
+
+	std::vector<vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>> copiedChains = chains;
+	for(size_t i = 0; i < copiedChains.size(); i++)
+	{
+		vk::PhysicalDeviceVulkan11Features& vulkan11Features = copiedChains[i].GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>();
+		assert(copiedChains[i].GetChainHead().pNext == &vulkan11Features);
+		assert(vulkan11Features.multiview == (i != 2));
+	}
+
+	vk::PhysicalDeviceMeshShaderFeaturesNV& meshShaderFeatures = copiedChains[1].GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+	assert(copiedChains[1].GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>().pNext == &meshShaderFeatures);
+	assert(meshShaderFeatures.pNext == &copiedChains[1].GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>());
+}
+
+void GenericStructureTestsHpp::TestStructureChainBuilder()
+{
+	vgs::StructureChainBuilder<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Builder;
+	physicalDeviceFeatures2Builder.GetChainHead().features.robustBufferAccess = true;
+
+	vk::PhysicalDeviceVulkan11Features vulkan11Features = {};
+	vulkan11Features.multiview = true;
+
+	vk::PhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures = {};
+	meshShaderFeatures.taskShader = true;
+
+	physicalDeviceFeatures2Builder.AppendToChain(vulkan11Features);
+	physicalDeviceFeatures2Builder.AppendToChain(meshShaderFeatures);
+	physicalDeviceFeatures2Builder.AppendToChain(vulkan11Features);
+
+	vgs::BakedStructureChain bakedChain = physicalDeviceFeatures2Builder.Bake();
+	
+	const vk::PhysicalDeviceFeatures2&            bakedPhysicalDeviceFeatures2 = bakedChain.GetChainHeadAs<vk::PhysicalDeviceFeatures2>();
+	const vk::PhysicalDeviceVulkan11Features&     bakedVulkan11Features        = bakedChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>(0);
+	const vk::PhysicalDeviceMeshShaderFeaturesNV& bakedMeshShaderFeatures      = bakedChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+	const vk::PhysicalDeviceVulkan11Features&     bakedVulkan11Features2       = bakedChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>(1);
+
+	assert(bakedChain.GetChainHeadSType() == vk::StructureType::ePhysicalDeviceFeatures2);
+	assert(bakedPhysicalDeviceFeatures2.features.robustBufferAccess);
+
+	assert(bakedChain.CountOf<vk::PhysicalDeviceVulkan11Features>()     == 2);
+	assert(bakedChain.CountOf<vk::PhysicalDeviceMeshShaderFeaturesNV>() == 1);
+
+	assert(bakedVulkan11Features.sType == vk::StructureType::ePhysicalDeviceVulkan11Features);
+	assert(bakedVulkan11Features.multiview);
+	assert(bakedMeshShaderFeatures.taskShader);
+
+	//Pointers are only set up on baking, the last one is always null
+	assert(bakedPhysicalDeviceFeatures2.pNext == &bakedVulkan11Features);
+	assert(bakedVulkan11Features.pNext        == &bakedMeshShaderFeatures);
+	assert(bakedMeshShaderFeatures.pNext      == &bakedVulkan11Features2);
+	assert(bakedVulkan11Features2.pNext       == nullptr);
+
+	//The baked chain should be exact-size and independent of the builder
+	assert(bakedChain.GetChainDataSize() <= sizeof(vk::PhysicalDeviceFeatures2) + 2 * sizeof(vk::PhysicalDeviceVulkan11Features) + sizeof(vk::PhysicalDeviceMeshShaderFeaturesNV) + 3 * sizeof(uint64_t));
+	assert((const std::byte*)(&bakedVulkan11Features2) + sizeof(vk::PhysicalDeviceVulkan11Features) == (const std::byte*)bakedChain.GetChainHeadData() + bakedChain.GetChainDataSize());
+
+	physicalDeviceFeatures2Builder.Clear();
+	physicalDeviceFeatures2Builder.AppendToChain(meshShaderFeatures);
+
+	assert(bakedChain.CountOf<vk::PhysicalDeviceVulkan11Features>() == 2);
+
+	vgs::BakedStructureChain bakedChain2 = physicalDeviceFeatures2Builder.Bake();
+	assert(bakedChain2.GetChainHeadAs<vk::PhysicalDeviceFeatures2>().pNext == &bakedChain2.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>());
+	assert(bakedChain2.GetChainHeadAs<vk::PhysicalDeviceFeatures2>().features.robustBufferAccess);
+	assert(bakedChain2.CountOf<vk::PhysicalDeviceVulkan11Features>() == 0);
+}
+
+void GenericStructureTestsHpp::TestChainTemplate()
+{
+	vk::PhysicalDeviceVulkan11Features vulkan11Features = {};
+	vulkan11Features.multiview = true;
+
+	vk::PhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures = {};
+
+	vgs::ChainTemplate<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Template;
+	physicalDeviceFeatures2Template.AppendToChain(vulkan11Features);
+
+	vgs::ChainSlot<vk::PhysicalDeviceFeatures2>            headSlot               = physicalDeviceFeatures2Template.GetHeadSlot();
+	vgs::ChainSlot<vk::PhysicalDeviceMeshShaderFeaturesNV> meshShaderFeaturesSlot = physicalDeviceFeatures2Template.AppendToChain(meshShaderFeatures);
+
+	size_t instanceStride = (physicalDeviceFeatures2Template.GetInstanceSize() + vgs::ChainLinkDataAlignment - 1) & ~(vgs::ChainLinkDataAlignment - 1);
+	std::vector<uint64_t> instanceMemory(4 * instanceStride / sizeof(uint64_t));
+
+	//Each instance should be a separate chain with patched slots
+	for(uint32_t i = 0; i < 4; i++)
+	{
+		std::byte* instanceData = (std::byte*)instanceMemory.data() + i * instanceStride;
+
+		vgs::ChainInstance<vk::PhysicalDeviceFeatures2> instance = physicalDeviceFeatures2Template.Instantiate(instanceData);
+		instance.GetSlotData(meshShaderFeaturesSlot).taskShader = (i % 2 == 0);
+		instance.GetSlotData(headSlot).features.robustBufferAccess = (i >= 2);
+	}
+
+	for(uint32_t i = 0; i < 4; i++)
+	{
+		std::byte* instanceData = (std::byte*)instanceMemory.data() + i * instanceStride;
+
+		vk::PhysicalDeviceFeatures2*            physicalDeviceFeatures2    = (vk::PhysicalDeviceFeatures2*)instanceData;
+		vk::PhysicalDeviceVulkan11Features*     instanceVulkan11Features   = (vk::PhysicalDeviceVulkan11Features*)physicalDeviceFeatures2->pNext;
+		vk::PhysicalDeviceMeshShaderFeaturesNV* instanceMeshShaderFeatures = (vk::PhysicalDeviceMeshShaderFeaturesNV*)instanceVulkan11Features->pNext;
+
+		assert(physicalDeviceFeatures2->sType    == vk::StructureType::ePhysicalDeviceFeatures2);
+		assert(instanceVulkan11Features->sType   == vk::StructureType::ePhysicalDeviceVulkan11Features);
+		assert(instanceMeshShaderFeatures->sType == vk::StructureType::ePhysicalDeviceMeshShaderFeaturesNV);
+		assert(instanceMeshShaderFeatures->pNext == nullptr);
+
+		assert((std::byte*)instanceVulkan11Features   >= instanceData && (std::byte*)instanceVulkan11Features   < instanceData + instanceStride);
+		assert((std::byte*)instanceMeshShaderFeatures >= instanceData && (std::byte*)instanceMeshShaderFeatures < instanceData + instanceStride);
+
+		assert(instanceVulkan11Features->multiview);
+		assert(instanceMeshShaderFeatures->taskShader               == (i % 2 == 0));
+		assert(physicalDeviceFeatures2->features.robustBufferAccess == (i >= 2));
+	}
+}
+
+void GenericStructureTestsHpp::TestStructureHashing()
+{
+	vk::PhysicalDeviceVulkan11Features vulkan11Features;
+	vk::PhysicalDeviceVulkan11Features vulkan11Features2;
+
+	vk::PhysicalDeviceVulkan11Features* vulkan11FeaturesPtrs[] = {&vulkan11Features, &vulkan11Features2};
+	for(vk::PhysicalDeviceVulkan11Features* features: vulkan11FeaturesPtrs)
+	{
+		features->storageBuffer16BitAccess           = false;
+		features->uniformAndStorageBuffer16BitAccess = false;
+		features->storagePushConstant16              = false;
+		features->storageInputOutput16               = false;
+		features->multiview                          = true;
+		features->multiviewGeometryShader            = false;
+		features->multiviewTessellationShader        = false;
+		features->variablePointersStorageBuffer      = false;
+		features->variablePointers                   = false;
+		features->protectedMemory                    = false;
+		features->samplerYcbcrConversion             = false;
+		features->shaderDrawParameters               = false;
+	}
+
+	//The member ranges are needed to mask the padding
+	size_t memberRangeCount = 0;
+	assert(vgs::GetSTypeMemberRanges(vk::StructureType::ePhysicalDeviceVulkan11Features, &memberRangeCount) != nullptr);
+	assert(memberRangeCount != 0);
+
+	//pNext and padding should be ignored
+	vgs::StructureBlob vulkan11FeaturesBlob(vulkan11Features);
+	vgs::StructureBlob vulkan11FeaturesBlob2(vulkan11Features2);
+
+	assert(vulkan11FeaturesBlob        == vulkan11FeaturesBlob2);
+	assert(vulkan11FeaturesBlob.Hash() == vulkan11FeaturesBlob2.Hash());
+	assert(std::hash<vgs::StructureBlob>()(vulkan11FeaturesBlob) == std::hash<vgs::StructureBlob>()(vulkan11FeaturesBlob2));
+
+	vgs::GenericStruct genericVulkan11Features = vgs::TransmuteTypeToSType(vulkan11Features);
+	assert(genericVulkan11Features        == vulkan11FeaturesBlob);
+	assert(genericVulkan11Features.Hash() == vulkan11FeaturesBlob.Hash());
+
+	vulkan11Features.multiview = false;
+	assert(genericVulkan11Features != vulkan11FeaturesBlob);
+
+	//Chains should be equal regardless of the link order
+	vk::PhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures = {};
+	meshShaderFeatures.taskShader = true;
+
+	vk::PhysicalDeviceImagelessFramebufferFeatures imagelessFramebufferFeatures = {};
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain;
+	physicalDeviceFeatures2Chain.AppendToChain(vulkan11Features2);
+	physicalDeviceFeatures2Chain.AppendToChain(meshShaderFeatures);
+	physicalDeviceFeatures2Chain.AppendToChain(imagelessFramebufferFeatures);
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain2;
+	physicalDeviceFeatures2Chain2.AppendToChain(imagelessFramebufferFeatures);
+	physicalDeviceFeatures2Chain2.AppendToChain(vulkan11Features2);
+	physicalDeviceFeatures2Chain2.AppendToChain(meshShaderFeatures);
+
+	assert(physicalDeviceFeatures2Chain        == physicalDeviceFeatures2Chain2);
+	assert(physicalDeviceFeatures2Chain.Hash() == physicalDeviceFeatures2Chain2.Hash());
+
+	//Non-owning chains should compare the same way
+	vulkan11Features2.pNext = nullptr;
+
+	vk::PhysicalDeviceFeatures2 physicalDeviceFeatures2 = {};
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2View(physicalDeviceFeatures2);
+	physicalDeviceFeatures2View.AppendToChain(meshShaderFeatures);
+	physicalDeviceFeatures2View.AppendToChain(imagelessFramebufferFeatures);
+	physicalDeviceFeatures2View.AppendToChain(vulkan11Features2);
+
+	assert(physicalDeviceFeatures2View        == physicalDeviceFeatures2Chain);
+	assert(physicalDeviceFeatures2View.Hash() == physicalDeviceFeatures2Chain.Hash());
+
+	//Any difference in the contents or the link count should matter
+	physicalDeviceFeatures2Chain2.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>().meshShader = true;
+	assert(physicalDeviceFeatures2Chain        != physicalDeviceFeatures2Chain2);
+	assert(physicalDeviceFeatures2Chain.Hash() != physicalDeviceFeatures2Chain2.Hash());
+
+	physicalDeviceFeatures2Chain2.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>().meshShader = false;
+	physicalDeviceFeatures2Chain2.AppendToChain(physicalDeviceFeatures2Chain.GetChainLinkDataAs<vk::PhysicalDeviceImagelessFramebufferFeatures>());
+	assert(physicalDeviceFeatures2Chain != physicalDeviceFeatures2Chain2);
+
+	physicalDeviceFeatures2Chain2.Remove<vk::PhysicalDeviceImagelessFramebufferFeatures>(1);
+	assert(physicalDeviceFeatures2Chain == physicalDeviceFeatures2Chain2);
+
+	//Chains as keys
+	std::unordered_set<vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>> chainSet;
+	chainSet.insert(physicalDeviceFeatures2Chain);
+	chainSet.insert(physicalDeviceFeatures2Chain2);
+	assert(chainSet.size() == 1);
+}
+
+void GenericStructureTestsHpp::TestChainInternTable()
+{
+	vgs::ChainInternTable internTable;
+
+	vk::SamplerReductionModeCreateInfo samplerReductionModeCreateInfo = {};
+	samplerReductionModeCreateInfo.reductionMode = vk::SamplerReductionMode::eMin;
+
+	vgs::StructureChainBlob<vk::SamplerCreateInfo> samplerCreateInfoChain;
+	samplerCreateInfoChain.GetChainHead().maxAnisotropy = 16.0f;
+	samplerCreateInfoChain.AppendToChain(samplerReductionModeCreateInfo);
+
+	std::shared_ptr<const vgs::AnyStructureChainBlob> internedChain = internTable.Intern(samplerCreateInfoChain);
+	assert(*internedChain == samplerCreateInfoChain);
+	assert(internedChain->GetChainHeadData() != samplerCreateInfoChain.GetChainHeadData());
+
+	//Equal chains from many threads should give the same pointer
+	std::vector<std::shared_ptr<const vgs::AnyStructureChainBlob>> threadChains(8);
+	std::vector<std::thread>                                       threads;
+	for(size_t i = 0; i < threadChains.size(); i++)
+	{
+		threads.emplace_back([&internTable, &threadChains, &samplerReductionModeCreateInfo, i]()
+		{
+			for(int j = 0; j < 100; j++)
+			{
+				vgs::StructureChainBlob<vk::SamplerCreateInfo> threadSamplerCreateInfoChain;
+				threadSamplerCreateInfoChain.GetChainHead().maxAnisotropy = 16.0f;
+				threadSamplerCreateInfoChain.AppendToChain(samplerReductionModeCreateInfo);
+
+				threadChains[i] = internTable.Intern(threadSamplerCreateInfoChain);
+
+				//Different chains
+				threadSamplerCreateInfoChain.GetChainHead().mipLodBias = (float)j;
+				internTable.Intern(threadSamplerCreateInfoChain);
+			}
+		});
+	}
+
+	for(std::thread& thread: threads)
+	{
+		thread.join();
+	}
+
+	for(size_t i = 0; i < threadChains.size(); i++)
+	{
+		assert(threadChains[i] == internedChain);
+	}
+
+	assert(internTable.GetChainCount() == 100);
+
+	//Unreferenced chains should be purged, referenced should stay
+	threadChains.clear();
+	assert(internTable.Purge()         == 99);
+	assert(internTable.GetChainCount() == 1);
+
+	assert(internTable.Intern(samplerCreateInfoChain) == internedChain);
+
+	//Links with unknown sType are not copied, so they shouldn't stop the chain from matching
+	vk::SamplerCreateInfo samplerCreateInfo = samplerCreateInfoChain.GetChainHead();
+	vk::BaseOutStructure  unknownStructure;
+	unknownStructure.sType  = (vk::StructureType)VK_STRUCTURE_TYPE_MAX_ENUM;
+	unknownStructure.pNext  = (vk::BaseOutStructure*)&samplerReductionModeCreateInfo;
+	samplerCreateInfo.pNext = &unknownStructure;
+
+	for(int i = 0; i < 4; i++)
+	{
+		assert(internTable.Intern(&samplerCreateInfo) == internedChain);
+	}
+
+	assert(internTable.GetChainCount() == 1);
+}
+
+void GenericStructureTestsHpp::TestStructureTreeBlob()
+{
+	//Without the generated pointer layouts the tree would be a shallow copy
+	assert(vgs::GetSTypePointerLayout(vk::StructureType::eDeviceCreateInfo) != nullptr);
+
+	vgs::StructureTreeBlob deviceCreateInfoTree;
+
+	{
+		float queuePriorities[] = {1.0f, 0.5f, 0.25f};
+
+		char swapchainExtensionName[]   = "VK_KHR_swapchain";
+		char maintenanceExtensionName[] = "VK_KHR_maintenance1";
+
+		const char* extensionNames[] = {swapchainExtensionName, maintenanceExtensionName};
+
+		vk::DeviceQueueCreateInfo queueCreateInfos[2];
+		queueCreateInfos[0].queueFamilyIndex = 0;
+		queueCreateInfos[0].queueCount       = 2;
+		queueCreateInfos[0].pQueuePriorities = queuePriorities;
+		queueCreateInfos[1].queueFamilyIndex = 1;
+		queueCreateInfos[1].queueCount       = 1;
+		queueCreateInfos[1].pQueuePriorities = queuePriorities + 2;
+
+		vk::PhysicalDeviceVulkan11Features vulkan11Features = {};
+		vulkan11Features.multiview = true;
+
+		vk::PhysicalDeviceFeatures2 physicalDeviceFeatures2 = {};
+		physicalDeviceFeatures2.pNext                      = &vulkan11Features;
+		physicalDeviceFeatures2.features.samplerAnisotropy = true;
+
+		vk::DeviceCreateInfo deviceCreateInfo = {};
+		deviceCreateInfo.pNext                   = &physicalDeviceFeatures2;
+		deviceCreateInfo.queueCreateInfoCount    = 2;
+		deviceCreateInfo.pQueueCreateInfos       = queueCreateInfos;
+		deviceCreateInfo.enabledExtensionCount   = 2;
+		deviceCreateInfo.ppEnabledExtensionNames = extensionNames;
+
+		deviceCreateInfoTree = vgs::StructureTreeBlob(&deviceCreateInfo);
+
+		//The tree shouldn't reference the source structures in any way
+		queuePriorities[0]                   = 0.0f;
+		swapchainExtensionName[0]            = 'X';
+		vulkan11Features.multiview           = false;
+		queueCreateInfos[1].pQueuePriorities = nullptr;
+	}
+
+	const vk::DeviceCreateInfo& treeDeviceCreateInfo = deviceCreateInfoTree.GetTreeHeadAs<vk::DeviceCreateInfo>();
+
+	const std::byte* treeBegin = (const std::byte*)deviceCreateInfoTree.GetTreeHeadData();
+	const std::byte* treeEnd   = treeBegin + deviceCreateInfoTree.GetTreeDataSize();
+
+	assert((const std::byte*)treeDeviceCreateInfo.pQueueCreateInfos >= treeBegin && (const std::byte*)treeDeviceCreateInfo.pQueueCreateInfos < treeEnd);
+	assert((const std::byte*)treeDeviceCreateInfo.ppEnabledExtensionNames >= treeBegin && (const std::byte*)treeDeviceCreateInfo.ppEnabledExtensionNames < treeEnd);
+	assert(treeDeviceCreateInfo.ppEnabledLayerNames == nullptr);
+	assert(treeDeviceCreateInfo.pEnabledFeatures    == nullptr);
+
+	assert(treeDeviceCreateInfo.queueCreateInfoCount                     == 2);
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[0].sType               == vk::StructureType::eDeviceQueueCreateInfo);
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[0].queueCount          == 2);
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[0].pQueuePriorities[0] == 1.0f);
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[0].pQueuePriorities[1] == 0.5f);
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[1].queueFamilyIndex    == 1);
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[1].pQueuePriorities[0] == 0.25f);
+
+	assert(strcmp(treeDeviceCreateInfo.ppEnabledExtensionNames[0], "VK_KHR_swapchain") == 0);
+	assert(strcmp(treeDeviceCreateInfo.ppEnabledExtensionNames[1], "VK_KHR_maintenance1") == 0);
+
+	//The pNext chain is copied too
+	const vk::PhysicalDeviceFeatures2* treePhysicalDeviceFeatures2 = (const vk::PhysicalDeviceFeatures2*)treeDeviceCreateInfo.pNext;
+	const vk::PhysicalDeviceVulkan11Features* treeVulkan11Features = (const vk::PhysicalDeviceVulkan11Features*)treePhysicalDeviceFeatures2->pNext;
+
+	assert((const std::byte*)treePhysicalDeviceFeatures2 >= treeBegin && (const std::byte*)treePhysicalDeviceFeatures2 < treeEnd);
+	assert(treePhysicalDeviceFeatures2->sType == vk::StructureType::ePhysicalDeviceFeatures2);
+	assert(treePhysicalDeviceFeatures2->features.samplerAnisotropy);
+	assert(treeVulkan11Features->sType == vk::StructureType::ePhysicalDeviceVulkan11Features);
+	assert(treeVulkan11Features->multiview);
+	assert(treeVulkan11Features->pNext == nullptr);
+
+	//A copy is a separate tree, a move keeps the tree in place
+	vgs::StructureTreeBlob deviceCreateInfoTreeCopy = deviceCreateInfoTree;
+
+	const vk::DeviceCreateInfo& copiedDeviceCreateInfo = deviceCreateInfoTreeCopy.GetTreeHeadAs<vk::DeviceCreateInfo>();
+	assert(copiedDeviceCreateInfo.pQueueCreateInfos != treeDeviceCreateInfo.pQueueCreateInfos);
+	assert(copiedDeviceCreateInfo.pQueueCreateInfos[1].pQueuePriorities[0]               == 0.25f);
+	assert(strcmp(copiedDeviceCreateInfo.ppEnabledExtensionNames[0], "VK_KHR_swapchain") == 0);
+	assert(deviceCreateInfoTreeCopy.GetTreeDataSize()                                    == deviceCreateInfoTree.GetTreeDataSize());
+
+	vgs::StructureTreeBlob movedDeviceCreateInfoTree = std::move(deviceCreateInfoTree);
+	assert(&movedDeviceCreateInfoTree.GetTreeHeadAs<vk::DeviceCreateInfo>() == &treeDeviceCreateInfo);
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[0].pQueuePriorities[0]    == 1.0f);
+}
+
+void GenericStructureTestsHpp::TestStructureTreeKey()
+{
+	//Without the pointer layouts the keys can't see the nested data
+	assert(vgs::GetSTypePointerLayout(vk::StructureType::eGraphicsPipelineCreateInfo) != nullptr);
+
+	//Two equal pipelines in separate memory, the second one has the rasterization pNext chain in reverse order
+	char shaderEntryNames[2][8] = {"main", "main"};
+
+	uint32_t                   specializationData[2]  = {42, 42};
+	vk::SpecializationMapEntry specializationMapEntry = {0, 0, sizeof(uint32_t)};
+	vk::DynamicState           dynamicStates[2][2]    = {{vk::DynamicState::eViewport, vk::DynamicState::eScissor}, {vk::DynamicState::eViewport, vk::DynamicState::eScissor}};
+
+	vk::SpecializationInfo                               specializationInfos[2]   = {};
+	vk::PipelineShaderStageCreateInfo                    shaderStages[2][2]       = {};
+	vk::PipelineRasterizationStateCreateInfo             rasterizationStates[2]   = {};
+	vk::PipelineRasterizationLineStateCreateInfoEXT      lineStates[2]            = {};
+	vk::PipelineRasterizationDepthClipStateCreateInfoEXT depthClipStates[2]       = {};
+	vk::PipelineDynamicStateCreateInfo                   dynamicStateInfos[2]     = {};
+	vk::GraphicsPipelineCreateInfo                       graphicsPipelineInfos[2] = {};
+
+	//Different padding after mapEntryCount, it shouldn't get into the keys
+	memset(&specializationInfos[0], 0xAA, sizeof(vk::SpecializationInfo));
+	memset(&specializationInfos[1], 0x55, sizeof(vk::SpecializationInfo));
+
+	for(int i = 0; i < 2; i++)
+	{
+		specializationInfos[i].mapEntryCount = 1;
+		specializationInfos[i].pMapEntries   = &specializationMapEntry;
+		specializationInfos[i].dataSize      = sizeof(uint32_t);
+		specializationInfos[i].pData         = &specializationData[i];
+
+		for(int j = 0; j < 2; j++)
+		{
+			shaderStages[i][j].stage               = (j == 0) ? vk::ShaderStageFlagBits::eVertex : vk::ShaderStageFlagBits::eFragment;
+			shaderStages[i][j].pName               = shaderEntryNames[i];
+			shaderStages[i][j].pSpecializationInfo = &specializationInfos[i];
+		}
+
+		lineStates[i].stippledLineEnable = true;
+		lineStates[i].lineStippleFactor  = 4;
+
+		depthClipStates[i].depthClipEnable = true;
+
+		rasterizationStates[i].lineWidth = 1.0f;
+
+		dynamicStateInfos[i].dynamicStateCount = 2;
+		dynamicStateInfos[i].pDynamicStates    = dynamicStates[i];
+
+		graphicsPipelineInfos[i].stageCount          = 2;
+		graphicsPipelineInfos[i].pStages             = shaderStages[i];
+		graphicsPipelineInfos[i].pRasterizationState = &rasterizationStates[i];
+		graphicsPipelineInfos[i].pDynamicState       = &dynamicStateInfos[i];
+	}
+
+	rasterizationStates[0].pNext = &lineStates[0];
+	lineStates[0].pNext          = &depthClipStates[0];
+	depthClipStates[0].pNext     = nullptr;
+
+	rasterizationStates[1].pNext = &depthClipStates[1];
+	depthClipStates[1].pNext     = &lineStates[1];
+	lineStates[1].pNext          = nullptr;
+
+	vgs::StructureTreeKeyBuilder keyBuilder;
+
+	vgs::StructureTreeKey pipelineKey  = keyBuilder.MakeKey(&graphicsPipelineInfos[0], true);
+	vgs::StructureTreeKey pipelineKey2 = keyBuilder.MakeKey(&graphicsPipelineInfos[1], true);
+	assert(pipelineKey                                     == pipelineKey2);
+	assert(pipelineKey.KeyData                             == pipelineKey2.KeyData);
+	assert(std::hash<vgs::StructureTreeKey>()(pipelineKey) == std::hash<vgs::StructureTreeKey>()(pipelineKey2));
+
+	//Keys without the data are compared by the hash
+	vgs::StructureTreeKey compactPipelineKey = keyBuilder.MakeKey(&graphicsPipelineInfos[1]);
+	assert(compactPipelineKey.KeyData.size() == 0);
+	assert(compactPipelineKey                == pipelineKey);
+
+	//Any change deep in the tree changes the key
+	specializationData[1] = 43;
+	assert(keyBuilder.MakeKey(&graphicsPipelineInfos[1]) != pipelineKey);
+	specializationData[1] = 42;
+
+	shaderEntryNames[1][0] = 'M';
+	assert(keyBuilder.MakeKey(&graphicsPipelineInfos[1]) != pipelineKey);
+	shaderEntryNames[1][0] = 'm';
+
+	lineStates[1].lineStippleFactor = 2;
+	assert(keyBuilder.MakeKey(&graphicsPipelineInfos[1]) != pipelineKey);
+	lineStates[1].lineStippleFactor = 4;
+
+	dynamicStateInfos[1].dynamicStateCount = 1;
+	assert(keyBuilder.MakeKey(&graphicsPipelineInfos[1]) != pipelineKey);
+	dynamicStateInfos[1].dynamicStateCount = 2;
+
+	assert(keyBuilder.MakeKey(&graphicsPipelineInfos[1]) == pipelineKey);
+
+	std::unordered_set<vgs::StructureTreeKey> pipelineKeys;
+	pipelineKeys.insert(pipelineKey);
+	pipelineKeys.insert(compactPipelineKey);
+	assert(pipelineKeys.size() == 1);
+}
+
+void GenericStructureTestsHpp::TestSerializeStructures()
+{
+	vk::PhysicalDeviceFeatures2                 physicalDeviceFeatures2;
+	vk::PhysicalDeviceVulkan11Features          vulkan11Features;
+	vk::PhysicalDeviceVulkanMemoryModelFeatures memoryModelFeatures;
+
+	physicalDeviceFeatures2.features.geometryShader = true;
+	vulkan11Features.multiview                      = true;
+	memoryModelFeatures.vulkanMemoryModel           = true;
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> featuresChain(physicalDeviceFeatures2);
+	featuresChain.AppendToChain(vulkan11Features);
+	featuresChain.AppendToChain(memoryModelFeatures);
+
+	//Round trip of a chain
+	std::vector<std::byte> serializedChain = featuresChain.Serialize();
+
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> deserializedChain;
+	assert(vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>::Deserialize(serializedChain.data(), serializedChain.size(), deserializedChain));
+	assert(deserializedChain == featuresChain);
+
+	assert(deserializedChain.GetChainHead().features.geometryShader                                              == true);
+	assert(deserializedChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan11Features>().multiview                  == true);
+	assert(deserializedChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkanMemoryModelFeatures>().vulkanMemoryModel == true);
+	assert(deserializedChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkanMemoryModelFeatures>().pNext             == nullptr);
+
+	//Wrong head type, broken and truncated data are rejected
+	vgs::StructureChainBlob<vk::DeviceCreateInfo> wrongHeadChain;
+	assert(!vgs::StructureChainBlob<vk::DeviceCreateInfo>::Deserialize(serializedChain.data(), serializedChain.size(), wrongHeadChain));
+	assert(!vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>::Deserialize(serializedChain.data(), serializedChain.size() - 1, deserializedChain));
+
+	std::vector<std::byte> brokenChain = serializedChain;
+	brokenChain[0] = std::byte(0);
+	assert(!vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2>::Deserialize(brokenChain.data(), brokenChain.size(), deserializedChain));
+
+	//Round trip of a single structure
+	vgs::StructureBlob vulkan11FeaturesBlob(vulkan11Features);
+	std::vector<std::byte> serializedBlob = vulkan11FeaturesBlob.Serialize();
+
+	vgs::StructureBlob deserializedBlob;
+	assert(vgs::StructureBlob::Deserialize(serializedBlob.data(), serializedBlob.size(), deserializedBlob));
+	assert(deserializedBlob == vulkan11FeaturesBlob);
+
+	assert(deserializedBlob.GetSType() == vk::StructureType::ePhysicalDeviceVulkan11Features);
+	assert(deserializedBlob.GetPNext() == nullptr);
+
+	//Zero-copy loading relocates the pointers right in the (aligned) data, as it would in a memory-mapped file
+	std::vector<uint64_t> mappedChain((serializedChain.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	memcpy(mappedChain.data(), serializedChain.data(), serializedChain.size());
+
+	const std::byte* mappedBegin = (const std::byte*)mappedChain.data();
+	const std::byte* mappedEnd   = mappedBegin + serializedChain.size();
+
+	const vk::PhysicalDeviceFeatures2* loadedFeatures2 = (const vk::PhysicalDeviceFeatures2*)vgs::LoadSerializedStructures(mappedChain.data(), serializedChain.size());
+	assert(loadedFeatures2 != nullptr);
+	assert((const std::byte*)loadedFeatures2 > mappedBegin && (const std::byte*)loadedFeatures2 < mappedEnd);
+
+	const vk::PhysicalDeviceVulkan11Features* loadedVulkan11Features = (const vk::PhysicalDeviceVulkan11Features*)loadedFeatures2->pNext;
+	const vk::PhysicalDeviceVulkanMemoryModelFeatures* loadedMemoryModelFeatures = (const vk::PhysicalDeviceVulkanMemoryModelFeatures*)loadedVulkan11Features->pNext;
+
+	assert((const std::byte*)loadedMemoryModelFeatures > mappedBegin && (const std::byte*)loadedMemoryModelFeatures < mappedEnd);
+	assert(loadedFeatures2->features.geometryShader     == true);
+	assert(loadedVulkan11Features->sType                == vk::StructureType::ePhysicalDeviceVulkan11Features);
+	assert(loadedMemoryModelFeatures->vulkanMemoryModel == true);
+	assert(loadedMemoryModelFeatures->pNext             == nullptr);
+	assert(vgs::CompareChains(loadedFeatures2, featuresChain.GetChainHeadData()));
+
+	//The data can be loaded only once
+	assert(vgs::LoadSerializedStructures(mappedChain.data(), serializedChain.size()) == nullptr);
+
+	//Broken pointers are found before anything is written, so the broken data is left as is
+	vgs::SerializedStructuresHeader chainHeader;
+	memcpy(&chainHeader, serializedChain.data(), sizeof(vgs::SerializedStructuresHeader));
+
+	size_t    chainDataOffset = vgs::GetSerializedDataOffset(chainHeader);
+	uintptr_t headPNext       = (uintptr_t)vgs::GetSerializedRecord(serializedChain.data(), 1).Offset + 1;
+	uintptr_t middlePNext     = headPNext + sizeof(VkBaseInStructure);
+	uint64_t  lastPNextOffset = chainDataOffset + vgs::GetSerializedRecord(serializedChain.data(), 2).Offset + offsetof(VkBaseInStructure, pNext);
+
+	std::vector<uint64_t> brokenMappedChain(mappedChain.size());
+	memcpy(brokenMappedChain.data(), serializedChain.data(), serializedChain.size());
+	memcpy((std::byte*)brokenMappedChain.data() + chainDataOffset + offsetof(VkBaseInStructure, pNext), &middlePNext, sizeof(uintptr_t));
+
+	std::vector<uint64_t> brokenMappedChainCopy = brokenMappedChain;
+	assert(vgs::LoadSerializedStructures(brokenMappedChain.data(), serializedChain.size()) == nullptr);
+	assert(brokenMappedChain == brokenMappedChainCopy);
+
+	vgs::StructureTreeBlob brokenTree;
+	assert(!vgs::StructureTreeBlob::Deserialize(brokenMappedChain.data(), serializedChain.size(), brokenTree));
+
+	//pNext without a relocation
+	memcpy(brokenMappedChain.data(), serializedChain.data(), serializedChain.size());
+	memcpy((std::byte*)brokenMappedChain.data() + lastPNextOffset, &headPNext, sizeof(uintptr_t));
+
+	brokenMappedChainCopy = brokenMappedChain;
+	assert(vgs::LoadSerializedStructures(brokenMappedChain.data(), serializedChain.size()) == nullptr);
+	assert(brokenMappedChain == brokenMappedChainCopy);
+
+	//Deep serialization follows the generated pointer layouts
+	assert(vgs::GetSTypePointerLayout(vk::StructureType::eDeviceCreateInfo) != nullptr);
+
+	float                   queuePriorities[2] = {1.0f, 0.5f};
+	const char*             extensionNames[2]  = {"VK_KHR_swapchain", "VK_KHR_maintenance1"};
+	vk::DeviceQueueCreateInfo queueCreateInfo;
+	vk::DeviceCreateInfo      deviceCreateInfo;
+
+	queueCreateInfo.queueCount       = 2;
+	queueCreateInfo.pQueuePriorities = queuePriorities;
+
+	deviceCreateInfo.pNext                   = &featuresChain.GetChainHead();
+	deviceCreateInfo.queueCreateInfoCount    = 1;
+	deviceCreateInfo.pQueueCreateInfos       = &queueCreateInfo;
+	deviceCreateInfo.enabledExtensionCount   = 2;
+	deviceCreateInfo.ppEnabledExtensionNames = extensionNames;
+
+	std::vector<std::byte> serializedTree = vgs::SerializeStructures(&deviceCreateInfo, true);
+
+	//Deep data can't be loaded into a chain, which doesn't own the pointed data
+	vgs::AnyStructureChainBlob deviceCreateInfoChain;
+	assert(!vgs::AnyStructureChainBlob::Deserialize(serializedTree.data(), serializedTree.size(), deviceCreateInfoChain));
+
+	vgs::StructureTreeBlob deviceCreateInfoTree;
+	assert(vgs::StructureTreeBlob::Deserialize(serializedTree.data(), serializedTree.size(), deviceCreateInfoTree));
+
+	const vk::DeviceCreateInfo& treeDeviceCreateInfo = deviceCreateInfoTree.GetTreeHeadAs<vk::DeviceCreateInfo>();
+	assert(treeDeviceCreateInfo.pQueueCreateInfos[0].pQueuePriorities[1] == 0.5f);
+	assert(strcmp(treeDeviceCreateInfo.ppEnabledExtensionNames[1], "VK_KHR_maintenance1") == 0);
+
+	const vk::PhysicalDeviceFeatures2* treeFeatures2 = (const vk::PhysicalDeviceFeatures2*)treeDeviceCreateInfo.pNext;
+	assert(treeFeatures2->features.geometryShader == true);
+
+	//Serializing the loaded tree again gives the same data
+	assert(deviceCreateInfoTree.Serialize() == serializedTree);
+
+	std::vector<uint64_t> mappedTree((serializedTree.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	memcpy(mappedTree.data(), serializedTree.data(), serializedTree.size());
+
+	const vk::DeviceCreateInfo* loadedDeviceCreateInfo = (const vk::DeviceCreateInfo*)vgs::LoadSerializedStructures(mappedTree.data(), serializedTree.size());
+	assert(loadedDeviceCreateInfo != nullptr);
+	assert(loadedDeviceCreateInfo->pQueueCreateInfos[0].pQueuePriorities[0] == 1.0f);
+	assert(strcmp(loadedDeviceCreateInfo->ppEnabledExtensionNames[0], "VK_KHR_swapchain") == 0);
+
+	//A count that makes the pointed data go past the end is rejected
+	std::vector<uint64_t> brokenMappedTree(mappedTree.size());
+	memcpy(brokenMappedTree.data(), serializedTree.data(), serializedTree.size());
+
+	vgs::SerializedStructuresHeader treeHeader;
+	memcpy(&treeHeader, serializedTree.data(), sizeof(vgs::SerializedStructuresHeader));
+
+	uint32_t brokenExtensionCount = 1000;
+	memcpy((std::byte*)brokenMappedTree.data() + vgs::GetSerializedDataOffset(treeHeader) + offsetof(vk::DeviceCreateInfo, enabledExtensionCount), &brokenExtensionCount, sizeof(uint32_t));
+
+	std::vector<uint64_t> brokenMappedTreeCopy = brokenMappedTree;
+	assert(vgs::LoadSerializedStructures(brokenMappedTree.data(), serializedTree.size()) == nullptr);
+	assert(brokenMappedTree == brokenMappedTreeCopy);
+
+	//The pointers that are not relocated are zeroed instead of being left dangling
+	int                                  userData = 0;
+	vk::DebugReportCallbackCreateInfoEXT debugReportCallbackCreateInfo;
+
+	debugReportCallbackCreateInfo.pUserData = &userData;
+	deviceCreateInfo.pNext                  = &debugReportCallbackCreateInfo;
+
+	std::vector<std::byte> serializedShallowChain = vgs::SerializeStructures(&deviceCreateInfo, false);
+
+	std::vector<uint64_t> mappedShallowChain((serializedShallowChain.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	memcpy(mappedShallowChain.data(), serializedShallowChain.data(), serializedShallowChain.size());
+
+	const vk::DeviceCreateInfo* loadedShallowDeviceCreateInfo = (const vk::DeviceCreateInfo*)vgs::LoadSerializedStructures(mappedShallowChain.data(), serializedShallowChain.size());
+	assert(loadedShallowDeviceCreateInfo != nullptr);
+	assert(loadedShallowDeviceCreateInfo->queueCreateInfoCount    == 1);
+	assert(loadedShallowDeviceCreateInfo->pQueueCreateInfos       == nullptr);
+	assert(loadedShallowDeviceCreateInfo->ppEnabledExtensionNames == nullptr);
+
+	const vk::DebugReportCallbackCreateInfoEXT* loadedDebugReportCallbackCreateInfo = (const vk::DebugReportCallbackCreateInfoEXT*)loadedShallowDeviceCreateInfo->pNext;
+	assert(loadedDebugReportCallbackCreateInfo->pUserData == nullptr);
+}
+
+void GenericStructureTestsHpp::TestDeviceChainCache()
+{
+	uint8_t deviceUUID[VK_UUID_SIZE] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0, 0x01};
+
+	//Synthetic queried chains
+	vk::PhysicalDeviceFeatures2                 physicalDeviceFeatures2;
+	vk::PhysicalDeviceVulkan11Features          vulkan11Features;
+	vk::PhysicalDeviceVulkanMemoryModelFeatures memoryModelFeatures;
+	vk::PhysicalDeviceProperties2               physicalDeviceProperties2;
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> featuresChain(physicalDeviceFeatures2);
+	featuresChain.AppendToChain(vulkan11Features);
+	featuresChain.AppendToChain(memoryModelFeatures);
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceProperties2> propertiesChain(physicalDeviceProperties2);
+
+	//The keys are made before the query, from the chains that would be queried
+	vgs::DeviceChainCacheKey featuresKey   = vgs::MakeDeviceChainCacheKey(deviceUUID, 42, &featuresChain.GetChainHead());
+	vgs::DeviceChainCacheKey propertiesKey = vgs::MakeDeviceChainCacheKey(deviceUUID, 42, &propertiesChain.GetChainHead());
+	assert(featuresKey != propertiesKey);
+
+	featuresChain.GetChainHead().features.geometryShader = true;
+	vulkan11Features.multiview                           = true;
+	memoryModelFeatures.vulkanMemoryModel                = true;
+
+	propertiesChain.GetChainHead().properties.apiVersion    = VK_MAKE_VERSION(1, 2, 0);
+	propertiesChain.GetChainHead().properties.driverVersion = 42;
+
+	//Cold cache
+	vgs::DeviceChainCache coldCache;
+	assert(coldCache.FindChain(featuresKey) == nullptr);
+
+	coldCache.StoreChain(featuresKey,   &featuresChain.GetChainHead());
+	coldCache.StoreChain(propertiesKey, &propertiesChain.GetChainHead());
+
+	const vk::PhysicalDeviceFeatures2* storedFeatures2 = coldCache.FindChainAs<vk::PhysicalDeviceFeatures2>(featuresKey);
+	assert(storedFeatures2 != nullptr);
+	assert(storedFeatures2 != &featuresChain.GetChainHead());
+	assert(vgs::CompareChains(storedFeatures2, &featuresChain.GetChainHead()));
+
+	std::vector<std::byte> savedCache = coldCache.Save();
+
+	//Warm cache, the data is aligned the same way a memory-mapped file is
+	std::vector<uint64_t> mappedCache((savedCache.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	memcpy(mappedCache.data(), savedCache.data(), savedCache.size());
+
+	const std::byte* mappedBegin = (const std::byte*)mappedCache.data();
+	const std::byte* mappedEnd   = mappedBegin + savedCache.size();
+
+	vgs::DeviceChainCache warmCache;
+	assert(warmCache.Open(mappedCache.data(), savedCache.size()));
+
+	//The chains are used right from the cache data, without copying
+	const vk::PhysicalDeviceFeatures2*   cachedFeatures2   = warmCache.FindChainAs<vk::PhysicalDeviceFeatures2>(featuresKey);
+	const vk::PhysicalDeviceProperties2* cachedProperties2 = warmCache.FindChainAs<vk::PhysicalDeviceProperties2>(propertiesKey);
+
+	assert(cachedFeatures2 != nullptr && cachedProperties2 != nullptr);
+	assert((const std::byte*)cachedFeatures2   > mappedBegin && (const std::byte*)cachedFeatures2   < mappedEnd);
+	assert((const std::byte*)cachedProperties2 > mappedBegin && (const std::byte*)cachedProperties2 < mappedEnd);
+
+	const vk::PhysicalDeviceVulkan11Features* cachedVulkan11Features = (const vk::PhysicalDeviceVulkan11Features*)cachedFeatures2->pNext;
+	assert((const std::byte*)cachedVulkan11Features > mappedBegin && (const std::byte*)cachedVulkan11Features < mappedEnd);
+
+	assert(cachedFeatures2->features.geometryShader == true);
+	assert(cachedVulkan11Features->multiview        == true);
+	assert(cachedProperties2->properties.apiVersion == VK_MAKE_VERSION(1, 2, 0));
+	assert(warmCache.FindChain(featuresKey)         == cachedFeatures2);
+	assert(vgs::CompareChains(cachedFeatures2, &featuresChain.GetChainHead()));
+
+	//Another driver version or another set of structures is a miss
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> headOnlyFeaturesChain;
+
+	assert(warmCache.FindChain(vgs::MakeDeviceChainCacheKey(deviceUUID, 43, &featuresChain.GetChainHead()))         == nullptr);
+	assert(warmCache.FindChain(vgs::MakeDeviceChainCacheKey(deviceUUID, 42, &headOnlyFeaturesChain.GetChainHead())) == nullptr);
+
+	//Saving the warm cache gives the same data
+	assert(warmCache.Save() == savedCache);
+
+	//Broken data is not a cache
+	std::vector<uint64_t> brokenCache = mappedCache;
+	brokenCache[0] = 0;
+
+	vgs::DeviceChainCache brokenDeviceChainCache;
+	assert(!brokenDeviceChainCache.Open(brokenCache.data(), savedCache.size()));
+
+	//A broken chain is checked once and left untouched, the other chains still load
+	vgs::DeviceChainCacheEntry featuresEntry;
+	memcpy(&featuresEntry, savedCache.data() + sizeof(vgs::DeviceChainCacheHeader), sizeof(vgs::DeviceChainCacheEntry));
+
+	vgs::SerializedStructuresHeader featuresHeader;
+	memcpy(&featuresHeader, savedCache.data() + featuresEntry.Offset, sizeof(vgs::SerializedStructuresHeader));
+
+	size_t    brokenPNextOffset = (size_t)featuresEntry.Offset + vgs::GetSerializedDataOffset(featuresHeader) + offsetof(VkBaseInStructure, pNext);
+	uintptr_t brokenPNext       = sizeof(VkBaseInStructure) + 1;
+
+	std::vector<uint64_t> brokenChainCache(mappedCache.size());
+	memcpy(brokenChainCache.data(), savedCache.data(), savedCache.size());
+	memcpy((std::byte*)brokenChainCache.data() + brokenPNextOffset, &brokenPNext, sizeof(uintptr_t));
+
+	std::vector<uint64_t> brokenChainCacheCopy = brokenChainCache;
+
+	vgs::DeviceChainCache brokenChainDeviceCache;
+	assert(brokenChainDeviceCache.Open(brokenChainCache.data(), savedCache.size()));
+	assert(brokenChainDeviceCache.FindChain(featuresKey)   == nullptr);
+	assert(brokenChainDeviceCache.FindChain(propertiesKey) != nullptr);
+	assert(memcmp((std::byte*)brokenChainCache.data() + featuresEntry.Offset, (std::byte*)brokenChainCacheCopy.data() + featuresEntry.Offset, (size_t)featuresEntry.Size) == 0);
+
+	//Even if the data gets fixed, the entry is not loaded again
+	memcpy((std::byte*)brokenChainCache.data() + brokenPNextOffset, savedCache.data() + brokenPNextOffset, sizeof(uintptr_t));
+	assert(brokenChainDeviceCache.FindChain(featuresKey) == nullptr);
+
+	//The broken chain is not saved
+	std::vector<std::byte> fixedCache = brokenChainDeviceCache.Save();
+
+	std::vector<uint64_t> mappedFixedCache((fixedCache.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	memcpy(mappedFixedCache.data(), fixedCache.data(), fixedCache.size());
+
+	vgs::DeviceChainCache fixedDeviceChainCache;
+	assert(fixedDeviceChainCache.Open(mappedFixedCache.data(), fixedCache.size()));
+	assert(fixedDeviceChainCache.FindChain(featuresKey)   == nullptr);
+	assert(fixedDeviceChainCache.FindChain(propertiesKey) != nullptr);
+}
+
+void GenericStructureTestsHpp::TestFullFeatureChain()
+{
+	//The generated table has every structure that extends VkPhysicalDeviceFeatures2, not only the head
+	assert(vgs::FeatureStructureCount > 1);
+
+	//Everything core in 1.2 plus the structures of the enabled extensions
+	const char* enabledExtensionNames[] = {"VK_EXT_debug_report", "VK_NV_mesh_shader"};
+
+	vgs::FullFeatureChain fullFeatureChain = vgs::BuildFullFeatureChain(VK_API_VERSION_1_2, 2, enabledExtensionNames);
+	assert(fullFeatureChain.Contains<vk::PhysicalDeviceVulkan11Features>());
+	assert(fullFeatureChain.Contains<vk::PhysicalDeviceVulkanMemoryModelFeatures>());
+	assert(fullFeatureChain.Contains<vk::PhysicalDeviceMeshShaderFeaturesNV>());
+	assert(!fullFeatureChain.Contains<vk::PhysicalDeviceDeviceGeneratedCommandsFeaturesNV>());
+	assert(!fullFeatureChain.Contains<vk::PhysicalDeviceInlineUniformBlockFeaturesEXT>());
+	assert(!fullFeatureChain.Contains<vk::DeviceCreateInfo>());
+
+	vk::PhysicalDeviceFeatures2& physicalDeviceFeatures2 = fullFeatureChain.GetChainHeadAs<vk::PhysicalDeviceFeatures2>();
+	assert(physicalDeviceFeatures2.sType                   == vk::StructureType::ePhysicalDeviceFeatures2);
+	assert(physicalDeviceFeatures2.features.geometryShader == false);
+
+	//All the links are zeroed, initialized and chained
+	uint32_t linkCount = 0;
+	for(const void* link = &physicalDeviceFeatures2; link != nullptr; link = vgs::GetChainLinkPNext(link))
+	{
+		assert(vgs::GetFeatureStructureOrdinal(vgs::GetChainLinkSType(link)) != vgs::NoFeatureStructure);
+		linkCount++;
+	}
+
+	assert(linkCount == fullFeatureChain.GetLinkCount());
+
+	vk::PhysicalDeviceMeshShaderFeaturesNV& meshShaderFeatures = fullFeatureChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+	assert(meshShaderFeatures.sType      == vk::StructureType::ePhysicalDeviceMeshShaderFeaturesNV);
+	assert(meshShaderFeatures.meshShader == false);
+
+	meshShaderFeatures.meshShader = true;
+
+	//Promoted structures are included by the extension under the old name
+	const char* imagelessExtensionNames[] = {"VK_KHR_imageless_framebuffer"};
+
+	vgs::FullFeatureChain vulkan11FeatureChain = vgs::BuildFullFeatureChain(VK_API_VERSION_1_1, 1, imagelessExtensionNames);
+	assert(vulkan11FeatureChain.Contains<vk::PhysicalDeviceImagelessFramebufferFeatures>());
+	assert(!vulkan11FeatureChain.Contains<vk::PhysicalDeviceVulkan11Features>());
+	assert(!vulkan11FeatureChain.Contains<vk::PhysicalDeviceMeshShaderFeaturesNV>());
+	assert(vulkan11FeatureChain.Contains<vk::PhysicalDeviceMultiviewFeatures>());
+
+	//Only the head is left for Vulkan 1.0 without any extensions
+	vgs::FullFeatureChain vulkan10FeatureChain = vgs::BuildFullFeatureChain(VK_API_VERSION_1_0, 0, nullptr);
+	assert(vulkan10FeatureChain.GetLinkCount() == 1);
+	assert(vulkan10FeatureChain.GetChainHeadAs<vk::PhysicalDeviceFeatures2>().pNext == nullptr);
+
+	//The copy is linked within itself
+	vgs::FullFeatureChain fullFeatureChainCopy = fullFeatureChain;
+
+	vk::PhysicalDeviceMeshShaderFeaturesNV& meshShaderFeaturesCopy = fullFeatureChainCopy.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>();
+	assert(&meshShaderFeaturesCopy           != &meshShaderFeatures);
+	assert(meshShaderFeaturesCopy.meshShader == true);
+
+	uint32_t copyLinkCount = 0;
+	for(const void* link = &fullFeatureChainCopy.GetChainHeadAs<vk::PhysicalDeviceFeatures2>(); link != nullptr; link = vgs::GetChainLinkPNext(link))
+	{
+		assert(link != &meshShaderFeatures);
+		copyLinkCount++;
+	}
+
+	assert(copyLinkCount == linkCount);
+}
+
+void GenericStructureTestsHpp::TestFeatureBitset()
+{
+	//Every VkBool32 member of the generated feature structures gets a bit
+	assert(vgs::FeatureBitCount != 0);
+
+	constexpr uint32_t geometryShaderBit     = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceFeatures2>, offsetof(vk::PhysicalDeviceFeatures2, features) + offsetof(vk::PhysicalDeviceFeatures, geometryShader));
+	constexpr uint32_t multiviewBit          = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceVulkan11Features>, offsetof(vk::PhysicalDeviceVulkan11Features, multiview));
+	constexpr uint32_t taskShaderBit         = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceMeshShaderFeaturesNV>, offsetof(vk::PhysicalDeviceMeshShaderFeaturesNV, taskShader));
+	constexpr uint32_t meshShaderBit         = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceMeshShaderFeaturesNV>, offsetof(vk::PhysicalDeviceMeshShaderFeaturesNV, meshShader));
+	constexpr uint32_t inlineUniformBlockBit = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceInlineUniformBlockFeaturesEXT>, offsetof(vk::PhysicalDeviceInlineUniformBlockFeaturesEXT, inlineUniformBlock));
+
+	assert(geometryShaderBit     != vgs::NoFeatureBit);
+	assert(multiviewBit          != vgs::NoFeatureBit);
+	assert(taskShaderBit         != vgs::NoFeatureBit);
+	assert(meshShaderBit         == taskShaderBit + 1);
+	assert(inlineUniformBlockBit != vgs::NoFeatureBit);
+
+	assert(vgs::GetFeatureBit(vgs::ValidStructureType<vk::DeviceCreateInfo>, 0) == vgs::NoFeatureBit);
+
+	//Supported features of a device
+	vk::PhysicalDeviceFeatures2            physicalDeviceFeatures2;
+	vk::PhysicalDeviceVulkan11Features     vulkan11Features;
+	vk::PhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures;
+
+	physicalDeviceFeatures2.features.geometryShader = true;
+	vulkan11Features.multiview                      = true;
+	meshShaderFeatures.taskShader                   = true;
+	meshShaderFeatures.meshShader                   = true;
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> supportedFeaturesChain(physicalDeviceFeatures2);
+	supportedFeaturesChain.AppendToChain(vulkan11Features);
+	supportedFeaturesChain.AppendToChain(meshShaderFeatures);
+
+	vgs::FeatureBitset supportedFeatures = vgs::MakeFeatureBitset(&supportedFeaturesChain.GetChainHead());
+	assert(supportedFeatures.Count() == 4);
+	assert(supportedFeatures.Test(geometryShaderBit));
+	assert(supportedFeatures.Test(multiviewBit));
+	assert(supportedFeatures.Test(meshShaderBit));
+	assert(!supportedFeatures.Test(inlineUniformBlockBit));
+
+	//Set operations
+	vgs::FeatureBitset requiredFeatures;
+	assert(requiredFeatures.IsEmpty());
+
+	requiredFeatures.Set(geometryShaderBit);
+	requiredFeatures.Set(meshShaderBit);
+
+	assert(requiredFeatures.IsSubsetOf(supportedFeatures));
+	assert(!supportedFeatures.IsSubsetOf(requiredFeatures));
+	assert(requiredFeatures.Intersect(supportedFeatures) == requiredFeatures);
+
+	vgs::FeatureBitset extraFeatures = supportedFeatures.Diff(requiredFeatures);
+	assert(extraFeatures.Count() == 2);
+	assert(extraFeatures.Test(multiviewBit));
+	assert(extraFeatures.Test(taskShaderBit));
+
+	requiredFeatures.Set(inlineUniformBlockBit);
+	assert(!requiredFeatures.IsSubsetOf(supportedFeatures));
+	assert(requiredFeatures.Diff(supportedFeatures).Count() == 1);
+
+	requiredFeatures.Set(inlineUniformBlockBit, false);
+	assert(requiredFeatures.IsSubsetOf(supportedFeatures));
+
+	//Back into a chain, only the structures with the required features are there
+	vgs::FullFeatureChain enabledFeaturesChain = vgs::BuildFeatureChain(requiredFeatures);
+	assert(enabledFeaturesChain.GetLinkCount() == 2);
+	assert(enabledFeaturesChain.Contains<vk::PhysicalDeviceMeshShaderFeaturesNV>());
+	assert(!enabledFeaturesChain.Contains<vk::PhysicalDeviceVulkan11Features>());
+
+	assert(enabledFeaturesChain.GetChainHeadAs<vk::PhysicalDeviceFeatures2>().features.geometryShader     == true);
+	assert(enabledFeaturesChain.GetChainHeadAs<vk::PhysicalDeviceFeatures2>().features.tessellationShader == false);
+	assert(enabledFeaturesChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>().meshShader   == true);
+	assert(enabledFeaturesChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>().taskShader   == false);
+
+	assert(vgs::MakeFeatureBitset(&enabledFeaturesChain.GetChainHeadAs<vk::PhysicalDeviceFeatures2>()) == requiredFeatures);
+
+	//The members of VkPhysicalDeviceVulkanNNFeatures share the bits with the same members of the structures promoted to that version
+	constexpr uint32_t promotedMultiviewBit   = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceMultiviewFeatures>, offsetof(vk::PhysicalDeviceMultiviewFeatures, multiview));
+	constexpr uint32_t drawIndirectCountBit   = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceVulkan12Features>, offsetof(vk::PhysicalDeviceVulkan12Features, drawIndirectCount));
+	constexpr uint32_t vulkanMemoryModelBit   = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceVulkan12Features>, offsetof(vk::PhysicalDeviceVulkan12Features, vulkanMemoryModel));
+	constexpr uint32_t promotedMemoryModelBit = vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceVulkanMemoryModelFeatures>, offsetof(vk::PhysicalDeviceVulkanMemoryModelFeatures, vulkanMemoryModel));
+
+	assert(promotedMultiviewBit == multiviewBit);
+	assert(promotedMemoryModelBit == vulkanMemoryModelBit);
+	assert(vgs::FindFeatureBit("VkPhysicalDeviceMultiviewFeatures", "multiview") == multiviewBit);
+
+	vk::PhysicalDeviceFeatures2         promotedFeatures2;
+	vk::PhysicalDeviceMultiviewFeatures multiviewFeatures;
+
+	multiviewFeatures.multiview = true;
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> promotedFeaturesChain(promotedFeatures2);
+	promotedFeaturesChain.AppendToChain(multiviewFeatures);
+
+	vgs::FeatureBitset promotedFeatures = vgs::MakeFeatureBitset(&promotedFeaturesChain.GetChainHead());
+	assert(promotedFeatures.Count() == 1);
+	assert(promotedFeatures.IsSubsetOf(supportedFeatures));
+
+	//The aliased features go to the promoted structures, unless VkPhysicalDeviceVulkanNNFeatures is needed for its own features. Never to both
+	vgs::FullFeatureChain supportedFeaturesChainCopy = vgs::BuildFeatureChain(supportedFeatures);
+	assert(supportedFeaturesChainCopy.Contains<vk::PhysicalDeviceMultiviewFeatures>());
+	assert(!supportedFeaturesChainCopy.Contains<vk::PhysicalDeviceVulkan11Features>());
+	assert(supportedFeaturesChainCopy.GetChainLinkDataAs<vk::PhysicalDeviceMultiviewFeatures>().multiview == true);
+	assert(vgs::MakeFeatureBitset(&supportedFeaturesChainCopy.GetChainHeadAs<vk::PhysicalDeviceFeatures2>()) == supportedFeatures);
+
+	vgs::FeatureBitset vulkan12Features;
+	vulkan12Features.Set(drawIndirectCountBit);
+	vulkan12Features.Set(promotedMemoryModelBit);
+
+	vgs::FullFeatureChain vulkan12FeaturesChain = vgs::BuildFeatureChain(vulkan12Features);
+	assert(vulkan12FeaturesChain.Contains<vk::PhysicalDeviceVulkan12Features>());
+	assert(!vulkan12FeaturesChain.Contains<vk::PhysicalDeviceVulkanMemoryModelFeatures>());
+	assert(vulkan12FeaturesChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan12Features>().drawIndirectCount == true);
+	assert(vulkan12FeaturesChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkan12Features>().vulkanMemoryModel == true);
+	assert(vgs::MakeFeatureBitset(&vulkan12FeaturesChain.GetChainHeadAs<vk::PhysicalDeviceFeatures2>()) == vulkan12Features);
+
+	//Bulk evaluation of stored profiles
+	std::vector<vgs::FeatureBitset> deviceProfiles(1000);
+	for(size_t i = 0; i < deviceProfiles.size(); i++)
+	{
+		deviceProfiles[i].Set(geometryShaderBit, i % 3 != 0);
+		deviceProfiles[i].Set(meshShaderBit,     i % 2 == 0);
+	}
+
+	bool profilesSupported[1000];
+	assert(vgs::EvaluateFeatureProfiles(requiredFeatures, deviceProfiles.data(), deviceProfiles.size(), profilesSupported) == 333);
+	assert(!profilesSupported[0]);
+	assert(profilesSupported[2]);
+	assert(!profilesSupported[3]);
+}
+
+void GenericStructureTestsHpp::TestQueryChainArray()
+{
+	vk::PhysicalDeviceProperties2      physicalDeviceProperties2;
+	vk::PhysicalDeviceIDProperties     idProperties;
+	vk::PhysicalDeviceDriverProperties driverProperties;
+
+	//Leftovers in the template of the returnedonly structures are not copied
+	assert(vgs::IsSTypeReturnedOnly(vk::StructureType::ePhysicalDeviceIdProperties));
+	idProperties.deviceNodeMask = 0xFF;
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceProperties2> propertiesChain(physicalDeviceProperties2);
+	propertiesChain.AppendToChain(idProperties);
+	propertiesChain.AppendToChain(driverProperties);
+
+	vgs::QueryChainArray<vk::PhysicalDeviceProperties2> propertiesChains(propertiesChain.GetChainHead(), 3);
+	assert(propertiesChains.GetChainCount() == 3);
+	assert((std::byte*)(&propertiesChains.GetChainHead(1)) > (std::byte*)(&propertiesChains.GetChainHead(0)));
+
+	for(size_t i = 0; i < propertiesChains.GetChainCount(); i++)
+	{
+		vk::PhysicalDeviceProperties2&      queriedProperties2      = propertiesChains.GetChainHead(i);
+		vk::PhysicalDeviceIDProperties&     queriedIdProperties     = propertiesChains.GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>(i);
+		vk::PhysicalDeviceDriverProperties& queriedDriverProperties = propertiesChains.GetChainLinkDataAs<vk::PhysicalDeviceDriverProperties>(i);
+
+		assert(queriedProperties2.sType      == vk::StructureType::ePhysicalDeviceProperties2);
+		assert(queriedProperties2.pNext      == &queriedIdProperties);
+		assert(queriedIdProperties.sType     == vk::StructureType::ePhysicalDeviceIdProperties);
+		assert(queriedIdProperties.pNext     == &queriedDriverProperties);
+		assert(queriedDriverProperties.pNext == nullptr);
+
+		assert(queriedIdProperties.deviceNodeMask == 0);
+
+		//Simulated query, the last device is different
+		queriedProperties2.properties.apiVersion = VK_API_VERSION_1_2;
+		queriedIdProperties.deviceNodeMask       = (i == 2) ? 2 : 1;
+	}
+
+	//Re-arming restores only sType and pNext
+	propertiesChains.GetChainHead(1).pNext                                       = nullptr;
+	propertiesChains.GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>(1).sType = vk::StructureType::eApplicationInfo;
+	propertiesChains.Rearm();
+
+	assert(propertiesChains.GetChainHead(1).pNext                                                == &propertiesChains.GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>(1));
+	assert(propertiesChains.GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>(1).sType          == vk::StructureType::ePhysicalDeviceIdProperties);
+	assert(propertiesChains.GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>(1).deviceNodeMask == 1);
+	assert(propertiesChains.GetChainHead(1).properties.apiVersion                                == VK_API_VERSION_1_2);
+
+	//Cross-device diff
+	std::vector<vgs::QueryChainMember> differentMembers = propertiesChains.Diff();
+	assert(differentMembers.size()       == 1);
+	assert(differentMembers[0].LinkIndex == 1);
+	assert(differentMembers[0].SType     == vk::StructureType::ePhysicalDeviceIdProperties);
+
+	size_t rangeCount = 0;
+	if(vgs::GetSTypeMemberRanges(vk::StructureType::ePhysicalDeviceIdProperties, &rangeCount) != nullptr)
+	{
+		assert(differentMembers[0].Offset == offsetof(vk::PhysicalDeviceIDProperties, deviceNodeMask));
+		assert(differentMembers[0].Size   == sizeof(uint32_t));
+	}
+
+	assert(propertiesChains.Diff(0, 1).empty());
+	assert(propertiesChains.Diff(1, 2).size() == 1);
+
+	//The copy is linked within itself
+	vgs::QueryChainArray<vk::PhysicalDeviceProperties2> propertiesChainsCopy = propertiesChains;
+	assert(propertiesChainsCopy.GetChainHead(2).pNext                                                == &propertiesChainsCopy.GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>(2));
+	assert(propertiesChainsCopy.GetChainLinkDataAs<vk::PhysicalDeviceIDProperties>(2).deviceNodeMask == 2);
+
+	//The structures that are not returnedonly are copied from the template
+	vk::PhysicalDeviceFeatures2 physicalDeviceFeatures2;
+	physicalDeviceFeatures2.features.geometryShader = true;
+
+	vgs::QueryChainArray<vk::PhysicalDeviceFeatures2> featuresChains(physicalDeviceFeatures2, 2);
+	assert(featuresChains.GetChainHead(1).features.geometryShader == true);
+	assert(featuresChains.GetChainHead(1).pNext                   == nullptr);
+}
+
+void GenericStructureTestsHpp::TestFeatureProfile()
+{
+	//Profile names are looked up in the generated feature bit table
+	assert(vgs::FeatureBitCount != 0);
+
+	const char profileJson[] = R"({
+		"capabilities": {
+			"baseline": {
+				"extensions": {"VK_NV_mesh_shader": 1},
+				"features": {
+					"VkPhysicalDeviceFeatures": {"geometryShader": true, "tessellationShader": false},
+					"VkPhysicalDeviceVulkanMemoryModelFeaturesKHR": {"vulkanMemoryModel": true},
+					"VkPhysicalDeviceMeshShaderFeaturesNV": {"meshShader": true},
+					"VkPhysicalDeviceFutureFeaturesEXT": {"futureFeature": true}
+				},
+				"properties": {"VkPhysicalDeviceProperties": {"limits": {"maxImageDimension2D": 4096, "pointSizeRange": [1.0, 64.0]}}}
+			},
+			"optional": {
+				"features": {"VkPhysicalDeviceVulkan11Features": {"multiview": true}}
+			}
+		},
+		"profiles": {"VP_TEST_profile": {"version": 1, "capabilities": ["baseline", "optional"]}}
+	})";
+
+	uint32_t geometryShaderBit = vgs::FindFeatureBit("VkPhysicalDeviceFeatures", "geometryShader");
+	uint32_t memoryModelBit    = vgs::FindFeatureBit("VkPhysicalDeviceVulkanMemoryModelFeatures", "vulkanMemoryModel");
+	uint32_t meshShaderBit     = vgs::FindFeatureBit("VkPhysicalDeviceMeshShaderFeaturesNV", "meshShader");
+	uint32_t multiviewBit      = vgs::FindFeatureBit("VkPhysicalDeviceVulkan11Features", "multiview");
+
+	assert(geometryShaderBit == vgs::GetFeatureBit(vgs::ValidStructureType<vk::PhysicalDeviceFeatures2>, offsetof(vk::PhysicalDeviceFeatures2, features) + offsetof(vk::PhysicalDeviceFeatures, geometryShader)));
+	assert(memoryModelBit    == vgs::FindFeatureBit("VkPhysicalDeviceVulkanMemoryModelFeaturesKHR", "vulkanMemoryModel"));
+	assert(meshShaderBit     != vgs::NoFeatureBit);
+	assert(multiviewBit      != vgs::NoFeatureBit);
+
+	assert(vgs::FindFeatureBit("VkPhysicalDeviceFeatures", "geometry")             == vgs::NoFeatureBit);
+	assert(vgs::FindFeatureBit("VkPhysicalDeviceFeatures2", "geometryShader")      == vgs::NoFeatureBit);
+	assert(vgs::FindFeatureBit("VkPhysicalDeviceVulkan11Features", "multiviewXYZ") == vgs::NoFeatureBit);
+
+	//Only the baseline capability
+	vgs::FeatureBitset baselineFeatures;
+	uint32_t           unknownFeatureCount = 0;
+	assert(vgs::LoadFeatureProfile(profileJson, sizeof(profileJson) - 1, "baseline", baselineFeatures, &unknownFeatureCount));
+
+	assert(unknownFeatureCount      == 1);
+	assert(baselineFeatures.Count() == 3);
+	assert(baselineFeatures.Test(geometryShaderBit));
+	assert(baselineFeatures.Test(memoryModelBit));
+	assert(baselineFeatures.Test(meshShaderBit));
+	assert(!baselineFeatures.Test(multiviewBit));
+
+	//All capabilities
+	vgs::FeatureBitset allFeatures;
+	assert(vgs::LoadFeatureProfile(profileJson, sizeof(profileJson) - 1, nullptr, allFeatures));
+	assert(allFeatures.Count() == 4);
+	assert(allFeatures.Test(multiviewBit));
+
+	//Straight into a chain
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> baselineFeatureChain;
+	assert(vgs::LoadFeatureProfile(profileJson, sizeof(profileJson) - 1, "baseline", baselineFeatureChain));
+
+	assert(baselineFeatureChain.GetChainHead().features.geometryShader                                              == true);
+	assert(baselineFeatureChain.GetChainHead().features.tessellationShader                                          == false);
+	assert(baselineFeatureChain.GetChainLinkDataAs<vk::PhysicalDeviceVulkanMemoryModelFeatures>().vulkanMemoryModel == true);
+	assert(baselineFeatureChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>().meshShader             == true);
+	assert(baselineFeatureChain.CountOf<vk::PhysicalDeviceVulkan11Features>() == 0);
+
+	assert(vgs::MakeFeatureBitset(&baselineFeatureChain.GetChainHead()) == baselineFeatures);
+
+	//Broken data
+	const char brokenProfileJson[] = R"({"features": {"VkPhysicalDeviceFeatures": {"geometryShader": tru}}})";
+
+	vgs::FeatureBitset brokenFeatures;
+	assert(!vgs::LoadFeatureProfile(brokenProfileJson, sizeof(brokenProfileJson) - 1, nullptr, brokenFeatures));
+	assert(!vgs::LoadFeatureProfile(profileJson, sizeof(profileJson) - 10, nullptr, brokenFeatures));
+}
+
+void GenericStructureTestsHpp::TestStructureReflection()
+{
+	const vgs::StructureReflection* deviceCreateInfoReflection = vgs::GetSTypeReflection(vk::StructureType::eDeviceCreateInfo);
+	assert(deviceCreateInfoReflection != nullptr);
+	assert(deviceCreateInfoReflection == &vgs::StructureReflectionOf<vk::DeviceCreateInfo>);
+	assert(strcmp(deviceCreateInfoReflection->Name, "VkDeviceCreateInfo") == 0);
+	assert(deviceCreateInfoReflection->SType == vk::StructureType::eDeviceCreateInfo);
+	assert(deviceCreateInfoReflection->Size  == sizeof(vk::DeviceCreateInfo));
+
+	//The tables can be used in constant expressions
+	constexpr uint32_t extensionNamesIndex = vgs::FindStructureMemberIndex(vgs::StructureReflectionOf<vk::DeviceCreateInfo>,   "ppEnabledExtensionNames");
+	constexpr uint32_t queueCreateInfosIndex = vgs::FindStructureMemberIndex(vgs::StructureReflectionOf<vk::DeviceCreateInfo>, "pQueueCreateInfos");
+	constexpr uint32_t unknownMemberIndex = vgs::FindStructureMemberIndex(vgs::StructureReflectionOf<vk::DeviceCreateInfo>,    "ppEnabledExtension");
+
+	assert(extensionNamesIndex   != vgs::NoMemberIndex);
+	assert(queueCreateInfosIndex != vgs::NoMemberIndex);
+	assert(unknownMemberIndex    == vgs::NoMemberIndex);
+
+	const vgs::StructureMemberInfo& extensionNamesMember = deviceCreateInfoReflection->Members[extensionNamesIndex];
+	assert(extensionNamesMember.Offset       == offsetof(vk::DeviceCreateInfo, ppEnabledExtensionNames));
+	assert(extensionNamesMember.Size         == sizeof(const char* const*));
+	assert(extensionNamesMember.ScalarKind   == vgs::MemberScalarKind::Char);
+	assert(extensionNamesMember.PointerDepth == 2);
+	assert(strcmp(extensionNamesMember.Len, "enabledExtensionCount,null-terminated") == 0);
+	assert(strcmp(deviceCreateInfoReflection->Members[extensionNamesMember.LenMemberIndex].Name, "enabledExtensionCount") == 0);
+
+	const vgs::StructureMemberInfo& queueCreateInfosMember = deviceCreateInfoReflection->Members[queueCreateInfosIndex];
+	assert(queueCreateInfosMember.ScalarKind        == vgs::MemberScalarKind::Struct);
+	assert(queueCreateInfosMember.ElementReflection == &vgs::StructureReflectionOf<vk::DeviceQueueCreateInfo>);
+
+	const vgs::StructureMemberInfo* sTypeMember = vgs::FindStructureMember(*deviceCreateInfoReflection, "sType");
+	assert(sTypeMember != nullptr);
+	assert(sTypeMember->ScalarKind == vgs::MemberScalarKind::Enum);
+	assert(vgs::FindStructureMember(*deviceCreateInfoReflection, "queueCreateInfo") == nullptr);
+
+	//Nested structures and fixed-size arrays
+	const vgs::StructureMemberInfo* featuresMember = vgs::FindStructureMember(vgs::StructureReflectionOf<vk::PhysicalDeviceFeatures2>, "features");
+	assert(featuresMember->ScalarKind        == vgs::MemberScalarKind::Struct);
+	assert(featuresMember->PointerDepth      == 0);
+	assert(featuresMember->ElementReflection == &vgs::StructureReflectionOf<vk::PhysicalDeviceFeatures>);
+
+	const vgs::StructureMemberInfo* deviceUUIDMember = vgs::FindStructureMember(vgs::StructureReflectionOf<vk::PhysicalDeviceIDProperties>, "deviceUUID");
+	assert(deviceUUIDMember->ScalarKind  == vgs::MemberScalarKind::Uint8);
+	assert(deviceUUIDMember->ArrayLength == VK_UUID_SIZE);
+
+	//Member-wise comparison of two structures without any code written for the structure type
+	vk::PhysicalDeviceFeatures supportedFeatures;
+	vk::PhysicalDeviceFeatures requiredFeatures;
+
+	supportedFeatures.geometryShader    = true;
+	requiredFeatures.geometryShader     = true;
+	requiredFeatures.tessellationShader = true;
+
+	const vgs::StructureReflection& featuresReflection = *featuresMember->ElementReflection;
+
+	uint32_t    missingFeatureCount = 0;
+	const char* missingFeatureName  = nullptr;
+	for(uint32_t memberIndex = 0; memberIndex < featuresReflection.MemberCount; memberIndex++)
+	{
+		const vgs::StructureMemberInfo& member = featuresReflection.Members[memberIndex];
+		assert(member.ScalarKind == vgs::MemberScalarKind::Bool32);
+
+		vk::Bool32 supported = false;
+		vk::Bool32 required  = false;
+		memcpy(&supported, (const std::byte*)&supportedFeatures + member.Offset, sizeof(vk::Bool32));
+		memcpy(&required,  (const std::byte*)&requiredFeatures  + member.Offset, sizeof(vk::Bool32));
+
+		if(required && !supported)
+		{
+			missingFeatureCount++;
+			missingFeatureName = member.Name;
+		}
+	}
+
+	assert(missingFeatureCount == 1);
+	assert(strcmp(missingFeatureName, "tessellationShader") == 0);
+}
+
+//Generic visitor for TestStructureVisit, records the type of the structure it was called with
+struct StructureTypeRecorderHpp
+{
+	template<typename Struct>
+	void operator()(Struct&)
+	{
+		VisitedSType = vgs::ValidStructureType<Struct>;
+		VisitedSize  = sizeof(Struct);
+	}
+
+	void operator()(vk::PhysicalDeviceVulkan11Features& vulkan11Features)
+	{
+		vulkan11Features.multiview = true;
+
+		VisitedSType = vgs::ValidStructureType<vk::PhysicalDeviceVulkan11Features>;
+		VisitedSize  = sizeof(vk::PhysicalDeviceVulkan11Features);
+	}
+
+	vk::StructureType VisitedSType = (vk::StructureType)VK_STRUCTURE_TYPE_MAX_ENUM;
+	size_t            VisitedSize  = 0;
+};
+
+void GenericStructureTestsHpp::TestStructureVisit()
+{
+	static_assert(std::is_same<vgs::StructureTypeToType<vk::StructureType::ePhysicalDeviceVulkan11Features>::Type, vk::PhysicalDeviceVulkan11Features>::value);
+	static_assert(std::is_same<vgs::StructureTypeToType<vgs::ValidStructureType<vk::DeviceCreateInfo>>::Type, vk::DeviceCreateInfo>::value);
+
+	//Ordinals are dense and map back to the same sType
+	constexpr uint32_t features2Ordinal = (uint32_t)vgs::StructureTypeToType<vk::StructureType::ePhysicalDeviceFeatures2>::Ordinal;
+	assert(vgs::GetStructureOrdinal(vk::StructureType::ePhysicalDeviceFeatures2)   == features2Ordinal);
+	assert(vgs::GetStructureOrdinal((vk::StructureType)VK_STRUCTURE_TYPE_MAX_ENUM) == vgs::NoStructureOrdinal);
+
+	for(uint32_t ordinal = 0; ordinal < vgs::StructureOrdinalCount; ordinal++)
+	{
+		assert(vgs::GetStructureOrdinal(vgs::StructureOrdinalSTypes[ordinal]) == ordinal);
+	}
+
+	vk::PhysicalDeviceFeatures2                 physicalDeviceFeatures2;
+	vk::PhysicalDeviceVulkan11Features          vulkan11Features;
+	vk::PhysicalDeviceVulkanMemoryModelFeatures memoryModelFeatures;
+
+	vgs::GenericStructureChain<vk::PhysicalDeviceFeatures2> physicalDeviceFeatures2Chain(physicalDeviceFeatures2);
+	physicalDeviceFeatures2Chain.AppendToChain(vulkan11Features);
+	physicalDeviceFeatures2Chain.AppendToChain(memoryModelFeatures);
+
+	//Each link of a raw chain is visited as its own type
+	uint32_t visitedLinkCount = 0;
+	for(vk::BaseOutStructure* link = (vk::BaseOutStructure*)&physicalDeviceFeatures2Chain.GetChainHead(); link != nullptr; link = link->pNext)
+	{
+		StructureTypeRecorderHpp recorder;
+		assert(vgs::Visit(link, recorder));
+
+		assert(recorder.VisitedSType == link->sType);
+		assert(recorder.VisitedSize  == vgs::GetSTypeStructureSize(link->sType));
+
+		visitedLinkCount++;
+	}
+
+	assert(visitedLinkCount           == 3);
+	assert(vulkan11Features.multiview == true);
+
+	//Generic structures and temporary visitors
+	vgs::GenericStruct genericMemoryModelFeatures = memoryModelFeatures;
+	assert(vgs::Visit(genericMemoryModelFeatures, StructureTypeRecorderHpp()));
+
+	//Unknown sType
+	vk::BaseOutStructure unknownStructure;
+	unknownStructure.sType = (vk::StructureType)VK_STRUCTURE_TYPE_MAX_ENUM;
+	unknownStructure.pNext = nullptr;
+
+	StructureTypeRecorderHpp unknownRecorder;
+	assert(!vgs::Visit(&unknownStructure, unknownRecorder));
+	assert(unknownRecorder.VisitedSize == 0);
+}
+
+void GenericStructureTestsHpp::TestExtensionStructureTable()
+{
+	//GetExtensionIndex is a perfect hash of the generated extension names
+	assert(vgs::ExtensionCount != 0);
+
+	//Extension indices can be found at compile time
+	constexpr uint32_t debugReportIndex        = vgs::GetExtensionIndex(VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
+	constexpr uint32_t validationFeaturesIndex = vgs::GetExtensionIndex(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+
+	assert(debugReportIndex        != vgs::NoExtensionIndex);
+	assert(validationFeaturesIndex != vgs::NoExtensionIndex);
+	assert(debugReportIndex        != validationFeaturesIndex);
+	assert(strcmp(vgs::ExtensionNames[debugReportIndex], VK_EXT_DEBUG_REPORT_EXTENSION_NAME) == 0);
+
+	assert(vgs::GetExtensionIndex("VK_EXT_debug_repor")   == vgs::NoExtensionIndex);
+	assert(vgs::GetExtensionIndex("VK_EXT_debug_reportX") == vgs::NoExtensionIndex);
+	assert(vgs::GetExtensionIndex("")                     == vgs::NoExtensionIndex);
+
+	//Every name maps back to its own position
+	uint32_t extensionNameCount = 0;
+	for(uint32_t extensionIndex = 0; vgs::ExtensionNames[extensionIndex] != nullptr; extensionIndex++)
+	{
+		assert(vgs::GetExtensionIndex(vgs::ExtensionNames[extensionIndex]) == extensionIndex);
+		extensionNameCount++;
+	}
+
+	assert(extensionNameCount == vgs::ExtensionCount);
+
+	vk::DebugReportCallbackCreateInfoEXT debugReportCallbackCreateInfo;
+	vk::ValidationFeaturesEXT            validationFeatures;
+
+	debugReportCallbackCreateInfo.flags = vk::DebugReportFlagsEXT(0x0F);
+
+	vgs::ExtensionStructureTable extensionStructures;
+	assert(extensionStructures.SetStructure(VK_EXT_DEBUG_REPORT_EXTENSION_NAME, vgs::StructureBlob(debugReportCallbackCreateInfo)));
+	assert(!extensionStructures.SetStructure("VK_EXT_unknown_extension", vgs::StructureBlob(debugReportCallbackCreateInfo)));
+	extensionStructures.SetStructure(validationFeaturesIndex, vgs::StructureBlob(validationFeatures));
+
+	assert(extensionStructures.GetStructure(VK_EXT_DEBUG_REPORT_EXTENSION_NAME)->GetSType() == vk::StructureType::eDebugReportCallbackCreateInfoEXT);
+	assert(extensionStructures.GetStructure(VK_NV_MESH_SHADER_EXTENSION_NAME)               == nullptr);
+	assert(extensionStructures.GetStructure("VK_EXT_unknown_extension")                     == nullptr);
+
+	//Extensions without a structure and unknown extensions are skipped
+	const char* enabledExtensionNames[] = {VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME, VK_NV_MESH_SHADER_EXTENSION_NAME, "VK_EXT_unknown_extension", VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+
+	vgs::StructureChainBlob<vk::InstanceCreateInfo> instanceCreateInfoChain;
+	extensionStructures.AppendToChain(instanceCreateInfoChain, 4, enabledExtensionNames);
+
+	assert(instanceCreateInfoChain.CountOf<vk::ValidationFeaturesEXT>()            == 1);
+	assert(instanceCreateInfoChain.CountOf<vk::DebugReportCallbackCreateInfoEXT>() == 1);
+	assert(instanceCreateInfoChain.GetChainLinkDataAs<vk::DebugReportCallbackCreateInfoEXT>().flags == vk::DebugReportFlagsEXT(0x0F));
+
+	const vk::BaseInStructure* firstLink = (const vk::BaseInStructure*)instanceCreateInfoChain.GetChainHead().pNext;
+	assert(firstLink->sType        == vk::StructureType::eValidationFeaturesEXT);
+	assert(firstLink->pNext->sType == vk::StructureType::eDebugReportCallbackCreateInfoEXT);
+
+	//Same with the indices
+	extensionStructures.RemoveStructure(validationFeaturesIndex);
+	assert(extensionStructures.GetStructure(validationFeaturesIndex) == nullptr);
+
+	const uint32_t enabledExtensionIndices[] = {debugReportIndex, validationFeaturesIndex};
+
+	vgs::StructureChainBlob<vk::InstanceCreateInfo> instanceCreateInfoChain2;
+	extensionStructures.AppendToChain(instanceCreateInfoChain2, 2, enabledExtensionIndices);
+
+	assert(instanceCreateInfoChain2.CountOf<vk::ValidationFeaturesEXT>()            == 0);
+	assert(instanceCreateInfoChain2.CountOf<vk::DebugReportCallbackCreateInfoEXT>() == 1);
+}
+
+void GenericStructureTestsHpp::TestFilterByEnabled()
+{
+	//Which structures to keep comes from the generated StructureRequirements
+	assert(vgs::ExtensionCount != 0);
+
+	const char* enabledExtensionNames[] = {VK_NV_MESH_SHADER_EXTENSION_NAME, "VK_EXT_unknown_extension"};
+
+	vgs::ExtensionBitset enabledExtensions(2, enabledExtensionNames);
+	assert(enabledExtensions.Test(vgs::GetExtensionIndex(VK_NV_MESH_SHADER_EXTENSION_NAME)));
+	assert(!enabledExtensions.Test(vgs::GetExtensionIndex(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME)));
+	assert(!enabledExtensions.Set("VK_EXT_unknown_extension"));
+
+	assert(vgs::IsStructureSupported(vk::StructureType::ePhysicalDeviceFeatures2,              VK_API_VERSION_1_1, enabledExtensions));
+	assert(vgs::IsStructureSupported(vk::StructureType::ePhysicalDeviceMeshShaderFeaturesNV,   VK_API_VERSION_1_1, enabledExtensions));
+	assert(!vgs::IsStructureSupported(vk::StructureType::ePhysicalDeviceVulkan11Features,      VK_API_VERSION_1_1, enabledExtensions));
+	assert(vgs::IsStructureSupported(vk::StructureType::ePhysicalDeviceVulkan11Features,       VK_API_VERSION_1_2, enabledExtensions));
+
+	vk::PhysicalDeviceVulkan11Features              vulkan11Features;
+	vk::PhysicalDeviceImagelessFramebufferFeatures  imagelessFramebufferFeatures;
+	vk::PhysicalDeviceMeshShaderFeaturesNV          meshShaderFeatures;
+	vk::PhysicalDeviceInlineUniformBlockFeaturesEXT inlineUniformBlockFeatures;
+
+	meshShaderFeatures.taskShader = VK_TRUE;
+
+	//Owned chain: the unsupported structures are unlinked, the supported ones keep their order
+	vgs::StructureChainBlob<vk::PhysicalDeviceFeatures2> physicalDeviceFeaturesChain;
+	physicalDeviceFeaturesChain.AppendToChain(vulkan11Features);
+	physicalDeviceFeaturesChain.AppendToChain(meshShaderFeatures);
+	physicalDeviceFeaturesChain.AppendToChain(imagelessFramebufferFeatures);
+	physicalDeviceFeaturesChain.AppendToChain(inlineUniformBlockFeatures);
+
+	assert(vgs::FilterByEnabled(physicalDeviceFeaturesChain, VK_API_VERSION_1_1, enabledExtensions) == 3);
+	assert(physicalDeviceFeaturesChain.CountOf<vk::PhysicalDeviceVulkan11Features>()     == 0);
+	assert(physicalDeviceFeaturesChain.CountOf<vk::PhysicalDeviceMeshShaderFeaturesNV>() == 1);
+	assert(physicalDeviceFeaturesChain.GetChainLinkDataAs<vk::PhysicalDeviceMeshShaderFeaturesNV>().taskShader == VK_TRUE);
+
+	const vk::BaseInStructure* firstLink = (const vk::BaseInStructure*)physicalDeviceFeaturesChain.GetChainHead().pNext;
+	assert(firstLink->sType == vk::StructureType::ePhysicalDeviceMeshShaderFeaturesNV);
+	assert(firstLink->pNext == nullptr);
+
+	//The storage of the unlinked structures is reused
+	physicalDeviceFeaturesChain.AppendToChain(vulkan11Features);
+	assert(physicalDeviceFeaturesChain.CountOf<vk::PhysicalDeviceVulkan11Features>() == 1);
+	assert(vgs::FilterByEnabled(physicalDeviceFeaturesChain, VK_API_VERSION_1_2, enabledExtensions) == 0);
+
+	//Raw chain: only the pNext pointers of the kept structures change
+	vk::PhysicalDeviceFeatures2 physicalDeviceFeatures2;
+
+	physicalDeviceFeatures2.pNext      = &vulkan11Features;
+	vulkan11Features.pNext             = &imagelessFramebufferFeatures;
+	imagelessFramebufferFeatures.pNext = &meshShaderFeatures;
+	meshShaderFeatures.pNext           = &inlineUniformBlockFeatures;
+	inlineUniformBlockFeatures.pNext   = nullptr;
+
+	assert(vgs::FilterByEnabled(&physicalDeviceFeatures2, VK_API_VERSION_1_2, enabledExtensions) == 1);
+	assert(physicalDeviceFeatures2.pNext      == &vulkan11Features);
+	assert(vulkan11Features.pNext             == &imagelessFramebufferFeatures);
+	assert(imagelessFramebufferFeatures.pNext == &meshShaderFeatures);
+	assert(meshShaderFeatures.pNext           == nullptr);
+
+	assert(vgs::FilterByEnabled(&physicalDeviceFeatures2, VK_API_VERSION_1_1, vgs::ExtensionBitset()) == 3);
+	assert(physicalDeviceFeatures2.pNext == nullptr);
+}
+
+void GenericStructureTestsHpp::TestValidateChain()
+{
+	//Without the generated rules nothing but the cycles could be checked
+	assert(vgs::StructureChainRules[vgs::GetStructureOrdinal(vk::StructureType::eValidationFeaturesEXT)].ExtendedSTypes != nullptr);
+
+	vk::InstanceCreateInfo                 instanceCreateInfo;
+	vk::ValidationFeaturesEXT              validationFeatures;
+	vk::ValidationFeaturesEXT              validationFeatures2;
+	vk::PhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures;
+	vk::BaseOutStructure                   unknownStructure;
+
+	unknownStructure.sType = static_cast<vk::StructureType>(VK_STRUCTURE_TYPE_MAX_ENUM);
+
+	instanceCreateInfo.pNext = &validationFeatures;
+
+	vgs::ChainValidationReport validReport = vgs::ValidateChain(&instanceCreateInfo);
+	assert(validReport.IssueCount == 0);
+
+	//All the issues are reported in the order of the links
+	validationFeatures.pNext  = &meshShaderFeatures;
+	meshShaderFeatures.pNext  = &validationFeatures2;
+	validationFeatures2.pNext = &unknownStructure;
+
+	vgs::ChainValidationReport invalidReport = vgs::ValidateChain(&instanceCreateInfo);
+	assert(invalidReport.IssueCount == 3);
+	assert(invalidReport.Issues[0].Kind == vgs::ChainIssueKind::InvalidExtension && invalidReport.Issues[0].LinkIndex == 2);
+	assert(invalidReport.Issues[1].Kind == vgs::ChainIssueKind::Duplicate        && invalidReport.Issues[1].LinkIndex == 3);
+	assert(invalidReport.Issues[2].Kind == vgs::ChainIssueKind::UnknownStructure && invalidReport.Issues[2].LinkIndex == 4);
+	assert(invalidReport.Issues[1].SType == vk::StructureType::eValidationFeaturesEXT);
+
+	//A cycle is reported once at the link that closes it, the links are not checked twice
+	meshShaderFeatures.pNext = &validationFeatures;
+
+	vgs::ChainValidationReport cycleReport = vgs::ValidateChain(&instanceCreateInfo);
+	assert(cycleReport.IssueCount == 2);
+	assert(cycleReport.Issues[0].Kind == vgs::ChainIssueKind::InvalidExtension);
+	assert(cycleReport.Issues[1].Kind == vgs::ChainIssueKind::Cycle && cycleReport.Issues[1].LinkIndex == 2);
+	assert(cycleReport.Issues[1].SType == vk::StructureType::ePhysicalDeviceMeshShaderFeaturesNV);
+
+	//Long cycles are found too, only the first MaxReportedChainIssues issues are stored
+	std::vector<vk::ValidationFeaturesEXT> longChain(100, validationFeatures);
+	for(size_t i = 0; i < longChain.size(); i++)
+	{
+		longChain[i].pNext = &longChain[(i + 1) % longChain.size()];
+	}
+
+	instanceCreateInfo.pNext = &longChain[0];
+
+	vgs::ChainValidationReport longCycleReport = vgs::ValidateChain(&instanceCreateInfo);
+	assert(longCycleReport.IssueCount == 100);
+	assert(longCycleReport.Issues[0].Kind == vgs::ChainIssueKind::Duplicate && longCycleReport.Issues[0].LinkIndex == 2);
+
+	instanceCreateInfo.pNext = &instanceCreateInfo;
+
+	vgs::ChainValidationReport selfCycleReport = vgs::ValidateChain(&instanceCreateInfo);
+	assert(selfCycleReport.IssueCount == 1);
+	assert(selfCycleReport.Issues[0].Kind == vgs::ChainIssueKind::Cycle && selfCycleReport.Issues[0].LinkIndex == 0);
+}
+
+void GenericStructureTestsHpp::TestPNextEditor()
+{
+	vk::DeviceCreateInfo                           deviceCreateInfo;
+	vk::PhysicalDeviceVulkan11Features             vulkan11Features;
+	vk::PhysicalDeviceMeshShaderFeaturesNV         meshShaderFeatures;
+	vk::PhysicalDeviceImagelessFramebufferFeatures imagelessFramebufferFeatures;
+
+	deviceCreateInfo.enabledExtensionCount = 3;
+	deviceCreateInfo.pNext                 = &vulkan11Features;
+	vulkan11Features.pNext                 = &meshShaderFeatures;
+	meshShaderFeatures.pNext               = &imagelessFramebufferFeatures;
+	vulkan11Features.multiview             = VK_TRUE;
+
+	const vk::DeviceCreateInfo* originalChain = &deviceCreateInfo;
+
+	vgs::PNextEditor chainEditor(originalChain);
+	assert(chainEditor.GetChainHead() == originalChain);
+	assert(!chainEditor.Remove<vk::PhysicalDeviceInlineUniformBlockFeaturesEXT>());
+
+	//Only the structures in front of the removed one are copied, the tail is shared with the original chain
+	assert(chainEditor.Remove<vk::PhysicalDeviceMeshShaderFeaturesNV>());
+	assert(chainEditor.GetWritableLinkCount() == 2);
+
+	const vk::DeviceCreateInfo& editedDeviceCreateInfo = chainEditor.GetChainHeadAs<vk::DeviceCreateInfo>();
+	assert(&editedDeviceCreateInfo != originalChain);
+	assert(editedDeviceCreateInfo.enabledExtensionCount == 3);
+
+	const vk::PhysicalDeviceVulkan11Features* editedVulkan11Features = (const vk::PhysicalDeviceVulkan11Features*)editedDeviceCreateInfo.pNext;
+	assert(editedVulkan11Features != &vulkan11Features);
+	assert(editedVulkan11Features->multiview == VK_TRUE);
+	assert(editedVulkan11Features->pNext     == &imagelessFramebufferFeatures);
+
+	assert(deviceCreateInfo.pNext   == &vulkan11Features);
+	assert(vulkan11Features.pNext   == &meshShaderFeatures);
+	assert(meshShaderFeatures.pNext == &imagelessFramebufferFeatures);
+
+	//Inserted structures go right after the head
+	vk::PhysicalDeviceInlineUniformBlockFeaturesEXT inlineUniformBlockFeatures;
+	inlineUniformBlockFeatures.inlineUniformBlock = VK_TRUE;
+
+	vk::PhysicalDeviceInlineUniformBlockFeaturesEXT& insertedFeatures = chainEditor.Insert(inlineUniformBlockFeatures);
+	assert(insertedFeatures.sType == vk::StructureType::ePhysicalDeviceInlineUniformBlockFeaturesEXT);
+	assert(editedDeviceCreateInfo.pNext == &insertedFeatures);
+	assert(insertedFeatures.pNext       == editedVulkan11Features);
+	assert(chainEditor.GetWritableLinkCount() == 3);
+
+	assert(chainEditor.Remove<vk::PhysicalDeviceVulkan11Features>());
+	assert(insertedFeatures.pNext == &imagelessFramebufferFeatures);
+	assert(chainEditor.GetWritableLinkCount() == 2);
+
+	//Structures that don't fit in the inline storage are allocated separately
+	for(uint32_t i = 0; i < 16; i++)
+	{
+		chainEditor.Insert(vulkan11Features).multiview = VK_TRUE;
+	}
+
+	uint32_t editedLinkCount = 0;
+	for(const vk::BaseInStructure* link = (const vk::BaseInStructure*)chainEditor.GetChainHead(); link != nullptr; link = link->pNext)
+	{
+		editedLinkCount++;
+	}
+
+	assert(editedLinkCount == 19);
+	assert(chainEditor.GetWritableLinkCount() == 18);
+
+	//Structures of unknown sType can't be copied
+	vk::BaseOutStructure unknownStructure;
+	unknownStructure.sType = static_cast<vk::StructureType>(VK_STRUCTURE_TYPE_MAX_ENUM);
+	unknownStructure.pNext = (vk::BaseOutStructure*)&meshShaderFeatures;
+	deviceCreateInfo.pNext = &unknownStructure;
+
+	vgs::PNextEditor unknownChainEditor(originalChain);
+	assert(!unknownChainEditor.Remove<vk::PhysicalDeviceMeshShaderFeaturesNV>());
+	assert(unknownStructure.pNext == (vk::BaseOutStructure*)&meshShaderFeatures);
 }
\ No newline at end of file
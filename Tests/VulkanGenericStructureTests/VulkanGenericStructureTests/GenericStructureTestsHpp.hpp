@@ -14,4 +14,29 @@ private:
 	void TestStructureBlob();
 	void TestGenericStructureChain();
 	void TestStructureChainBlob();
+	void TestStructureChainDuplicates();
+	void TestStructureChainBlobEditing();
+	void TestGenericStructureChainEnableMask();
+	void TestStructureChainBlobEmplace();
+	void TestAnyStructureChainBlob();
+	void TestStructureChainBlobLinearize();
+	void TestStructureChainBlobCopy();
+	void TestStructureChainBuilder();
+	void TestChainTemplate();
+	void TestStructureHashing();
+	void TestChainInternTable();
+	void TestStructureTreeBlob();
+	void TestStructureTreeKey();
+	void TestSerializeStructures();
+	void TestDeviceChainCache();
+	void TestFullFeatureChain();
+	void TestFeatureBitset();
+	void TestQueryChainArray();
+	void TestFeatureProfile();
+	void TestStructureReflection();
+	void TestStructureVisit();
+	void TestExtensionStructureTable();
+	void TestFilterByEnabled();
+	void TestValidateChain();
+	void TestPNextEditor();
 };
\ No newline at end of file
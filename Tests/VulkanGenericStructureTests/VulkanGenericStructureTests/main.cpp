@@ -1,5 +1,7 @@
 #include "GenericStructureTestsH.hpp"
 #include "GenericStructureTestsHpp.hpp"
+#include "GenericStructureBenchmarksH.hpp"
+#include <cstring>
 
 int main(int argc, char* argv[])
 {
@@ -8,4 +10,20 @@ int main(int argc, char* argv[])
 
 	GenericStructureTestsHpp genStructureTestsHpp;
 	genStructureTestsHpp.DoTests();
-}
\ No newline at end of file
+
+	//Benchmarks take much longer than the tests, they only run with --benchmarks
+	bool runBenchmarks = false;
+	for(int i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "--benchmarks") == 0)
+		{
+			runBenchmarks = true;
+		}
+	}
+
+	if(runBenchmarks)
+	{
+		GenericStructureBenchmarksH genStructureBenchmarksH;
+		genStructureBenchmarksH.DoBenchmarks();
+	}
+}